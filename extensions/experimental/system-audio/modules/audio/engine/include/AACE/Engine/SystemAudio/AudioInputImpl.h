@@ -17,54 +17,41 @@
 #define AACE_ENGINE_SYSTEMAUDIO_AUDIO_INPUT_IMPL_H
 
 #include <memory>
-#if defined(DUMP_AUDIO) || defined(UTTERANCE_FILE_INPUT)
+#ifdef UTTERANCE_FILE_INPUT
 #include <fstream>
 #endif
 #include <AACE/Audio/AudioInput.h>
-#include <AACE/Engine/SystemAudio/Throttle.h>
-#include <aal.h>
+#include <AACE/Engine/SystemAudio/CaptureDevice.h>
 
 namespace aace {
 namespace engine {
 namespace systemAudio {
 
+/**
+ * AudioInputImpl is an input channel reading the audio captured by a @c CaptureDevice, which may be shared with
+ * other channels.
+ */
 class AudioInputImpl : public aace::audio::AudioInput {
 public:
     ~AudioInputImpl();
 
     // Factory
-    static std::unique_ptr<AudioInputImpl> create(
-        int moduleId,
-        const std::string& deviceName,
-        int sampleRate,
-        const std::string& name = "");
+    static std::unique_ptr<AudioInputImpl> create(std::shared_ptr<CaptureDevice> device, const std::string& name = "");
 
     // aace::audio::AudioInput
     bool startAudioInput() override;
     bool stopAudioInput() override;
 
-    void onStreamStart();
-    void onStreamStop(aal_status_t reason);
-    void onStreamDataCallback(const int16_t* data, const size_t length);
-
 private:
-    AudioInputImpl(int moduleId, const std::string& deviceName, int sampleRate, const std::string& name);
+    AudioInputImpl(std::shared_ptr<CaptureDevice> device, const std::string& name);
     bool initialize();
 
-    int m_moduleId;
+    std::shared_ptr<CaptureDevice> m_device;
     std::string m_name;
-    aal_handle_t m_recorder = nullptr;
-    std::string m_deviceName;
-    int m_sampleRate;
-#ifdef DUMP_AUDIO
-    std::ofstream m_audioDump;
-#endif
+    int m_readerId = -1;
 #ifdef UTTERANCE_FILE_INPUT
     std::ifstream m_utterance;
 #endif
-#ifdef THROTTLE_AUDIO
-    Throttle<int16_t> m_throttle;
-#endif
 };
 
 }  // namespace systemAudio
@@ -18,9 +18,9 @@
 
 #include <AACE/Audio/AudioOutput.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
+#include <AACE/Engine/Utils/Threading/TimerWheel.h>
 
 #include <memory>
-#include <thread>
 #include <atomic>
 #include <mutex>
 #include <aal.h>
@@ -39,13 +39,24 @@ public:
     static std::unique_ptr<AudioOutputImpl> create(
         int moduleId,
         const std::string& deviceName,
-        const std::string& name = "");
+        const std::string& name = "",
+        std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor> streamingExecutor = nullptr,
+        std::shared_ptr<aace::engine::utils::threading::TimerWheel> streamingTimers = nullptr);
+
+    // The user data of the AAL callbacks of a player. The players of an output share its listener, so the callbacks
+    // identify the player they come from to ignore the players that are no longer current. A pooled player gets a
+    // new ID each time it is reused, so the late callbacks of its previous source are ignored too.
+    struct PlayerContext {
+        AudioOutputImpl* output;
+        std::atomic<uint64_t> playerId;
+    };
 
     // AAL callbacks
-    void onStart();
-    void onStop(aal_status_t reason);
-    void onDataRequested();
-    void onAlmostDone();
+    void onStart(uint64_t playerId);
+    void onStop(uint64_t playerId, aal_status_t reason);
+    void onDataRequested(uint64_t playerId);
+    void onEnoughData(uint64_t playerId);
+    void onAlmostDone(uint64_t playerId);
 
     // aace::audio::AudioOutput
     bool prepare(std::shared_ptr<aace::audio::AudioStream> stream, bool repeating) override;
@@ -62,11 +73,30 @@ public:
     bool mutedStateChanged(MutedState state) override;
 
 private:
-    AudioOutputImpl(int moduleId, const std::string& deviceName, const std::string& name);
+    // A player that is not current, with the context of its callbacks
+    struct Player {
+        // Key of the module and audio format, for reuse
+        std::string key;
+        aal_handle_t handle;
+        std::unique_ptr<PlayerContext> context;
+    };
+
+    AudioOutputImpl(
+        int moduleId,
+        const std::string& deviceName,
+        const std::string& name,
+        std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor> streamingExecutor,
+        std::shared_ptr<aace::engine::utils::threading::TimerWheel> streamingTimers);
     bool initialize();
     bool writeStreamToFile(aace::audio::AudioStream* stream, const std::string& path);
-    bool writeStreamToPipeline();
-    void streamingLoop();
+
+    // Result of writing the stream to the player's pipeline
+    enum class WriteStatus { Written, Starved, Ended };
+
+    WriteStatus writeStreamToPipeline();
+    void scheduleStreaming();
+    void scheduleStreamingRetry();
+    void executeStreamData();
 
     void executeOnStart();
     void executeOnStop(aal_status_t reason);
@@ -77,6 +107,11 @@ private:
     bool executePrepare(const std::string& url, bool repeating);
     bool prepareLocked(const std::string& url, std::shared_ptr<aace::audio::AudioStream> stream, bool repeating);
     void preparePlayer(const std::string& url, std::shared_ptr<aace::audio::AudioStream> stream);
+    void acquirePlayer(const std::string& key, aal_attributes_t& attr, aal_audio_parameters_t* params);
+    void recyclePlayer();
+    void poolPlayer(Player player);
+    void destroyPlayer(Player& player);
+    void executeOnPreviousPlayerStop(uint64_t playerId);
     bool executePlay();
     bool executeStop();
     bool executePause();
@@ -112,6 +147,17 @@ private:
     int m_moduleId;
     std::string m_name;
     aal_handle_t m_player = nullptr;
+    std::string m_playerKey;
+    std::unique_ptr<PlayerContext> m_playerContext;
+    // ID of the current player, read by the AAL callbacks
+    std::atomic<uint64_t> m_playerId{0};
+    uint64_t m_nextPlayerId = 1;
+    // Whether the current player is stopped, with no on_stop callback to come, which is required to reset it
+    bool m_playerStopped = true;
+    // Stopped players kept for reuse, most recently used first
+    std::deque<Player> m_idlePlayers;
+    // Players waiting for their on_stop callback before they are kept for reuse
+    std::deque<Player> m_stoppingPlayers;
     std::shared_ptr<aace::audio::AudioStream> m_currentStream;
     std::string m_mediaUrl;
     std::deque<std::string> m_mediaQueue;
@@ -120,10 +166,27 @@ private:
     float m_currentVolume = 0.5;
     MutedState m_currentMutedState = MutedState::UNMUTED;
     std::string m_tmpFile;
-    std::thread m_streamingThread;
-    std::atomic<bool> m_streaming;
     std::string m_deviceName;
 
+    // Streaming is driven by the data requests of the player, on an executor shared by the audio outputs
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor> m_streamingExecutor;
+    std::mutex m_streamingMutex;
+    std::atomic<bool> m_streaming{false};
+    std::atomic<bool> m_streamEnded{false};
+    std::atomic<bool> m_dataRequested{false};
+    std::atomic<bool> m_streamingScheduled{false};
+    // A starved stream is read again from a timer, instead of holding the executor until it has data
+    std::shared_ptr<aace::engine::utils::threading::TimerWheel> m_streamingTimers;
+    std::atomic<bool> m_retryScheduled{false};
+    // Lets the timers reach the output only while it exists
+    struct StreamingRetry {
+        std::mutex mutex;
+        AudioOutputImpl* output;
+    };
+    std::shared_ptr<StreamingRetry> m_streamingRetry;
+    // Data read from the stream that the player has not accepted yet
+    std::vector<char> m_pendingData;
+
     State m_state;
     alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
 };
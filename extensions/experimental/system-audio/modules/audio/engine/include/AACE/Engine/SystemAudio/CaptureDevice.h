@@ -0,0 +1,97 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_SYSTEMAUDIO_CAPTURE_DEVICE_H
+#define AACE_ENGINE_SYSTEMAUDIO_CAPTURE_DEVICE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#ifdef DUMP_AUDIO
+#include <fstream>
+#endif
+#include <AACE/Engine/SystemAudio/FanOutBuffer.h>
+#include <AACE/Engine/SystemAudio/Throttle.h>
+#include <aal.h>
+
+namespace aace {
+namespace engine {
+namespace systemAudio {
+
+/**
+ * CaptureDevice captures a physical device once, converted to the format of the Engine, and fans the captured
+ * audio out to all of the input channels opened on the device. The recorder is started when the first reader
+ * starts and stopped when the last reader stops.
+ */
+class CaptureDevice {
+public:
+    using OutputFunc = FanOutBuffer<int16_t>::OutputFunc;
+
+    ~CaptureDevice();
+
+    // Factory
+    static std::shared_ptr<CaptureDevice> create(
+        int moduleId,
+        const std::string& deviceName,
+        int sampleRate,
+        const std::string& name = "");
+
+    /**
+     * Adds a reader, which receives the captured audio once started.
+     *
+     * @return The id of the reader.
+     */
+    int addReader(OutputFunc output);
+
+    /**
+     * Removes a reader, stopping it if needed.
+     */
+    void removeReader(int readerId);
+
+    bool startReader(int readerId);
+    bool stopReader(int readerId);
+
+    void onStreamStart();
+    void onStreamStop(aal_status_t reason);
+    void onStreamDataCallback(const int16_t* data, const size_t length);
+
+private:
+    CaptureDevice(int moduleId, const std::string& deviceName, int sampleRate, const std::string& name);
+    bool initialize();
+
+    int m_moduleId;
+    std::string m_name;
+    aal_handle_t m_recorder = nullptr;
+    std::string m_deviceName;
+    int m_sampleRate;
+
+    // Serializes starting and stopping the recorder, which must not be done while holding the buffer lock
+    std::mutex m_recorderMutex;
+    bool m_recording = false;
+
+    FanOutBuffer<int16_t> m_buffer;
+#ifdef DUMP_AUDIO
+    std::ofstream m_audioDump;
+#endif
+#ifdef THROTTLE_AUDIO
+    Throttle<int16_t> m_throttle;
+#endif
+};
+
+}  // namespace systemAudio
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_SYSTEMAUDIO_CAPTURE_DEVICE_H
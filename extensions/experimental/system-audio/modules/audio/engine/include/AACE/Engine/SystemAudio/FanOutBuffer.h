@@ -0,0 +1,165 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_SYSTEMAUDIO_FAN_OUT_BUFFER_H
+#define AACE_ENGINE_SYSTEMAUDIO_FAN_OUT_BUFFER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace aace {
+namespace engine {
+namespace systemAudio {
+
+/**
+ * FanOutBuffer delivers the data of a single writer to any number of readers through a shared ring buffer.
+ *
+ * Each reader has its own cursor into the ring buffer. Written data is copied once, then delivered to every active
+ * reader in the writer thread by calling its output function with contiguous slices of the ring buffer. A reader
+ * which does not accept all of the data keeps its cursor and receives the rest with the next write, and a reader
+ * which falls more than the capacity behind skips the oldest data, without affecting the other readers.
+ */
+template <typename T>
+class FanOutBuffer {
+public:
+    /// Receives a slice of the buffered data, and returns how much of it was accepted
+    using OutputFunc = std::function<ssize_t(const T* data, size_t length)>;
+
+    explicit FanOutBuffer(size_t capacity) : m_buffer(capacity) {
+    }
+
+    /**
+     * Adds an inactive reader.
+     *
+     * @return The id of the reader.
+     */
+    int addReader(OutputFunc output) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto id = m_nextReaderId++;
+        m_readers.emplace(id, Reader{std::move(output), m_writePosition, false});
+        return id;
+    }
+
+    /**
+     * Removes a reader, which must not be called again once this returns.
+     *
+     * @return The number of active readers left.
+     */
+    size_t removeReader(int id) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_readers.find(id);
+        if (it != m_readers.end()) {
+            if (it->second.active) {
+                m_activeReaders--;
+            }
+            m_readers.erase(it);
+        }
+        return m_activeReaders;
+    }
+
+    /**
+     * Activates or deactivates a reader. An activated reader receives the data written from now on.
+     *
+     * @return The number of active readers after the change.
+     */
+    size_t setReaderActive(int id, bool active) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_readers.find(id);
+        if (it != m_readers.end() && it->second.active != active) {
+            it->second.active = active;
+            it->second.cursor = m_writePosition;
+            m_activeReaders += active ? 1 : -1;
+        }
+        return m_activeReaders;
+    }
+
+    /**
+     * Copies the data into the ring buffer and delivers it to the active readers.
+     */
+    void write(const T* data, size_t length) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_buffer.empty()) {
+            return;
+        }
+
+        // only the most recent data fits in the ring buffer
+        auto capacity = m_buffer.size();
+        if (length > capacity) {
+            m_writePosition += length - capacity;
+            data += length - capacity;
+            length = capacity;
+        }
+        while (length > 0) {
+            auto offset = m_writePosition % capacity;
+            auto count = std::min(length, capacity - offset);
+            std::copy(data, data + count, m_buffer.begin() + offset);
+            m_writePosition += count;
+            data += count;
+            length -= count;
+        }
+
+        for (auto& it : m_readers) {
+            if (it.second.active) {
+                deliver(it.second);
+            }
+        }
+    }
+
+private:
+    struct Reader {
+        OutputFunc output;
+        uint64_t cursor;
+        bool active;
+    };
+
+    void deliver(Reader& reader) {
+        auto capacity = m_buffer.size();
+        if (m_writePosition - reader.cursor > capacity) {
+            // the reader was overrun, skip to the oldest data in the ring buffer
+            reader.cursor = m_writePosition - capacity;
+        }
+        while (reader.cursor < m_writePosition) {
+            auto offset = reader.cursor % capacity;
+            auto count = std::min(static_cast<size_t>(m_writePosition - reader.cursor), capacity - offset);
+            auto accepted = reader.output(m_buffer.data() + offset, count);
+            if (accepted <= 0) {
+                break;
+            }
+            reader.cursor += std::min(static_cast<size_t>(accepted), count);
+        }
+    }
+
+private:
+    std::vector<T> m_buffer;
+    uint64_t m_writePosition = 0;
+
+    std::map<int, Reader> m_readers;
+    int m_nextReaderId = 0;
+    size_t m_activeReaders = 0;
+
+    std::mutex m_mutex;
+};
+
+}  // namespace systemAudio
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_SYSTEMAUDIO_FAN_OUT_BUFFER_H
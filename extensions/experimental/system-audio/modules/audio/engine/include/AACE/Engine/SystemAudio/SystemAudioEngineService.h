@@ -19,6 +19,8 @@
 #include <set>
 #include <AACE/Engine/Utils/JSON/JSON.h>
 #include <AACE/Engine/Audio/AudioEngineService.h>
+#include <AVSCommon/Utils/Threading/Executor.h>
+#include <AACE/Engine/Utils/Threading/TimerWheel.h>
 
 namespace aace {
 namespace engine {
@@ -43,12 +45,14 @@ public:
 
     int prepareModule(const std::string& target);
     std::unique_ptr<DeviceConfig> getDeviceConfig(const std::string& name, const std::string& type);
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor> getStreamingExecutor();
+    std::shared_ptr<aace::engine::utils::threading::TimerWheel> getStreamingTimers();
 
 private:
     SystemAudioEngineService(const aace::engine::core::ServiceDescription& description);
 
     bool initialize() override;
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configureFromValue(const rapidjson::Value& configuration) override;
     bool preRegister() override;
     bool shutdown() override;
 
@@ -56,6 +60,10 @@ private:
 
     std::shared_ptr<rapidjson::Document> m_configuration;
     std::set<int> m_modulesInUse;
+    // Streams the audio of all the outputs to their players
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor> m_streamingExecutor;
+    // Retries the reads of the starved streams of the outputs
+    std::shared_ptr<aace::engine::utils::threading::TimerWheel> m_streamingTimers;
 };
 
 }  // namespace systemAudio
@@ -15,11 +15,13 @@
 
 #include <AACE/Engine/SystemAudio/AudioInputImpl.h>
 #include <AACE/Engine/Core/EngineMacros.h>
-#include <cstdio>
+
+#ifdef UTTERANCE_FILE_INPUT
 #include <thread>
 
 #define DEFAULT_AUDIO_FRAGMENT_DURATION 20
 #define DEFAULT_AUDIO_FRAGMENT_SAMPLES 320
+#endif
 
 namespace aace {
 namespace engine {
@@ -28,89 +30,22 @@ namespace systemAudio {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.systemAudio.AudioInputImpl");
 
-void AudioInputImpl::onStreamStart() {
-#ifdef DUMP_AUDIO
-    std::string dumpFile = std::tmpnam(nullptr);
-    AACE_VERBOSE(LX("microphone").d("name", m_name).d("audioDump", dumpFile));
-    m_audioDump.open(dumpFile, std::ios::out | std::ios::binary);
-#endif
-}
-
-// static
-void AudioInputImpl::onStreamStop(aal_status_t reason) {
-#ifdef DUMP_AUDIO
-    m_audioDump.close();
-#endif
-}
-
-// static
-void AudioInputImpl::onStreamDataCallback(const int16_t* data, const size_t length) {
-#ifdef DUMP_AUDIO
-    if (m_audioDump.is_open()) {
-        m_audioDump.write(reinterpret_cast<const char*>(data), length * 2);
-    }
-#endif
-#ifdef THROTTLE_AUDIO
-    m_throttle.write(data, length);
-#else
-    write(data, length);
-#endif
-}
-
-// clang-format off
-static aal_listener_t aalListener = {
-    .on_start = [](void *user_data) {
-        ReturnIf(!user_data);
-        auto self = static_cast<AudioInputImpl*>(user_data);
-        self->onStreamStart();
-    },
-    .on_stop = [](aal_status_t reason, void *user_data) {
-        ReturnIf(!user_data);
-        auto self = static_cast<AudioInputImpl*>(user_data);
-        self->onStreamStop(reason);
-    },
-    .on_almost_done = nullptr,
-    .on_data = [](const int16_t* data, const size_t length, void* user_data) {
-        ReturnIf(!user_data);
-        auto self = static_cast<AudioInputImpl*>(user_data);
-        self->onStreamDataCallback(data, length);
-    },
-    .on_data_requested = nullptr
-};
-// clang-format on
-
-AudioInputImpl::AudioInputImpl(
-    const int moduleId,
-    const std::string& deviceName,
-    int sampleRate,
-    const std::string& name) :
-        m_moduleId(moduleId),
-        m_name(name),
-        m_deviceName(deviceName),
-        m_sampleRate(sampleRate)
-#ifdef THROTTLE_AUDIO
-        ,
-        m_throttle(
-            DEFAULT_AUDIO_FRAGMENT_SAMPLES,
-            std::chrono::milliseconds(DEFAULT_AUDIO_FRAGMENT_DURATION),
-            [this](const int16_t* data, size_t length) { write(data, length); })
-#endif
-{
+AudioInputImpl::AudioInputImpl(std::shared_ptr<CaptureDevice> device, const std::string& name) :
+        m_device(device), m_name(name) {
 }
 
 AudioInputImpl::~AudioInputImpl() {
-    if (m_recorder) {
-        aal_recorder_destroy(m_recorder);
+    if (m_readerId >= 0) {
+        m_device->removeReader(m_readerId);
     }
 }
 
 std::unique_ptr<AudioInputImpl> AudioInputImpl::create(
-    const int moduleId,
-    const std::string& deviceName,
-    int sampleRate,
+    std::shared_ptr<CaptureDevice> device,
     const std::string& name) {
     try {
-        auto audioInput = std::unique_ptr<AudioInputImpl>(new AudioInputImpl(moduleId, deviceName, sampleRate, name));
+        ThrowIfNull(device, "invalidDevice");
+        auto audioInput = std::unique_ptr<AudioInputImpl>(new AudioInputImpl(device, name));
 
         ThrowIfNot(audioInput->initialize(), "initializeFailed");
 
@@ -125,24 +60,7 @@ bool AudioInputImpl::initialize() {
     try {
         AACE_VERBOSE(LX(TAG));
 
-        // clang-format off
-        const aal_attributes_t attr = {
-            .name = m_name.c_str(),
-            .device = m_deviceName.c_str(),
-            .uri = nullptr,
-            .listener = &aalListener,
-            .user_data = this,
-            .module_id = m_moduleId,
-        };
-        aal_lpcm_parameters_t params = {
-            .sample_format = AAL_SAMPLE_FORMAT_DEFAULT,
-            .channels = 0,
-            .sample_rate = m_sampleRate,
-        };
-        // clang-format on
-
-        m_recorder = aal_recorder_create(&attr, &params);
-        ThrowIfNull(m_recorder, "createRecorderFailed");
+        m_readerId = m_device->addReader([this](const int16_t* data, size_t length) { return write(data, length); });
 
         return true;
     } catch (std::exception& ex) {
@@ -183,13 +101,7 @@ bool AudioInputImpl::startAudioInput() {
     }
 #endif
 
-    try {
-        aal_recorder_play(m_recorder);
-        return true;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    return m_device->startReader(m_readerId);
 }
 
 bool AudioInputImpl::stopAudioInput() {
@@ -200,14 +112,8 @@ bool AudioInputImpl::stopAudioInput() {
     }
 #endif
 
-    try {
-        AACE_VERBOSE(LX(TAG));
-        aal_recorder_stop(m_recorder);
-        return true;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    AACE_VERBOSE(LX(TAG).d("name", m_name));
+    return m_device->stopReader(m_readerId);
 }
 
 }  // namespace systemAudio
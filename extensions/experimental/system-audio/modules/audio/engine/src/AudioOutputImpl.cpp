@@ -33,6 +33,11 @@ namespace systemAudio {
 static const std::string TAG("aace.systemAudio.AudioOutputImpl");
 
 static constexpr size_t READ_BUFFER_SIZE = 4096;
+// Interval at which a starved stream is read again, without holding the shared streaming executor
+static constexpr std::chrono::milliseconds STREAMING_RETRY_INTERVAL(10);
+
+// Maximum number of stopped players kept for reuse by each audio output
+static constexpr size_t MAX_IDLE_PLAYERS = 2;
 
 std::ostream& operator<<(std::ostream& stream, AudioOutputImpl::State state) {
     switch (state) {
@@ -89,30 +94,46 @@ void AudioOutputImpl::setState(State state) {
 static aal_listener_t aalListener = {
     .on_start = [](void* user_data) {
         ReturnIf(!user_data);
-        auto self = static_cast<AudioOutputImpl*>(user_data);
-        self->onStart();
+        auto context = static_cast<AudioOutputImpl::PlayerContext*>(user_data);
+        context->output->onStart(context->playerId);
     },
     .on_stop = [](aal_status_t reason, void* user_data) {
         ReturnIf(!user_data);
-        auto self = static_cast<AudioOutputImpl*>(user_data);
-        self->onStop(reason);
+        auto context = static_cast<AudioOutputImpl::PlayerContext*>(user_data);
+        context->output->onStop(context->playerId, reason);
     },
     .on_almost_done = [](void* user_data) {
         ReturnIf(!user_data);
-        auto self = static_cast<AudioOutputImpl*>(user_data);
-        self->onAlmostDone();
+        auto context = static_cast<AudioOutputImpl::PlayerContext*>(user_data);
+        context->output->onAlmostDone(context->playerId);
     },
     .on_data = nullptr,
     .on_data_requested = [](void* user_data) {
         ReturnIf(!user_data);
-        auto self = static_cast<AudioOutputImpl*>(user_data);
-        self->onDataRequested();
+        auto context = static_cast<AudioOutputImpl::PlayerContext*>(user_data);
+        context->output->onDataRequested(context->playerId);
+    },
+    .on_enough_data = [](void* user_data) {
+        ReturnIf(!user_data);
+        auto context = static_cast<AudioOutputImpl::PlayerContext*>(user_data);
+        context->output->onEnoughData(context->playerId);
     }
 };
 // clang-format on
 
-AudioOutputImpl::AudioOutputImpl(const int moduleId, const std::string& deviceName, const std::string& name) :
-        m_moduleId(moduleId), m_name(name), m_deviceName(deviceName) {
+AudioOutputImpl::AudioOutputImpl(
+    const int moduleId,
+    const std::string& deviceName,
+    const std::string& name,
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor> streamingExecutor,
+    std::shared_ptr<aace::engine::utils::threading::TimerWheel> streamingTimers) :
+        m_moduleId(moduleId),
+        m_name(name),
+        m_deviceName(deviceName),
+        m_streamingExecutor(streamingExecutor),
+        m_streamingTimers(streamingTimers),
+        m_streamingRetry(std::make_shared<StreamingRetry>()) {
+    m_streamingRetry->output = this;
 }
 
 AudioOutputImpl::~AudioOutputImpl() {
@@ -121,19 +142,38 @@ AudioOutputImpl::~AudioOutputImpl() {
         if (m_player) {
             aal_player_destroy(m_player);
         }
+        for (auto& player : m_idlePlayers) {
+            destroyPlayer(player);
+        }
+        for (auto& player : m_stoppingPlayers) {
+            destroyPlayer(player);
+        }
         if (!m_tmpFile.empty()) {
             std::remove(m_tmpFile.c_str());
         }
     });
     m_executor.waitForSubmittedTasks();
+
+    // a retry that did not run yet finds the output gone
+    std::lock_guard<std::mutex> lock(m_streamingRetry->mutex);
+    m_streamingRetry->output = nullptr;
 }
 
 std::unique_ptr<AudioOutputImpl> AudioOutputImpl::create(
     const int moduleId,
     const std::string& deviceName,
-    const std::string& name) {
+    const std::string& name,
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor> streamingExecutor,
+    std::shared_ptr<aace::engine::utils::threading::TimerWheel> streamingTimers) {
     try {
-        auto audioOutput = std::unique_ptr<AudioOutputImpl>(new AudioOutputImpl(moduleId, deviceName, name));
+        if (!streamingExecutor) {
+            streamingExecutor = std::make_shared<alexaClientSDK::avsCommon::utils::threading::Executor>();
+        }
+        if (!streamingTimers) {
+            streamingTimers = std::make_shared<aace::engine::utils::threading::TimerWheel>();
+        }
+        auto audioOutput = std::unique_ptr<AudioOutputImpl>(
+            new AudioOutputImpl(moduleId, deviceName, name, streamingExecutor, streamingTimers));
 
         ThrowIfNot(audioOutput->initialize(), "initializeFailed");
 
@@ -188,53 +228,58 @@ bool AudioOutputImpl::writeStreamToFile(aace::audio::AudioStream* stream, const
     }
 }
 
-bool AudioOutputImpl::writeStreamToPipeline() {
+AudioOutputImpl::WriteStatus AudioOutputImpl::writeStreamToPipeline() {
     try {
         ThrowIfNull(m_currentStream, "invalidAudioStream");
 
-        constexpr std::chrono::milliseconds RETRY_INTERVAL(100);
-        char buffer[READ_BUFFER_SIZE];
-        ssize_t size;
-
-        while (m_streaming) {
-            size = m_currentStream->read(buffer, READ_BUFFER_SIZE);
+        if (m_pendingData.empty()) {
+            // never waits for data, the executor is shared by the outputs
+            char buffer[READ_BUFFER_SIZE];
+            ssize_t size = m_currentStream->read(buffer, READ_BUFFER_SIZE);
             ThrowIf(size < 0, "readFromStreamFailed");
-            if (size > 0) {
-                break;
-            }
-            if (m_currentStream->isClosed()) {
-                aal_player_notify_end_of_stream(m_player);
-                return false;
+            if (size == 0) {
+                if (m_currentStream->isClosed()) {
+                    auto statistics = m_currentStream->getReadStatistics();
+                    AACE_DEBUG(LXT.m("endOfStream")
+                                   .d("bytesRead", statistics.bytesRead)
+                                   .d("readCount", statistics.readCount)
+                                   .d("underrunCount", statistics.underrunCount));
+                    aal_player_notify_end_of_stream(m_player);
+                    return WriteStatus::Ended;
+                }
+                return WriteStatus::Starved;
             }
-            // if we didn't read any data and the stream is not closed, then
-            // sleep some mount of time before next read
-            std::this_thread::sleep_for(RETRY_INTERVAL);
+            m_pendingData.assign(buffer, buffer + size);
         }
 
         // write the data to the player's pipeline
-        while (m_streaming) {
-            int written = aal_player_write(m_player, buffer, size);
-            ThrowIf(written < 0, "writeToPipelineFailed");
-            if (written > 0) {
-                ThrowIf(written != size, "writeToPipelinePartially");
-                break;
-            }
-            std::this_thread::sleep_for(RETRY_INTERVAL);
+        ssize_t written = aal_player_write(m_player, m_pendingData.data(), m_pendingData.size());
+        ThrowIf(written < 0, "writeToPipelineFailed");
+        if (written == 0) {
+            // the player is full, keep the data until it requests more
+            m_dataRequested = false;
+            return WriteStatus::Written;
         }
+        ThrowIf(written != static_cast<ssize_t>(m_pendingData.size()), "writeToPipelinePartially");
+        m_pendingData.clear();
 
-        return true;
+        return WriteStatus::Written;
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()));
 
         // on an error we want to abort the operation so tell the player
         // not to attempt to write anymore data...
         aal_player_notify_end_of_stream(m_player);
-        return false;
+        return WriteStatus::Ended;
     }
 }
 
-void AudioOutputImpl::onStart() {
-    m_executor.submit([this] { executeOnStart(); });
+void AudioOutputImpl::onStart(uint64_t playerId) {
+    m_executor.submit([this, playerId] {
+        if (playerId == m_playerId) {
+            executeOnStart();
+        }
+    });
 }
 
 void AudioOutputImpl::executeOnStart() {
@@ -253,13 +298,22 @@ void AudioOutputImpl::executeOnStart() {
     mediaStateChanged(MediaState::PLAYING);
 }
 
-void AudioOutputImpl::onStop(aal_status_t reason) {
-    m_executor.submit([this, reason] { executeOnStop(reason); });
+void AudioOutputImpl::onStop(uint64_t playerId, aal_status_t reason) {
+    m_executor.submit([this, playerId, reason] {
+        if (playerId == m_playerId) {
+            executeOnStop(reason);
+        } else {
+            executeOnPreviousPlayerStop(playerId);
+        }
+    });
 }
 
-void AudioOutputImpl::onAlmostDone() {
-    int64_t almostDonePosition = aal_player_get_position(m_player);
-    m_executor.submit([this, almostDonePosition] { m_currentPosition = almostDonePosition; });
+void AudioOutputImpl::onAlmostDone(uint64_t playerId) {
+    m_executor.submit([this, playerId] {
+        if (playerId == m_playerId) {
+            m_currentPosition = aal_player_get_position(m_player);
+        }
+    });
 }
 
 void AudioOutputImpl::executeOnStop(aal_status_t reason) {
@@ -273,6 +327,9 @@ void AudioOutputImpl::executeOnStop(aal_status_t reason) {
         })) {
         AACE_WARN(LXT.d("reason", "suspicious state change").d("state", m_state));
     }
+    if (reason != AAL_PAUSED) {
+        m_playerStopped = true;
+    }
     try {
         executeStopStreaming();
         if (reason == AAL_ERROR) {
@@ -287,12 +344,14 @@ void AudioOutputImpl::executeOnStop(aal_status_t reason) {
                     // play next media item
                     preparePlayer(m_mediaQueue.front(), nullptr);
                     if (m_player) {
+                        m_playerStopped = false;
                         aal_player_play(m_player);
                         return;  // no state change
                     }
                 } else if (m_repeating && !m_mediaUrl.empty()) {
                     // play the URL again
                     if (prepareLocked(m_mediaUrl, nullptr, m_repeating)) {
+                        m_playerStopped = false;
                         aal_player_play(m_player);
                         return;  // no state change
                     }
@@ -311,33 +370,88 @@ void AudioOutputImpl::executeOnStop(aal_status_t reason) {
     }
 }
 
-void AudioOutputImpl::streamingLoop() {
-    do {
-        if (!writeStreamToPipeline()) break;
-    } while (m_streaming);
+void AudioOutputImpl::scheduleStreaming() {
+    std::lock_guard<std::mutex> lock(m_streamingMutex);
+    if (m_streaming && !m_streamingScheduled.exchange(true)) {
+        m_streamingExecutor->submit([this] { executeStreamData(); });
+    }
 }
 
-void AudioOutputImpl::executeStartStreaming() {
-    if (m_streamingThread.joinable()) {
-        // Streaming has already been started, let's ignore this request.
+void AudioOutputImpl::scheduleStreamingRetry() {
+    ReturnIf(m_retryScheduled.exchange(true));
+    std::weak_ptr<StreamingRetry> weakRetry = m_streamingRetry;
+    auto id = m_streamingTimers->scheduleAfter(STREAMING_RETRY_INTERVAL, [weakRetry] {
+        auto retry = weakRetry.lock();
+        ReturnIf(!retry);
+        std::lock_guard<std::mutex> lock(retry->mutex);
+        if (retry->output) {
+            retry->output->m_retryScheduled = false;
+            retry->output->scheduleStreaming();
+        }
+    });
+    if (id == aace::engine::utils::threading::TimerWheel::INVALID_TIMER) {
+        // the timers are shut down, the next data request resumes the stream
+        m_retryScheduled = false;
+    }
+}
+
+void AudioOutputImpl::executeStreamData() {
+    m_streamingScheduled = false;
+    if (!m_streaming || m_streamEnded || !m_dataRequested) {
+        // the player will request data again
         return;
     }
-    // Start streaming thread
-    m_streaming = true;
-    m_streamingThread = std::thread(&AudioOutputImpl::streamingLoop, this);
+    switch (writeStreamToPipeline()) {
+        case WriteStatus::Written:
+            // one chunk per task, so the outputs sharing the executor take turns
+            scheduleStreaming();
+            break;
+        case WriteStatus::Starved:
+            // the player may not request data again before it runs out, so read again after a while
+            scheduleStreamingRetry();
+            break;
+        case WriteStatus::Ended:
+            m_streamEnded = true;
+            break;
+    }
 }
 
-void AudioOutputImpl::executeStopStreaming() {
-    m_streaming = false;
-    if (m_streamingThread.joinable()) {
-        m_streamingThread.join();
+void AudioOutputImpl::executeStartStreaming() {
+    {
+        std::lock_guard<std::mutex> lock(m_streamingMutex);
+        m_streaming = true;
     }
+    scheduleStreaming();
 }
 
-void AudioOutputImpl::onDataRequested() {
+void AudioOutputImpl::executeStopStreaming() {
+    {
+        std::lock_guard<std::mutex> lock(m_streamingMutex);
+        m_streaming = false;
+        m_dataRequested = false;
+    }
+    // no task is scheduled any more, wait for the one already scheduled, if any, to return
+    m_streamingExecutor->submit([] {}).wait();
+    m_streamEnded = false;
+    m_pendingData.clear();
+}
+
+void AudioOutputImpl::onDataRequested(uint64_t playerId) {
+    ReturnIf(playerId != m_playerId);
+    m_dataRequested = true;
+    if (m_streaming) {
+        // already streaming, resume reading without waking the output executor
+        scheduleStreaming();
+        return;
+    }
     m_executor.submit([this]() { executeStartStreaming(); });
 }
 
+void AudioOutputImpl::onEnoughData(uint64_t playerId) {
+    ReturnIf(playerId != m_playerId);
+    m_dataRequested = false;
+}
+
 //
 // aace::audio::AudioOutput
 //
@@ -524,11 +638,87 @@ bool AudioOutputImpl::prepareLocked(
     return succeeded;
 }
 
-void AudioOutputImpl::preparePlayer(const std::string& url, std::shared_ptr<aace::audio::AudioStream> stream) {
+void AudioOutputImpl::recyclePlayer() {
+    if (!m_player) {
+        return;
+    }
+    Player player{m_playerKey, m_player, std::move(m_playerContext)};
+    m_player = nullptr;
+    m_playerId = 0;
+    if (m_playerStopped) {
+        poolPlayer(std::move(player));
+        return;
+    }
+
+    // only a stopped player can be reset, so it is kept for reuse when its on_stop callback arrives
+    aal_player_stop(player.handle);
+    m_stoppingPlayers.push_back(std::move(player));
+    if (m_stoppingPlayers.size() > MAX_IDLE_PLAYERS) {
+        destroyPlayer(m_stoppingPlayers.front());
+        m_stoppingPlayers.pop_front();
+    }
+}
+
+void AudioOutputImpl::poolPlayer(Player player) {
+    m_idlePlayers.push_front(std::move(player));
+    if (m_idlePlayers.size() > MAX_IDLE_PLAYERS) {
+        destroyPlayer(m_idlePlayers.back());
+        m_idlePlayers.pop_back();
+    }
+}
+
+void AudioOutputImpl::destroyPlayer(Player& player) {
+    // the context is released with the player, after its last callback
+    aal_player_destroy(player.handle);
+    player.context.reset();
+}
+
+void AudioOutputImpl::executeOnPreviousPlayerStop(uint64_t playerId) {
+    auto it = std::find_if(m_stoppingPlayers.begin(), m_stoppingPlayers.end(), [playerId](const Player& player) {
+        return player.context->playerId == playerId;
+    });
+    if (it == m_stoppingPlayers.end()) {
+        // a late callback of a player that is not current
+        return;
+    }
+    auto player = std::move(*it);
+    m_stoppingPlayers.erase(it);
+    poolPlayer(std::move(player));
+}
+
+void AudioOutputImpl::acquirePlayer(const std::string& key, aal_attributes_t& attr, aal_audio_parameters_t* params) {
+    auto it = std::find_if(
+        m_idlePlayers.begin(), m_idlePlayers.end(), [&key](const Player& player) { return player.key == key; });
+    if (it != m_idlePlayers.end()) {
+        auto player = std::move(*it);
+        m_idlePlayers.erase(it);
+        player.context->playerId = m_nextPlayerId++;
+        // Resetting keeps the pipeline, which saves building a new one for every prepare
+        if (aal_player_reset(player.handle, attr.uri, params)) {
+            AACE_DEBUG(LXT.m("playerReused").d("key", key));
+            m_player = player.handle;
+            m_playerContext = std::move(player.context);
+        } else {
+            destroyPlayer(player);
+        }
+    }
+    if (!m_player) {
+        std::unique_ptr<PlayerContext> context(new PlayerContext{this, {m_nextPlayerId++}});
+        attr.user_data = context.get();
+        m_player = aal_player_create(&attr, params);
+        if (m_player) {
+            m_playerContext = std::move(context);
+        }
+    }
     if (m_player) {
-        aal_player_destroy(m_player);
-        m_player = nullptr;
+        m_playerKey = key;
+        m_playerId = m_playerContext->playerId.load();
+        m_playerStopped = true;
     }
+}
+
+void AudioOutputImpl::preparePlayer(const std::string& url, std::shared_ptr<aace::audio::AudioStream> stream) {
+    recyclePlayer();
 
     // clang-format off
     aal_attributes_t attr = {
@@ -536,7 +726,7 @@ void AudioOutputImpl::preparePlayer(const std::string& url, std::shared_ptr<aace
         .device = m_deviceName.c_str(),
         .uri = url.c_str(),
         .listener = &aalListener,
-        .user_data = this,
+        .user_data = nullptr,
         .module_id = m_moduleId,
     };
     // clang-format on
@@ -563,9 +753,11 @@ void AudioOutputImpl::preparePlayer(const std::string& url, std::shared_ptr<aace
                              .channels = af.getNumChannels(),
                              .sample_rate = (int)af.getSampleRate()};
 
-        m_player = aal_player_create(&attr, &audio_params);
+        auto key = std::to_string(attr.module_id) + ":lpcm:" + std::to_string(af.getNumChannels()) + ":" +
+                   std::to_string(af.getSampleRate());
+        acquirePlayer(key, attr, &audio_params);
     } else {
-        m_player = aal_player_create(&attr, nullptr);
+        acquirePlayer(std::to_string(attr.module_id) + ":uri", attr, nullptr);
     }
 
     if (m_player) {
@@ -591,6 +783,7 @@ bool AudioOutputImpl::executePlay() {
             return false;
         }
         setState(State::Starting);
+        m_playerStopped = false;
         aal_player_play(m_player);
         return true;
     } catch (std::exception& ex) {
@@ -657,6 +850,7 @@ bool AudioOutputImpl::executeResume() {
             return false;
         }
         setState(State::Resuming);
+        m_playerStopped = false;
         aal_player_play(m_player);
         return true;
     } catch (std::exception& ex) {
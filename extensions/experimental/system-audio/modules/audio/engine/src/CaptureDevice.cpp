@@ -0,0 +1,201 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/SystemAudio/CaptureDevice.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <cstdio>
+
+#define DEFAULT_AUDIO_FRAGMENT_DURATION 20
+#define DEFAULT_AUDIO_FRAGMENT_SAMPLES 320
+
+// One second of audio in the format of the Engine
+#define CAPTURE_BUFFER_SAMPLES 16000
+
+namespace aace {
+namespace engine {
+namespace systemAudio {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.systemAudio.CaptureDevice");
+
+void CaptureDevice::onStreamStart() {
+#ifdef DUMP_AUDIO
+    std::string dumpFile = std::tmpnam(nullptr);
+    AACE_VERBOSE(LX("microphone").d("name", m_name).d("audioDump", dumpFile));
+    m_audioDump.open(dumpFile, std::ios::out | std::ios::binary);
+#endif
+}
+
+void CaptureDevice::onStreamStop(aal_status_t reason) {
+#ifdef DUMP_AUDIO
+    m_audioDump.close();
+#endif
+}
+
+void CaptureDevice::onStreamDataCallback(const int16_t* data, const size_t length) {
+#ifdef DUMP_AUDIO
+    if (m_audioDump.is_open()) {
+        m_audioDump.write(reinterpret_cast<const char*>(data), length * 2);
+    }
+#endif
+#ifdef THROTTLE_AUDIO
+    m_throttle.write(data, length);
+#else
+    m_buffer.write(data, length);
+#endif
+}
+
+// clang-format off
+static aal_listener_t aalListener = {
+    .on_start = [](void *user_data) {
+        ReturnIf(!user_data);
+        auto self = static_cast<CaptureDevice*>(user_data);
+        self->onStreamStart();
+    },
+    .on_stop = [](aal_status_t reason, void *user_data) {
+        ReturnIf(!user_data);
+        auto self = static_cast<CaptureDevice*>(user_data);
+        self->onStreamStop(reason);
+    },
+    .on_almost_done = nullptr,
+    .on_data = [](const int16_t* data, const size_t length, void* user_data) {
+        ReturnIf(!user_data);
+        auto self = static_cast<CaptureDevice*>(user_data);
+        self->onStreamDataCallback(data, length);
+    },
+    .on_data_requested = nullptr,
+    .on_enough_data = nullptr
+};
+// clang-format on
+
+CaptureDevice::CaptureDevice(
+    const int moduleId,
+    const std::string& deviceName,
+    int sampleRate,
+    const std::string& name) :
+        m_moduleId(moduleId),
+        m_name(name),
+        m_deviceName(deviceName),
+        m_sampleRate(sampleRate),
+        m_buffer(CAPTURE_BUFFER_SAMPLES)
+#ifdef THROTTLE_AUDIO
+        ,
+        m_throttle(
+            DEFAULT_AUDIO_FRAGMENT_SAMPLES,
+            std::chrono::milliseconds(DEFAULT_AUDIO_FRAGMENT_DURATION),
+            [this](const int16_t* data, size_t length) { m_buffer.write(data, length); })
+#endif
+{
+}
+
+CaptureDevice::~CaptureDevice() {
+    if (m_recorder) {
+        aal_recorder_destroy(m_recorder);
+    }
+}
+
+std::shared_ptr<CaptureDevice> CaptureDevice::create(
+    const int moduleId,
+    const std::string& deviceName,
+    int sampleRate,
+    const std::string& name) {
+    try {
+        auto device = std::shared_ptr<CaptureDevice>(new CaptureDevice(moduleId, deviceName, sampleRate, name));
+
+        ThrowIfNot(device->initialize(), "initializeFailed");
+
+        return device;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+bool CaptureDevice::initialize() {
+    try {
+        AACE_VERBOSE(LX(TAG).d("device", m_deviceName));
+
+        // clang-format off
+        const aal_attributes_t attr = {
+            .name = m_name.c_str(),
+            .device = m_deviceName.c_str(),
+            .uri = nullptr,
+            .listener = &aalListener,
+            .user_data = this,
+            .module_id = m_moduleId,
+        };
+        aal_lpcm_parameters_t params = {
+            .sample_format = AAL_SAMPLE_FORMAT_DEFAULT,
+            .channels = 0,
+            .sample_rate = m_sampleRate,
+        };
+        // clang-format on
+
+        m_recorder = aal_recorder_create(&attr, &params);
+        ThrowIfNull(m_recorder, "createRecorderFailed");
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+int CaptureDevice::addReader(OutputFunc output) {
+    return m_buffer.addReader(std::move(output));
+}
+
+void CaptureDevice::removeReader(int readerId) {
+    std::lock_guard<std::mutex> lock(m_recorderMutex);
+    if (m_buffer.removeReader(readerId) == 0 && m_recording) {
+        AACE_VERBOSE(LX(TAG, "Stop the recorder").d("device", m_deviceName));
+        aal_recorder_stop(m_recorder);
+        m_recording = false;
+    }
+}
+
+bool CaptureDevice::startReader(int readerId) {
+    try {
+        std::lock_guard<std::mutex> lock(m_recorderMutex);
+        if (m_buffer.setReaderActive(readerId, true) > 0 && !m_recording) {
+            AACE_VERBOSE(LX(TAG, "Start the recorder").d("device", m_deviceName));
+            aal_recorder_play(m_recorder);
+            m_recording = true;
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool CaptureDevice::stopReader(int readerId) {
+    try {
+        std::lock_guard<std::mutex> lock(m_recorderMutex);
+        if (m_buffer.setReaderActive(readerId, false) == 0 && m_recording) {
+            AACE_VERBOSE(LX(TAG, "Stop the recorder").d("device", m_deviceName));
+            aal_recorder_stop(m_recorder);
+            m_recording = false;
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+}  // namespace systemAudio
+}  // namespace engine
+}  // namespace aace
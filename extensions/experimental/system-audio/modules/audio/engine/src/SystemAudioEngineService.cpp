@@ -30,6 +30,8 @@ namespace engine {
 namespace systemAudio {
 
 using namespace aace::audio;
+using alexaClientSDK::avsCommon::utils::threading::Executor;
+using aace::engine::utils::threading::TimerWheel;
 
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.systemAudio.SystemAudioEngineService");
@@ -50,13 +52,19 @@ bool SystemAudioEngineService::initialize() {
 
     aal_set_log_func([](int level, const char* log, int c) { AACE_DEBUG(LX(TAG, "AAL").m(log)); });
 
+    m_streamingExecutor = std::make_shared<Executor>();
+    m_streamingTimers = std::make_shared<TimerWheel>();
+
     return true;
 }
 
-bool SystemAudioEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool SystemAudioEngineService::configureFromValue(const rapidjson::Value& configuration) {
     try {
-        m_configuration = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(m_configuration, "parseConfigurationStreamFailed");
+        ThrowIfNot(configuration.IsObject(), "invalidConfiguration");
+
+        // the configuration is used after configure() returns, so keep a copy of it
+        m_configuration = std::make_shared<rapidjson::Document>();
+        m_configuration->CopyFrom(configuration, m_configuration->GetAllocator());
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -92,6 +100,14 @@ int SystemAudioEngineService::prepareModule(const std::string& target) {
     Throw("Module not found");
 }
 
+std::shared_ptr<Executor> SystemAudioEngineService::getStreamingExecutor() {
+    return m_streamingExecutor;
+}
+
+std::shared_ptr<TimerWheel> SystemAudioEngineService::getStreamingTimers() {
+    return m_streamingTimers;
+}
+
 bool SystemAudioEngineService::isConfigEnabled(const std::string& name) {
     bool enabled = true;
     try {
@@ -184,7 +200,8 @@ public:
 
 private:
     std::weak_ptr<SystemAudioEngineService> m_service;
-    std::unordered_map<std::string, std::shared_ptr<AudioInputImpl>> m_sharedInputs;
+    // Capture devices by module, card and rate, shared by the channels opened on them
+    std::unordered_map<std::string, std::weak_ptr<CaptureDevice>> m_devices;
 };
 
 AudioInputProviderImpl::AudioInputProviderImpl(std::weak_ptr<SystemAudioEngineService> service) : m_service{service} {
@@ -201,21 +218,16 @@ std::shared_ptr<AudioInput> AudioInputProviderImpl::openChannel(const std::strin
             Throw("Loopback device must be configured explicitly");
         }
         auto moduleId = service->prepareModule(config->module);
-        std::shared_ptr<AudioInputImpl> impl;
-        if (config->shared) {
-            auto search = m_sharedInputs.find(config->name);
-            if (search == m_sharedInputs.end()) {
-                AACE_DEBUG(LX(TAG, "Create the new shared input").d("device", config->name));
-                impl = AudioInputImpl::create(moduleId, config->card, config->rate, name);
-                ThrowIfNull(impl, "Failed to create AudioInputImpl");
-                m_sharedInputs[config->name] = impl;
-            } else {
-                impl = search->second;
-            }
-        } else {
-            // Non-shared input
-            impl = AudioInputImpl::create(moduleId, config->card, config->rate, name);
+        auto key = std::to_string(moduleId) + ":" + config->card + ":" + std::to_string(config->rate);
+        auto device = m_devices[key].lock();
+        if (device == nullptr) {
+            AACE_DEBUG(LX(TAG, "Create the new capture device").d("device", config->name).d("key", key));
+            device = CaptureDevice::create(moduleId, config->card, config->rate, config->name);
+            ThrowIfNull(device, "Failed to create CaptureDevice");
+            m_devices[key] = device;
         }
+        std::shared_ptr<AudioInputImpl> impl = AudioInputImpl::create(device, name);
+        ThrowIfNull(impl, "Failed to create AudioInputImpl");
         return impl;
     } catch (std::exception& ex) {
         AACE_WARN(LX(TAG).d("reason", ex.what()));
@@ -248,7 +260,8 @@ std::shared_ptr<AudioOutput> AudioOutputProviderImpl::openChannel(const std::str
         auto config = service->getDeviceConfig("AudioOutputProvider", ss.str());
 
         auto moduleId = service->prepareModule(config->module);
-        auto impl = AudioOutputImpl::create(moduleId, config->card, name);
+        auto impl = AudioOutputImpl::create(
+            moduleId, config->card, name, service->getStreamingExecutor(), service->getStreamingTimers());
         return impl;
     } catch (std::exception& ex) {
         AACE_WARN(LX(TAG).d("reason", ex.what()));
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AACE/Engine/SystemAudio/FanOutBuffer.h>
+
+using aace::engine::systemAudio::FanOutBuffer;
+
+static const size_t CAPACITY = 16;
+
+/// Returns the values from @c first to @c last, excluded.
+static std::vector<int> sequence(int first, int last) {
+    std::vector<int> values;
+    for (int value = first; value < last; value++) {
+        values.push_back(value);
+    }
+    return values;
+}
+
+/// Collects the data delivered to a reader, accepting at most @c limit values per call.
+struct Reader {
+    std::vector<int> received;
+    size_t limit = SIZE_MAX;
+
+    FanOutBuffer<int>::OutputFunc output() {
+        return [this](const int* data, size_t length) {
+            auto count = std::min(length, limit);
+            received.insert(received.end(), data, data + count);
+            return static_cast<ssize_t>(count);
+        };
+    }
+};
+
+TEST(FanOutBufferTest, deliversToActiveReadersOnly) {
+    FanOutBuffer<int> buffer(CAPACITY);
+    Reader active, inactive;
+    auto activeId = buffer.addReader(active.output());
+    buffer.addReader(inactive.output());
+    EXPECT_EQ(buffer.setReaderActive(activeId, true), 1u);
+
+    auto values = sequence(0, 10);
+    buffer.write(values.data(), values.size());
+
+    EXPECT_EQ(active.received, values);
+    EXPECT_TRUE(inactive.received.empty());
+    EXPECT_EQ(buffer.removeReader(activeId), 0u);
+}
+
+TEST(FanOutBufferTest, partialReaderReceivesTheRestWithTheNextWrite) {
+    FanOutBuffer<int> buffer(CAPACITY);
+    Reader partial, full;
+    partial.limit = 0;
+    buffer.setReaderActive(buffer.addReader(partial.output()), true);
+    buffer.setReaderActive(buffer.addReader(full.output()), true);
+
+    // the partial reader refuses the data, which stays buffered without delaying the other reader
+    auto values = sequence(0, 12);
+    buffer.write(values.data(), 6);
+    EXPECT_TRUE(partial.received.empty());
+    EXPECT_EQ(full.received, sequence(0, 6));
+
+    // then it accepts a few values per call, across the end of the ring buffer
+    partial.limit = 5;
+    buffer.write(values.data() + 6, 6);
+    EXPECT_EQ(partial.received, values);
+    EXPECT_EQ(full.received, values);
+
+    auto more = sequence(12, 24);
+    buffer.write(more.data(), more.size());
+    EXPECT_EQ(partial.received, sequence(0, 24));
+}
+
+TEST(FanOutBufferTest, overrunReaderSkipsTheOldestData) {
+    FanOutBuffer<int> buffer(CAPACITY);
+    Reader stalled, full;
+    stalled.limit = 0;
+    buffer.setReaderActive(buffer.addReader(stalled.output()), true);
+    buffer.setReaderActive(buffer.addReader(full.output()), true);
+
+    auto values = sequence(0, 40);
+    for (int j = 0; j < 30; j += 10) {
+        buffer.write(values.data() + j, 10);
+    }
+
+    // the stalled reader receives the capacity of the most recent data once it accepts again
+    stalled.limit = SIZE_MAX;
+    buffer.write(values.data() + 30, 10);
+    EXPECT_EQ(stalled.received, sequence(40 - CAPACITY, 40));
+    EXPECT_EQ(full.received, values);
+
+    // a write longer than the capacity keeps its most recent data, for every reader
+    auto large = sequence(40, 40 + 3 * CAPACITY);
+    buffer.write(large.data(), large.size());
+    auto recent = sequence(40 + 2 * CAPACITY, 40 + 3 * CAPACITY);
+    EXPECT_EQ(std::vector<int>(stalled.received.begin() + CAPACITY, stalled.received.end()), recent);
+    EXPECT_EQ(std::vector<int>(full.received.begin() + 40, full.received.end()), recent);
+}
+
+TEST(FanOutBufferTest, readerToggledWhileWritingReceivesContiguousData) {
+    FanOutBuffer<int> buffer(CAPACITY);
+    std::atomic<bool> restarted{false};
+    std::atomic<bool> contiguous{true};
+    std::atomic<int> deliveries{0};
+    int expected = -1;
+
+    // each activation starts at the data written from then on, without gaps or repeats
+    auto id = buffer.addReader([&](const int* data, size_t length) {
+        if (!restarted.exchange(false) && data[0] != expected) {
+            contiguous = false;
+        }
+        for (size_t j = 1; j < length; j++) {
+            if (data[j] != data[j - 1] + 1) {
+                contiguous = false;
+            }
+        }
+        expected = data[length - 1] + 1;
+        deliveries++;
+        return static_cast<ssize_t>(length);
+    });
+
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        int next = 0;
+        while (!done) {
+            int values[5];
+            for (auto& value : values) {
+                value = next++;
+            }
+            buffer.write(values, 5);
+        }
+    });
+
+    for (int j = 0; j < 1000; j++) {
+        restarted = true;
+        buffer.setReaderActive(id, true);
+        std::this_thread::yield();
+        buffer.setReaderActive(id, false);
+    }
+    done = true;
+    writer.join();
+
+    EXPECT_TRUE(contiguous);
+    EXPECT_GT(deliveries, 0);
+    EXPECT_EQ(buffer.removeReader(id), 0u);
+}
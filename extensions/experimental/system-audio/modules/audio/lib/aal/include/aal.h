@@ -43,6 +43,7 @@ typedef struct {
     void (*on_almost_done)(void* user_data);
     void (*on_data)(const int16_t* data, const size_t length, void* user_data);
     void (*on_data_requested)(void* user_data);
+    void (*on_enough_data)(void* user_data);  // optional, the player stops requesting data until on_data_requested
 } aal_listener_t;
 
 typedef struct {
@@ -120,6 +121,13 @@ ssize_t aal_player_write(aal_handle_t handle, const char* data, size_t size);
 void aal_player_notify_end_of_stream(aal_handle_t handle);
 void aal_player_destroy(aal_handle_t handle);
 
+/*
+ * Reuses a stopped player for another source. The uri and audio parameters follow the same rules as
+ * aal_player_create(). Returns false if the module cannot reset its players, in which case the player should be
+ * destroyed and a new one created.
+ */
+bool aal_player_reset(aal_handle_t handle, const char* uri, aal_audio_parameters_t* params);
+
 aal_handle_t aal_recorder_create(const aal_attributes_t* attr, aal_lpcm_parameters_t* params);
 void aal_recorder_play(aal_handle_t handle);
 void aal_recorder_stop(aal_handle_t handle);
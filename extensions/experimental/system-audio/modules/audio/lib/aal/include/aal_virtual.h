@@ -0,0 +1,96 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef __AAL_VIRTUAL_H_
+#define __AAL_VIRTUAL_H_
+
+#include "aal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Controls of the "Virtual" module, which plays and records without sound hardware. It is available when AAL is
+ * built with ENABLE_VIRTUAL.
+ *
+ * The device of a player or a recorder selects where the audio goes or comes from:
+ * - "" or "null": the player discards the audio, the recorder captures silence until it is stopped
+ * - "wav:<path>": the player writes a WAV file, the recorder reads a 16-bit WAV file at AAL_AVS_SAMPLE_RATE
+ * - "mem:<name>": the buffer registered with aal_virtual_register_buffer()
+ *
+ * Players and recorders consume and produce audio by periods on a virtual clock shared by the module. All the times
+ * are in microseconds of that clock.
+ */
+
+typedef enum {
+    AAL_VIRTUAL_CLOCK_REALTIME = 0,  // follows the monotonic clock
+    AAL_VIRTUAL_CLOCK_ACCELERATED,   // follows the monotonic clock, multiplied by a speed
+    AAL_VIRTUAL_CLOCK_STEPPED,       // only moves with aal_virtual_clock_advance()
+} aal_virtual_clock_mode_t;
+
+typedef enum {
+    AAL_VIRTUAL_EVENT_START = 0,
+    AAL_VIRTUAL_EVENT_FIRST_SAMPLE,
+    AAL_VIRTUAL_EVENT_UNDERRUN,
+    AAL_VIRTUAL_EVENT_STOP,
+} aal_virtual_event_t;
+
+typedef struct {
+    int16_t* data;    // interleaved samples
+    size_t capacity;  // samples
+    size_t length;    // samples. Read by recorders, and appended to by players up to the capacity.
+} aal_virtual_buffer_t;
+
+typedef struct {
+    int64_t start_time;          // play requested, or -1
+    int64_t first_sample_time;   // first period played or delivered, or -1
+    int64_t stop_time;           // stop reported, or -1
+    int64_t last_underrun_time;  // or -1
+    int underruns;               // player: ran out of data, recorder: fell a period behind the clock
+    int64_t frames;              // frames played or delivered
+} aal_virtual_stats_t;
+
+typedef void aal_virtual_event_func(const char* name, aal_virtual_event_t event, int64_t time, void* user_data);
+
+/*
+ * Changes the virtual clock. The speed is only used by AAL_VIRTUAL_CLOCK_ACCELERATED. The clock keeps its current
+ * time, and the default is AAL_VIRTUAL_CLOCK_REALTIME, or AAL_VIRTUAL_CLOCK_ACCELERATED with the speed given by the
+ * AAL_VIRTUAL_CLOCK_SPEED environment variable.
+ */
+void aal_virtual_set_clock(aal_virtual_clock_mode_t mode, double speed);
+int64_t aal_virtual_clock_now();
+
+/*
+ * Moves a stepped clock forward, and returns once every running player and recorder has processed its periods up to
+ * the new time. Must not be called from a listener callback.
+ */
+void aal_virtual_clock_advance(int64_t us);
+
+/* The buffer must stay valid until it is unregistered. Returns false if the name is taken or too many are registered */
+bool aal_virtual_register_buffer(const char* name, aal_virtual_buffer_t* buffer);
+void aal_virtual_unregister_buffer(const char* name);
+
+/* Receives the events of every player and recorder, with their aal_attributes_t name. Called from their threads. */
+void aal_virtual_set_event_func(aal_virtual_event_func* func, void* user_data);
+
+/* Returns false if the handle does not belong to the "Virtual" module */
+bool aal_virtual_get_stats(aal_handle_t handle, aal_virtual_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // __AAL_VIRTUAL_H_
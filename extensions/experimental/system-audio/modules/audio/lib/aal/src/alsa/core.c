@@ -0,0 +1,296 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "core.h"
+
+#define DEFAULT_DEVICE "default"
+
+/* The write buffer of a player holds at least 4 writes of the engine, or 4 times the device buffer */
+#define WRITE_BUFFER_MIN_SIZE 16384
+#define WRITE_BUFFER_TIME (AAL_ALSA_BUFFER_TIME * 4)
+
+static size_t alsa_write_buffer_size(aal_alsa_context_t* ctx) {
+    aal_lpcm_parameters_t* lpcm = &ctx->audio_params.lpcm;
+    size_t frames = (size_t)((uint64_t)lpcm->sample_rate * WRITE_BUFFER_TIME / 1000000);
+    size_t size = frames * ALSA_FRAME_BYTES(lpcm->channels);
+    return size > WRITE_BUFFER_MIN_SIZE ? size : WRITE_BUFFER_MIN_SIZE;
+}
+
+static int alsa_set_hw_params(aal_alsa_context_t* ctx) {
+    aal_lpcm_parameters_t* lpcm = &ctx->audio_params.lpcm;
+    snd_pcm_hw_params_t* hw_params;
+    unsigned int period_time = AAL_ALSA_PERIOD_TIME;
+    unsigned int buffer_time = AAL_ALSA_BUFFER_TIME;
+    int r;
+
+    snd_pcm_hw_params_alloca(&hw_params);
+    r = snd_pcm_hw_params_any(ctx->pcm_handle, hw_params);
+    bail_if_error(r);
+
+    ctx->mmap = true;
+    r = snd_pcm_hw_params_set_access(ctx->pcm_handle, hw_params, SND_PCM_ACCESS_MMAP_INTERLEAVED);
+    if (r < 0) {
+        debug("mmap access is not supported, fall back to read/write access");
+        ctx->mmap = false;
+        r = snd_pcm_hw_params_set_access(ctx->pcm_handle, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED);
+        bail_if_error(r);
+    }
+
+    r = snd_pcm_hw_params_set_format(ctx->pcm_handle, hw_params, SND_PCM_FORMAT_S16_LE);
+    bail_if_error(r);
+
+    /* Rate conversions are done by the module, not by alsa-lib */
+    snd_pcm_hw_params_set_rate_resample(ctx->pcm_handle, hw_params, 0);
+
+    ctx->channels = lpcm->channels;
+    r = snd_pcm_hw_params_set_channels_near(ctx->pcm_handle, hw_params, &ctx->channels);
+    bail_if_error(r);
+
+    ctx->rate = lpcm->sample_rate;
+    r = snd_pcm_hw_params_set_rate_near(ctx->pcm_handle, hw_params, &ctx->rate, NULL);
+    bail_if_error(r);
+
+    r = snd_pcm_hw_params_set_period_time_near(ctx->pcm_handle, hw_params, &period_time, NULL);
+    bail_if_error(r);
+
+    r = snd_pcm_hw_params_set_buffer_time_near(ctx->pcm_handle, hw_params, &buffer_time, NULL);
+    bail_if_error(r);
+
+    r = snd_pcm_hw_params(ctx->pcm_handle, hw_params);
+    bail_if_error(r);
+
+    snd_pcm_hw_params_get_period_size(hw_params, &ctx->period_size, NULL);
+    snd_pcm_hw_params_get_buffer_size(hw_params, &ctx->buffer_size);
+
+bail:
+    return r;
+}
+
+static int alsa_set_sw_params(aal_alsa_context_t* ctx) {
+    snd_pcm_sw_params_t* sw_params;
+    snd_pcm_uframes_t start_threshold;
+    int r;
+
+    snd_pcm_sw_params_alloca(&sw_params);
+    r = snd_pcm_sw_params_current(ctx->pcm_handle, sw_params);
+    bail_if_error(r);
+
+    if (ctx->stream == SND_PCM_STREAM_PLAYBACK) {
+        /* Start playing once two periods are queued */
+        start_threshold = ctx->period_size * 2;
+        if (start_threshold > ctx->buffer_size) start_threshold = ctx->buffer_size;
+    } else {
+        /* The capture is started explicitly */
+        start_threshold = 1;
+    }
+    r = snd_pcm_sw_params_set_start_threshold(ctx->pcm_handle, sw_params, start_threshold);
+    bail_if_error(r);
+
+    r = snd_pcm_sw_params_set_avail_min(ctx->pcm_handle, sw_params, ctx->period_size);
+    bail_if_error(r);
+
+    r = snd_pcm_sw_params(ctx->pcm_handle, sw_params);
+
+bail:
+    return r;
+}
+
+int alsa_configure(aal_alsa_context_t* ctx) {
+    aal_lpcm_parameters_t* lpcm = &ctx->audio_params.lpcm;
+    size_t in_frames, out_frames;
+    int r;
+
+    r = alsa_set_hw_params(ctx);
+    bail_if_error(r);
+
+    r = alsa_set_sw_params(ctx);
+    bail_if_error(r);
+
+    debug(
+        "Configured: rate=%u channels=%u period=%lu buffer=%lu mmap=%d",
+        ctx->rate,
+        ctx->channels,
+        ctx->period_size,
+        ctx->buffer_size,
+        ctx->mmap);
+
+    if (ctx->stream == SND_PCM_STREAM_PLAYBACK) {
+        if (!alsa_resampler_init(&ctx->resampler, lpcm->sample_rate, lpcm->channels, ctx->rate, ctx->channels)) {
+            r = -EINVAL;
+            goto bail;
+        }
+        in_frames = (size_t)((uint64_t)ctx->period_size * lpcm->sample_rate / ctx->rate) + 2;
+        in_frames *= lpcm->channels;
+        out_frames = ctx->period_size * ctx->channels;
+    } else {
+        if (!alsa_resampler_init(&ctx->resampler, ctx->rate, ctx->channels, AAL_AVS_SAMPLE_RATE, AAL_AVS_CHANNELS)) {
+            r = -EINVAL;
+            goto bail;
+        }
+        in_frames = ctx->period_size * ctx->channels;
+        out_frames = alsa_resampler_max_output(&ctx->resampler, ctx->period_size) * AAL_AVS_CHANNELS;
+    }
+
+    free(ctx->in_buffer);
+    free(ctx->out_buffer);
+    ctx->in_frames = 0;
+    ctx->in_capacity = in_frames / ctx->resampler.in_channels;
+    ctx->out_capacity = out_frames / ctx->resampler.out_channels;
+    ctx->in_buffer = (int16_t*)malloc(in_frames * sizeof(int16_t));
+    ctx->out_buffer = (int16_t*)malloc(out_frames * sizeof(int16_t));
+    if (!ctx->in_buffer || !ctx->out_buffer) r = -ENOMEM;
+
+bail:
+    return r;
+}
+
+snd_pcm_sframes_t alsa_recover(aal_alsa_context_t* ctx, snd_pcm_sframes_t err) {
+    debug("Recover from %s", snd_strerror((int)err));
+    int r = snd_pcm_recover(ctx->pcm_handle, (int)err, 1);
+    if (r == 0 && ctx->stream == SND_PCM_STREAM_CAPTURE) {
+        r = snd_pcm_start(ctx->pcm_handle);
+    }
+    return r;
+}
+
+bool alsa_start_thread(aal_alsa_context_t* ctx, void* (*loop)(void*)) {
+    alsa_join_thread(ctx);
+
+    pthread_mutex_lock(&ctx->lock);
+    ctx->stop_requested = false;
+    ctx->pause_requested = false;
+    pthread_mutex_unlock(&ctx->lock);
+
+    if (pthread_create(&ctx->thread, NULL, loop, ctx) != 0) {
+        debug("Unable to start thread");
+        return false;
+    }
+    ctx->thread_started = true;
+    return true;
+}
+
+void alsa_join_thread(aal_alsa_context_t* ctx) {
+    if (!ctx->thread_started) return;
+
+    if (pthread_equal(ctx->thread, pthread_self())) {
+        /* Called from a listener callback, the thread ends on its own */
+        pthread_detach(ctx->thread);
+    } else {
+        pthread_join(ctx->thread, NULL);
+    }
+    ctx->thread_started = false;
+}
+
+void alsa_stop(aal_handle_t handle) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+
+    debug("Request Stop");
+    pthread_mutex_lock(&ctx->lock);
+    ctx->stop_requested = true;
+    pthread_cond_broadcast(&ctx->cond);
+    pthread_mutex_unlock(&ctx->lock);
+
+    alsa_join_thread(ctx);
+}
+
+void alsa_destroy(aal_handle_t handle) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+
+    alsa_stop(handle);
+    if (ctx->pcm_handle) snd_pcm_close(ctx->pcm_handle);
+    aal_ring_free(ctx->write_buffer);
+    free(ctx->in_buffer);
+    free(ctx->out_buffer);
+    pthread_cond_destroy(&ctx->cond);
+    pthread_mutex_destroy(&ctx->lock);
+    free(ctx);
+}
+
+aal_handle_t alsa_create_context(
+    snd_pcm_stream_t stream,
+    const aal_attributes_t* attrs,
+    aal_audio_parameters_t* params) {
+    int r = 0;
+
+    if (attrs->uri != NULL && strlen(attrs->uri) > 0) {
+        debug("Should not specify an URI");
+        return NULL;
+    }
+    if (params != NULL && params->stream_type != AAL_STREAM_LPCM) {
+        debug("Only LPCM is supported");
+        return NULL;
+    }
+
+    /* Allocate context */
+    aal_alsa_context_t* ctx;
+    ctx = (aal_alsa_context_t*)calloc(1, sizeof(aal_alsa_context_t));
+    bail_if_null(ctx);
+    ctx->stream = stream;
+    pthread_mutex_init(&ctx->lock, NULL);
+    pthread_cond_init(&ctx->cond, NULL);
+    ctx->saved_volume = 1.0;
+    ctx->gain = 1 << 15;
+    if (params != NULL) {
+        ctx->audio_params = *params;
+    }
+    ctx->audio_params.stream_type = AAL_STREAM_LPCM;
+
+    /* Device format. The recorder always delivers the AVS format. */
+    aal_lpcm_parameters_t* lpcm = &ctx->audio_params.lpcm;
+    if (lpcm->channels == 0) {
+        lpcm->channels = AAL_AVS_CHANNELS;
+    }
+    if (lpcm->sample_rate == 0) {
+        lpcm->sample_rate = AAL_AVS_SAMPLE_RATE;
+    }
+
+    const char* device = attrs->device && !IS_EMPTY_STRING(attrs->device) ? attrs->device : DEFAULT_DEVICE;
+    debug("Open PCM: name=%s, stream=%d", device, stream);
+    r = snd_pcm_open(&ctx->pcm_handle, device, stream, 0);
+    bail_if_error(r);
+
+    r = alsa_configure(ctx);
+    bail_if_error(r);
+
+    if (stream == SND_PCM_STREAM_PLAYBACK) {
+        ctx->write_buffer = aal_ring_new(alsa_write_buffer_size(ctx));
+        bail_if_null(ctx->write_buffer);
+    }
+
+    return ctx;
+
+bail:
+    debug("Error status: %s", snd_strerror(r));
+    if (ctx) alsa_destroy(ctx);
+
+    return NULL;
+}
+
+extern const aal_player_ops_t alsa_player_ops;
+extern const aal_recorder_ops_t alsa_recorder_ops;
+
+// clang-format off
+aal_module_t alsa_module = {
+	.name = "ALSA",
+	.capabilities = AAL_MODULE_CAP_STREAM_PLAYBACK | AAL_MODULE_CAP_LPCM_PLAYBACK,
+	.initialize = NULL,
+	.deinitialize = NULL,
+	.player_ops = &alsa_player_ops,
+	.recorder_ops = &alsa_recorder_ops
+};
+// clang-format on
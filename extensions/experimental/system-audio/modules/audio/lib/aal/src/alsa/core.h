@@ -0,0 +1,91 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef __AAL_ALSA_CORE_H_
+#define __AAL_ALSA_CORE_H_
+
+#define AAL_DEBUG_TAG "alsa"
+#include "../common.h"
+#include "../ring.h"
+#include "resampler.h"
+
+#include <alsa/asoundlib.h>
+#include <pthread.h>
+
+#ifndef AAL_ALSA_PERIOD_TIME
+#define AAL_ALSA_PERIOD_TIME 20000
+#endif
+#ifndef AAL_ALSA_BUFFER_TIME
+#define AAL_ALSA_BUFFER_TIME 80000
+#endif
+
+typedef struct {
+    COMMON_CONTEXT;
+
+    snd_pcm_t* pcm_handle;
+    snd_pcm_stream_t stream;
+    bool mmap;                      // false if the device only supports read/write access
+    unsigned int rate;              // sample rate of the device
+    unsigned int channels;          // channels of the device
+    snd_pcm_uframes_t period_size;  // frames
+    snd_pcm_uframes_t buffer_size;  // frames
+    alsa_resampler_t resampler;     // player: input to device, recorder: device to AVS format
+
+    pthread_t thread;
+    bool thread_started;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    bool stop_requested;
+    bool pause_requested;
+    bool eos;
+    bool data_requested;
+
+    aal_ring_t* write_buffer;   // player input, written by aal_player_write() and read by the thread
+    int16_t* in_buffer;         // input frames waiting for conversion
+    size_t in_frames;           // frames in in_buffer
+    size_t in_capacity;         // frames
+    int16_t* out_buffer;        // converted frames, if they cannot be converted in place
+    size_t out_capacity;        // frames
+    uint64_t frames_committed;  // frames handed to the device since the start of the stream
+    double saved_volume;
+    bool muted;
+    int32_t gain;  // software volume, in Q15
+
+    aal_audio_parameters_t audio_params;  // actual audio parameters applied
+} aal_alsa_context_t;
+
+#define bail_if_error(X)        \
+    {                           \
+        if ((X) < 0) goto bail; \
+    }
+#define bail_if_null(X)             \
+    {                               \
+        if ((X) == NULL) goto bail; \
+    }
+
+#define ALSA_FRAME_BYTES(channels) ((channels) * sizeof(int16_t))
+
+aal_handle_t alsa_create_context(
+    snd_pcm_stream_t stream,
+    const aal_attributes_t* attrs,
+    aal_audio_parameters_t* params);
+int alsa_configure(aal_alsa_context_t* ctx);
+bool alsa_start_thread(aal_alsa_context_t* ctx, void* (*loop)(void*));
+void alsa_join_thread(aal_alsa_context_t* ctx);
+void alsa_stop(aal_handle_t handle);
+void alsa_destroy(aal_handle_t handle);
+snd_pcm_sframes_t alsa_recover(aal_alsa_context_t* ctx, snd_pcm_sframes_t err);
+
+#endif  // __AAL_ALSA_CORE_H_
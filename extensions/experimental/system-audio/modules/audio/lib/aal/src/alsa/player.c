@@ -0,0 +1,370 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include "core.h"
+
+#define GAIN_ONE (1 << 15)
+
+/* Must be called with the lock held */
+static bool alsa_player_has_input(aal_alsa_context_t* ctx) {
+    return ctx->in_frames > 0 ||
+           aal_ring_bytes_used(ctx->write_buffer) >= ALSA_FRAME_BYTES(ctx->resampler.in_channels);
+}
+
+/* Takes up to count input frames out of the write buffer, which the thread reads without the lock */
+static size_t alsa_player_read_input(aal_alsa_context_t* ctx, void* dst, size_t count) {
+    size_t frame_bytes = ALSA_FRAME_BYTES(ctx->resampler.in_channels);
+    size_t available = aal_ring_bytes_used(ctx->write_buffer) / frame_bytes;
+
+    if (count > available) count = available;
+    return aal_ring_read(ctx->write_buffer, dst, count * frame_bytes) / frame_bytes;
+}
+
+/* Converts the buffered input into up to frames device frames, and returns the number of frames converted */
+static size_t alsa_player_fill(aal_alsa_context_t* ctx, int16_t* dst, size_t frames) {
+    alsa_resampler_t* resampler = &ctx->resampler;
+    size_t produced = 0;
+
+    while (produced < frames) {
+        int16_t* out = dst + produced * resampler->out_channels;
+
+        if (ctx->in_frames == 0 && alsa_resampler_is_passthrough(resampler)) {
+            /* Copy the input straight into the device buffer */
+            size_t count = alsa_player_read_input(ctx, out, frames - produced);
+            if (count == 0) break;
+            produced += count;
+            continue;
+        }
+
+        if (ctx->in_frames == 0) {
+            ctx->in_frames = alsa_player_read_input(ctx, ctx->in_buffer, ctx->in_capacity);
+            if (ctx->in_frames == 0) break;
+        }
+
+        size_t used;
+        produced += alsa_resampler_process(resampler, ctx->in_buffer, ctx->in_frames, &used, out, frames - produced);
+        ctx->in_frames -= used;
+        if (ctx->in_frames > 0) {
+            memmove(
+                ctx->in_buffer,
+                ctx->in_buffer + used * resampler->in_channels,
+                ctx->in_frames * ALSA_FRAME_BYTES(resampler->in_channels));
+        }
+    }
+
+    return produced;
+}
+
+static void alsa_player_apply_gain(int16_t* samples, size_t count, int32_t gain) {
+    if (gain == GAIN_ONE) return;
+
+    for (size_t i = 0; i < count; i++) {
+        samples[i] = (int16_t)((samples[i] * gain) >> 15);
+    }
+}
+
+/* Converts the buffered input into the next period of the device */
+static snd_pcm_sframes_t alsa_player_write_period(aal_alsa_context_t* ctx, snd_pcm_uframes_t frames, int32_t gain) {
+    snd_pcm_sframes_t r;
+    size_t produced;
+
+    if (ctx->mmap) {
+        const snd_pcm_channel_area_t* areas;
+        snd_pcm_uframes_t offset;
+
+        r = snd_pcm_mmap_begin(ctx->pcm_handle, &areas, &offset, &frames);
+        if (r < 0) return r;
+
+        int16_t* dst = (int16_t*)((uint8_t*)areas[0].addr + (areas[0].first + offset * areas[0].step) / 8);
+        produced = alsa_player_fill(ctx, dst, frames);
+        alsa_player_apply_gain(dst, produced * ctx->channels, gain);
+
+        r = snd_pcm_mmap_commit(ctx->pcm_handle, offset, produced);
+        if (r >= 0 && (size_t)r != produced) r = -EPIPE;
+    } else {
+        if (frames > ctx->out_capacity) frames = ctx->out_capacity;
+        produced = alsa_player_fill(ctx, ctx->out_buffer, frames);
+        alsa_player_apply_gain(ctx->out_buffer, produced * ctx->channels, gain);
+
+        r = produced > 0 ? snd_pcm_writei(ctx->pcm_handle, ctx->out_buffer, produced) : 0;
+    }
+    if (r < 0) return r;
+
+    pthread_mutex_lock(&ctx->lock);
+    ctx->frames_committed += produced;
+    pthread_mutex_unlock(&ctx->lock);
+
+    return r;
+}
+
+static void* alsa_player_loop(void* argument) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)argument;
+    aal_status_t status = AAL_ERROR;
+    snd_pcm_sframes_t r;
+
+    r = snd_pcm_prepare(ctx->pcm_handle);
+    bail_if_error(r);
+
+    if (ctx->listener->on_start) {
+        debug("Calling on_start...");
+        ctx->listener->on_start(ctx->user_data);
+    }
+
+    for (;;) {
+        bool request = false;
+
+        pthread_mutex_lock(&ctx->lock);
+        if (!ctx->stop_requested && !ctx->eos && !ctx->data_requested &&
+            aal_ring_bytes_used(ctx->write_buffer) < aal_ring_capacity(ctx->write_buffer) / 2) {
+            ctx->data_requested = true;
+            request = true;
+        }
+        /* Wait for the requested data, which is only written when the device needs it */
+        while (!request && !ctx->stop_requested && !ctx->eos && ctx->data_requested && !alsa_player_has_input(ctx)) {
+            pthread_cond_wait(&ctx->cond, &ctx->lock);
+        }
+        bool stop_requested = ctx->stop_requested;
+        bool pause_requested = ctx->pause_requested;
+        bool eos = ctx->eos;
+        bool has_input = alsa_player_has_input(ctx);
+        int32_t gain = ctx->gain;
+        pthread_mutex_unlock(&ctx->lock);
+
+        if (stop_requested) {
+            status = pause_requested ? AAL_PAUSED : AAL_UNKNOWN;
+            break;
+        }
+        if (request) {
+            if (ctx->listener->on_data_requested) ctx->listener->on_data_requested(ctx->user_data);
+            continue;
+        }
+        if (!has_input) {
+            if (eos) {
+                debug("End of stream, drain");
+                snd_pcm_drain(ctx->pcm_handle);
+                status = AAL_SUCCESS;
+                break;
+            }
+            continue;
+        }
+
+        r = snd_pcm_avail_update(ctx->pcm_handle);
+        if (r < 0) {
+            r = alsa_recover(ctx, r);
+            bail_if_error(r);
+            continue;
+        }
+        if ((snd_pcm_uframes_t)r < ctx->period_size) {
+            r = snd_pcm_wait(ctx->pcm_handle, AAL_ALSA_BUFFER_TIME / 1000);
+            if (r < 0) {
+                r = alsa_recover(ctx, r);
+                bail_if_error(r);
+            }
+            continue;
+        }
+
+        r = alsa_player_write_period(ctx, ctx->period_size, gain);
+        if (r < 0) {
+            r = alsa_recover(ctx, r);
+            bail_if_error(r);
+        }
+    }
+
+bail:
+    if (status != AAL_SUCCESS) snd_pcm_drop(ctx->pcm_handle);
+    if (status == AAL_ERROR) debug("Error status: %s", snd_strerror((int)r));
+    if (ctx->listener->on_stop) ctx->listener->on_stop(status, ctx->user_data);
+
+    return NULL;
+}
+
+static aal_handle_t alsa_player_create(const aal_attributes_t* attrs, aal_audio_parameters_t* params) {
+    if (attrs->uri && !IS_EMPTY_STRING(attrs->uri)) {
+        debug("URI is not supported, stream only");
+        return NULL;
+    }
+    return alsa_create_context(SND_PCM_STREAM_PLAYBACK, attrs, params);
+}
+
+static void alsa_player_play(aal_handle_t handle) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+
+    alsa_start_thread(ctx, alsa_player_loop);
+}
+
+static void alsa_player_pause(aal_handle_t handle) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+
+    debug("Request pause");
+    pthread_mutex_lock(&ctx->lock);
+    ctx->pause_requested = true;
+    ctx->stop_requested = true;
+    pthread_cond_broadcast(&ctx->cond);
+    pthread_mutex_unlock(&ctx->lock);
+
+    alsa_join_thread(ctx);
+}
+
+static void alsa_player_stop(aal_handle_t handle) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+
+    alsa_stop(handle);
+
+    /* Discard the rest of the stream, as the consumer now that the thread is stopped */
+    aal_ring_consume(ctx->write_buffer, aal_ring_bytes_used(ctx->write_buffer));
+    pthread_mutex_lock(&ctx->lock);
+    ctx->eos = false;
+    ctx->data_requested = false;
+    ctx->frames_committed = 0;
+    pthread_mutex_unlock(&ctx->lock);
+    ctx->in_frames = 0;
+    alsa_resampler_reset(&ctx->resampler);
+}
+
+static int64_t alsa_player_get_position(aal_handle_t handle) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+    snd_pcm_sframes_t delay = 0;
+
+    pthread_mutex_lock(&ctx->lock);
+    int64_t frames = (int64_t)ctx->frames_committed;
+    pthread_mutex_unlock(&ctx->lock);
+
+    if (snd_pcm_delay(ctx->pcm_handle, &delay) == 0 && delay > 0) {
+        frames -= delay;
+    }
+    if (frames < 0) frames = 0;
+
+    return frames * 1000 / ctx->rate;
+}
+
+static int64_t alsa_player_get_duration(aal_handle_t handle) {
+    debug("player_get_duration not supported");
+    return -1;
+}
+
+static int64_t alsa_player_get_num_bytes_buffered(aal_handle_t handle) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+
+    return (int64_t)aal_ring_bytes_used(ctx->write_buffer);
+}
+
+static void alsa_player_seek(aal_handle_t handle, int64_t position) {
+    debug("player_seek not supported");
+}
+
+static void alsa_player_update_gain(aal_alsa_context_t* ctx) {
+    ctx->gain = ctx->muted ? 0 : (int32_t)(ctx->saved_volume * GAIN_ONE);
+}
+
+static void alsa_player_set_volume(aal_handle_t handle, double volume) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+
+    if (volume < 0.0) volume = 0.0;
+    if (volume > 1.0) volume = 1.0;
+
+    pthread_mutex_lock(&ctx->lock);
+    ctx->saved_volume = volume;
+    alsa_player_update_gain(ctx);
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+static void alsa_player_set_mute(aal_handle_t handle, bool mute) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+
+    pthread_mutex_lock(&ctx->lock);
+    ctx->muted = mute;
+    alsa_player_update_gain(ctx);
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+static ssize_t alsa_player_write(aal_handle_t handle, const char* data, const size_t size) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+    ssize_t written;
+
+    /* All or nothing. The thread only frees space, so the check holds until the data is written. */
+    if (aal_ring_bytes_free(ctx->write_buffer) < size) {
+        debug("Not enough space for write buffer");
+        written = 0;
+    } else {
+        aal_ring_write(ctx->write_buffer, data, size);
+        written = size;
+    }
+
+    /* The data is committed before the thread is woken up, so it cannot miss it */
+    pthread_mutex_lock(&ctx->lock);
+    /* Request data again once the device has consumed some of the buffer */
+    if (written == 0) ctx->data_requested = false;
+    pthread_cond_broadcast(&ctx->cond);
+    pthread_mutex_unlock(&ctx->lock);
+
+    return written;
+}
+
+static void alsa_player_notify_end_of_stream(aal_handle_t handle) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+
+    pthread_mutex_lock(&ctx->lock);
+    ctx->eos = true;
+    pthread_cond_broadcast(&ctx->cond);
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+static bool alsa_player_reset(aal_handle_t handle, const char* uri, aal_audio_parameters_t* params) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+    aal_lpcm_parameters_t* lpcm = &ctx->audio_params.lpcm;
+
+    if ((uri && !IS_EMPTY_STRING(uri)) || (params && params->stream_type != AAL_STREAM_LPCM)) {
+        debug("Only LPCM streams are supported");
+        return false;
+    }
+
+    alsa_player_stop(handle);
+
+    int channels = params && params->lpcm.channels ? params->lpcm.channels : AAL_AVS_CHANNELS;
+    int sample_rate = params && params->lpcm.sample_rate ? params->lpcm.sample_rate : AAL_AVS_SAMPLE_RATE;
+    if (channels == lpcm->channels && sample_rate == lpcm->sample_rate) {
+        return true;
+    }
+
+    /* Reconfigure the device and the conversion for the new format */
+    lpcm->channels = channels;
+    lpcm->sample_rate = sample_rate;
+    if (alsa_configure(ctx) < 0) {
+        debug("Failed to configure the device");
+        return false;
+    }
+    return true;
+}
+
+// clang-format off
+const aal_player_ops_t alsa_player_ops = {
+	.create = alsa_player_create,
+	.play = alsa_player_play,
+	.pause = alsa_player_pause,
+	.stop = alsa_player_stop,
+	.get_position = alsa_player_get_position,
+	.get_duration = alsa_player_get_duration,
+	.get_num_bytes_buffered = alsa_player_get_num_bytes_buffered,
+	.seek = alsa_player_seek,
+	.set_volume = alsa_player_set_volume,
+	.set_mute = alsa_player_set_mute,
+	.write = alsa_player_write,
+	.notify_end_of_stream = alsa_player_notify_end_of_stream,
+	.destroy = alsa_destroy,
+	.reset = alsa_player_reset
+};
+// clang-format on
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <errno.h>
+#include "core.h"
+
+#define WAIT_TIMEOUT 100  // ms
+
+static void alsa_recorder_deliver(aal_alsa_context_t* ctx, const int16_t* data, size_t frames) {
+    if (!ctx->listener->on_data || frames == 0) return;
+
+    if (alsa_resampler_is_passthrough(&ctx->resampler)) {
+        ctx->listener->on_data(data, frames, ctx->user_data);
+    } else {
+        size_t used;
+        size_t produced =
+            alsa_resampler_process(&ctx->resampler, data, frames, &used, ctx->out_buffer, ctx->out_capacity);
+        if (produced > 0) ctx->listener->on_data(ctx->out_buffer, produced, ctx->user_data);
+    }
+}
+
+/* Delivers the next period captured by the device */
+static snd_pcm_sframes_t alsa_recorder_read_period(aal_alsa_context_t* ctx) {
+    snd_pcm_uframes_t frames = ctx->period_size;
+    snd_pcm_sframes_t r;
+
+    if (ctx->mmap) {
+        const snd_pcm_channel_area_t* areas;
+        snd_pcm_uframes_t offset;
+
+        r = snd_pcm_mmap_begin(ctx->pcm_handle, &areas, &offset, &frames);
+        if (r < 0) return r;
+
+        /* The audio in the AVS format is delivered straight from the device buffer */
+        const int16_t* src = (const int16_t*)((uint8_t*)areas[0].addr + (areas[0].first + offset * areas[0].step) / 8);
+        alsa_recorder_deliver(ctx, src, frames);
+
+        r = snd_pcm_mmap_commit(ctx->pcm_handle, offset, frames);
+        if (r >= 0 && (snd_pcm_uframes_t)r != frames) r = -EPIPE;
+    } else {
+        r = snd_pcm_readi(ctx->pcm_handle, ctx->in_buffer, frames);
+        if (r > 0) alsa_recorder_deliver(ctx, ctx->in_buffer, r);
+    }
+
+    return r;
+}
+
+static void* alsa_recorder_loop(void* argument) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)argument;
+    aal_status_t status = AAL_ERROR;
+    snd_pcm_sframes_t r;
+
+    alsa_resampler_reset(&ctx->resampler);
+
+    r = snd_pcm_prepare(ctx->pcm_handle);
+    bail_if_error(r);
+
+    r = snd_pcm_start(ctx->pcm_handle);
+    bail_if_error(r);
+
+    if (ctx->listener->on_start) {
+        debug("Calling on_start...");
+        ctx->listener->on_start(ctx->user_data);
+    }
+
+    for (;;) {
+        pthread_mutex_lock(&ctx->lock);
+        bool stop_requested = ctx->stop_requested;
+        pthread_mutex_unlock(&ctx->lock);
+
+        if (stop_requested) {
+            /* AAL_UNKNOWN: Stop requested */
+            status = AAL_UNKNOWN;
+            break;
+        }
+
+        r = snd_pcm_wait(ctx->pcm_handle, WAIT_TIMEOUT);
+        if (r < 0) {
+            r = alsa_recover(ctx, r);
+            bail_if_error(r);
+            continue;
+        }
+
+        snd_pcm_sframes_t avail = snd_pcm_avail_update(ctx->pcm_handle);
+        if (avail < 0) {
+            r = alsa_recover(ctx, avail);
+            bail_if_error(r);
+            continue;
+        }
+
+        while ((snd_pcm_uframes_t)avail >= ctx->period_size) {
+            r = alsa_recorder_read_period(ctx);
+            if (r < 0) {
+                r = alsa_recover(ctx, r);
+                bail_if_error(r);
+                break;
+            }
+            avail -= r;
+        }
+    }
+
+bail:
+    snd_pcm_drop(ctx->pcm_handle);
+    if (status == AAL_ERROR) debug("Error status: %s", snd_strerror((int)r));
+    if (ctx->listener->on_stop) ctx->listener->on_stop(status, ctx->user_data);
+
+    return NULL;
+}
+
+static aal_handle_t alsa_recorder_create(const aal_attributes_t* attrs, aal_lpcm_parameters_t* params) {
+    if (params != NULL) {
+        aal_audio_parameters_t audio_params;
+        audio_params.stream_type = AAL_STREAM_LPCM;
+        audio_params.lpcm = *params;
+
+        return alsa_create_context(SND_PCM_STREAM_CAPTURE, attrs, &audio_params);
+    }
+    return alsa_create_context(SND_PCM_STREAM_CAPTURE, attrs, NULL);
+}
+
+static void alsa_recorder_play(aal_handle_t handle) {
+    aal_alsa_context_t* ctx = (aal_alsa_context_t*)handle;
+
+    alsa_start_thread(ctx, alsa_recorder_loop);
+}
+
+// clang-format off
+const aal_recorder_ops_t alsa_recorder_ops = {
+	.create = alsa_recorder_create,
+	.play = alsa_recorder_play,
+	.stop = alsa_stop,
+	.destroy = alsa_destroy
+};
+// clang-format on
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "resampler.h"
+
+#define PHASE_ONE (1ull << 32)
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* Cutoff of the low-pass filter, as a fraction of the output rate, below its Nyquist frequency of 0.5 */
+#define FILTER_CUTOFF 0.45
+
+/* Computes a Hamming-windowed sinc low-pass filter for a cutoff given as a fraction of the input rate */
+static void init_filter(alsa_resampler_t* r, double cutoff) {
+    double coeffs[AAL_ALSA_FILTER_TAPS];
+    double sum = 0;
+    int32_t total = 0;
+    int center = AAL_ALSA_FILTER_TAPS / 2;
+    int k;
+
+    for (k = 0; k < AAL_ALSA_FILTER_TAPS; k++) {
+        int t = k - center;
+        double sinc = t == 0 ? 2 * cutoff : sin(2 * M_PI * cutoff * t) / (M_PI * t);
+        double window = 0.54 - 0.46 * cos(2 * M_PI * k / (AAL_ALSA_FILTER_TAPS - 1));
+        coeffs[k] = sinc * window;
+        sum += coeffs[k];
+    }
+    for (k = 0; k < AAL_ALSA_FILTER_TAPS; k++) {
+        r->coeffs[k] = (int32_t)lround(coeffs[k] / sum * 32768);
+        total += r->coeffs[k];
+    }
+    // the rounding error goes to the center tap, so that a constant signal keeps its level
+    r->coeffs[center] += 32768 - total;
+}
+
+bool alsa_resampler_init(
+    alsa_resampler_t* r,
+    unsigned int in_rate,
+    unsigned int in_channels,
+    unsigned int out_rate,
+    unsigned int out_channels) {
+    if (in_rate == 0 || out_rate == 0 || in_channels == 0 || out_channels == 0 ||
+        in_channels > AAL_ALSA_MAX_CHANNELS || out_channels > AAL_ALSA_MAX_CHANNELS) {
+        return false;
+    }
+
+    r->in_rate = in_rate;
+    r->in_channels = in_channels;
+    r->out_rate = out_rate;
+    r->out_channels = out_channels;
+    r->step = ((uint64_t)in_rate << 32) / out_rate;
+    r->filtered = out_rate < in_rate;
+    if (r->filtered) init_filter(r, FILTER_CUTOFF * out_rate / in_rate);
+    alsa_resampler_reset(r);
+    return true;
+}
+
+void alsa_resampler_reset(alsa_resampler_t* r) {
+    // The first two input frames are loaded before the first output frame
+    r->phase = 2 * PHASE_ONE;
+    memset(r->prev, 0, sizeof(r->prev));
+    memset(r->next, 0, sizeof(r->next));
+    memset(r->history, 0, sizeof(r->history));
+    r->history_pos = 0;
+}
+
+bool alsa_resampler_is_passthrough(const alsa_resampler_t* r) {
+    return r->in_rate == r->out_rate && r->in_channels == r->out_channels;
+}
+
+size_t alsa_resampler_max_output(const alsa_resampler_t* r, size_t in_frames) {
+    return (size_t)(((uint64_t)in_frames * r->out_rate + r->in_rate - 1) / r->in_rate) + 1;
+}
+
+static void load_frame(const alsa_resampler_t* r, const int16_t* frame, int32_t* dst) {
+    unsigned int c;
+
+    if (r->in_channels == r->out_channels) {
+        for (c = 0; c < r->out_channels; c++) dst[c] = frame[c];
+    } else if (r->out_channels == 1) {
+        int32_t sum = 0;
+        for (c = 0; c < r->in_channels; c++) sum += frame[c];
+        dst[0] = sum / (int32_t)r->in_channels;
+    } else {
+        for (c = 0; c < r->out_channels; c++) dst[c] = frame[c % r->in_channels];
+    }
+}
+
+/* Loads the next input frame, filtered when decimating */
+static void push_frame(alsa_resampler_t* r, const int16_t* frame, int32_t* dst) {
+    unsigned int c;
+    int k;
+
+    load_frame(r, frame, dst);
+    if (!r->filtered) return;
+
+    for (c = 0; c < r->out_channels; c++) {
+        int16_t* history = r->history[c];
+        int32_t acc = 1 << 14;
+
+        history[r->history_pos] = history[r->history_pos + AAL_ALSA_FILTER_TAPS] = (int16_t)dst[c];
+        // the taps run from the oldest frame, at the position after the one just written
+        history += r->history_pos + 1;
+        for (k = 0; k < AAL_ALSA_FILTER_TAPS; k++) acc += r->coeffs[k] * history[k];
+        dst[c] = acc >> 15;
+    }
+    r->history_pos = (r->history_pos + 1) % AAL_ALSA_FILTER_TAPS;
+}
+
+static int16_t clamp_sample(int32_t value) {
+    return value > INT16_MAX ? INT16_MAX : value < INT16_MIN ? INT16_MIN : (int16_t)value;
+}
+
+size_t alsa_resampler_process(
+    alsa_resampler_t* r,
+    const int16_t* in,
+    size_t in_frames,
+    size_t* in_used,
+    int16_t* out,
+    size_t out_frames) {
+    size_t i = 0, n = 0;
+    unsigned int c;
+
+    if (alsa_resampler_is_passthrough(r)) {
+        n = in_frames < out_frames ? in_frames : out_frames;
+        memcpy(out, in, n * r->in_channels * sizeof(int16_t));
+        *in_used = n;
+        return n;
+    }
+
+    while (n < out_frames) {
+        // Move the pair of input frames up to the position of the next output frame
+        while (r->phase >= PHASE_ONE) {
+            if (i >= in_frames) goto done;
+            memcpy(r->prev, r->next, sizeof(r->prev));
+            push_frame(r, in + i * r->in_channels, r->next);
+            r->phase -= PHASE_ONE;
+            i++;
+        }
+
+        int64_t frac = (int64_t)(r->phase >> 16);
+        for (c = 0; c < r->out_channels; c++) {
+            out[n * r->out_channels + c] =
+                clamp_sample(r->prev[c] + (int32_t)(((r->next[c] - r->prev[c]) * frac) >> 16));
+        }
+        r->phase += r->step;
+        n++;
+    }
+
+done:
+    *in_used = i;
+    return n;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef __AAL_ALSA_RESAMPLER_H_
+#define __AAL_ALSA_RESAMPLER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define AAL_ALSA_MAX_CHANNELS 8
+
+/* Length of the low-pass filter applied before decimation */
+#define AAL_ALSA_FILTER_TAPS 63
+
+/*
+ * Converts interleaved S16 audio between a fixed pair of sample rates and channel counts, with linear
+ * interpolation. Mono is duplicated to every output channel, and multiple channels are averaged to mono.
+ * When the output rate is lower, the input first goes through a windowed-sinc low-pass filter below the
+ * output Nyquist frequency, so that the frequencies which do not fit in the output rate are not aliased.
+ */
+typedef struct {
+    unsigned int in_rate;
+    unsigned int in_channels;
+    unsigned int out_rate;
+    unsigned int out_channels;
+
+    uint64_t step;   // input frames per output frame, in 32.32 fixed point
+    uint64_t phase;  // position of the next output frame after the previous input frame, in 32.32 fixed point
+    int32_t prev[AAL_ALSA_MAX_CHANNELS];
+    int32_t next[AAL_ALSA_MAX_CHANNELS];
+
+    bool filtered;
+    int32_t coeffs[AAL_ALSA_FILTER_TAPS];  // in Q15, with a gain of 1 at DC
+    // the latest input frames of each channel, written twice so that the taps are always contiguous
+    int16_t history[AAL_ALSA_MAX_CHANNELS][2 * AAL_ALSA_FILTER_TAPS];
+    unsigned int history_pos;
+} alsa_resampler_t;
+
+bool alsa_resampler_init(
+    alsa_resampler_t* r,
+    unsigned int in_rate,
+    unsigned int in_channels,
+    unsigned int out_rate,
+    unsigned int out_channels);
+
+/* Restarts the conversion, e.g. after a stop */
+void alsa_resampler_reset(alsa_resampler_t* r);
+
+/* Whether the audio can be copied as is */
+bool alsa_resampler_is_passthrough(const alsa_resampler_t* r);
+
+/* Upper bound of the output frames converted from in_frames input frames */
+size_t alsa_resampler_max_output(const alsa_resampler_t* r, size_t in_frames);
+
+/*
+ * Converts up to in_frames input frames into at most out_frames output frames. Returns the number of output frames,
+ * and sets in_used to the number of input frames consumed. The input frames which are not consumed must be given
+ * again with the next call.
+ */
+size_t alsa_resampler_process(
+    alsa_resampler_t* r,
+    const int16_t* in,
+    size_t in_frames,
+    size_t* in_used,
+    int16_t* out,
+    size_t out_frames);
+
+#endif  // __AAL_ALSA_RESAMPLER_H_
@@ -25,6 +25,12 @@ extern aal_module_t omxal_module;
 #ifdef CONFIG_QSA
 extern aal_module_t qsa_module;
 #endif
+#ifdef CONFIG_ALSA
+extern aal_module_t alsa_module;
+#endif
+#ifdef CONFIG_VIRTUAL
+extern aal_module_t virtual_module;
+#endif
 
 aal_module_t* modules[] = {
 #ifdef CONFIG_GSTREAMER
@@ -35,6 +41,12 @@ aal_module_t* modules[] = {
 #endif
 #ifdef CONFIG_QSA
     &qsa_module,
+#endif
+#ifdef CONFIG_ALSA
+    &alsa_module,
+#endif
+#ifdef CONFIG_VIRTUAL
+    &virtual_module,
 #endif
     NULL};
 
@@ -161,6 +173,15 @@ void aal_player_destroy(aal_handle_t handle) {
     MODULE(handle)->player_ops->destroy(handle);
 }
 
+bool aal_player_reset(aal_handle_t handle, const char* uri, aal_audio_parameters_t* params) {
+    if (!MODULE(handle)->player_ops->reset) {
+        debug("Player reset is not supported");
+        return false;
+    }
+
+    return MODULE(handle)->player_ops->reset(handle, uri, params);
+}
+
 aal_handle_t aal_recorder_create(const aal_attributes_t* attr, aal_lpcm_parameters_t* params) {
     aal_common_context_t* ctx;
 
@@ -54,6 +54,7 @@ typedef struct {
     ssize_t (*write)(aal_handle_t handle, const char* data, size_t size);
     void (*notify_end_of_stream)(aal_handle_t handle);
     void (*destroy)(aal_handle_t handle);
+    bool (*reset)(aal_handle_t handle, const char* uri, aal_audio_parameters_t* params);
 } aal_player_ops_t;
 
 typedef struct {
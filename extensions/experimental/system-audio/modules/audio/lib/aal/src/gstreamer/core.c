@@ -63,9 +63,6 @@ aal_gst_context_t* gstreamer_create_context(GstElement* pipeline, const char* el
     aal_gst_context_t* ctx = (aal_gst_context_t*)calloc(1, sizeof(aal_gst_context_t));
     ctx->name = attr->name;
     ctx->pipeline = pipeline;
-    // GLoop creation for the bus watch
-    ctx->worker_context = g_main_context_new();
-    ctx->main_loop = g_main_loop_new(ctx->worker_context, false);
 
     return ctx;
 }
@@ -98,16 +95,9 @@ void gstreamer_destroy(aal_handle_t handle) {
     }
 
     gst_element_set_state(ctx->pipeline, GST_STATE_NULL);
+    gstreamer_stop_main_loop(ctx);
     gst_object_unref(ctx->pipeline);
 
-    g_main_context_unref(ctx->worker_context);
-    g_main_loop_quit(ctx->main_loop);
-    g_main_loop_unref(ctx->main_loop);
-
-    g_debug("%s: waiting for gstreamer loop to exit", ctx->name);
-    pthread_join(ctx->thread_id, NULL);
-    g_debug("%s: gstreamer loop exited", ctx->name);
-
     g_debug("%s: free aal_gst_context_t", ctx->name);
     free(ctx);
 }
@@ -290,30 +280,40 @@ static gboolean bus_message_callback(GstBus* bus, GstMessage* msg, gpointer poin
     return TRUE;
 }
 
-static void* gloop(void* arg) {
-    GstBus* bus;
-    aal_gst_context_t* ctx = (aal_gst_context_t*)arg;
-
-    g_main_context_push_thread_default(ctx->worker_context);
+void gstreamer_start_main_loop(aal_gst_context_t* ctx) {
+    ctx->worker = gstreamer_worker_acquire();
+    if (!ctx->worker) return;
+    ctx->worker_context = ctx->worker->context;
 
-    // Add bus watch only after calling g_main_context_push_thread_default.
-    bus = gst_pipeline_get_bus(GST_PIPELINE(ctx->pipeline));
-    guint bus_watch_id = gst_bus_add_watch(bus, &bus_message_callback, ctx);
+    // The bus messages of the context are handled in order on its worker, with the callbacks it invokes there
+    GstBus* bus = gst_pipeline_get_bus(GST_PIPELINE(ctx->pipeline));
+    ctx->bus_watch = gst_bus_create_watch(bus);
     gst_object_unref(bus);
+    g_source_set_callback(ctx->bus_watch, (GSourceFunc)bus_message_callback, ctx, NULL);
+    g_source_attach(ctx->bus_watch, ctx->worker_context);
+}
 
-    g_main_loop_run(ctx->main_loop);
+static gboolean detach_bus_watch(gpointer user_data) {
+    aal_gst_context_t* ctx = (aal_gst_context_t*)user_data;
 
-    // Remove the watch
-    GSource* source = g_main_context_find_source_by_id(ctx->worker_context, bus_watch_id);
-    if (source) g_source_destroy(source);
+    g_source_destroy(ctx->bus_watch);
+    g_source_unref(ctx->bus_watch);
+    ctx->bus_watch = NULL;
+    return G_SOURCE_REMOVE;
+}
 
-    g_main_context_pop_thread_default(ctx->worker_context);
+void gstreamer_stop_main_loop(aal_gst_context_t* ctx) {
+    if (!ctx->worker) return;
 
-    return NULL;
-}
+    // Detach on the worker, so no callback of the context is running or pending once it returns
+    if (ctx->bus_watch) {
+        g_debug("%s: detaching from gstreamer worker", ctx->name);
+        gstreamer_worker_invoke_sync(ctx->worker, detach_bus_watch, ctx);
+    }
 
-void gstreamer_start_main_loop(aal_gst_context_t* ctx) {
-    pthread_create(&ctx->thread_id, NULL, gloop, ctx);
+    gstreamer_worker_release(ctx->worker);
+    ctx->worker = NULL;
+    ctx->worker_context = NULL;
 }
 
 char* gstreamer_audio_pcm_caps(GstAudioFormat sample_format, int channels, int sample_rate) {
@@ -18,6 +18,7 @@
 
 #define AAL_DEBUG_TAG "gstreamer"
 #include "../common.h"
+#include "worker.h"
 
 #include <gst/gst.h>
 #include <gst/audio/audio-format.h>
@@ -34,9 +35,9 @@ typedef struct {
 #ifdef USE_FAKEMUTE
     double saved_volume;
 #endif
-    pthread_t thread_id;
-    GMainLoop* main_loop;
+    aal_gst_worker_t* worker;
     GMainContext* worker_context;
+    GSource* bus_watch;
 
     aal_audio_parameters_t audio_params;
 } aal_gst_context_t;
@@ -44,6 +45,7 @@ typedef struct {
 aal_gst_context_t* gstreamer_create_context(GstElement* pipeline, const char* element, const aal_attributes_t* attr);
 GstElement* gstreamer_create_and_add_element(GstElement* bin, const char* factory, const char* name);
 void gstreamer_start_main_loop(aal_gst_context_t* ctx);
+void gstreamer_stop_main_loop(aal_gst_context_t* ctx);
 void gstreamer_destroy(aal_handle_t handle);
 void gstreamer_play(aal_handle_t handle);
 void gstreamer_stop(aal_handle_t handle);
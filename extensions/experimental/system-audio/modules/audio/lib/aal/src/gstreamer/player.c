@@ -43,7 +43,9 @@ static void need_data_callback(GstAppSrc* src, guint length, gpointer pointer) {
 }
 
 static void enough_data_callback(GstAppSrc* src, gpointer pointer) {
+    aal_gst_context_t* ctx = (aal_gst_context_t*)pointer;
     g_debug("onEnoughData\n");
+    if (ctx->listener && ctx->listener->on_enough_data) ctx->listener->on_enough_data(ctx->user_data);
 }
 
 static gboolean seek_data_callback(GstAppSrc* src, guint64 offset, gpointer pointer) {
@@ -102,24 +104,46 @@ static void source_setup_callback(GstElement* playbin, GstElement* source, gpoin
     g_object_set(G_OBJECT(source), "format", GST_FORMAT_TIME, NULL);
 }
 
-static aal_handle_t gstreamer_player_create(const aal_attributes_t* attr, aal_audio_parameters_t* params) {
-    bool success = false;
-    aal_gst_context_t* ctx = NULL;
-    GstElement* bin = NULL;
-    GstElement* sink = NULL;
-    GstElement* volume = NULL;
-
-    if (!attr->uri || IS_EMPTY_STRING(attr->uri)) {
+static bool gstreamer_player_check_source(const char* uri, aal_audio_parameters_t* params) {
+    if (!uri || IS_EMPTY_STRING(uri)) {
         if (params != NULL && params->stream_type != AAL_STREAM_LPCM) {
             g_debug("Should only specify audio parameters for LPCM stream");
-            goto exit;
+            return false;
         }
     } else {
         if (params != NULL) {
             g_debug("Specifying audio parameters for file is not supported");
-            goto exit;
+            return false;
+        }
+    }
+    return true;
+}
+
+static void gstreamer_player_set_source(aal_gst_context_t* ctx, const char* uri, aal_audio_parameters_t* params) {
+    if (!uri || IS_EMPTY_STRING(uri)) {
+        // The caps are applied to the appsrc by source_setup_callback
+        if (params != NULL) {
+            ctx->audio_params = *params;
+        } else {
+            ctx->audio_params.stream_type = AAL_STREAM_LPCM;
+            ctx->audio_params.lpcm.sample_format = AAL_AVS_SAMPLE_FORMAT;
+            ctx->audio_params.lpcm.channels = AAL_AVS_CHANNELS;
+            ctx->audio_params.lpcm.sample_rate = AAL_AVS_SAMPLE_RATE;
         }
+        g_object_set(GST_OBJECT(ctx->pipeline), "uri", APPSRC_URI, NULL);
+    } else {
+        g_object_set(GST_OBJECT(ctx->pipeline), "uri", uri, NULL);
     }
+}
+
+static aal_handle_t gstreamer_player_create(const aal_attributes_t* attr, aal_audio_parameters_t* params) {
+    bool success = false;
+    aal_gst_context_t* ctx = NULL;
+    GstElement* bin = NULL;
+    GstElement* sink = NULL;
+    GstElement* volume = NULL;
+
+    if (!gstreamer_player_check_source(attr->uri, params)) goto exit;
 
     ctx = gstreamer_create_context(NULL, "playbin", attr);
     if (!ctx) goto exit;
@@ -165,19 +189,7 @@ static aal_handle_t gstreamer_player_create(const aal_attributes_t* attr, aal_au
     gst_element_add_pad(bin, sink_pad);
     gst_object_unref(pad);
 
-    if (!attr->uri || IS_EMPTY_STRING(attr->uri)) {
-        if (params != NULL) {
-            ctx->audio_params = *params;
-        } else {
-            ctx->audio_params.stream_type = AAL_STREAM_LPCM;
-            ctx->audio_params.lpcm.sample_format = AAL_AVS_SAMPLE_FORMAT;
-            ctx->audio_params.lpcm.channels = AAL_AVS_CHANNELS;
-            ctx->audio_params.lpcm.channels = AAL_AVS_SAMPLE_RATE;
-        }
-        g_object_set(GST_OBJECT(ctx->pipeline), "uri", APPSRC_URI, NULL);
-    } else {
-        g_object_set(GST_OBJECT(ctx->pipeline), "uri", attr->uri, NULL);
-    }
+    gstreamer_player_set_source(ctx, attr->uri, params);
     g_object_set(GST_OBJECT(ctx->pipeline), "audio-sink", bin, NULL);
 
     g_signal_connect(ctx->pipeline, "about-to-finish", G_CALLBACK(about_to_finish_callback), ctx);
@@ -362,6 +374,25 @@ static void gstreamer_player_notify_end_of_stream(aal_handle_t handle) {
     if (GST_IS_APP_SRC(source)) gst_app_src_end_of_stream(GST_APP_SRC(source));
 }
 
+static bool gstreamer_player_reset(aal_handle_t handle, const char* uri, aal_audio_parameters_t* params) {
+    aal_gst_context_t* ctx = (aal_gst_context_t*)handle;
+
+    if (!gstreamer_player_check_source(uri, params)) return false;
+
+    // READY tears down the source of playbin but keeps the sink bin, the bus watch and the main loop. The new source
+    // is created, and source_setup_callback applies the new caps, when the pipeline is played again.
+    if (gst_element_set_state(ctx->pipeline, GST_STATE_READY) == GST_STATE_CHANGE_FAILURE) {
+        g_warning("%s: failed to reset pipeline", ctx->name);
+        return false;
+    }
+    ctx->state = AAL_STATE_NULL;
+    ctx->pending_position = 0;
+
+    gstreamer_player_set_source(ctx, uri, params);
+
+    return true;
+}
+
 const aal_player_ops_t gstreamer_player_ops = {.create = gstreamer_player_create,
                                                .play = gstreamer_play,
                                                .pause = gstreamer_pause,
@@ -374,4 +405,5 @@ const aal_player_ops_t gstreamer_player_ops = {.create = gstreamer_player_create
                                                .set_mute = gstreamer_player_set_mute,
                                                .write = gstreamer_player_write,
                                                .notify_end_of_stream = gstreamer_player_notify_end_of_stream,
-                                               .destroy = gstreamer_destroy};
+                                               .destroy = gstreamer_destroy,
+                                               .reset = gstreamer_player_reset};
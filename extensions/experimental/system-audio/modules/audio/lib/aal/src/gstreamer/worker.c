@@ -0,0 +1,166 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#define G_LOG_DOMAIN "AAL"
+#include "worker.h"
+
+static aal_gst_worker_t workers[AAL_GST_WORKER_COUNT];
+static pthread_mutex_t workers_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+typedef struct {
+    GSourceFunc func;
+    gpointer data;
+    bool done;
+    GMutex mutex;
+    GCond cond;
+} sync_call_t;
+
+typedef struct {
+    GMainContext* context;
+    GMainLoop* loop;
+} worker_thread_t;
+
+static void* worker_loop(void* arg) {
+    // The thread owns references to its context and loop, as the worker may be released and acquired again with
+    // another context while a thread detached by a release from its own callback is still running
+    worker_thread_t* thread = (worker_thread_t*)arg;
+    GMainContext* context = thread->context;
+    GMainLoop* loop = thread->loop;
+    g_free(thread);
+
+    g_main_context_push_thread_default(context);
+    g_main_loop_run(loop);
+    g_main_context_pop_thread_default(context);
+
+    g_main_loop_unref(loop);
+    g_main_context_unref(context);
+    return NULL;
+}
+
+static gboolean quit_loop(gpointer user_data) {
+    g_main_loop_quit((GMainLoop*)user_data);
+    return G_SOURCE_REMOVE;
+}
+
+aal_gst_worker_t* gstreamer_worker_acquire() {
+    aal_gst_worker_t* worker = &workers[0];
+
+    pthread_mutex_lock(&workers_mutex);
+
+    // Bind the new context to the least used worker
+    for (int i = 1; i < AAL_GST_WORKER_COUNT; i++) {
+        if (workers[i].users < worker->users) worker = &workers[i];
+    }
+
+    if (worker->users == 0) {
+        worker_thread_t* thread = g_new(worker_thread_t, 1);
+        worker->context = g_main_context_new();
+        worker->loop = g_main_loop_new(worker->context, false);
+        thread->context = g_main_context_ref(worker->context);
+        thread->loop = g_main_loop_ref(worker->loop);
+        if (pthread_create(&worker->thread_id, NULL, worker_loop, thread) != 0) {
+            g_warning("Unable to start worker thread");
+            g_main_loop_unref(thread->loop);
+            g_main_context_unref(thread->context);
+            g_free(thread);
+            g_main_loop_unref(worker->loop);
+            g_main_context_unref(worker->context);
+            worker->loop = NULL;
+            worker->context = NULL;
+            worker = NULL;
+            goto exit;
+        }
+        g_debug("worker %p: started", worker);
+    }
+    worker->users++;
+
+exit:
+    pthread_mutex_unlock(&workers_mutex);
+    return worker;
+}
+
+void gstreamer_worker_release(aal_gst_worker_t* worker) {
+    GMainContext* context = NULL;
+    GMainLoop* loop = NULL;
+    pthread_t thread_id;
+    bool join = false;
+
+    if (!worker) return;
+
+    pthread_mutex_lock(&workers_mutex);
+
+    if (--worker->users == 0) {
+        context = worker->context;
+        loop = worker->loop;
+        thread_id = worker->thread_id;
+        worker->loop = NULL;
+        worker->context = NULL;
+
+        // Quit from a source of the loop, so the quit is not lost if the loop is not running yet
+        GSource* source = g_idle_source_new();
+        g_source_set_callback(source, quit_loop, g_main_loop_ref(loop), (GDestroyNotify)g_main_loop_unref);
+        g_source_attach(source, context);
+        g_source_unref(source);
+
+        if (pthread_equal(pthread_self(), thread_id)) {
+            // Released from one of its own callbacks, the loop exits once the callback returns
+            pthread_detach(thread_id);
+        } else {
+            join = true;
+        }
+        g_debug("worker %p: stopped", worker);
+    }
+
+    pthread_mutex_unlock(&workers_mutex);
+
+    // The worker may be acquired again with a new thread while this one exits
+    if (join) pthread_join(thread_id, NULL);
+    if (loop) g_main_loop_unref(loop);
+    if (context) g_main_context_unref(context);
+}
+
+static gboolean sync_call_dispatch(gpointer user_data) {
+    sync_call_t* call = (sync_call_t*)user_data;
+
+    call->func(call->data);
+
+    g_mutex_lock(&call->mutex);
+    call->done = true;
+    g_cond_signal(&call->cond);
+    g_mutex_unlock(&call->mutex);
+
+    return G_SOURCE_REMOVE;
+}
+
+void gstreamer_worker_invoke_sync(aal_gst_worker_t* worker, GSourceFunc func, gpointer data) {
+    if (g_main_context_is_owner(worker->context)) {
+        func(data);
+        return;
+    }
+
+    // Callbacks invoked earlier on the worker run before this one
+    sync_call_t call = {.func = func, .data = data, .done = false};
+    g_mutex_init(&call.mutex);
+    g_cond_init(&call.cond);
+
+    g_main_context_invoke(worker->context, sync_call_dispatch, &call);
+
+    g_mutex_lock(&call.mutex);
+    while (!call.done) g_cond_wait(&call.cond, &call.mutex);
+    g_mutex_unlock(&call.mutex);
+
+    g_cond_clear(&call.cond);
+    g_mutex_clear(&call.mutex);
+}
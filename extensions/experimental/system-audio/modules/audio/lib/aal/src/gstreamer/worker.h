@@ -0,0 +1,42 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef __AAL_GSTREAMER_WORKER_H_
+#define __AAL_GSTREAMER_WORKER_H_
+
+#include <glib.h>
+#include <pthread.h>
+#include <stdbool.h>
+
+/*
+ * Number of GLib worker threads shared by all the players and recorders. Each context is bound to one worker for its
+ * lifetime, so its bus messages and callbacks are handled in order.
+ */
+#ifndef AAL_GST_WORKER_COUNT
+#define AAL_GST_WORKER_COUNT 1
+#endif
+
+typedef struct {
+    GMainContext* context;
+    GMainLoop* loop;
+    pthread_t thread_id;
+    int users;
+} aal_gst_worker_t;
+
+aal_gst_worker_t* gstreamer_worker_acquire();
+void gstreamer_worker_release(aal_gst_worker_t* worker);
+void gstreamer_worker_invoke_sync(aal_gst_worker_t* worker, GSourceFunc func, gpointer data);
+
+#endif  // __AAL_GSTREAMER_WORKER_H_
@@ -22,19 +22,9 @@
 #define DEFAULT_AUDIO_FRAG_SIZE (AAL_AVS_SAMPLE_RATE * 2 * 20 / 1000)
 
 static ssize_t qsa_read_from_write_buffer(aal_qsa_context_t* ctx, uint8_t* buffer, bool* need_data) {
-    ssize_t size = 0;
-
-    pthread_mutex_lock(&ctx->lock);
-    size_t available = ringbuf_bytes_used(ctx->write_buffer);
-    if (available > 0) {
-        size = MIN(available, ctx->buffer_size);
-        if (!ringbuf_memcpy_from(buffer, ctx->write_buffer, size)) {
-            debug("ringbuf_memcpy_from Failed");
-            size = -1;
-        }
-    }
-    *need_data = ringbuf_is_empty(ctx->write_buffer);
-    pthread_mutex_unlock(&ctx->lock);
+    /* The thread is the only reader, so it needs no lock */
+    ssize_t size = (ssize_t)aal_ring_read(ctx->write_buffer, buffer, ctx->buffer_size);
+    *need_data = aal_ring_bytes_used(ctx->write_buffer) == 0;
 
     return size;
 }
@@ -198,7 +188,7 @@ void qsa_play(aal_handle_t handle) {
 
     if (ctx->channel == SND_PCM_CHANNEL_PLAYBACK) {
         /* Prepare ring buffer */
-        ctx->write_buffer = ringbuf_new(ctx->buffer_size * 10);
+        ctx->write_buffer = aal_ring_new(ctx->buffer_size * 10);
         bail_if_null(ctx->write_buffer);
     }
 
@@ -211,7 +201,8 @@ void qsa_play(aal_handle_t handle) {
     return;
 
 bail:
-    if (ctx->write_buffer) ringbuf_free(&ctx->write_buffer);
+    aal_ring_free(ctx->write_buffer);
+    ctx->write_buffer = NULL;
 
     return;
 }
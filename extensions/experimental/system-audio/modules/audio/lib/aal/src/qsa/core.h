@@ -18,11 +18,11 @@
 
 #define AAL_DEBUG_TAG "qsa"
 #include "../common.h"
+#include "../ring.h"
 
 /* This is NOT for ALSA but QSA */
 #include <sys/asoundlib.h>
 #include <pthread.h>
-#include <ringbuf.h>
 
 typedef struct {
     COMMON_CONTEXT;
@@ -37,7 +37,7 @@ typedef struct {
     pthread_mutex_t lock;
     bool stop_requested;
     bool eos;
-    ringbuf_t write_buffer;
+    aal_ring_t* write_buffer;  // written by qsa_player_write() and read by the thread, without the lock
     snd_pcm_channel_status_t status;
     int base_sched_priority;
 
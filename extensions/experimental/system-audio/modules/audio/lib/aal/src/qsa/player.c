@@ -116,16 +116,14 @@ static ssize_t qsa_player_write(aal_handle_t handle, const char* data, const siz
     ssize_t written;
 
     debug("Write %ld bytes into buffer", size);
-    pthread_mutex_lock(&ctx->lock);
-    /* All or nothing */
-    if (ringbuf_bytes_free(ctx->write_buffer) < size) {
+    /* All or nothing. The thread only frees space, so the check holds until the data is written. */
+    if (aal_ring_bytes_free(ctx->write_buffer) < size) {
         debug("Not enough space for write buffer");
         written = 0;
     } else {
-        ringbuf_memcpy_into(ctx->write_buffer, data, size);
+        aal_ring_write(ctx->write_buffer, data, size);
         written = size;
     }
-    pthread_mutex_unlock(&ctx->lock);
 
     return written;
 }
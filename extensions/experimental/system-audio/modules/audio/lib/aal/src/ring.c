@@ -0,0 +1,181 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "ring.h"
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef AAL_RING_CACHE_LINE
+#define AAL_RING_CACHE_LINE 64
+#endif
+
+/*
+ * The head and the tail count the bytes written and read since the last reset, and wrap around with size_t. Each side
+ * keeps its own index and its last view of the other index on its own cache line, so that the two threads only share a
+ * line when one of them has to refresh its view.
+ */
+struct aal_ring {
+    /* Producer */
+    atomic_size_t head;
+    size_t cached_tail;
+    uint8_t producer_padding[AAL_RING_CACHE_LINE - sizeof(atomic_size_t) - sizeof(size_t)];
+
+    /* Consumer */
+    atomic_size_t tail;
+    size_t cached_head;
+    uint8_t consumer_padding[AAL_RING_CACHE_LINE - sizeof(atomic_size_t) - sizeof(size_t)];
+
+    /* Constant */
+    size_t capacity;  // a power of two
+    uint8_t* data;
+};
+
+aal_ring_t* aal_ring_new(size_t capacity) {
+    aal_ring_t* ring = (aal_ring_t*)calloc(1, sizeof(aal_ring_t));
+    if (!ring) return NULL;
+
+    for (ring->capacity = 1; ring->capacity < capacity; ring->capacity <<= 1) {
+    }
+    ring->data = (uint8_t*)malloc(ring->capacity);
+    if (!ring->data) {
+        free(ring);
+        return NULL;
+    }
+    aal_ring_reset(ring);
+
+    return ring;
+}
+
+void aal_ring_free(aal_ring_t* ring) {
+    if (!ring) return;
+    free(ring->data);
+    free(ring);
+}
+
+size_t aal_ring_capacity(const aal_ring_t* ring) {
+    return ring->capacity;
+}
+
+void aal_ring_reset(aal_ring_t* ring) {
+    atomic_store_explicit(&ring->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, 0, memory_order_relaxed);
+    ring->cached_tail = 0;
+    ring->cached_head = 0;
+}
+
+size_t aal_ring_bytes_used(const aal_ring_t* ring) {
+    /* The tail first, so that it is never ahead of the head */
+    size_t tail = atomic_load_explicit(&((aal_ring_t*)ring)->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&((aal_ring_t*)ring)->head, memory_order_acquire);
+
+    return head - tail;
+}
+
+size_t aal_ring_bytes_free(const aal_ring_t* ring) {
+    return ring->capacity - aal_ring_bytes_used(ring);
+}
+
+/* Producer. Returns the free space, refreshing the view of the tail if it shows less than needed. */
+static size_t aal_ring_free_space(aal_ring_t* ring, size_t head, size_t needed) {
+    size_t space = ring->capacity - (head - ring->cached_tail);
+
+    if (space < needed) {
+        /* Acquire the bytes the consumer is done with before overwriting them */
+        ring->cached_tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        space = ring->capacity - (head - ring->cached_tail);
+    }
+
+    return space;
+}
+
+/* Consumer. Returns the used space, refreshing the view of the head if it shows less than needed. */
+static size_t aal_ring_used_space(aal_ring_t* ring, size_t tail, size_t needed) {
+    size_t space = ring->cached_head - tail;
+
+    if (space < needed) {
+        /* Acquire the bytes committed by the producer before reading them */
+        ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        space = ring->cached_head - tail;
+    }
+
+    return space;
+}
+
+size_t aal_ring_reserve(aal_ring_t* ring, void** data) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t offset = head & (ring->capacity - 1);
+    size_t contiguous = ring->capacity - offset;
+    size_t space = aal_ring_free_space(ring, head, contiguous);
+
+    *data = ring->data + offset;
+    return space < contiguous ? space : contiguous;
+}
+
+void aal_ring_commit(aal_ring_t* ring, size_t size) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    atomic_store_explicit(&ring->head, head + size, memory_order_release);
+}
+
+size_t aal_ring_write(aal_ring_t* ring, const void* data, size_t size) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t space = aal_ring_free_space(ring, head, size);
+    size_t offset = head & (ring->capacity - 1);
+
+    if (size > space) size = space;
+    size_t first = ring->capacity - offset < size ? ring->capacity - offset : size;
+    memcpy(ring->data + offset, data, first);
+    memcpy(ring->data, (const uint8_t*)data + first, size - first);
+    atomic_store_explicit(&ring->head, head + size, memory_order_release);
+
+    return size;
+}
+
+size_t aal_ring_peek(aal_ring_t* ring, const void** data) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t offset = tail & (ring->capacity - 1);
+    size_t contiguous = ring->capacity - offset;
+    size_t space = aal_ring_used_space(ring, tail, contiguous);
+
+    *data = ring->data + offset;
+    return space < contiguous ? space : contiguous;
+}
+
+void aal_ring_consume(aal_ring_t* ring, size_t size) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed) + size;
+
+    /* Consuming more than the last peek, such as all the bytes used, can move the tail past the view of the head */
+    if (ring->cached_head - tail > ring->capacity) {
+        ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    }
+    atomic_store_explicit(&ring->tail, tail, memory_order_release);
+}
+
+size_t aal_ring_read(aal_ring_t* ring, void* data, size_t size) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t space = aal_ring_used_space(ring, tail, size);
+    size_t offset = tail & (ring->capacity - 1);
+
+    if (size > space) size = space;
+    size_t first = ring->capacity - offset < size ? ring->capacity - offset : size;
+    memcpy(data, ring->data + offset, first);
+    memcpy((uint8_t*)data + first, ring->data, size - first);
+    atomic_store_explicit(&ring->tail, tail + size, memory_order_release);
+
+    return size;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef __AAL_RING_H_
+#define __AAL_RING_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Lock-free byte ring for one producer thread and one consumer thread, such as aal_player_write() and the thread of a
+ * player. The producer and the consumer never wait for each other and need no lock: the producer publishes the bytes
+ * it commits with a release store of the head, and the consumer frees the bytes it consumes with a release store of
+ * the tail.
+ *
+ * reserve/commit and peek/consume give direct access to the bytes of the ring, one contiguous range at a time, and
+ * write/read copy in and out of it.
+ */
+typedef struct aal_ring aal_ring_t;
+
+/* Returns a ring of at least the given capacity in bytes, rounded up to a power of two, or NULL */
+aal_ring_t* aal_ring_new(size_t capacity);
+void aal_ring_free(aal_ring_t* ring);
+size_t aal_ring_capacity(const aal_ring_t* ring);
+
+/* Empties the ring. Neither the producer nor the consumer may use the ring at the same time. */
+void aal_ring_reset(aal_ring_t* ring);
+
+/* Any thread. The other side may change the result as soon as it is returned. */
+size_t aal_ring_bytes_used(const aal_ring_t* ring);
+size_t aal_ring_bytes_free(const aal_ring_t* ring);
+
+/* Producer. Returns the size of the contiguous free range at the head and points data to it. */
+size_t aal_ring_reserve(aal_ring_t* ring, void** data);
+/* Producer. Publishes size bytes of the range returned by aal_ring_reserve() to the consumer. */
+void aal_ring_commit(aal_ring_t* ring, size_t size);
+/* Producer. Copies up to size bytes into the ring, and returns the number of bytes copied. */
+size_t aal_ring_write(aal_ring_t* ring, const void* data, size_t size);
+
+/* Consumer. Returns the size of the contiguous used range at the tail and points data to it. */
+size_t aal_ring_peek(aal_ring_t* ring, const void** data);
+/*
+ * Consumer. Frees size bytes for the producer, from the range returned by aal_ring_peek() or up to
+ * aal_ring_bytes_used() to discard the bytes in the ring.
+ */
+void aal_ring_consume(aal_ring_t* ring, size_t size);
+/* Consumer. Copies up to size bytes out of the ring, and returns the number of bytes copied. */
+size_t aal_ring_read(aal_ring_t* ring, void* data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // __AAL_RING_H_
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef __AAL_TEST_HELPERS_H_
+#define __AAL_TEST_HELPERS_H_
+
+#include <aal.h>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <vector>
+
+/* A quiet 440 Hz tone */
+static inline std::vector<int16_t> make_tone(size_t samples, int sample_rate) {
+    std::vector<int16_t> tone(samples);
+    for (size_t i = 0; i < samples; i++) {
+        tone[i] = static_cast<int16_t>(1000 * std::sin(2 * M_PI * 440 * i / sample_rate));
+    }
+    return tone;
+}
+
+/* CPU time used by the process, in seconds */
+static inline double process_cpu_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Base of the state that a test shares with the callbacks of a player or recorder, given as their user data. T is
+ * the derived state: each static callback calls the method of T with the same name, which T defines for the
+ * callbacks it uses. The stop is recorded, to be checked or waited for.
+ */
+template <typename T>
+struct TestListener {
+    bool stopped{};
+    aal_status_t reason{AAL_UNKNOWN};
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    void on_stop(aal_status_t status) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+            reason = status;
+        }
+        cv.notify_all();
+    }
+
+    bool is_stopped() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stopped;
+    }
+
+    template <typename Rep, typename Period>
+    bool wait_stopped(std::chrono::duration<Rep, Period> timeout) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return cv.wait_for(lock, timeout, [this] { return stopped; });
+    }
+
+    static void start_callback(void* user_data) {
+        static_cast<T*>(user_data)->on_start();
+    }
+
+    static void stop_callback(aal_status_t reason, void* user_data) {
+        static_cast<T*>(user_data)->on_stop(reason);
+    }
+
+    static void data_callback(const int16_t* data, const size_t length, void* user_data) {
+        static_cast<T*>(user_data)->on_data(data, length);
+    }
+
+    static void data_requested_callback(void* user_data) {
+        static_cast<T*>(user_data)->on_data_requested();
+    }
+
+    static void enough_data_callback(void* user_data) {
+        static_cast<T*>(user_data)->on_enough_data();
+    }
+};
+
+#endif  // __AAL_TEST_HELPERS_H_
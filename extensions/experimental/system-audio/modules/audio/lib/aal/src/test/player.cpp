@@ -15,11 +15,15 @@
 
 #define G_LOG_DOMAIN "AAL"
 #include <aal.h>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <ctime>
+#include <dirent.h>
 #include <iostream>
 #include <mutex>
 #include <random>
@@ -28,6 +32,8 @@
 
 #include <gtest/gtest.h>
 
+#include "helpers.h"
+
 #define LOG(msg, ...) printf("[Player] " msg "\n", ##__VA_ARGS__)
 
 static std::string param_audio_file;
@@ -192,7 +198,8 @@ TEST(Interactive, DISABLED_Player) {
                                      .on_stop = TestCase::on_stop,
                                      .on_almost_done = nullptr,
                                      .on_data = nullptr,
-                                     .on_data_requested = TestCase::on_data_requested};
+                                     .on_data_requested = TestCase::on_data_requested,
+                                     .on_enough_data = nullptr};
 
     aal_attributes_t attr = {.name = "SampleApp",
                              .device = nullptr,
@@ -293,7 +300,8 @@ TEST(StressTest, RepeatedStops) {
                                .on_stop = TestCase::on_stop,
                                .on_almost_done = nullptr,
                                .on_data = nullptr,
-                               .on_data_requested = nullptr};
+                               .on_data_requested = nullptr,
+                               .on_enough_data = nullptr};
 
     const aal_attributes_t attr = {.name = "RepeatedStops",
                                    .device = param_device.empty() ? nullptr : param_device.c_str(),
@@ -391,4 +399,411 @@ TEST(FunctionalTest, CreateWithStream) {
         aal_handle_t player = aal_player_create(&attr, &audio_params);
         ASSERT_EQ(player, nullptr);
     }
-}
\ No newline at end of file
+}
+TEST(FunctionalTest, ResetWithStream) {
+    aal_attributes_t attr = {.name = "ResetWithStream",
+                             .device = param_device.empty() ? nullptr : param_device.c_str(),
+                             .uri = "",
+                             .listener = nullptr,
+                             .user_data = nullptr,
+                             .module_id = param_module_id};
+
+    aal_audio_parameters_t audio_params;
+    audio_params.stream_type = AAL_STREAM_LPCM;
+    audio_params.lpcm = {.sample_format = AAL_SAMPLE_FORMAT_DEFAULT, .channels = 1, .sample_rate = 16000};
+
+    aal_handle_t player = aal_player_create(&attr, &audio_params);
+    ASSERT_NE(player, nullptr);
+    if (!aal_player_reset(player, attr.uri, &audio_params)) {
+        LOG("Player reset is not supported by %s", aal_get_module_name(param_module_id));
+        aal_player_destroy(player);
+        return;
+    }
+
+    // Can change LPCM parameters
+    audio_params.lpcm.channels = 2;
+    audio_params.lpcm.sample_rate = 48000;
+    EXPECT_TRUE(aal_player_reset(player, attr.uri, &audio_params));
+
+    // Cannot reset with non-LPCM stream
+    audio_params.stream_type = AAL_STREAM_UNKNOWN;
+    EXPECT_FALSE(aal_player_reset(player, attr.uri, &audio_params));
+
+    // Cannot reset file with audio parameters
+    audio_params.stream_type = AAL_STREAM_LPCM;
+    if (!param_audio_file.empty()) {
+        EXPECT_FALSE(aal_player_reset(player, param_audio_file.c_str(), &audio_params));
+        EXPECT_TRUE(aal_player_reset(player, param_audio_file.c_str(), nullptr));
+    }
+
+    aal_player_destroy(player);
+}
+
+// Returns the number of threads of this process, or -1 if it is not available
+static int count_threads() {
+    DIR* dir = opendir("/proc/self/task");
+    if (!dir) return -1;
+    int count = 0;
+    while (struct dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') count++;
+    }
+    closedir(dir);
+    return count;
+}
+
+TEST(FunctionalTest, ThreadsDoNotScaleWithPlayers) {
+    const int PLAYER_COUNT = 10;
+    aal_attributes_t attr = {.name = "ThreadsDoNotScaleWithPlayers",
+                             .device = param_device.empty() ? nullptr : param_device.c_str(),
+                             .uri = "",
+                             .listener = nullptr,
+                             .user_data = nullptr,
+                             .module_id = param_module_id};
+
+    aal_handle_t first = aal_player_create(&attr, nullptr);
+    ASSERT_NE(first, nullptr);
+    int threads = count_threads();
+    if (threads < 0) {
+        LOG("Thread count is not available");
+        aal_player_destroy(first);
+        return;
+    }
+
+    std::vector<aal_handle_t> players;
+    for (int i = 1; i < PLAYER_COUNT; i++) {
+        aal_handle_t player = aal_player_create(&attr, nullptr);
+        ASSERT_NE(player, nullptr);
+        players.push_back(player);
+    }
+    int added_threads = count_threads() - threads;
+    LOG("%d threads added by %d players", added_threads, PLAYER_COUNT - 1);
+    EXPECT_LT(added_threads, PLAYER_COUNT - 1) << "Idle players should share their worker threads";
+
+    for (auto player : players) {
+        aal_player_destroy(player);
+    }
+    aal_player_destroy(first);
+}
+
+TEST(Benchmark, PrepareToFirstSample) {
+    struct TestCase : TestListener<TestCase> {
+        bool requested{};
+
+        void reset() {
+            std::lock_guard<std::mutex> lock(mutex);
+            requested = false;
+            stopped = false;
+        }
+
+        void on_data_requested() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                requested = true;
+            }
+            cv.notify_all();
+        }
+
+        bool wait_requested(std::chrono::seconds timeout) {
+            std::unique_lock<std::mutex> lock(mutex);
+            return cv.wait_for(lock, timeout, [this] { return requested; });
+        }
+    } t;
+
+    aal_listener_t listener = {.on_start = nullptr,
+                               .on_stop = TestCase::stop_callback,
+                               .on_almost_done = nullptr,
+                               .on_data = nullptr,
+                               .on_data_requested = TestCase::data_requested_callback,
+                               .on_enough_data = nullptr};
+
+    const aal_attributes_t attr = {.name = "PrepareToFirstSample",
+                                   .device = param_device.empty() ? nullptr : param_device.c_str(),
+                                   .uri = "",
+                                   .listener = &listener,
+                                   .user_data = &t,
+                                   .module_id = param_module_id};
+
+    aal_audio_parameters_t audio_params;
+    audio_params.stream_type = AAL_STREAM_LPCM;
+    audio_params.lpcm = {.sample_format = AAL_SAMPLE_FORMAT_DEFAULT, .channels = 1, .sample_rate = 16000};
+
+    // Measures the time from preparing a player until its source requests the first sample
+    auto measure = [&](bool reuse) {
+        aal_handle_t player = reuse ? aal_player_create(&attr, &audio_params) : nullptr;
+        std::chrono::microseconds total(0);
+        int completed = 0;
+        for (; completed < param_iterations; ++completed) {
+            t.reset();
+            auto start = std::chrono::steady_clock::now();
+            if (reuse) {
+                if (!player || !aal_player_reset(player, attr.uri, &audio_params)) break;
+            } else {
+                player = aal_player_create(&attr, &audio_params);
+                if (!player) break;
+            }
+            aal_player_play(player);
+            bool requested = t.wait_requested(std::chrono::seconds(5));
+            auto elapsed = std::chrono::steady_clock::now() - start;
+
+            // End the stream without writing data, so the player stops by itself before the next iteration
+            aal_player_notify_end_of_stream(player);
+            bool stopped = t.wait_stopped(std::chrono::seconds(5));
+            if (!reuse) {
+                aal_player_destroy(player);
+                player = nullptr;
+            }
+            if (!requested || !stopped) break;
+            total += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
+        }
+        if (player) aal_player_destroy(player);
+        return completed > 0 ? total.count() / completed : -1;
+    };
+
+    auto create_us = measure(false);
+    ASSERT_GT(create_us, 0) << "First sample was not requested from a new player";
+    LOG("Create per prepare: %lld us to first sample", (long long)create_us);
+    RecordProperty("createMicroseconds", (int)create_us);
+
+    auto reset_us = measure(true);
+    if (reset_us < 0) {
+        LOG("Player reset is not supported by %s", aal_get_module_name(param_module_id));
+        return;
+    }
+    LOG("Reset per prepare: %lld us to first sample", (long long)reset_us);
+    RecordProperty("resetMicroseconds", (int)reset_us);
+}
+
+/*
+ * Measures the data requests of a player, with a client that writes only between on_data_requested and on_enough_data.
+ * Only the module side of the requests is covered: the engine code that answers them is not part of AAL.
+ */
+TEST(Benchmark, DataRequests) {
+    const int SAMPLE_RATE = 16000;
+    const int DURATION_SECONDS = 3;
+    static const size_t CHUNK_SIZE = 4096;
+
+    struct TestCase : TestListener<TestCase> {
+        aal_handle_t handle{};
+        std::vector<char> stream;
+        size_t offset{};
+        bool requested{};
+        bool started{};
+        int requests{};
+        std::chrono::steady_clock::time_point started_at;
+
+        void streaming_loop() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (!stopped && offset < stream.size()) {
+                cv.wait(lock, [this] { return stopped || requested; });
+                if (stopped) break;
+                requests++;
+                while (requested && offset < stream.size()) {
+                    size_t size = std::min(CHUNK_SIZE, stream.size() - offset);
+                    lock.unlock();
+                    ssize_t written = aal_player_write(handle, stream.data() + offset, size);
+                    lock.lock();
+                    if (written <= 0) {
+                        // the player is full, wait for the next request
+                        requested = false;
+                        break;
+                    }
+                    offset += written;
+                }
+            }
+            lock.unlock();
+            aal_player_notify_end_of_stream(handle);
+        }
+
+        void set_requested(bool value) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                requested = value;
+            }
+            cv.notify_all();
+        }
+
+        void on_start() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!started) started_at = std::chrono::steady_clock::now();
+                started = true;
+            }
+            cv.notify_all();
+        }
+
+        void on_data_requested() {
+            set_requested(true);
+        }
+
+        void on_enough_data() {
+            set_requested(false);
+        }
+    } t;
+
+    auto tone = make_tone(SAMPLE_RATE * DURATION_SECONDS, SAMPLE_RATE);
+    auto bytes = reinterpret_cast<const char*>(tone.data());
+    t.stream.assign(bytes, bytes + tone.size() * sizeof(int16_t));
+
+    aal_listener_t listener = {.on_start = TestCase::start_callback,
+                               .on_stop = TestCase::stop_callback,
+                               .on_almost_done = nullptr,
+                               .on_data = nullptr,
+                               .on_data_requested = TestCase::data_requested_callback,
+                               .on_enough_data = TestCase::enough_data_callback};
+
+    const aal_attributes_t attr = {.name = "DataRequests",
+                                   .device = param_device.empty() ? nullptr : param_device.c_str(),
+                                   .uri = "",
+                                   .listener = &listener,
+                                   .user_data = &t,
+                                   .module_id = param_module_id};
+
+    aal_audio_parameters_t audio_params;
+    audio_params.stream_type = AAL_STREAM_LPCM;
+    audio_params.lpcm = {.sample_format = AAL_SAMPLE_FORMAT_DEFAULT, .channels = 1, .sample_rate = SAMPLE_RATE};
+
+    t.handle = aal_player_create(&attr, &audio_params);
+    ASSERT_NE(t.handle, nullptr);
+
+    std::thread streaming_thread(&TestCase::streaming_loop, &t);
+    auto start = std::chrono::steady_clock::now();
+    aal_player_play(t.handle);
+    bool stopped = t.wait_stopped(std::chrono::seconds(DURATION_SECONDS * 3));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    t.on_stop(AAL_UNKNOWN);  // ends the streaming thread if playback did not complete
+    streaming_thread.join();
+    aal_player_destroy(t.handle);
+
+    ASSERT_TRUE(stopped) << "Playback did not complete";
+    ASSERT_TRUE(t.started) << "Playback did not start";
+    auto first_audio_ms = std::chrono::duration_cast<std::chrono::milliseconds>(t.started_at - start).count();
+    double seconds = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() / 1000.0;
+    LOG("Time to first audio: %lld ms", (long long)first_audio_ms);
+    LOG("Data requests: %d in %.2f s (%.1f per second)", t.requests, seconds, t.requests / seconds);
+    RecordProperty("timeToFirstAudioMilliseconds", (int)first_audio_ms);
+    RecordProperty("dataRequests", t.requests);
+}
+
+TEST(Benchmark, PlaybackLatencyAndCpu) {
+    const int SAMPLE_RATE = 16000;
+    const int DURATION_SECONDS = 3;
+    const size_t CHUNK_SIZE = 4096;
+
+    struct TestCase : TestListener<TestCase> {
+    } t;
+
+    auto samples = make_tone(SAMPLE_RATE * DURATION_SECONDS, SAMPLE_RATE);
+    auto stream = reinterpret_cast<const char*>(samples.data());
+    size_t stream_size = samples.size() * sizeof(int16_t);
+
+    aal_listener_t listener = {.on_start = nullptr,
+                               .on_stop = TestCase::stop_callback,
+                               .on_almost_done = nullptr,
+                               .on_data = nullptr,
+                               .on_data_requested = nullptr,
+                               .on_enough_data = nullptr};
+
+    const aal_attributes_t attr = {.name = "PlaybackLatencyAndCpu",
+                                   .device = param_device.empty() ? nullptr : param_device.c_str(),
+                                   .uri = "",
+                                   .listener = &listener,
+                                   .user_data = &t,
+                                   .module_id = param_module_id};
+
+    aal_audio_parameters_t audio_params;
+    audio_params.stream_type = AAL_STREAM_LPCM;
+    audio_params.lpcm = {.sample_format = AAL_SAMPLE_FORMAT_DEFAULT, .channels = 1, .sample_rate = SAMPLE_RATE};
+
+    auto handle = aal_player_create(&attr, &audio_params);
+    ASSERT_NE(handle, nullptr);
+
+    // Write the stream as fast as the player accepts it, and poll the position to find when audio is output
+    size_t offset = 0;
+    int64_t latency_us = -1;
+    auto start = std::chrono::steady_clock::now();
+    auto cpu_start = process_cpu_seconds();
+    aal_player_play(handle);
+    while (!t.wait_stopped(std::chrono::milliseconds(2))) {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        if (offset < stream_size) {
+            ssize_t written = aal_player_write(handle, stream + offset, std::min(CHUNK_SIZE, stream_size - offset));
+            if (written > 0) {
+                offset += written;
+                if (offset == stream_size) aal_player_notify_end_of_stream(handle);
+            }
+        }
+        if (latency_us < 0 && aal_player_get_position(handle) > 0) {
+            latency_us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        }
+        if (elapsed > std::chrono::seconds(DURATION_SECONDS * 3)) break;
+    }
+    double seconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start)
+                         .count() /
+                     1000.0;
+    double cpu_seconds = process_cpu_seconds() - cpu_start;
+    bool stopped = t.is_stopped();
+    if (!stopped) aal_player_stop(handle);
+    aal_player_destroy(handle);
+
+    ASSERT_TRUE(stopped) << "Playback did not complete";
+    LOG("%s: %lld us to audio output", aal_get_module_name(param_module_id), (long long)latency_us);
+    LOG("%s: %.1f%% CPU over %.2f s", aal_get_module_name(param_module_id), cpu_seconds * 100 / seconds, seconds);
+    RecordProperty("latencyMicroseconds", (int)latency_us);
+    RecordProperty("cpuPermille", (int)(cpu_seconds * 1000 / seconds));
+}
+
+TEST(Benchmark, CaptureLatencyAndCpu) {
+    const int DURATION_SECONDS = 3;
+
+    struct TestCase : TestListener<TestCase> {
+        size_t samples{};
+        std::chrono::steady_clock::time_point first_data;
+
+        void on_data(const int16_t* data, size_t length) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (samples == 0) first_data = std::chrono::steady_clock::now();
+            samples += length;
+        }
+    } t;
+
+    aal_listener_t listener = {.on_start = nullptr,
+                               .on_stop = TestCase::stop_callback,
+                               .on_almost_done = nullptr,
+                               .on_data = TestCase::data_callback,
+                               .on_data_requested = nullptr,
+                               .on_enough_data = nullptr};
+
+    const aal_attributes_t attr = {.name = "CaptureLatencyAndCpu",
+                                   .device = param_device.empty() ? nullptr : param_device.c_str(),
+                                   .uri = nullptr,
+                                   .listener = &listener,
+                                   .user_data = &t,
+                                   .module_id = param_module_id};
+
+    auto handle = aal_recorder_create(&attr, nullptr);
+    if (!handle) {
+        LOG("Recorder is not supported by %s", aal_get_module_name(param_module_id));
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto cpu_start = process_cpu_seconds();
+    aal_recorder_play(handle);
+    std::this_thread::sleep_for(std::chrono::seconds(DURATION_SECONDS));
+    aal_recorder_stop(handle);
+    bool stopped = t.wait_stopped(std::chrono::seconds(DURATION_SECONDS));
+    double seconds =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count() /
+        1000.0;
+    double cpu_seconds = process_cpu_seconds() - cpu_start;
+    aal_recorder_destroy(handle);
+
+    ASSERT_TRUE(stopped) << "Recorder did not stop";
+    ASSERT_GT(t.samples, 0u) << "No audio captured";
+    auto latency_us = std::chrono::duration_cast<std::chrono::microseconds>(t.first_data - start).count();
+    LOG("%s: %lld us to first captured audio", aal_get_module_name(param_module_id), (long long)latency_us);
+    LOG("%s: %zu samples captured in %.2f s", aal_get_module_name(param_module_id), t.samples, seconds);
+    LOG("%s: %.1f%% CPU over %.2f s", aal_get_module_name(param_module_id), cpu_seconds * 100 / seconds, seconds);
+    RecordProperty("latencyMicroseconds", (int)latency_us);
+    RecordProperty("cpuPermille", (int)(cpu_seconds * 1000 / seconds));
+}
@@ -66,7 +66,8 @@ static const aal_listener_t listener = {.on_start = on_start_callback,
                                         .on_stop = on_stop_callback,
                                         .on_almost_done = NULL,
                                         .on_data = on_data_callback,
-                                        .on_data_requested = NULL};
+                                        .on_data_requested = NULL,
+                                        .on_enough_data = NULL};
 
 static void signal_handler(int signo) {
     printf("Call aal_recorder_stop...\n");
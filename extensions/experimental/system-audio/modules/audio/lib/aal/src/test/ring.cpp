@@ -0,0 +1,241 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <ring.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define LOG(msg, ...) printf("[Ring] " msg "\n", ##__VA_ARGS__)
+
+/* ringbuf_locked.c */
+extern "C" {
+void* ringbuf_locked_new(size_t capacity);
+void ringbuf_locked_free(void* handle);
+size_t ringbuf_locked_write(void* handle, const void* data, size_t size);
+size_t ringbuf_locked_read(void* handle, void* data, size_t size);
+}
+
+/* The byte at a position of the stream, with a period that does not divide the capacity of the ring */
+static uint8_t stream_byte(size_t position) {
+    return static_cast<uint8_t>(position % 251);
+}
+
+TEST(Ring, CapacityIsRoundedUp) {
+    aal_ring_t* ring = aal_ring_new(3000);
+    ASSERT_NE(ring, nullptr);
+    EXPECT_EQ(aal_ring_capacity(ring), 4096u);
+    EXPECT_EQ(aal_ring_bytes_used(ring), 0u);
+    EXPECT_EQ(aal_ring_bytes_free(ring), 4096u);
+    aal_ring_free(ring);
+}
+
+TEST(Ring, WriteAndReadWrapAround) {
+    aal_ring_t* ring = aal_ring_new(16);
+    uint8_t in[16], out[16];
+    for (size_t i = 0; i < sizeof(in); i++) in[i] = stream_byte(i);
+
+    EXPECT_EQ(aal_ring_write(ring, in, 12), 12u);
+    EXPECT_EQ(aal_ring_read(ring, out, 10), 10u);
+    EXPECT_EQ(memcmp(in, out, 10), 0);
+
+    /* Wraps around the end, and only the free space is written */
+    EXPECT_EQ(aal_ring_write(ring, in, 16), 14u);
+    EXPECT_EQ(aal_ring_bytes_used(ring), 16u);
+    EXPECT_EQ(aal_ring_write(ring, in, 1), 0u);
+
+    EXPECT_EQ(aal_ring_read(ring, out, 16), 16u);
+    EXPECT_EQ(memcmp(out, in + 10, 2), 0);
+    EXPECT_EQ(memcmp(out + 2, in, 14), 0);
+    EXPECT_EQ(aal_ring_read(ring, out, 1), 0u);
+
+    aal_ring_free(ring);
+}
+
+TEST(Ring, ReserveAndPeekAreContiguous) {
+    aal_ring_t* ring = aal_ring_new(16);
+    void* reserved;
+    const void* peeked;
+
+    /* Move the head and the tail close to the end */
+    uint8_t scratch[12] = {};
+    aal_ring_write(ring, scratch, sizeof(scratch));
+    aal_ring_read(ring, scratch, sizeof(scratch));
+
+    /* Only the range up to the end is contiguous */
+    ASSERT_EQ(aal_ring_reserve(ring, &reserved), 4u);
+    memset(reserved, 0xaa, 4);
+    aal_ring_commit(ring, 4);
+    ASSERT_EQ(aal_ring_reserve(ring, &reserved), 12u);
+    memset(reserved, 0xbb, 2);
+    aal_ring_commit(ring, 2);
+    EXPECT_EQ(aal_ring_bytes_used(ring), 6u);
+
+    ASSERT_EQ(aal_ring_peek(ring, &peeked), 4u);
+    EXPECT_EQ(static_cast<const uint8_t*>(peeked)[3], 0xaa);
+    aal_ring_consume(ring, 4);
+    ASSERT_EQ(aal_ring_peek(ring, &peeked), 2u);
+    EXPECT_EQ(static_cast<const uint8_t*>(peeked)[0], 0xbb);
+    aal_ring_consume(ring, 2);
+    EXPECT_EQ(aal_ring_peek(ring, &peeked), 0u);
+
+    aal_ring_write(ring, scratch, 5);
+    aal_ring_reset(ring);
+    EXPECT_EQ(aal_ring_bytes_used(ring), 0u);
+    EXPECT_EQ(aal_ring_reserve(ring, &reserved), 16u);
+
+    aal_ring_free(ring);
+}
+
+TEST(Ring, ConsumeAllBytesUsed) {
+    aal_ring_t* ring = aal_ring_new(16);
+    uint8_t in[16], out[16];
+    const void* peeked;
+    for (size_t i = 0; i < sizeof(in); i++) in[i] = stream_byte(i);
+
+    /* The consumer views 8 bytes, and then discards them with the 4 bytes written since */
+    aal_ring_write(ring, in, 8);
+    ASSERT_EQ(aal_ring_peek(ring, &peeked), 8u);
+    aal_ring_write(ring, in, 4);
+    aal_ring_consume(ring, aal_ring_bytes_used(ring));
+    EXPECT_EQ(aal_ring_bytes_used(ring), 0u);
+    EXPECT_EQ(aal_ring_peek(ring, &peeked), 0u);
+
+    /* Only the bytes written after the discard are read */
+    aal_ring_write(ring, in + 4, 4);
+    EXPECT_EQ(aal_ring_read(ring, out, sizeof(out)), 4u);
+    EXPECT_EQ(memcmp(out, in + 4, 4), 0);
+
+    aal_ring_free(ring);
+}
+
+/*
+ * A producer and a consumer stream bytes through a small ring in random sizes, with both the zero-copy and the copy
+ * interfaces, and the consumer checks every byte. Run with ThreadSanitizer to check the ordering of the ring.
+ */
+TEST(StressTest, ProducerAndConsumer) {
+    const size_t total = 64 * 1024 * 1024;
+    aal_ring_t* ring = aal_ring_new(4096);
+    bool corrupted = false;
+
+    std::thread producer([&] {
+        std::mt19937 random(1);
+        std::vector<uint8_t> chunk(1024);
+        for (size_t position = 0; position < total;) {
+            size_t size = std::min<size_t>(random() % chunk.size() + 1, total - position);
+            if (random() % 2) {
+                void* data;
+                size = std::min(size, aal_ring_reserve(ring, &data));
+                for (size_t i = 0; i < size; i++) static_cast<uint8_t*>(data)[i] = stream_byte(position + i);
+                aal_ring_commit(ring, size);
+            } else {
+                for (size_t i = 0; i < size; i++) chunk[i] = stream_byte(position + i);
+                size = aal_ring_write(ring, chunk.data(), size);
+            }
+            position += size;
+            if (size == 0) std::this_thread::yield();
+        }
+    });
+
+    std::mt19937 random(2);
+    std::vector<uint8_t> chunk(1024);
+    for (size_t position = 0; position < total && !corrupted;) {
+        size_t size;
+        const uint8_t* data;
+        if (random() % 2) {
+            const void* peeked;
+            size = std::min<size_t>(random() % chunk.size() + 1, aal_ring_peek(ring, &peeked));
+            data = static_cast<const uint8_t*>(peeked);
+        } else {
+            size = aal_ring_read(ring, chunk.data(), random() % chunk.size() + 1);
+            data = chunk.data();
+        }
+        for (size_t i = 0; i < size; i++) {
+            if (data[i] != stream_byte(position + i)) {
+                LOG("Unexpected byte at %zu", position + i);
+                corrupted = true;
+                break;
+            }
+        }
+        if (data != chunk.data()) aal_ring_consume(ring, size);
+        position += size;
+        if (size == 0) std::this_thread::yield();
+    }
+
+    producer.join();
+    EXPECT_FALSE(corrupted);
+    EXPECT_EQ(aal_ring_bytes_used(ring), 0u);
+    aal_ring_free(ring);
+}
+
+/*
+ * Streams the same amount of audio through the ring and through c-ringbuf, which the modules had to lock around, in
+ * the chunk sizes of the engine writes and of the device periods.
+ */
+TEST(Benchmark, Throughput) {
+    const size_t total = 256 * 1024 * 1024;
+    const size_t write_size = 4096;
+    const size_t period_size = 640;
+    const size_t capacity = 32768;
+
+    using Write = std::function<size_t(const uint8_t*, size_t)>;
+    using Read = std::function<size_t(uint8_t*, size_t)>;
+
+    auto stream = [&](Write write, Read read) {
+        auto start = std::chrono::steady_clock::now();
+        std::thread producer([&] {
+            std::vector<uint8_t> chunk(write_size, 1);
+            for (size_t position = 0; position < total;) {
+                size_t size = write(chunk.data(), std::min(write_size, total - position));
+                position += size;
+                if (size == 0) std::this_thread::yield();
+            }
+        });
+        std::vector<uint8_t> period(period_size);
+        for (size_t position = 0; position < total;) {
+            size_t size = read(period.data(), period_size);
+            position += size;
+            if (size == 0) std::this_thread::yield();
+        }
+        producer.join();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    aal_ring_t* ring = aal_ring_new(capacity);
+    double ring_seconds = stream(
+        [&](const uint8_t* data, size_t size) {
+            /* All or nothing, like aal_player_write() */
+            return aal_ring_bytes_free(ring) < size ? 0 : aal_ring_write(ring, data, size);
+        },
+        [&](uint8_t* data, size_t size) { return aal_ring_read(ring, data, size); });
+    aal_ring_free(ring);
+
+    void* ringbuf = ringbuf_locked_new(capacity);
+    double ringbuf_seconds = stream(
+        [&](const uint8_t* data, size_t size) { return ringbuf_locked_write(ringbuf, data, size); },
+        [&](uint8_t* data, size_t size) { return ringbuf_locked_read(ringbuf, data, size); });
+    ringbuf_locked_free(ringbuf);
+
+    LOG("aal_ring: %.0f MB/s", total / ring_seconds / 1e6);
+    LOG("c-ringbuf with a mutex: %.0f MB/s", total / ringbuf_seconds / 1e6);
+}
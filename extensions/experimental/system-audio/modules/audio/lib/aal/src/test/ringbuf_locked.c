@@ -0,0 +1,69 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * c-ringbuf behind a mutex, as the modules used it before aal_ring, for the benchmark of the ring test. ringbuf.h does
+ * not compile as C++.
+ */
+
+#include <pthread.h>
+#include <ringbuf.h>
+#include <stdlib.h>
+
+typedef struct {
+    ringbuf_t ringbuf;
+    pthread_mutex_t lock;
+} ringbuf_locked_t;
+
+void* ringbuf_locked_new(size_t capacity) {
+    ringbuf_locked_t* locked = (ringbuf_locked_t*)malloc(sizeof(ringbuf_locked_t));
+    locked->ringbuf = ringbuf_new(capacity);
+    pthread_mutex_init(&locked->lock, NULL);
+    return locked;
+}
+
+void ringbuf_locked_free(void* handle) {
+    ringbuf_locked_t* locked = (ringbuf_locked_t*)handle;
+    ringbuf_free(&locked->ringbuf);
+    pthread_mutex_destroy(&locked->lock);
+    free(locked);
+}
+
+/* All or nothing, like aal_player_write() */
+size_t ringbuf_locked_write(void* handle, const void* data, size_t size) {
+    ringbuf_locked_t* locked = (ringbuf_locked_t*)handle;
+
+    pthread_mutex_lock(&locked->lock);
+    if (ringbuf_bytes_free(locked->ringbuf) < size) {
+        size = 0;
+    } else {
+        ringbuf_memcpy_into(locked->ringbuf, data, size);
+    }
+    pthread_mutex_unlock(&locked->lock);
+
+    return size;
+}
+
+size_t ringbuf_locked_read(void* handle, void* data, size_t size) {
+    ringbuf_locked_t* locked = (ringbuf_locked_t*)handle;
+
+    pthread_mutex_lock(&locked->lock);
+    size_t used = ringbuf_bytes_used(locked->ringbuf);
+    if (size > used) size = used;
+    if (size > 0) ringbuf_memcpy_from(data, locked->ringbuf, size);
+    pthread_mutex_unlock(&locked->lock);
+
+    return size;
+}
@@ -0,0 +1,358 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <aal.h>
+#include <aal_virtual.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "helpers.h"
+
+#define LOG(msg, ...) printf("[Virtual] " msg "\n", ##__VA_ARGS__)
+
+static const int SAMPLE_RATE = 16000;
+static const int64_t PERIOD_US = 10000;
+
+static int param_module_id = -1;
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+
+    int modules = aal_get_module_count();
+    for (int i = 0; i < modules; i++) {
+        if (std::string(aal_get_module_name(i)) == "Virtual") {
+            param_module_id = i;
+            break;
+        }
+    }
+
+    if (param_module_id < 0 || !aal_initialize(param_module_id)) {
+        LOG("Virtual module is not available");
+        return EXIT_FAILURE;
+    }
+
+    auto test_result = RUN_ALL_TESTS();
+
+    aal_deinitialize(param_module_id);
+
+    return test_result;
+}
+
+/* Streams a source to a player from on_data_requested */
+struct Stream : TestListener<Stream> {
+    aal_handle_t handle{};
+    std::vector<int16_t> source;
+    size_t offset{};     // samples written
+    size_t limit{};      // samples to write before the stream starves
+    size_t chunk{1024};  // samples per write
+
+    void write() {
+        std::lock_guard<std::mutex> lock(mutex);
+        while (offset < limit) {
+            size_t count = std::min(chunk, limit - offset);
+            if (aal_player_write(handle, reinterpret_cast<const char*>(&source[offset]), count * 2) <= 0) break;
+            offset += count;
+        }
+        if (offset == source.size()) aal_player_notify_end_of_stream(handle);
+    }
+
+    void on_data_requested() {
+        write();
+    }
+};
+
+static const aal_listener_t stream_listener = {.on_start = nullptr,
+                                               .on_stop = Stream::stop_callback,
+                                               .on_almost_done = nullptr,
+                                               .on_data = nullptr,
+                                               .on_data_requested = Stream::data_requested_callback,
+                                               .on_enough_data = nullptr};
+
+static aal_handle_t create_player(Stream& stream, const char* device) {
+    const aal_attributes_t attr = {.name = "VirtualPlayer",
+                                   .device = device,
+                                   .uri = "",
+                                   .listener = &stream_listener,
+                                   .user_data = &stream,
+                                   .module_id = param_module_id};
+
+    aal_audio_parameters_t audio_params;
+    audio_params.stream_type = AAL_STREAM_LPCM;
+    audio_params.lpcm = {.sample_format = AAL_SAMPLE_FORMAT_DEFAULT, .channels = 1, .sample_rate = SAMPLE_RATE};
+
+    stream.handle = aal_player_create(&attr, &audio_params);
+    return stream.handle;
+}
+
+/* Captures into a vector */
+struct Capture : TestListener<Capture> {
+    std::vector<int16_t> samples;
+
+    void on_data(const int16_t* data, size_t length) {
+        std::lock_guard<std::mutex> lock(mutex);
+        samples.insert(samples.end(), data, data + length);
+    }
+};
+
+static const aal_listener_t capture_listener = {.on_start = nullptr,
+                                                .on_stop = Capture::stop_callback,
+                                                .on_almost_done = nullptr,
+                                                .on_data = Capture::data_callback,
+                                                .on_data_requested = nullptr,
+                                                .on_enough_data = nullptr};
+
+static aal_handle_t create_recorder(Capture& capture, const char* device) {
+    const aal_attributes_t attr = {.name = "VirtualRecorder",
+                                   .device = device,
+                                   .uri = nullptr,
+                                   .listener = &capture_listener,
+                                   .user_data = &capture,
+                                   .module_id = param_module_id};
+
+    return aal_recorder_create(&attr, nullptr);
+}
+
+class SteppedClock : public ::testing::Test {
+protected:
+    void SetUp() override {
+        aal_virtual_set_clock(AAL_VIRTUAL_CLOCK_STEPPED, 1.0);
+    }
+
+    void TearDown() override {
+        aal_virtual_set_clock(AAL_VIRTUAL_CLOCK_REALTIME, 1.0);
+    }
+
+    /* Advances the clock by periods until the predicate holds */
+    template <typename Predicate>
+    bool advance_until(Predicate predicate, int max_periods = 1000) {
+        for (int i = 0; i < max_periods && !predicate(); i++) {
+            aal_virtual_clock_advance(PERIOD_US);
+        }
+        return predicate();
+    }
+};
+
+TEST_F(SteppedClock, PlayerToMemory) {
+    std::vector<int16_t> output(SAMPLE_RATE);
+    aal_virtual_buffer_t buffer = {.data = output.data(), .capacity = output.size(), .length = 0};
+    ASSERT_TRUE(aal_virtual_register_buffer("playback", &buffer));
+
+    Stream stream;
+    stream.source = make_tone(SAMPLE_RATE / 2, SAMPLE_RATE);
+    stream.limit = stream.source.size();
+    ASSERT_NE(create_player(stream, "mem:playback"), nullptr);
+
+    int64_t start = aal_virtual_clock_now();
+    aal_player_play(stream.handle);
+    ASSERT_TRUE(advance_until([&] { return stream.is_stopped(); }));
+
+    aal_virtual_stats_t stats;
+    ASSERT_TRUE(aal_virtual_get_stats(stream.handle, &stats));
+    aal_player_destroy(stream.handle);
+    aal_virtual_unregister_buffer("playback");
+
+    EXPECT_EQ(stream.reason, AAL_SUCCESS);
+    EXPECT_EQ(stats.start_time, start);
+    EXPECT_EQ(stats.first_sample_time, start + PERIOD_US);
+    EXPECT_EQ(stats.stop_time, start + 500000);
+    EXPECT_EQ(stats.underruns, 0);
+    EXPECT_EQ(stats.frames, SAMPLE_RATE / 2);
+    ASSERT_EQ(buffer.length, stream.source.size());
+    EXPECT_TRUE(std::equal(stream.source.begin(), stream.source.end(), output.begin()));
+}
+
+TEST_F(SteppedClock, PlayerUnderrun) {
+    Stream stream;
+    stream.source = make_tone(SAMPLE_RATE, SAMPLE_RATE);
+    stream.limit = SAMPLE_RATE / 10;  // 100 ms, then the stream starves
+    ASSERT_NE(create_player(stream, nullptr), nullptr);
+
+    int64_t start = aal_virtual_clock_now();
+    aal_player_play(stream.handle);
+    for (int i = 0; i < 20; i++) aal_virtual_clock_advance(PERIOD_US);
+
+    aal_virtual_stats_t stats;
+    ASSERT_TRUE(aal_virtual_get_stats(stream.handle, &stats));
+    EXPECT_EQ(stats.underruns, 1);
+    EXPECT_EQ(stats.last_underrun_time, start + 11 * PERIOD_US);
+    EXPECT_EQ(stats.frames, SAMPLE_RATE / 10);
+    EXPECT_FALSE(stream.is_stopped());
+
+    aal_player_stop(stream.handle);
+    EXPECT_TRUE(stream.is_stopped());
+    EXPECT_EQ(stream.reason, AAL_UNKNOWN);
+    aal_player_destroy(stream.handle);
+}
+
+TEST_F(SteppedClock, RecorderFromMemory) {
+    std::vector<int16_t> source = make_tone(SAMPLE_RATE / 4, SAMPLE_RATE);
+    aal_virtual_buffer_t buffer = {.data = source.data(), .capacity = source.size(), .length = source.size()};
+    ASSERT_TRUE(aal_virtual_register_buffer("utterance", &buffer));
+
+    Capture capture;
+    auto handle = create_recorder(capture, "mem:utterance");
+    ASSERT_NE(handle, nullptr);
+
+    int64_t start = aal_virtual_clock_now();
+    aal_recorder_play(handle);
+    aal_virtual_clock_advance(PERIOD_US);
+    {
+        std::lock_guard<std::mutex> lock(capture.mutex);
+        EXPECT_EQ(capture.samples.size(), static_cast<size_t>(SAMPLE_RATE * PERIOD_US / 1000000));
+    }
+    ASSERT_TRUE(advance_until([&] { return capture.is_stopped(); }));
+
+    aal_virtual_stats_t stats;
+    ASSERT_TRUE(aal_virtual_get_stats(handle, &stats));
+    aal_recorder_destroy(handle);
+    aal_virtual_unregister_buffer("utterance");
+
+    EXPECT_EQ(capture.reason, AAL_SUCCESS);
+    EXPECT_EQ(stats.first_sample_time, start + PERIOD_US);
+    EXPECT_EQ(stats.stop_time, start + 250000);
+    EXPECT_EQ(capture.samples, source);
+}
+
+TEST_F(SteppedClock, WavRoundTrip) {
+    char path[] = "/tmp/aal-virtual-XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    std::string device = std::string("wav:") + path;
+
+    Stream stream;
+    stream.source = make_tone(SAMPLE_RATE / 5, SAMPLE_RATE);
+    stream.limit = stream.source.size();
+    ASSERT_NE(create_player(stream, device.c_str()), nullptr);
+    aal_player_play(stream.handle);
+    ASSERT_TRUE(advance_until([&] { return stream.is_stopped(); }));
+    aal_player_destroy(stream.handle);
+
+    Capture capture;
+    auto handle = create_recorder(capture, device.c_str());
+    ASSERT_NE(handle, nullptr);
+    aal_recorder_play(handle);
+    ASSERT_TRUE(advance_until([&] { return capture.is_stopped(); }));
+    aal_recorder_destroy(handle);
+    remove(path);
+
+    EXPECT_EQ(capture.samples, stream.source);
+}
+
+TEST_F(SteppedClock, Events) {
+    struct Event {
+        std::string name;
+        aal_virtual_event_t event;
+        int64_t time;
+    };
+    std::vector<Event> events;
+    aal_virtual_set_event_func(
+        [](const char* name, aal_virtual_event_t event, int64_t time, void* user_data) {
+            reinterpret_cast<std::vector<Event>*>(user_data)->push_back({name, event, time});
+        },
+        &events);
+
+    Stream stream;
+    stream.source = make_tone(SAMPLE_RATE / 10, SAMPLE_RATE);
+    stream.limit = stream.source.size();
+    ASSERT_NE(create_player(stream, "null"), nullptr);
+    int64_t start = aal_virtual_clock_now();
+    aal_player_play(stream.handle);
+    ASSERT_TRUE(advance_until([&] { return stream.is_stopped(); }));
+    aal_player_destroy(stream.handle);
+    aal_virtual_set_event_func(nullptr, nullptr);
+
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events[0].name, "VirtualPlayer");
+    EXPECT_EQ(events[0].event, AAL_VIRTUAL_EVENT_START);
+    EXPECT_EQ(events[0].time, start);
+    EXPECT_EQ(events[1].event, AAL_VIRTUAL_EVENT_FIRST_SAMPLE);
+    EXPECT_EQ(events[1].time, start + PERIOD_US);
+    EXPECT_EQ(events[2].event, AAL_VIRTUAL_EVENT_STOP);
+    EXPECT_EQ(events[2].time, start + 100000);
+}
+
+TEST(AcceleratedClock, PlaysFasterThanRealTime) {
+    const int SPEED = 20;
+    const int DURATION_SECONDS = 2;
+
+    aal_virtual_set_clock(AAL_VIRTUAL_CLOCK_ACCELERATED, SPEED);
+
+    Stream stream;
+    stream.source = make_tone(SAMPLE_RATE * DURATION_SECONDS, SAMPLE_RATE);
+    stream.limit = stream.source.size();
+    ASSERT_NE(create_player(stream, nullptr), nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    aal_player_play(stream.handle);
+    bool stopped = stream.wait_stopped(std::chrono::milliseconds(DURATION_SECONDS * 1000));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    aal_virtual_stats_t stats;
+    ASSERT_TRUE(aal_virtual_get_stats(stream.handle, &stats));
+    aal_player_destroy(stream.handle);
+    aal_virtual_set_clock(AAL_VIRTUAL_CLOCK_REALTIME, 1.0);
+
+    ASSERT_TRUE(stopped);
+    EXPECT_LT(elapsed, std::chrono::milliseconds(DURATION_SECONDS * 1000 / 2));
+    EXPECT_EQ(stats.stop_time - stats.start_time, DURATION_SECONDS * 1000000);
+    EXPECT_EQ(stats.frames, SAMPLE_RATE * DURATION_SECONDS);
+}
+
+/*
+ * Measures the streaming path of a player fed from its data requests, without sound hardware. The stepped clock
+ * makes the latency and underruns repeatable, the CPU time covers the module and the writes.
+ */
+TEST(Benchmark, SteppedPlayback) {
+    const int DURATION_SECONDS = 10;
+
+    aal_virtual_set_clock(AAL_VIRTUAL_CLOCK_STEPPED, 1.0);
+
+    Stream stream;
+    stream.source = make_tone(SAMPLE_RATE * DURATION_SECONDS, SAMPLE_RATE);
+    stream.limit = stream.source.size();
+    ASSERT_NE(create_player(stream, nullptr), nullptr);
+
+    auto cpu_start = process_cpu_seconds();
+    aal_player_play(stream.handle);
+    int periods = 0;
+    while (!stream.is_stopped() && periods < DURATION_SECONDS * 200) {
+        aal_virtual_clock_advance(PERIOD_US);
+        periods++;
+    }
+    double cpu_seconds = process_cpu_seconds() - cpu_start;
+
+    aal_virtual_stats_t stats;
+    ASSERT_TRUE(aal_virtual_get_stats(stream.handle, &stats));
+    aal_player_destroy(stream.handle);
+    aal_virtual_set_clock(AAL_VIRTUAL_CLOCK_REALTIME, 1.0);
+
+    ASSERT_TRUE(stream.is_stopped());
+    auto latency_us = stats.first_sample_time - stats.start_time;
+    LOG("%lld us to first sample, %d underruns", (long long)latency_us, stats.underruns);
+    LOG("%.1f ms CPU for %d s of audio (%d periods)", cpu_seconds * 1000, DURATION_SECONDS, periods);
+    RecordProperty("latencyMicroseconds", (int)latency_us);
+    RecordProperty("underruns", stats.underruns);
+    RecordProperty("cpuMicroseconds", (int)(cpu_seconds * 1000000));
+}
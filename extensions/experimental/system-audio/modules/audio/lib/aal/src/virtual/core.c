@@ -0,0 +1,403 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "core.h"
+
+#define MODULE_NAME "Virtual"
+#define MAX_BUFFERS 16
+
+#define DEVICE_NULL "null"
+#define DEVICE_WAV_PREFIX "wav:"
+#define DEVICE_MEMORY_PREFIX "mem:"
+
+typedef struct {
+    char name[VIRTUAL_NAME_SIZE];
+    aal_virtual_buffer_t* buffer;
+} virtual_buffer_entry_t;
+
+static pthread_once_t virtual_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t virtual_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t virtual_cond;
+
+static aal_virtual_clock_mode_t clock_mode = AAL_VIRTUAL_CLOCK_REALTIME;
+static double clock_speed = 1.0;
+static int64_t clock_base;       // virtual time at the last change of the clock
+static int64_t clock_real_base;  // monotonic time at the last change of the clock
+
+static aal_virtual_context_t* contexts;
+static virtual_buffer_entry_t buffers[MAX_BUFFERS];
+static aal_virtual_event_func* event_func;
+static void* event_user_data;
+
+static int64_t monotonic_now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void virtual_init_once() {
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&virtual_cond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    clock_real_base = monotonic_now();
+}
+
+void virtual_lock() {
+    pthread_once(&virtual_once, virtual_init_once);
+    pthread_mutex_lock(&virtual_mutex);
+}
+
+void virtual_unlock() {
+    pthread_mutex_unlock(&virtual_mutex);
+}
+
+void virtual_broadcast() {
+    pthread_cond_broadcast(&virtual_cond);
+}
+
+int64_t virtual_now() {
+    switch (clock_mode) {
+        case AAL_VIRTUAL_CLOCK_STEPPED:
+            return clock_base;
+        case AAL_VIRTUAL_CLOCK_ACCELERATED:
+            return clock_base + (int64_t)((monotonic_now() - clock_real_base) * clock_speed);
+        default:
+            return clock_base + (monotonic_now() - clock_real_base);
+    }
+}
+
+bool virtual_is_stepped() {
+    return clock_mode == AAL_VIRTUAL_CLOCK_STEPPED;
+}
+
+void virtual_wait(int64_t deadline) {
+    if (clock_mode == AAL_VIRTUAL_CLOCK_STEPPED) {
+        pthread_cond_wait(&virtual_cond, &virtual_mutex);
+        return;
+    }
+
+    double speed = clock_mode == AAL_VIRTUAL_CLOCK_ACCELERATED ? clock_speed : 1.0;
+    int64_t real_deadline = clock_real_base + (int64_t)((deadline - clock_base) / speed) + 1;
+    struct timespec ts = {.tv_sec = real_deadline / 1000000, .tv_nsec = (real_deadline % 1000000) * 1000};
+    pthread_cond_timedwait(&virtual_cond, &virtual_mutex, &ts);
+}
+
+size_t virtual_frames_until(int rate, int64_t periods) {
+    return (size_t)(periods * AAL_VIRTUAL_PERIOD_TIME * rate / 1000000);
+}
+
+/* Whether every running context has processed its periods up to the current time */
+static bool virtual_is_idle() {
+    int64_t now = virtual_now();
+
+    for (aal_virtual_context_t* ctx = contexts; ctx != NULL; ctx = ctx->next) {
+        if (ctx->running && (ctx->busy || ctx->next_tick <= now)) return false;
+    }
+    return true;
+}
+
+void aal_virtual_set_clock(aal_virtual_clock_mode_t mode, double speed) {
+    virtual_lock();
+    clock_base = virtual_now();
+    clock_real_base = monotonic_now();
+    clock_mode = mode;
+    clock_speed = speed > 0 ? speed : 1.0;
+    virtual_broadcast();
+    virtual_unlock();
+}
+
+int64_t aal_virtual_clock_now() {
+    virtual_lock();
+    int64_t now = virtual_now();
+    virtual_unlock();
+
+    return now;
+}
+
+void aal_virtual_clock_advance(int64_t us) {
+    virtual_lock();
+    clock_base += us;
+    virtual_broadcast();
+    if (clock_mode == AAL_VIRTUAL_CLOCK_STEPPED) {
+        while (!virtual_is_idle()) pthread_cond_wait(&virtual_cond, &virtual_mutex);
+    }
+    virtual_unlock();
+}
+
+/* Must be called with the lock held */
+static virtual_buffer_entry_t* virtual_find_buffer_entry(const char* name) {
+    for (int i = 0; i < MAX_BUFFERS; i++) {
+        if (buffers[i].buffer && strcmp(buffers[i].name, name) == 0) return &buffers[i];
+    }
+    return NULL;
+}
+
+aal_virtual_buffer_t* virtual_find_buffer(const char* name) {
+    virtual_buffer_entry_t* entry = virtual_find_buffer_entry(name);
+    return entry ? entry->buffer : NULL;
+}
+
+bool aal_virtual_register_buffer(const char* name, aal_virtual_buffer_t* buffer) {
+    bool registered = false;
+
+    if (!name || strlen(name) >= VIRTUAL_NAME_SIZE || !buffer) return false;
+
+    virtual_lock();
+    if (!virtual_find_buffer_entry(name)) {
+        for (int i = 0; i < MAX_BUFFERS; i++) {
+            if (!buffers[i].buffer) {
+                strcpy(buffers[i].name, name);
+                buffers[i].buffer = buffer;
+                registered = true;
+                break;
+            }
+        }
+    }
+    virtual_unlock();
+
+    return registered;
+}
+
+void aal_virtual_unregister_buffer(const char* name) {
+    virtual_lock();
+    virtual_buffer_entry_t* entry = virtual_find_buffer_entry(name);
+    if (entry) entry->buffer = NULL;
+    virtual_unlock();
+}
+
+void aal_virtual_set_event_func(aal_virtual_event_func* func, void* user_data) {
+    virtual_lock();
+    event_func = func;
+    event_user_data = user_data;
+    virtual_unlock();
+}
+
+bool aal_virtual_get_stats(aal_handle_t handle, aal_virtual_stats_t* stats) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    if (!ctx || strcmp(aal_get_module_name(ctx->module_id), MODULE_NAME) != 0) return false;
+
+    virtual_lock();
+    *stats = ctx->stats;
+    virtual_unlock();
+
+    return true;
+}
+
+void virtual_record_event(aal_virtual_context_t* ctx, aal_virtual_event_t event, int64_t time) {
+    switch (event) {
+        case AAL_VIRTUAL_EVENT_START:
+            ctx->stats.start_time = time;
+            break;
+        case AAL_VIRTUAL_EVENT_FIRST_SAMPLE:
+            ctx->stats.first_sample_time = time;
+            break;
+        case AAL_VIRTUAL_EVENT_UNDERRUN:
+            ctx->stats.underruns++;
+            ctx->stats.last_underrun_time = time;
+            break;
+        case AAL_VIRTUAL_EVENT_STOP:
+            ctx->stats.stop_time = time;
+            break;
+    }
+
+    if (ctx->event_count < VIRTUAL_MAX_EVENTS) {
+        ctx->events[ctx->event_count] = event;
+        ctx->event_times[ctx->event_count] = time;
+        ctx->event_count++;
+    }
+}
+
+void virtual_report_events(aal_virtual_context_t* ctx) {
+    aal_virtual_event_t events[VIRTUAL_MAX_EVENTS];
+    int64_t times[VIRTUAL_MAX_EVENTS];
+    int count = ctx->event_count;
+    aal_virtual_event_func* func = event_func;
+    void* user_data = event_user_data;
+
+    if (count == 0) return;
+    memcpy(events, ctx->events, sizeof(events));
+    memcpy(times, ctx->event_times, sizeof(times));
+    ctx->event_count = 0;
+    if (!func) return;
+
+    bool busy = ctx->busy;
+    ctx->busy = true;
+    virtual_unlock();
+    for (int i = 0; i < count; i++) func(ctx->name, events[i], times[i], user_data);
+    virtual_lock();
+    ctx->busy = busy;
+    virtual_broadcast();
+}
+
+void virtual_reset_stats(aal_virtual_context_t* ctx) {
+    ctx->stats.start_time = -1;
+    ctx->stats.first_sample_time = -1;
+    ctx->stats.stop_time = -1;
+    ctx->stats.last_underrun_time = -1;
+    ctx->stats.underruns = 0;
+    ctx->stats.frames = 0;
+    ctx->event_count = 0;
+}
+
+bool virtual_is_running(aal_virtual_context_t* ctx) {
+    virtual_lock();
+    bool running = ctx->running;
+    virtual_unlock();
+
+    return running;
+}
+
+bool virtual_start_thread(aal_virtual_context_t* ctx, void* (*loop)(void*)) {
+    if (virtual_is_running(ctx)) return true;
+    virtual_join_thread(ctx);
+
+    virtual_lock();
+    ctx->stop_requested = false;
+    ctx->pause_requested = false;
+    ctx->underrun = false;
+    ctx->epoch = virtual_now();
+    ctx->periods = 0;
+    ctx->next_tick = ctx->epoch + AAL_VIRTUAL_PERIOD_TIME;
+    ctx->running = true;
+    if (ctx->stats.start_time < 0) virtual_record_event(ctx, AAL_VIRTUAL_EVENT_START, ctx->epoch);
+    virtual_unlock();
+
+    if (pthread_create(&ctx->thread, NULL, loop, ctx) != 0) {
+        debug("Unable to start thread");
+        virtual_lock();
+        ctx->running = false;
+        virtual_broadcast();
+        virtual_unlock();
+        return false;
+    }
+    ctx->thread_started = true;
+    return true;
+}
+
+void virtual_join_thread(aal_virtual_context_t* ctx) {
+    if (!ctx->thread_started) return;
+
+    if (pthread_equal(ctx->thread, pthread_self())) {
+        /* Called from a listener callback, the thread ends on its own */
+        pthread_detach(ctx->thread);
+    } else {
+        pthread_join(ctx->thread, NULL);
+    }
+    ctx->thread_started = false;
+}
+
+void virtual_stop(aal_handle_t handle) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    debug("Request Stop");
+    virtual_lock();
+    ctx->stop_requested = true;
+    virtual_broadcast();
+    virtual_unlock();
+
+    virtual_join_thread(ctx);
+}
+
+void virtual_destroy(aal_handle_t handle) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    virtual_stop(handle);
+
+    virtual_lock();
+    for (aal_virtual_context_t** p = &contexts; *p != NULL; p = &(*p)->next) {
+        if (*p == ctx) {
+            *p = ctx->next;
+            break;
+        }
+    }
+    virtual_broadcast();
+    virtual_unlock();
+
+    if (ctx->file) {
+        /* Complete the header with the size of the audio */
+        if (ctx->is_player) wav_write_header(ctx->file, &ctx->wav);
+        fclose(ctx->file);
+    }
+    aal_ring_free(ctx->write_buffer);
+    free(ctx->period_buffer);
+    free(ctx);
+}
+
+aal_virtual_context_t* virtual_create_context(bool is_player, const aal_attributes_t* attrs) {
+    virtual_device_type_t device_type = VIRTUAL_DEVICE_NULL;
+    const char* path = "";
+    const char* device = attrs->device;
+
+    if (device && !IS_EMPTY_STRING(device) && strcmp(device, DEVICE_NULL) != 0) {
+        if (strncmp(device, DEVICE_WAV_PREFIX, strlen(DEVICE_WAV_PREFIX)) == 0) {
+            device_type = VIRTUAL_DEVICE_WAV;
+            path = device + strlen(DEVICE_WAV_PREFIX);
+        } else if (strncmp(device, DEVICE_MEMORY_PREFIX, strlen(DEVICE_MEMORY_PREFIX)) == 0) {
+            device_type = VIRTUAL_DEVICE_MEMORY;
+            path = device + strlen(DEVICE_MEMORY_PREFIX);
+        } else {
+            debug("Unknown device %s", device);
+            return NULL;
+        }
+    }
+
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)calloc(1, sizeof(aal_virtual_context_t));
+    if (!ctx) return NULL;
+
+    ctx->is_player = is_player;
+    ctx->device_type = device_type;
+    snprintf(ctx->device_path, sizeof(ctx->device_path), "%s", path);
+    snprintf(ctx->name, sizeof(ctx->name), "%s", attrs->name ? attrs->name : "");
+    ctx->saved_volume = 1.0;
+    ctx->gain = 1 << 15;
+    virtual_reset_stats(ctx);
+
+    virtual_lock();
+    ctx->next = contexts;
+    contexts = ctx;
+    virtual_unlock();
+
+    return ctx;
+}
+
+static bool virtual_initialize() {
+    const char* speed = getenv("AAL_VIRTUAL_CLOCK_SPEED");
+    if (speed && atof(speed) > 0) {
+        debug("Accelerated clock, speed=%s", speed);
+        aal_virtual_set_clock(AAL_VIRTUAL_CLOCK_ACCELERATED, atof(speed));
+    }
+    return true;
+}
+
+extern const aal_player_ops_t virtual_player_ops;
+extern const aal_recorder_ops_t virtual_recorder_ops;
+
+// clang-format off
+aal_module_t virtual_module = {
+	.name = MODULE_NAME,
+	.capabilities = AAL_MODULE_CAP_STREAM_PLAYBACK | AAL_MODULE_CAP_LPCM_PLAYBACK,
+	.initialize = virtual_initialize,
+	.deinitialize = NULL,
+	.player_ops = &virtual_player_ops,
+	.recorder_ops = &virtual_recorder_ops
+};
+// clang-format on
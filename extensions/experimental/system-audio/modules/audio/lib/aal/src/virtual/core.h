@@ -0,0 +1,123 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef __AAL_VIRTUAL_CORE_H_
+#define __AAL_VIRTUAL_CORE_H_
+
+#define AAL_DEBUG_TAG "virtual"
+#include "../common.h"
+#include "../ring.h"
+#include "aal_virtual.h"
+#include "wav.h"
+
+#include <pthread.h>
+#include <stdio.h>
+
+#ifndef AAL_VIRTUAL_PERIOD_TIME
+#define AAL_VIRTUAL_PERIOD_TIME 10000
+#endif
+#ifndef AAL_VIRTUAL_BUFFER_TIME
+#define AAL_VIRTUAL_BUFFER_TIME 80000
+#endif
+
+#define VIRTUAL_NAME_SIZE 64
+#define VIRTUAL_MAX_EVENTS 4
+
+typedef enum { VIRTUAL_DEVICE_NULL, VIRTUAL_DEVICE_WAV, VIRTUAL_DEVICE_MEMORY } virtual_device_type_t;
+
+/*
+ * All the fields below the thread are protected by the module lock, which is also the lock of the virtual clock.
+ */
+typedef struct aal_virtual_context {
+    COMMON_CONTEXT;
+
+    struct aal_virtual_context* next;  // next context of the module
+    char name[VIRTUAL_NAME_SIZE];
+    bool is_player;
+    virtual_device_type_t device_type;
+    char device_path[VIRTUAL_NAME_SIZE * 4];  // WAV file path, or the name of the memory buffer
+    FILE* file;
+    wav_format_t wav;      // format of the WAV file
+    size_t source_offset;  // recorder: samples read from the WAV file or memory buffer
+
+    aal_lpcm_parameters_t lpcm;  // player: input format, recorder: AAL_AVS format
+    int16_t* period_buffer;
+    size_t period_capacity;  // frames
+
+    pthread_t thread;
+    bool thread_started;
+
+    bool running;  // the thread is started and has not reported its stop
+    bool busy;     // the thread is processing a period outside of the lock
+    bool stop_requested;
+    bool pause_requested;
+    bool eos;
+    bool data_requested;
+    bool underrun;  // player: out of data, recorder: late
+    int64_t epoch;      // virtual time of the first period
+    int64_t periods;    // periods processed since the epoch
+    int64_t next_tick;  // virtual time of the next period
+
+    aal_ring_t* write_buffer;  // player input, written by aal_player_write()
+    double saved_volume;
+    bool muted;
+    int32_t gain;  // software volume, in Q15
+
+    aal_virtual_stats_t stats;
+    aal_virtual_event_t events[VIRTUAL_MAX_EVENTS];  // events waiting to be reported
+    int64_t event_times[VIRTUAL_MAX_EVENTS];
+    int event_count;
+} aal_virtual_context_t;
+
+#define bail_if_error(X)        \
+    {                           \
+        if ((X) < 0) goto bail; \
+    }
+#define bail_if_null(X)             \
+    {                               \
+        if ((X) == NULL) goto bail; \
+    }
+
+#define UNUSED(x) (void)(x)
+
+#define VIRTUAL_FRAME_BYTES(channels) ((channels) * sizeof(int16_t))
+
+/* Module lock and virtual clock. The clock functions must be called with the lock held. */
+void virtual_lock();
+void virtual_unlock();
+void virtual_broadcast();
+int64_t virtual_now();
+bool virtual_is_stepped();
+void virtual_wait(int64_t deadline);
+
+/* Frames between the epoch and the end of the given period */
+size_t virtual_frames_until(int rate, int64_t periods);
+
+aal_virtual_context_t* virtual_create_context(bool is_player, const aal_attributes_t* attrs);
+aal_virtual_buffer_t* virtual_find_buffer(const char* name);
+bool virtual_is_running(aal_virtual_context_t* ctx);
+bool virtual_start_thread(aal_virtual_context_t* ctx, void* (*loop)(void*));
+void virtual_join_thread(aal_virtual_context_t* ctx);
+void virtual_stop(aal_handle_t handle);
+void virtual_destroy(aal_handle_t handle);
+
+void virtual_reset_stats(aal_virtual_context_t* ctx);
+
+/* Records an event in the stats of the context. Call with the lock held. */
+void virtual_record_event(aal_virtual_context_t* ctx, aal_virtual_event_t event, int64_t time);
+/* Reports the events recorded since the last call. Call with the lock held, which is released while reporting. */
+void virtual_report_events(aal_virtual_context_t* ctx);
+
+#endif  // __AAL_VIRTUAL_CORE_H_
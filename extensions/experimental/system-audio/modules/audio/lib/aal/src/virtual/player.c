@@ -0,0 +1,378 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "core.h"
+
+#define GAIN_ONE (1 << 15)
+
+/* The write buffer of a player holds at least 4 writes of the engine, or 4 times the device buffer */
+#define WRITE_BUFFER_MIN_SIZE 16384
+#define WRITE_BUFFER_TIME (AAL_VIRTUAL_BUFFER_TIME * 4)
+
+static bool virtual_player_configure(aal_virtual_context_t* ctx) {
+    size_t frame_bytes = VIRTUAL_FRAME_BYTES(ctx->lpcm.channels);
+    size_t frames = virtual_frames_until(ctx->lpcm.sample_rate, WRITE_BUFFER_TIME / AAL_VIRTUAL_PERIOD_TIME);
+    size_t size = frames * frame_bytes;
+
+    if (size < WRITE_BUFFER_MIN_SIZE) size = WRITE_BUFFER_MIN_SIZE;
+    aal_ring_free(ctx->write_buffer);
+    ctx->write_buffer = aal_ring_new(size);
+
+    free(ctx->period_buffer);
+    ctx->period_capacity = virtual_frames_until(ctx->lpcm.sample_rate, 1) + 1;
+    ctx->period_buffer = (int16_t*)malloc(ctx->period_capacity * frame_bytes);
+
+    return ctx->write_buffer && ctx->period_buffer;
+}
+
+static void virtual_player_apply_gain(int16_t* samples, size_t count, int32_t gain) {
+    if (gain == GAIN_ONE) return;
+
+    for (size_t i = 0; i < count; i++) {
+        samples[i] = (int16_t)((samples[i] * gain) >> 15);
+    }
+}
+
+/* Must be called with the lock held */
+static void virtual_player_write_memory(aal_virtual_context_t* ctx, size_t frames) {
+    aal_virtual_buffer_t* buffer = virtual_find_buffer(ctx->device_path);
+    size_t count = frames * ctx->lpcm.channels;
+
+    if (!buffer || buffer->length >= buffer->capacity) return;
+    if (count > buffer->capacity - buffer->length) count = buffer->capacity - buffer->length;
+    memcpy(buffer->data + buffer->length, ctx->period_buffer, count * sizeof(int16_t));
+    buffer->length += count;
+}
+
+/*
+ * Plays the period ending at the current tick. Must be called with the lock held, which is released while the audio is
+ * written to a WAV file. Returns false once the end of the stream is played.
+ */
+static bool virtual_player_play_period(aal_virtual_context_t* ctx) {
+    size_t frame_bytes = VIRTUAL_FRAME_BYTES(ctx->lpcm.channels);
+    int64_t tick = ctx->next_tick;
+
+    ctx->periods++;
+    ctx->next_tick = ctx->epoch + (ctx->periods + 1) * AAL_VIRTUAL_PERIOD_TIME;
+
+    size_t due = virtual_frames_until(ctx->lpcm.sample_rate, ctx->periods) -
+                 virtual_frames_until(ctx->lpcm.sample_rate, ctx->periods - 1);
+    size_t frames = aal_ring_bytes_used(ctx->write_buffer) / frame_bytes;
+    if (frames > due) frames = due;
+    if (frames > 0) {
+        aal_ring_read(ctx->write_buffer, ctx->period_buffer, frames * frame_bytes);
+        if (ctx->stats.first_sample_time < 0) virtual_record_event(ctx, AAL_VIRTUAL_EVENT_FIRST_SAMPLE, tick);
+        ctx->stats.frames += frames;
+    }
+
+    /* Running out of data is an underrun once the playback started, until the end of the stream */
+    if (frames < due && !ctx->eos && ctx->stats.first_sample_time >= 0) {
+        if (!ctx->underrun) virtual_record_event(ctx, AAL_VIRTUAL_EVENT_UNDERRUN, tick);
+        ctx->underrun = true;
+    } else if (frames == due) {
+        ctx->underrun = false;
+    }
+    bool playing = !ctx->eos || aal_ring_bytes_used(ctx->write_buffer) >= frame_bytes;
+
+    if (frames == 0) return playing;
+    virtual_player_apply_gain(ctx->period_buffer, frames * ctx->lpcm.channels, ctx->gain);
+
+    switch (ctx->device_type) {
+        case VIRTUAL_DEVICE_MEMORY:
+            virtual_player_write_memory(ctx, frames);
+            break;
+        case VIRTUAL_DEVICE_WAV:
+            /* Only the thread uses the file */
+            ctx->busy = true;
+            virtual_unlock();
+            ctx->wav.data_size += fwrite(ctx->period_buffer, frame_bytes, frames, ctx->file) * frame_bytes;
+            virtual_lock();
+            ctx->busy = false;
+            break;
+        default:
+            break;
+    }
+
+    return playing;
+}
+
+static void* virtual_player_loop(void* argument) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)argument;
+    aal_status_t status = AAL_UNKNOWN;
+
+    virtual_lock();
+    virtual_report_events(ctx);
+    virtual_unlock();
+
+    if (ctx->listener->on_start) {
+        debug("Calling on_start...");
+        ctx->listener->on_start(ctx->user_data);
+    }
+
+    virtual_lock();
+    for (;;) {
+        bool request = false;
+
+        if (!ctx->stop_requested && !ctx->eos && !ctx->data_requested &&
+            aal_ring_bytes_used(ctx->write_buffer) < aal_ring_capacity(ctx->write_buffer) / 2) {
+            ctx->data_requested = true;
+            request = true;
+        }
+        while (!request && !ctx->stop_requested && virtual_now() < ctx->next_tick) {
+            virtual_wait(ctx->next_tick);
+        }
+
+        if (ctx->stop_requested) {
+            status = ctx->pause_requested ? AAL_PAUSED : AAL_UNKNOWN;
+            break;
+        }
+        if (request) {
+            if (ctx->listener->on_data_requested) {
+                ctx->busy = true;
+                virtual_unlock();
+                ctx->listener->on_data_requested(ctx->user_data);
+                virtual_lock();
+                ctx->busy = false;
+                virtual_broadcast();
+            }
+            continue;
+        }
+
+        bool playing = virtual_player_play_period(ctx);
+        virtual_report_events(ctx);
+        virtual_broadcast();
+        if (!playing) {
+            debug("End of stream");
+            status = AAL_SUCCESS;
+            break;
+        }
+    }
+
+    /* The end of the stream is played at the end of the last period */
+    int64_t stop_time = status == AAL_SUCCESS ? ctx->next_tick - AAL_VIRTUAL_PERIOD_TIME : virtual_now();
+    virtual_record_event(ctx, AAL_VIRTUAL_EVENT_STOP, stop_time);
+    virtual_report_events(ctx);
+    ctx->busy = true;
+    virtual_unlock();
+
+    if (ctx->listener->on_stop) ctx->listener->on_stop(status, ctx->user_data);
+
+    virtual_lock();
+    ctx->busy = false;
+    ctx->running = false;
+    virtual_broadcast();
+    virtual_unlock();
+
+    return NULL;
+}
+
+static bool virtual_player_set_format(aal_virtual_context_t* ctx, aal_audio_parameters_t* params) {
+    ctx->lpcm.sample_format = AAL_SAMPLE_FORMAT_S16LE;
+    ctx->lpcm.channels = params && params->lpcm.channels ? params->lpcm.channels : AAL_AVS_CHANNELS;
+    ctx->lpcm.sample_rate = params && params->lpcm.sample_rate ? params->lpcm.sample_rate : AAL_AVS_SAMPLE_RATE;
+
+    return virtual_player_configure(ctx);
+}
+
+static aal_handle_t virtual_player_create(const aal_attributes_t* attrs, aal_audio_parameters_t* params) {
+    if ((attrs->uri && !IS_EMPTY_STRING(attrs->uri)) || (params && params->stream_type != AAL_STREAM_LPCM)) {
+        debug("Only LPCM streams are supported");
+        return NULL;
+    }
+
+    aal_virtual_context_t* ctx = virtual_create_context(true, attrs);
+    bail_if_null(ctx);
+
+    if (!virtual_player_set_format(ctx, params)) goto bail;
+
+    if (ctx->device_type == VIRTUAL_DEVICE_WAV) {
+        ctx->file = fopen(ctx->device_path, "wb");
+        bail_if_null(ctx->file);
+        ctx->wav.channels = ctx->lpcm.channels;
+        ctx->wav.sample_rate = ctx->lpcm.sample_rate;
+        if (!wav_write_header(ctx->file, &ctx->wav)) goto bail;
+    }
+
+    return ctx;
+
+bail:
+    debug("Failed to create the player");
+    if (ctx) virtual_destroy(ctx);
+
+    return NULL;
+}
+
+static void virtual_player_play(aal_handle_t handle) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    virtual_start_thread(ctx, virtual_player_loop);
+}
+
+static void virtual_player_pause(aal_handle_t handle) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    debug("Request pause");
+    virtual_lock();
+    ctx->pause_requested = true;
+    ctx->stop_requested = true;
+    virtual_broadcast();
+    virtual_unlock();
+
+    virtual_join_thread(ctx);
+}
+
+static void virtual_player_stop(aal_handle_t handle) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    virtual_stop(handle);
+
+    /* Discard the rest of the stream */
+    virtual_lock();
+    aal_ring_reset(ctx->write_buffer);
+    ctx->eos = false;
+    ctx->data_requested = false;
+    virtual_unlock();
+}
+
+static int64_t virtual_player_get_position(aal_handle_t handle) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    virtual_lock();
+    int64_t position = ctx->stats.frames * 1000 / ctx->lpcm.sample_rate;
+    virtual_unlock();
+
+    return position;
+}
+
+static int64_t virtual_player_get_duration(aal_handle_t handle) {
+    UNUSED(handle);
+    debug("player_get_duration not supported");
+    return -1;
+}
+
+static int64_t virtual_player_get_num_bytes_buffered(aal_handle_t handle) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    virtual_lock();
+    int64_t count = (int64_t)aal_ring_bytes_used(ctx->write_buffer);
+    virtual_unlock();
+
+    return count;
+}
+
+static void virtual_player_seek(aal_handle_t handle, int64_t position) {
+    UNUSED(handle);
+    UNUSED(position);
+    debug("player_seek not supported");
+}
+
+static void virtual_player_update_gain(aal_virtual_context_t* ctx) {
+    ctx->gain = ctx->muted ? 0 : (int32_t)(ctx->saved_volume * GAIN_ONE);
+}
+
+static void virtual_player_set_volume(aal_handle_t handle, double volume) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    if (volume < 0.0) volume = 0.0;
+    if (volume > 1.0) volume = 1.0;
+
+    virtual_lock();
+    ctx->saved_volume = volume;
+    virtual_player_update_gain(ctx);
+    virtual_unlock();
+}
+
+static void virtual_player_set_mute(aal_handle_t handle, bool mute) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    virtual_lock();
+    ctx->muted = mute;
+    virtual_player_update_gain(ctx);
+    virtual_unlock();
+}
+
+static ssize_t virtual_player_write(aal_handle_t handle, const char* data, const size_t size) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+    ssize_t written;
+
+    virtual_lock();
+    /* All or nothing */
+    if (aal_ring_bytes_free(ctx->write_buffer) < size) {
+        debug("Not enough space for write buffer");
+        /* Request data again once some of the buffer is played */
+        ctx->data_requested = false;
+        written = 0;
+    } else {
+        aal_ring_write(ctx->write_buffer, data, size);
+        written = size;
+    }
+    virtual_unlock();
+
+    return written;
+}
+
+static void virtual_player_notify_end_of_stream(aal_handle_t handle) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    virtual_lock();
+    ctx->eos = true;
+    virtual_unlock();
+}
+
+static bool virtual_player_reset(aal_handle_t handle, const char* uri, aal_audio_parameters_t* params) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    if ((uri && !IS_EMPTY_STRING(uri)) || (params && params->stream_type != AAL_STREAM_LPCM)) {
+        debug("Only LPCM streams are supported");
+        return false;
+    }
+
+    virtual_player_stop(handle);
+
+    int channels = params && params->lpcm.channels ? params->lpcm.channels : AAL_AVS_CHANNELS;
+    int sample_rate = params && params->lpcm.sample_rate ? params->lpcm.sample_rate : AAL_AVS_SAMPLE_RATE;
+    bool same_format = channels == ctx->lpcm.channels && sample_rate == ctx->lpcm.sample_rate;
+    if (!same_format && ctx->device_type == VIRTUAL_DEVICE_WAV) {
+        /* A WAV file holds a single format */
+        return false;
+    }
+
+    virtual_lock();
+    virtual_reset_stats(ctx);
+    virtual_unlock();
+
+    return same_format || virtual_player_set_format(ctx, params);
+}
+
+// clang-format off
+const aal_player_ops_t virtual_player_ops = {
+	.create = virtual_player_create,
+	.play = virtual_player_play,
+	.pause = virtual_player_pause,
+	.stop = virtual_player_stop,
+	.get_position = virtual_player_get_position,
+	.get_duration = virtual_player_get_duration,
+	.get_num_bytes_buffered = virtual_player_get_num_bytes_buffered,
+	.seek = virtual_player_seek,
+	.set_volume = virtual_player_set_volume,
+	.set_mute = virtual_player_set_mute,
+	.write = virtual_player_write,
+	.notify_end_of_stream = virtual_player_notify_end_of_stream,
+	.destroy = virtual_destroy,
+	.reset = virtual_player_reset
+};
+// clang-format on
@@ -0,0 +1,230 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "core.h"
+
+/* Must be called with the lock held */
+static size_t virtual_recorder_read_memory(aal_virtual_context_t* ctx, size_t frames) {
+    aal_virtual_buffer_t* buffer = virtual_find_buffer(ctx->device_path);
+
+    if (!buffer || ctx->source_offset >= buffer->length) return 0;
+    if (frames > buffer->length - ctx->source_offset) frames = buffer->length - ctx->source_offset;
+    memcpy(ctx->period_buffer, buffer->data + ctx->source_offset, frames * sizeof(int16_t));
+    ctx->source_offset += frames;
+
+    return frames;
+}
+
+/* Only the thread uses the file */
+static size_t virtual_recorder_read_wav(aal_virtual_context_t* ctx, size_t frames) {
+    int channels = ctx->wav.channels;
+    size_t remaining = (ctx->wav.data_size - ctx->source_offset) / VIRTUAL_FRAME_BYTES(channels);
+
+    if (frames > remaining) frames = remaining;
+    frames = fread(ctx->period_buffer, VIRTUAL_FRAME_BYTES(channels), frames, ctx->file);
+    ctx->source_offset += frames * VIRTUAL_FRAME_BYTES(channels);
+
+    /* Mix down to mono, in place */
+    if (channels > 1) {
+        for (size_t i = 0; i < frames; i++) {
+            int32_t sum = 0;
+            for (int c = 0; c < channels; c++) sum += ctx->period_buffer[i * channels + c];
+            ctx->period_buffer[i] = (int16_t)(sum / channels);
+        }
+    }
+
+    return frames;
+}
+
+/*
+ * Captures the period ending at the current tick. Must be called with the lock held, which is released while the
+ * audio is delivered. Returns false at the end of the source.
+ */
+static bool virtual_recorder_capture_period(aal_virtual_context_t* ctx) {
+    int64_t tick = ctx->next_tick;
+    size_t frames = 0;
+
+    ctx->periods++;
+    ctx->next_tick = ctx->epoch + (ctx->periods + 1) * AAL_VIRTUAL_PERIOD_TIME;
+
+    /* Falling a period behind the clock is an overrun of a real device. A stepped clock jumps, so it is not checked. */
+    if (!virtual_is_stepped() && virtual_now() - tick >= AAL_VIRTUAL_PERIOD_TIME) {
+        if (!ctx->underrun) virtual_record_event(ctx, AAL_VIRTUAL_EVENT_UNDERRUN, tick);
+        ctx->underrun = true;
+    } else {
+        ctx->underrun = false;
+    }
+
+    size_t due = virtual_frames_until(AAL_AVS_SAMPLE_RATE, ctx->periods) -
+                 virtual_frames_until(AAL_AVS_SAMPLE_RATE, ctx->periods - 1);
+    if (ctx->device_type == VIRTUAL_DEVICE_MEMORY) {
+        frames = virtual_recorder_read_memory(ctx, due);
+    }
+
+    ctx->busy = true;
+    virtual_unlock();
+    switch (ctx->device_type) {
+        case VIRTUAL_DEVICE_NULL:
+            memset(ctx->period_buffer, 0, due * sizeof(int16_t));
+            frames = due;
+            break;
+        case VIRTUAL_DEVICE_WAV:
+            frames = virtual_recorder_read_wav(ctx, due);
+            break;
+        default:
+            break;
+    }
+    if (frames > 0 && ctx->listener->on_data) ctx->listener->on_data(ctx->period_buffer, frames, ctx->user_data);
+    virtual_lock();
+    ctx->busy = false;
+
+    if (frames > 0 && ctx->stats.first_sample_time < 0) {
+        virtual_record_event(ctx, AAL_VIRTUAL_EVENT_FIRST_SAMPLE, tick);
+    }
+    ctx->stats.frames += frames;
+
+    switch (ctx->device_type) {
+        case VIRTUAL_DEVICE_MEMORY: {
+            aal_virtual_buffer_t* buffer = virtual_find_buffer(ctx->device_path);
+            return buffer && ctx->source_offset < buffer->length;
+        }
+        case VIRTUAL_DEVICE_WAV:
+            return frames == due && ctx->source_offset < ctx->wav.data_size;
+        default:
+            return true;
+    }
+}
+
+static void* virtual_recorder_loop(void* argument) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)argument;
+    aal_status_t status = AAL_UNKNOWN;
+
+    virtual_lock();
+    virtual_report_events(ctx);
+    virtual_unlock();
+
+    if (ctx->listener->on_start) {
+        debug("Calling on_start...");
+        ctx->listener->on_start(ctx->user_data);
+    }
+
+    virtual_lock();
+    for (;;) {
+        while (!ctx->stop_requested && virtual_now() < ctx->next_tick) {
+            virtual_wait(ctx->next_tick);
+        }
+
+        if (ctx->stop_requested) {
+            /* AAL_UNKNOWN: Stop requested */
+            status = AAL_UNKNOWN;
+            break;
+        }
+
+        bool capturing = virtual_recorder_capture_period(ctx);
+        virtual_report_events(ctx);
+        virtual_broadcast();
+        if (!capturing) {
+            debug("End of source");
+            status = AAL_SUCCESS;
+            break;
+        }
+    }
+
+    /* The end of the source is captured at the end of the last period */
+    int64_t stop_time = status == AAL_SUCCESS ? ctx->next_tick - AAL_VIRTUAL_PERIOD_TIME : virtual_now();
+    virtual_record_event(ctx, AAL_VIRTUAL_EVENT_STOP, stop_time);
+    virtual_report_events(ctx);
+    ctx->busy = true;
+    virtual_unlock();
+
+    if (ctx->listener->on_stop) ctx->listener->on_stop(status, ctx->user_data);
+
+    virtual_lock();
+    ctx->busy = false;
+    ctx->running = false;
+    virtual_broadcast();
+    virtual_unlock();
+
+    return NULL;
+}
+
+static aal_handle_t virtual_recorder_create(const aal_attributes_t* attrs, aal_lpcm_parameters_t* params) {
+    aal_virtual_context_t* ctx = virtual_create_context(false, attrs);
+    int channels = AAL_AVS_CHANNELS;
+    UNUSED(params);
+    bail_if_null(ctx);
+
+    /* The device parameters are ignored, the source is captured as is in the AVS format */
+    ctx->lpcm.sample_format = AAL_AVS_SAMPLE_FORMAT;
+    ctx->lpcm.channels = AAL_AVS_CHANNELS;
+    ctx->lpcm.sample_rate = AAL_AVS_SAMPLE_RATE;
+
+    if (ctx->device_type == VIRTUAL_DEVICE_WAV) {
+        ctx->file = fopen(ctx->device_path, "rb");
+        bail_if_null(ctx->file);
+        if (!wav_read_header(ctx->file, &ctx->wav) || ctx->wav.sample_rate != AAL_AVS_SAMPLE_RATE) {
+            debug("%s is not a 16-bit WAV file at %d Hz", ctx->device_path, AAL_AVS_SAMPLE_RATE);
+            goto bail;
+        }
+        channels = ctx->wav.channels;
+    } else if (ctx->device_type == VIRTUAL_DEVICE_MEMORY) {
+        virtual_lock();
+        bool found = virtual_find_buffer(ctx->device_path) != NULL;
+        virtual_unlock();
+        if (!found) {
+            debug("No buffer is registered as %s", ctx->device_path);
+            goto bail;
+        }
+    }
+
+    ctx->period_capacity = virtual_frames_until(AAL_AVS_SAMPLE_RATE, 1) + 1;
+    ctx->period_buffer = (int16_t*)malloc(ctx->period_capacity * VIRTUAL_FRAME_BYTES(channels));
+    bail_if_null(ctx->period_buffer);
+
+    return ctx;
+
+bail:
+    debug("Failed to create the recorder");
+    if (ctx) virtual_destroy(ctx);
+
+    return NULL;
+}
+
+static void virtual_recorder_play(aal_handle_t handle) {
+    aal_virtual_context_t* ctx = (aal_virtual_context_t*)handle;
+
+    if (virtual_is_running(ctx)) return;
+    virtual_join_thread(ctx);
+
+    /* Every capture starts at the beginning of the source */
+    ctx->source_offset = 0;
+    if (ctx->file) fseek(ctx->file, ctx->wav.data_offset, SEEK_SET);
+    virtual_lock();
+    virtual_reset_stats(ctx);
+    virtual_unlock();
+
+    virtual_start_thread(ctx, virtual_recorder_loop);
+}
+
+// clang-format off
+const aal_recorder_ops_t virtual_recorder_ops = {
+	.create = virtual_recorder_create,
+	.play = virtual_recorder_play,
+	.stop = virtual_stop,
+	.destroy = virtual_destroy
+};
+// clang-format on
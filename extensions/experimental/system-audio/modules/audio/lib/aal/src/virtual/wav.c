@@ -0,0 +1,99 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <string.h>
+#include "wav.h"
+
+#define WAV_HEADER_SIZE 44
+#define WAV_FORMAT_PCM 1
+#define WAV_BITS_PER_SAMPLE 16
+
+static uint32_t get_le32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t get_le16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static void put_le32(uint8_t* p, uint32_t value) {
+    p[0] = value & 0xff;
+    p[1] = (value >> 8) & 0xff;
+    p[2] = (value >> 16) & 0xff;
+    p[3] = (value >> 24) & 0xff;
+}
+
+static void put_le16(uint8_t* p, uint16_t value) {
+    p[0] = value & 0xff;
+    p[1] = (value >> 8) & 0xff;
+}
+
+bool wav_read_header(FILE* file, wav_format_t* format) {
+    uint8_t header[12];
+    uint8_t chunk[8];
+    uint8_t fmt[16];
+    bool has_fmt = false;
+
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) || memcmp(header, "RIFF", 4) != 0 ||
+        memcmp(header + 8, "WAVE", 4) != 0) {
+        return false;
+    }
+
+    while (fread(chunk, 1, sizeof(chunk), file) == sizeof(chunk)) {
+        uint32_t size = get_le32(chunk + 4);
+
+        if (memcmp(chunk, "fmt ", 4) == 0) {
+            if (size < sizeof(fmt) || fread(fmt, 1, sizeof(fmt), file) != sizeof(fmt)) return false;
+            if (get_le16(fmt) != WAV_FORMAT_PCM || get_le16(fmt + 14) != WAV_BITS_PER_SAMPLE) return false;
+            format->channels = get_le16(fmt + 2);
+            format->sample_rate = get_le32(fmt + 4);
+            has_fmt = true;
+            size -= sizeof(fmt);
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            if (!has_fmt || format->channels == 0) return false;
+            format->data_size = size;
+            format->data_offset = ftell(file);
+            return true;
+        }
+
+        /* Chunks are padded to an even size */
+        if (fseek(file, size + (size & 1), SEEK_CUR) != 0) return false;
+    }
+
+    return false;
+}
+
+bool wav_write_header(FILE* file, const wav_format_t* format) {
+    uint8_t header[WAV_HEADER_SIZE];
+    uint16_t block_align = format->channels * WAV_BITS_PER_SAMPLE / 8;
+
+    memcpy(header, "RIFF", 4);
+    put_le32(header + 4, WAV_HEADER_SIZE - 8 + format->data_size);
+    memcpy(header + 8, "WAVE", 4);
+    memcpy(header + 12, "fmt ", 4);
+    put_le32(header + 16, 16);
+    put_le16(header + 20, WAV_FORMAT_PCM);
+    put_le16(header + 22, format->channels);
+    put_le32(header + 24, format->sample_rate);
+    put_le32(header + 28, format->sample_rate * block_align);
+    put_le16(header + 32, block_align);
+    put_le16(header + 34, WAV_BITS_PER_SAMPLE);
+    memcpy(header + 36, "data", 4);
+    put_le32(header + 40, format->data_size);
+
+    if (fseek(file, 0, SEEK_SET) != 0 || fwrite(header, 1, sizeof(header), file) != sizeof(header)) return false;
+    return fseek(file, 0, SEEK_END) == 0;
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef __AAL_VIRTUAL_WAV_H_
+#define __AAL_VIRTUAL_WAV_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* 16-bit PCM WAV files */
+typedef struct {
+    int channels;
+    int sample_rate;
+    uint32_t data_size;  // bytes of audio
+    long data_offset;    // position of the audio in the file
+} wav_format_t;
+
+/* Reads the header, and leaves the file at the start of the audio */
+bool wav_read_header(FILE* file, wav_format_t* format);
+
+/* Writes the header at the start of the file, and leaves the file at the end of the audio */
+bool wav_write_header(FILE* file, const wav_format_t* format);
+
+#endif  // __AAL_VIRTUAL_WAV_H_
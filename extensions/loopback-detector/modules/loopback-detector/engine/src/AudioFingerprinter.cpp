@@ -0,0 +1,246 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. and its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: LicenseRef-.amazon.com.-ASL-1.0
+ *
+ * Licensed under the Amazon Software License (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *  http://aws.amazon.com/asl/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include "AudioFingerprinter.h"
+
+namespace aace {
+namespace engine {
+namespace loopbackDetector {
+
+/// The duration of audio analyzed for each fingerprint.
+static const std::chrono::milliseconds FRAME_DURATION = std::chrono::milliseconds(32);
+
+/// The frequency range of the bands, where most of the energy of speech is.
+static const float LOWEST_FREQUENCY = 300.0f;
+static const float HIGHEST_FREQUENCY = 4000.0f;
+
+/// Frames with a lower RMS level, in sample units, are silent.
+static const float SILENCE_LEVEL = 30.0f;
+
+/// The floor of the band energies relative to their mean, about -15 dB, which hides the noise of the microphone.
+static const double ENERGY_FLOOR = 0.03;
+
+/// The minimum number of fingerprints of a query, a fifth of a second.
+static const size_t MIN_QUERY_FINGERPRINTS = 25;
+
+static const float PI = 3.14159265358979f;
+
+const size_t AudioFingerprinter::NUM_BANDS;
+constexpr std::chrono::milliseconds AudioFingerprinter::HOP_DURATION;
+
+AudioFingerprinter::AudioFingerprinter(unsigned int sampleRateHz, std::chrono::milliseconds historyDuration) {
+    m_hopSize = sampleRateHz * HOP_DURATION.count() / 1000;
+    m_historySize = historyDuration.count() / HOP_DURATION.count();
+
+    // the frame is analyzed in a single FFT
+    size_t frameSamples = sampleRateHz * FRAME_DURATION.count() / 1000;
+    for (m_frameSize = 1; m_frameSize < frameSamples; m_frameSize <<= 1) {
+    }
+
+    m_window.resize(m_frameSize);
+    for (size_t i = 0; i < m_frameSize; i++) {
+        m_window[i] = 0.5f - 0.5f * std::cos(2 * PI * i / m_frameSize);
+    }
+
+    m_twiddles.resize(m_frameSize / 2);
+    for (size_t k = 0; k < m_frameSize / 2; k++) {
+        m_twiddles[k] = std::polar(1.0f, -2 * PI * k / m_frameSize);
+    }
+    m_spectrum.resize(m_frameSize);
+
+    // logarithmically spaced bands of at least one bin each
+    float highest = std::min(HIGHEST_FREQUENCY, sampleRateHz / 2.0f);
+    for (size_t band = 0; band <= NUM_BANDS; band++) {
+        float frequency = LOWEST_FREQUENCY * std::pow(highest / LOWEST_FREQUENCY, static_cast<float>(band) / NUM_BANDS);
+        size_t bin = static_cast<size_t>(std::lround(frequency * m_frameSize / sampleRateHz));
+        if (!m_bandEdges.empty()) {
+            bin = std::max(bin, m_bandEdges.back() + 1);
+        }
+        m_bandEdges.push_back(std::min(bin, m_frameSize / 2));
+    }
+
+    // the energy of white noise at the silence level in the bands, through the Hann window
+    size_t bins = m_bandEdges.back() - m_bandEdges.front();
+    m_silenceEnergy = bins * m_frameSize * 0.375f * SILENCE_LEVEL * SILENCE_LEVEL;
+}
+
+void AudioFingerprinter::process(const int16_t* data, size_t size) {
+    m_pending.insert(m_pending.end(), data, data + size);
+
+    size_t offset = 0;
+    for (; m_pending.size() - offset >= m_frameSize; offset += m_hopSize) {
+        processFrame(&m_pending[offset]);
+    }
+    m_pending.erase(m_pending.begin(), m_pending.begin() + offset);
+}
+
+void AudioFingerprinter::processFrame(const int16_t* frame) {
+    for (size_t i = 0; i < m_frameSize; i++) {
+        m_spectrum[i] = std::complex<float>(frame[i] * m_window[i], 0);
+    }
+
+    // in place radix-2 FFT
+    for (size_t i = 1, j = 0; i < m_frameSize; i++) {
+        size_t bit = m_frameSize >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(m_spectrum[i], m_spectrum[j]);
+        }
+    }
+    for (size_t length = 2; length <= m_frameSize; length <<= 1) {
+        size_t stride = m_frameSize / length;
+        for (size_t start = 0; start < m_frameSize; start += length) {
+            for (size_t k = 0; k < length / 2; k++) {
+                std::complex<float> odd = m_spectrum[start + k + length / 2] * m_twiddles[k * stride];
+                m_spectrum[start + k + length / 2] = m_spectrum[start + k] - odd;
+                m_spectrum[start + k] += odd;
+            }
+        }
+    }
+
+    Fingerprint fingerprint;
+    for (size_t band = 0; band < NUM_BANDS; band++) {
+        fingerprint[band] = 0;
+        for (size_t bin = m_bandEdges[band]; bin < m_bandEdges[band + 1]; bin++) {
+            fingerprint[band] += std::norm(m_spectrum[bin]);
+        }
+    }
+
+    m_history.push_back(fingerprint);
+    m_audibleCount += std::accumulate(fingerprint.begin(), fingerprint.end(), 0.0f) < m_silenceEnergy ? 0 : 1;
+    if (m_history.size() > m_historySize) {
+        const Fingerprint& oldest = m_history.front();
+        m_audibleCount -= std::accumulate(oldest.begin(), oldest.end(), 0.0f) < m_silenceEnergy ? 0 : 1;
+        m_history.pop_front();
+    }
+}
+
+std::vector<AudioFingerprinter::Fingerprint> AudioFingerprinter::getHistory() const {
+    return std::vector<Fingerprint>(m_history.begin(), m_history.end());
+}
+
+bool AudioFingerprinter::isSilent() const {
+    return m_audibleCount == 0;
+}
+
+void AudioFingerprinter::reset() {
+    m_pending.clear();
+    m_history.clear();
+    m_audibleCount = 0;
+}
+
+std::vector<AudioFingerprinter::Fingerprint> AudioFingerprinter::fingerprint(
+    unsigned int sampleRateHz,
+    const int16_t* data,
+    size_t size) {
+    // keep every fingerprint of the segment
+    size_t hops = size / (sampleRateHz * HOP_DURATION.count() / 1000) + 1;
+    AudioFingerprinter fingerprinter(sampleRateHz, std::chrono::milliseconds(HOP_DURATION.count() * hops));
+    fingerprinter.process(data, size);
+    return fingerprinter.getHistory();
+}
+
+/**
+ * Returns the spectral envelopes of the fingerprints: their log energies above a floor relative to their mean energy,
+ * less the mean of each fingerprint, so that only the shape of the spectrum and its changes remain.
+ */
+static std::vector<float> getEnvelopes(const std::vector<AudioFingerprinter::Fingerprint>& fingerprints) {
+    const size_t bands = AudioFingerprinter::NUM_BANDS;
+    double mean = 0;
+    for (const auto& next : fingerprints) {
+        mean += std::accumulate(next.begin(), next.end(), 0.0);
+    }
+    float floor = static_cast<float>(std::max(1.0, mean / (fingerprints.size() * bands) * ENERGY_FLOOR));
+
+    std::vector<float> envelopes(fingerprints.size() * bands);
+    for (size_t frame = 0; frame < fingerprints.size(); frame++) {
+        float* envelope = &envelopes[frame * bands];
+        float frameMean = 0;
+        for (size_t band = 0; band < bands; band++) {
+            envelope[band] = std::log(fingerprints[frame][band] + floor);
+            frameMean += envelope[band] / bands;
+        }
+        for (size_t band = 0; band < bands; band++) {
+            envelope[band] -= frameMean;
+        }
+    }
+
+    return envelopes;
+}
+
+float AudioFingerprinter::match(const std::vector<Fingerprint>& query, const std::vector<Fingerprint>& reference) {
+    if (query.size() < MIN_QUERY_FINGERPRINTS || reference.size() < query.size()) {
+        return 0;
+    }
+
+    // the query is centered in each band, so the covariance does not need the means of the reference
+    std::vector<float> queryEnvelopes = getEnvelopes(query);
+    double queryVariance = 0;
+    for (size_t band = 0; band < NUM_BANDS; band++) {
+        float mean = 0;
+        for (size_t frame = 0; frame < query.size(); frame++) {
+            mean += queryEnvelopes[frame * NUM_BANDS + band] / query.size();
+        }
+        for (size_t frame = 0; frame < query.size(); frame++) {
+            float& value = queryEnvelopes[frame * NUM_BANDS + band];
+            value -= mean;
+            queryVariance += value * value;
+        }
+    }
+    if (queryVariance <= 0) {
+        return 0;
+    }
+
+    // running sums of the reference give the variance of each alignment
+    std::vector<float> referenceEnvelopes = getEnvelopes(reference);
+    std::vector<double> sums(referenceEnvelopes.size() + NUM_BANDS, 0);
+    std::vector<double> squares(referenceEnvelopes.size() + NUM_BANDS, 0);
+    for (size_t i = 0; i < referenceEnvelopes.size(); i++) {
+        sums[i + NUM_BANDS] = sums[i] + referenceEnvelopes[i];
+        squares[i + NUM_BANDS] = squares[i] + referenceEnvelopes[i] * referenceEnvelopes[i];
+    }
+
+    float bestCorrelation = 0;
+    size_t values = queryEnvelopes.size();
+    for (size_t lag = 0; lag + query.size() <= reference.size(); lag++) {
+        const float* aligned = &referenceEnvelopes[lag * NUM_BANDS];
+        float covariance = std::inner_product(queryEnvelopes.begin(), queryEnvelopes.end(), aligned, 0.0f);
+
+        double referenceVariance = 0;
+        for (size_t band = 0; band < NUM_BANDS; band++) {
+            size_t first = lag * NUM_BANDS + band;
+            double sum = sums[first + values] - sums[first];
+            referenceVariance += squares[first + values] - squares[first] - sum * sum / query.size();
+        }
+        if (referenceVariance > 0) {
+            float correlation = static_cast<float>(covariance / std::sqrt(queryVariance * referenceVariance));
+            bestCorrelation = std::max(bestCorrelation, correlation);
+        }
+    }
+
+    return bestCorrelation;
+}
+
+}  // namespace loopbackDetector
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. and its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: LicenseRef-.amazon.com.-ASL-1.0
+ *
+ * Licensed under the Amazon Software License (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *  http://aws.amazon.com/asl/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_LOOPBACKDETECTOR_AUDIO_FINGERPRINTER_H
+#define AACE_ENGINE_LOOPBACKDETECTOR_AUDIO_FINGERPRINTER_H
+
+#include <array>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace loopbackDetector {
+
+/**
+ * Computes band energy fingerprints of 16-bit mono audio, and matches the fingerprints of a segment of microphone
+ * audio against the fingerprints of the speaker reference to find out whether the segment is the echo of the speaker.
+ */
+class AudioFingerprinter {
+public:
+    /// The number of logarithmically spaced frequency bands.
+    static const size_t NUM_BANDS = 16;
+
+    /// The energy of each band in one hop of audio.
+    using Fingerprint = std::array<float, NUM_BANDS>;
+
+    /// The duration of audio between two fingerprints.
+    static constexpr std::chrono::milliseconds HOP_DURATION = std::chrono::milliseconds(8);
+
+    /**
+     * @param sampleRateHz The sample rate of the audio.
+     * @param historyDuration The duration of the most recent fingerprints to keep.
+     */
+    AudioFingerprinter(unsigned int sampleRateHz, std::chrono::milliseconds historyDuration);
+
+    /// Fingerprints the audio following the audio previously processed.
+    void process(const int16_t* data, size_t size);
+
+    /// Returns the fingerprints kept, from the oldest to the most recent.
+    std::vector<Fingerprint> getHistory() const;
+
+    /// Returns @c true if every fingerprint kept is silent.
+    bool isSilent() const;
+
+    /// Clears the history and the audio not yet fingerprinted.
+    void reset();
+
+    /// Returns the fingerprints of a segment of audio.
+    static std::vector<Fingerprint> fingerprint(unsigned int sampleRateHz, const int16_t* data, size_t size);
+
+    /**
+     * Aligns the query with every position of the reference and returns the highest correlation of their spectral
+     * envelopes, close to 1 for an echo of the reference and below 0.6 for unrelated speech. The gain and the
+     * equalization of the acoustic path do not change the correlation. Returns 0 if the query is too short or the
+     * reference is shorter than the query.
+     */
+    static float match(const std::vector<Fingerprint>& query, const std::vector<Fingerprint>& reference);
+
+private:
+    void processFrame(const int16_t* frame);
+
+private:
+    size_t m_frameSize;
+    size_t m_hopSize;
+    size_t m_historySize;
+    float m_silenceEnergy;
+
+    std::vector<float> m_window;
+    std::vector<size_t> m_bandEdges;  // first FFT bin of each band, and the end of the last band
+    std::vector<std::complex<float>> m_twiddles;
+    std::vector<std::complex<float>> m_spectrum;
+
+    std::vector<int16_t> m_pending;  // audio not yet fingerprinted
+    size_t m_audibleCount = 0;       // fingerprints of the history that are not silent
+
+    std::deque<Fingerprint> m_history;
+};
+
+}  // namespace loopbackDetector
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_LOOPBACKDETECTOR_AUDIO_FINGERPRINTER_H
@@ -15,6 +15,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <climits>
 #include <AACE/Engine/Core/EngineMacros.h>
 #include "LoopbackDetector.h"
@@ -29,12 +30,23 @@ static const size_t MAX_READERS = 2;
 /// The amount of audio data to keep in the ring buffer.
 static const std::chrono::seconds AMOUNT_OF_AUDIO_DATA_IN_BUFFER = std::chrono::seconds(5);
 
+/// The amount of microphone audio verified when the detection has no indices, and at most otherwise.
+static const std::chrono::milliseconds DEFAULT_SEGMENT_DURATION = std::chrono::milliseconds(800);
+static const std::chrono::milliseconds MAX_SEGMENT_DURATION = std::chrono::seconds(2);
+
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.alexa.LoopbackDetector");
 
-LoopbackDetector::LoopbackDetector(const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat) :
+constexpr float LoopbackDetector::DEFAULT_MATCH_THRESHOLD;
+
+LoopbackDetector::LoopbackDetector(
+    const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+    Mode mode,
+    float matchThreshold) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
         m_audioFormat(audioFormat),
+        m_mode(mode),
+        m_matchThreshold(matchThreshold),
         m_wordSize(audioFormat.sampleSizeInBits / CHAR_BIT) {
 }
 
@@ -49,6 +61,14 @@ bool LoopbackDetector::initialize(
             "LoopbackDetector", audio::AudioManagerInterface::AudioInputType::LOOPBACK);
         ThrowIfNull(m_audioInputChannel, "invalidAudioInputChannel");
 
+        if (m_mode == Mode::REFERENCE) {
+            // no wakeword engine, the loopback audio is only fingerprinted
+            m_referenceFingerprinter = std::unique_ptr<AudioFingerprinter>(
+                new AudioFingerprinter(m_audioFormat.sampleRateHz, AMOUNT_OF_AUDIO_DATA_IN_BUFFER));
+            ThrowIfNot(startAudioInput(), "platformStartAudioInputFailed");
+            return true;
+        }
+
         ThrowIfNot(initializeAudioInputStream(), "initializeAudioInputStreamFailed");
 
         m_wakewordEngineAdapter = wakewordEngineAdapter;
@@ -73,11 +93,13 @@ bool LoopbackDetector::initialize(
 std::shared_ptr<LoopbackDetector> LoopbackDetector::create(
     const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
     std::shared_ptr<audio::AudioManagerInterface> audioManager,
-    std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter) {
+    std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter,
+    Mode mode,
+    float matchThreshold) {
     std::shared_ptr<LoopbackDetector> loopbackDetector = nullptr;
 
     try {
-        loopbackDetector = std::shared_ptr<LoopbackDetector>(new LoopbackDetector(audioFormat));
+        loopbackDetector = std::shared_ptr<LoopbackDetector>(new LoopbackDetector(audioFormat, mode, matchThreshold));
 
         ThrowIfNot(
             loopbackDetector->initialize(audioManager, wakewordEngineAdapter), "initializeLoopbackDetectorFailed");
@@ -103,6 +125,9 @@ void LoopbackDetector::doShutdown() {
         m_wakewordEngineAdapter->removeKeyWordObserver(shared_from_this());
         m_wakewordEngineAdapter.reset();
     }
+
+    std::lock_guard<std::mutex> lock(m_referenceMutex);
+    m_referenceFingerprinter.reset();
 }
 
 bool LoopbackDetector::initializeAudioInputStream() {
@@ -171,6 +196,13 @@ bool LoopbackDetector::stopAudioInput() {
 
 ssize_t LoopbackDetector::write(const int16_t* data, const size_t size) {
     try {
+        if (m_mode == Mode::REFERENCE) {
+            std::lock_guard<std::mutex> lock(m_referenceMutex);
+            ThrowIfNull(m_referenceFingerprinter, "nullReferenceFingerprinter");
+            m_referenceFingerprinter->process(data, size);
+            return size;
+        }
+
         ThrowIfNull(m_audioInputWriter, "nullAudioInputWriter");
 
         ssize_t result = m_audioInputWriter->write(data, size);
@@ -188,6 +220,12 @@ bool LoopbackDetector::verify(const std::string& wakeword, const std::chrono::mi
 
     AACE_DEBUG(LX(TAG, "verify").d("wakeword", wakeword));
 
+    if (m_mode == Mode::REFERENCE) {
+        // there is no audio to match the loopback audio against
+        AACE_WARN(LX(TAG, "verify").d("reason", "noDetectionAudio"));
+        return false;
+    }
+
     // Does wake-word is already detected by secondary WW engine within past N ms?
     if ((std::chrono::system_clock::now() - m_lastDetection) < timeout) {
         return true;
@@ -200,6 +238,66 @@ bool LoopbackDetector::verify(const std::string& wakeword, const std::chrono::mi
     return (std::chrono::system_clock::now() - m_lastDetection) < timeout;
 }
 
+bool LoopbackDetector::verifyDetection(
+    const std::string& wakeword,
+    std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream,
+    alexaClientSDK::avsCommon::avs::AudioInputStream::Index beginIndex,
+    alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex,
+    const std::chrono::milliseconds& timeout) {
+    if (m_mode != Mode::REFERENCE) {
+        return verify(wakeword, timeout);
+    }
+
+    using Reader = alexaClientSDK::avsCommon::avs::AudioInputStream::Reader;
+
+    try {
+        std::vector<AudioFingerprinter::Fingerprint> reference;
+        {
+            std::lock_guard<std::mutex> lock(m_referenceMutex);
+            ThrowIfNull(m_referenceFingerprinter, "nullReferenceFingerprinter");
+
+            // nothing was played recently, so the wakeword cannot come from the speaker
+            if (m_referenceFingerprinter->isSilent()) {
+                AACE_DEBUG(LX(TAG, "verifyDetection").d("wakeword", wakeword).d("reason", "silentLoopback"));
+                return false;
+            }
+            reference = m_referenceFingerprinter->getHistory();
+        }
+
+        ThrowIfNull(stream, "invalidStream");
+        ThrowIf(stream->getWordSize() != m_wordSize, "unexpectedWordSize");
+
+        // a nonblocking reader takes the detection audio already in the stream
+        auto reader = stream->createReader(Reader::Policy::NONBLOCKING);
+        ThrowIfNull(reader, "createReaderFailed");
+
+        size_t samplesPerMillisecond = m_audioFormat.sampleRateHz / 1000;
+        size_t words = DEFAULT_SEGMENT_DURATION.count() * samplesPerMillisecond;
+        if (beginIndex != KeyWordObserverInterface::UNSPECIFIED_INDEX &&
+            endIndex != KeyWordObserverInterface::UNSPECIFIED_INDEX && endIndex > beginIndex) {
+            words = std::min<size_t>(endIndex - beginIndex, MAX_SEGMENT_DURATION.count() * samplesPerMillisecond);
+            ThrowIfNot(reader->seek(endIndex - words, Reader::Reference::ABSOLUTE), "seekDetectionFailed");
+        } else {
+            ThrowIfNot(reader->seek(words, Reader::Reference::BEFORE_WRITER), "seekDetectionFailed");
+        }
+
+        std::vector<int16_t> segment(words);
+        ssize_t result = reader->read(segment.data(), words);
+        reader->close();
+        ThrowIf(result <= 0, "readDetectionFailed");
+        segment.resize(result);
+
+        float correlation = AudioFingerprinter::match(
+            AudioFingerprinter::fingerprint(m_audioFormat.sampleRateHz, segment.data(), segment.size()), reference);
+        AACE_DEBUG(LX(TAG, "verifyDetection").d("wakeword", wakeword).d("correlation", correlation));
+
+        return correlation > m_matchThreshold;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "verifyDetection").d("reason", ex.what()));
+        return false;
+    }
+}
+
 void LoopbackDetector::onKeyWordDetected(
     std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream,
     std::string keyword,
@@ -28,6 +28,8 @@
 #include <AACE/Engine/Alexa/WakewordVerifier.h>
 #include <AACE/Engine/Alexa/WakewordEngineAdapter.h>
 
+#include "AudioFingerprinter.h"
+
 namespace aace {
 namespace engine {
 namespace loopbackDetector {
@@ -37,20 +39,46 @@ class LoopbackDetector
         , public alexaClientSDK::avsCommon::utils::RequiresShutdown
         , public std::enable_shared_from_this<LoopbackDetector>
         , public alexa::WakewordVerifier {
+public:
+    /**
+     * How a detection is verified against the loopback audio.
+     */
+    enum class Mode {
+        /// A secondary wakeword engine listens to the loopback audio, and the detection waits for it.
+        WAKEWORD,
+        /// The fingerprints of the loopback audio are matched against the microphone audio of the detection.
+        REFERENCE
+    };
+
+    /// The default correlation threshold of @c Mode::REFERENCE.
+    static constexpr float DEFAULT_MATCH_THRESHOLD = 0.7f;
+
 private:
-    LoopbackDetector(const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat);
+    LoopbackDetector(const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat, Mode mode, float matchThreshold);
 
     bool initialize(
         std::shared_ptr<audio::AudioManagerInterface> audioManager,
         std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter);
 
 public:
+    /**
+     * @param matchThreshold The correlation above which the microphone audio is the loopback audio, in
+     * @c Mode::REFERENCE.
+     */
     static std::shared_ptr<LoopbackDetector> create(
         const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
         std::shared_ptr<audio::AudioManagerInterface> audioManager,
-        std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter = nullptr);
+        std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter = nullptr,
+        Mode mode = Mode::WAKEWORD,
+        float matchThreshold = DEFAULT_MATCH_THRESHOLD);
 
     bool verify(const std::string& wakeword, const std::chrono::milliseconds& timeout) override;
+    bool verifyDetection(
+        const std::string& wakeword,
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index beginIndex,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex,
+        const std::chrono::milliseconds& timeout) override;
 
     // KeyWordObserverInterface
     void onKeyWordDetected(
@@ -73,6 +101,8 @@ private:
 
 private:
     alexaClientSDK::avsCommon::utils::AudioFormat m_audioFormat;
+    Mode m_mode;
+    float m_matchThreshold;
     std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> m_audioInputStream;
     std::unique_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream::Writer> m_audioInputWriter;
 
@@ -88,6 +118,10 @@ private:
     std::condition_variable m_detectionCV;
 
     std::chrono::time_point<std::chrono::system_clock> m_lastDetection;
+
+    /// Fingerprints of the recent loopback audio, in @c Mode::REFERENCE.
+    std::unique_ptr<AudioFingerprinter> m_referenceFingerprinter;
+    std::mutex m_referenceMutex;
 };
 
 }  // namespace loopbackDetector
@@ -42,17 +42,30 @@ LoopbackDetectorEngineService::LoopbackDetectorEngineService(const core::Service
         core::EngineService(description) {
 }
 
-bool LoopbackDetectorEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool LoopbackDetectorEngineService::configureFromValue(const rapidjson::Value& configuration) {
     try {
-        auto document = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(document, "parseConfigurationStreamFailed");
+        ThrowIfNot(configuration.IsObject(), "invalidConfiguration");
 
-        auto configRoot = document->GetObject();
+        auto configRoot = configuration.GetObject();
 
         if (configRoot.HasMember("wakewordEngine") && configRoot["wakewordEngine"].IsString()) {
             m_wakewordEngineName = configRoot["wakewordEngine"].GetString();
         }
 
+        if (configRoot.HasMember("mode") && configRoot["mode"].IsString()) {
+            std::string mode = configRoot["mode"].GetString();
+            if (mode == "reference") {
+                m_mode = LoopbackDetector::Mode::REFERENCE;
+            } else {
+                ThrowIfNot(mode == "wakeword", "invalidMode");
+                m_mode = LoopbackDetector::Mode::WAKEWORD;
+            }
+        }
+
+        if (configRoot.HasMember("matchThreshold") && configRoot["matchThreshold"].IsNumber()) {
+            m_matchThreshold = configRoot["matchThreshold"].GetFloat();
+        }
+
         return true;
     } catch (std::exception& ex) {
         AACE_WARN(LX(TAG, "configure").d("reason", ex.what()));
@@ -88,11 +101,15 @@ bool LoopbackDetectorEngineService::prepareVerifier() {
         auto alexaEngineService = getContext()->getService<alexa::AlexaEngineService>();
         ThrowIfNull(alexaEngineService, "AlexaEngineService is not available");
 
-        auto wwManager = alexaEngineService->getServiceInterface<alexa::WakewordEngineManager>();
-        ThrowIfNull(wwManager, "WakewordEngineManager has not been registered");
+        // the reference mode does not need a secondary wakeword engine
+        std::shared_ptr<alexa::WakewordEngineAdapter> secondaryAdapter;
+        if (m_mode == LoopbackDetector::Mode::WAKEWORD) {
+            auto wwManager = alexaEngineService->getServiceInterface<alexa::WakewordEngineManager>();
+            ThrowIfNull(wwManager, "WakewordEngineManager has not been registered");
 
-        auto secondaryAdapter =
-            wwManager->createAdapter(alexa::WakewordEngineManager::AdapterType::SECONDARY, m_wakewordEngineName);
+            secondaryAdapter =
+                wwManager->createAdapter(alexa::WakewordEngineManager::AdapterType::SECONDARY, m_wakewordEngineName);
+        }
 
         AudioFormat audioFormat;
         audioFormat.sampleRateHz = 16000;
@@ -104,7 +121,8 @@ bool LoopbackDetectorEngineService::prepareVerifier() {
 
         auto audioManager = getContext()->getServiceInterface<audio::AudioManagerInterface>("aace.audio");
 
-        m_wakewordVerifier = LoopbackDetector::create(audioFormat, audioManager, secondaryAdapter);
+        m_wakewordVerifier =
+            LoopbackDetector::create(audioFormat, audioManager, secondaryAdapter, m_mode, m_matchThreshold);
         ThrowIfNull(m_wakewordVerifier, "Failed to create LoopbackDetector");
 
         return true;
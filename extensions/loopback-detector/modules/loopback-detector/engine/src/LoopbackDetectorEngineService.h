@@ -23,6 +23,8 @@
 #include <AACE/Engine/Alexa/AlexaEngineService.h>
 #include <AACE/Engine/Alexa/WakewordVerifier.h>
 
+#include "LoopbackDetector.h"
+
 namespace aace {
 namespace engine {
 namespace loopbackDetector {
@@ -35,7 +37,7 @@ public:
     virtual ~LoopbackDetectorEngineService() = default;
 
 protected:
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configureFromValue(const rapidjson::Value& configuration) override;
     bool preRegister() override;
 
 private:
@@ -43,6 +45,8 @@ private:
     bool prepareVerifier();
 
     std::string m_wakewordEngineName;
+    LoopbackDetector::Mode m_mode = LoopbackDetector::Mode::WAKEWORD;
+    float m_matchThreshold = LoopbackDetector::DEFAULT_MATCH_THRESHOLD;
     std::shared_ptr<alexa::WakewordVerifier> m_wakewordVerifier;
 };
 
@@ -0,0 +1,303 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. and its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: LicenseRef-.amazon.com.-ASL-1.0
+ *
+ * Licensed under the Amazon Software License (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *  http://aws.amazon.com/asl/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#include "AudioFingerprinter.h"
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using aace::engine::loopbackDetector::AudioFingerprinter;
+
+static const unsigned int SAMPLE_RATE = 16000;
+static const std::chrono::milliseconds HISTORY_DURATION = std::chrono::seconds(5);
+/// The default match threshold of the LoopbackDetector.
+static const float MATCH_THRESHOLD = 0.7f;
+/// The duration of the wakeword segment of the microphone.
+static const size_t WAKEWORD_SAMPLES = SAMPLE_RATE * 8 / 10;
+/// The size of the audio delivered by the loopback channel.
+static const size_t CHUNK_SAMPLES = SAMPLE_RATE / 100;
+
+/**
+ * Synthesizes speech-like audio: voiced syllables with a random pitch and random formants, separated by pauses.
+ */
+static std::vector<int16_t> synthesizeSpeech(unsigned int seed, size_t size, float level = 8000) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> uniform(0, 1);
+    std::vector<int16_t> samples(size, 0);
+    const float pi = 3.14159265f;
+
+    for (size_t start = 0; start < size;) {
+        size_t length = SAMPLE_RATE * (0.12f + 0.2f * uniform(random));
+        float pitch = 90 + 160 * uniform(random);
+        float glide = (uniform(random) - 0.5f) * 60;
+        float formants[3] = {300 + 600 * uniform(random), 900 + 1500 * uniform(random), 2300 + 1200 * uniform(random)};
+        float phase = 0;
+        for (size_t i = 0; i < length && start + i < size; i++) {
+            float position = static_cast<float>(i) / length;
+            float frequency = pitch + glide * position;
+            phase += 2 * pi * frequency / SAMPLE_RATE;
+            float value = 0;
+            for (int harmonic = 1; harmonic * frequency < 4000; harmonic++) {
+                float weight = 0;
+                for (float formant : formants) {
+                    float distance = (harmonic * frequency - formant) / 150;
+                    weight += std::exp(-distance * distance);
+                }
+                value += weight * std::sin(harmonic * phase);
+            }
+            samples[start + i] = static_cast<int16_t>(level * 0.3f * value * std::sin(pi * position));
+        }
+        start += length + static_cast<size_t>(SAMPLE_RATE * (0.03f + 0.1f * uniform(random)));
+    }
+
+    return samples;
+}
+
+/**
+ * Simulates the acoustic path from the speaker to the microphone: a delay, a few reflections, attenuation and noise
+ * at the given signal to noise ratio.
+ */
+static std::vector<int16_t> simulateEcho(
+    const std::vector<int16_t>& reference,
+    size_t delay,
+    float snrDb,
+    unsigned int seed) {
+    std::mt19937 random(seed);
+    std::normal_distribution<float> noise(0, 1);
+    std::vector<float> echo(reference.size(), 0);
+    const size_t reflections[] = {0, 37, 113, 271};
+    const float gains[] = {0.4f, 0.25f, 0.12f, 0.06f};
+
+    float power = 0;
+    for (size_t i = 0; i < echo.size(); i++) {
+        for (size_t r = 0; r < 4; r++) {
+            if (i >= delay + reflections[r]) {
+                echo[i] += gains[r] * reference[i - delay - reflections[r]];
+            }
+        }
+        power += echo[i] * echo[i];
+    }
+
+    float noiseLevel = std::sqrt(power / echo.size() / std::pow(10.0f, snrDb / 10));
+    std::vector<int16_t> samples(echo.size());
+    for (size_t i = 0; i < echo.size(); i++) {
+        float value = echo[i] + noiseLevel * noise(random);
+        samples[i] = static_cast<int16_t>(std::max(-32768.0f, std::min(32767.0f, value)));
+    }
+
+    return samples;
+}
+
+static std::vector<int16_t> mix(const std::vector<int16_t>& first, const std::vector<int16_t>& second) {
+    std::vector<int16_t> samples(first.size());
+    for (size_t i = 0; i < first.size(); i++) {
+        int32_t value = first[i] + (i < second.size() ? second[i] : 0);
+        samples[i] = static_cast<int16_t>(std::max(-32768, std::min(32767, value)));
+    }
+    return samples;
+}
+
+/// Streams the reference to the fingerprinter in the chunks of the loopback channel.
+static void streamReference(AudioFingerprinter& fingerprinter, const std::vector<int16_t>& reference) {
+    for (size_t offset = 0; offset < reference.size(); offset += CHUNK_SAMPLES) {
+        fingerprinter.process(&reference[offset], std::min(CHUNK_SAMPLES, reference.size() - offset));
+    }
+}
+
+static float verifySegment(AudioFingerprinter& fingerprinter, const std::vector<int16_t>& segment) {
+    auto query = AudioFingerprinter::fingerprint(SAMPLE_RATE, segment.data(), segment.size());
+    return AudioFingerprinter::match(query, fingerprinter.getHistory());
+}
+
+/// Reads a 16-bit mono WAV file at the sample rate of the tests.
+static bool readWav(const std::string& path, std::vector<int16_t>& samples) {
+    std::ifstream file(path, std::ios::binary);
+    char header[12];
+    if (!file.read(header, sizeof(header)) || std::memcmp(header, "RIFF", 4) || std::memcmp(header + 8, "WAVE", 4)) {
+        return false;
+    }
+
+    bool formatValid = false;
+    char chunk[8];
+    while (file.read(chunk, sizeof(chunk))) {
+        uint32_t size = 0;
+        for (int i = 7; i >= 4; i--) {
+            size = size << 8 | static_cast<uint8_t>(chunk[i]);
+        }
+        std::vector<char> data(size + (size & 1));
+        // a truncated data chunk is read up to the end of the file
+        if (!file.read(data.data(), data.size()) && std::memcmp(chunk, "data", 4)) {
+            return false;
+        }
+        if (!std::memcmp(chunk, "fmt ", 4) && size >= 16) {
+            int16_t format, channels, bits;
+            uint32_t rate;
+            std::memcpy(&format, &data[0], 2);
+            std::memcpy(&channels, &data[2], 2);
+            std::memcpy(&rate, &data[4], 4);
+            std::memcpy(&bits, &data[14], 2);
+            formatValid = format == 1 && channels == 1 && rate == SAMPLE_RATE && bits == 16;
+        } else if (!std::memcmp(chunk, "data", 4)) {
+            samples.resize(file.gcount() / sizeof(int16_t));
+            std::memcpy(samples.data(), data.data(), samples.size() * sizeof(int16_t));
+            return formatValid;
+        }
+    }
+
+    return false;
+}
+
+TEST(AudioFingerprinterTest, matchesEchoOfReference) {
+    AudioFingerprinter fingerprinter(SAMPLE_RATE, HISTORY_DURATION);
+    auto reference = synthesizeSpeech(1, SAMPLE_RATE * 5);
+    auto mic = simulateEcho(reference, SAMPLE_RATE / 25, 10, 2);
+    streamReference(fingerprinter, reference);
+
+    std::vector<int16_t> segment(mic.begin() + SAMPLE_RATE * 3, mic.begin() + SAMPLE_RATE * 3 + WAKEWORD_SAMPLES);
+    EXPECT_GT(verifySegment(fingerprinter, segment), MATCH_THRESHOLD);
+}
+
+TEST(AudioFingerprinterTest, rejectsUnrelatedSpeech) {
+    AudioFingerprinter fingerprinter(SAMPLE_RATE, HISTORY_DURATION);
+    streamReference(fingerprinter, synthesizeSpeech(3, SAMPLE_RATE * 5));
+
+    auto segment = synthesizeSpeech(4, WAKEWORD_SAMPLES);
+    EXPECT_LT(verifySegment(fingerprinter, segment), MATCH_THRESHOLD);
+}
+
+TEST(AudioFingerprinterTest, silentReferenceNeverMatches) {
+    AudioFingerprinter fingerprinter(SAMPLE_RATE, HISTORY_DURATION);
+    streamReference(fingerprinter, std::vector<int16_t>(SAMPLE_RATE * 5, 0));
+    EXPECT_TRUE(fingerprinter.isSilent());
+
+    auto segment = synthesizeSpeech(5, WAKEWORD_SAMPLES);
+    EXPECT_EQ(verifySegment(fingerprinter, segment), 0.0f);
+}
+
+TEST(AudioFingerprinterTest, keepsOnlyRecentHistory) {
+    AudioFingerprinter fingerprinter(SAMPLE_RATE, HISTORY_DURATION);
+    streamReference(fingerprinter, synthesizeSpeech(6, SAMPLE_RATE * 10));
+    EXPECT_EQ(
+        fingerprinter.getHistory().size(), static_cast<size_t>(HISTORY_DURATION / AudioFingerprinter::HOP_DURATION));
+    EXPECT_FALSE(fingerprinter.isSilent());
+
+    // the speech leaves the history after its duration
+    streamReference(fingerprinter, std::vector<int16_t>(SAMPLE_RATE * 6, 0));
+    EXPECT_TRUE(fingerprinter.isSilent());
+
+    fingerprinter.reset();
+    EXPECT_TRUE(fingerprinter.getHistory().empty());
+}
+
+/**
+ * Measures the CPU cost and the decisions of the reference mode of the LoopbackDetector on synthesized
+ * microphone/loopback pairs: the echo of the reference alone must be cancelled, while a user speaking over silence,
+ * unrelated audio or the echo must not. Pairs recorded on a device are measured too when LOOPBACK_DETECTOR_PAIRS
+ * names a file listing "<mic.wav> <loopback.wav> <1 if the mic is an echo, 0 otherwise>" on each line, where the
+ * mic file is the wakeword segment and the loopback file the reference audio that ends with it. The measurements are
+ * recorded as properties of the test. Disabled by default, run with --gtest_also_run_disabled_tests.
+ */
+TEST(AudioFingerprinterTest, DISABLED_benchmark) {
+    const int trials = 40;
+    std::mt19937 random(7);
+    std::uniform_int_distribution<size_t> delays(0, SAMPLE_RATE / 5);
+    std::uniform_real_distribution<float> snrs(5, 20);
+
+    std::chrono::nanoseconds referenceTime(0), verifyTime(0);
+    size_t referenceSamples = 0, verifications = 0;
+    int echoesCancelled = 0, unrelatedCancelled = 0, doubleTalkCancelled = 0;
+
+    for (int trial = 0; trial < trials; trial++) {
+        auto reference = synthesizeSpeech(100 + trial, SAMPLE_RATE * 5);
+        auto user = synthesizeSpeech(200 + trial, WAKEWORD_SAMPLES, 12000);
+        auto echo = simulateEcho(reference, delays(random), snrs(random), 300 + trial);
+        size_t start = reference.size() - WAKEWORD_SAMPLES - SAMPLE_RATE / 10;
+        std::vector<int16_t> echoSegment(echo.begin() + start, echo.begin() + start + WAKEWORD_SAMPLES);
+
+        AudioFingerprinter fingerprinter(SAMPLE_RATE, HISTORY_DURATION);
+        auto begin = std::chrono::steady_clock::now();
+        streamReference(fingerprinter, reference);
+        referenceTime += std::chrono::steady_clock::now() - begin;
+        referenceSamples += reference.size();
+
+        for (int kind = 0; kind < 3; kind++) {
+            const std::vector<int16_t> segment = kind == 0 ? echoSegment : kind == 1 ? user : mix(user, echoSegment);
+            begin = std::chrono::steady_clock::now();
+            bool cancelled = verifySegment(fingerprinter, segment) > MATCH_THRESHOLD;
+            verifyTime += std::chrono::steady_clock::now() - begin;
+            verifications++;
+            (kind == 0 ? echoesCancelled : kind == 1 ? unrelatedCancelled : doubleTalkCancelled) += cancelled ? 1 : 0;
+        }
+    }
+
+    double referenceCost = std::chrono::duration<double, std::micro>(referenceTime).count() /
+                           (static_cast<double>(referenceSamples) / SAMPLE_RATE);
+    double verifyCost = std::chrono::duration<double, std::micro>(verifyTime).count() / verifications;
+    RecordProperty("referenceMicrosecondsPerSecond", static_cast<int>(referenceCost));
+    RecordProperty("verificationMicroseconds", static_cast<int>(verifyCost));
+    RecordProperty("echoesCancelled", echoesCancelled);
+    RecordProperty("unrelatedSpeechCancelled", unrelatedCancelled);
+    RecordProperty("speechOverEchoCancelled", doubleTalkCancelled);
+
+    EXPECT_GE(echoesCancelled, trials * 9 / 10);
+    EXPECT_LE(unrelatedCancelled, trials / 20);
+
+    const char* pairs = std::getenv("LOOPBACK_DETECTOR_PAIRS");
+    if (pairs == nullptr) {
+        return;
+    }
+    std::ifstream list(pairs);
+    ASSERT_TRUE(list.is_open()) << pairs;
+
+    int recorded = 0, correct = 0;
+    std::string line;
+    while (std::getline(list, line)) {
+        std::istringstream fields(line);
+        std::string micPath, loopbackPath;
+        int isEcho;
+        if (!(fields >> micPath >> loopbackPath >> isEcho)) {
+            continue;
+        }
+        std::vector<int16_t> mic, loopback;
+        ASSERT_TRUE(readWav(micPath, mic)) << micPath;
+        ASSERT_TRUE(readWav(loopbackPath, loopback)) << loopbackPath;
+
+        AudioFingerprinter fingerprinter(SAMPLE_RATE, HISTORY_DURATION);
+        streamReference(fingerprinter, loopback);
+        bool cancelled = verifySegment(fingerprinter, mic) > MATCH_THRESHOLD;
+        recorded++;
+        correct += cancelled == (isEcho != 0) ? 1 : 0;
+    }
+    RecordProperty("recordedPairs", recorded);
+    RecordProperty("recordedPairsDecidedCorrectly", correct);
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
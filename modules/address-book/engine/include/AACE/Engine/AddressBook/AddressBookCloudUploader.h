@@ -108,7 +108,8 @@ private:
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
         NetworkInfoObserver::NetworkStatus networkStatus,
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient);
 
 public:
     static std::shared_ptr<AddressBookCloudUploader> create(
@@ -117,7 +118,8 @@ public:
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
         NetworkInfoObserver::NetworkStatus networkStatus,
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient);
 
     // AddressBookObserver
     bool addressBookAdded(std::shared_ptr<AddressBookEntity> addressBookEntity) override;
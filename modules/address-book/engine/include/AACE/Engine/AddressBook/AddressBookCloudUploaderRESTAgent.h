@@ -24,15 +24,13 @@
 #include <queue>
 
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpDelete.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
 #include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
 #include <AVSCommon/Utils/DeviceInfo.h>
 
 #include <AACE/Engine/Alexa/AlexaEndpointInterface.h>
+#include <AACE/Engine/Alexa/HttpClient.h>
 
 namespace aace {
 namespace engine {
@@ -42,7 +40,8 @@ class AddressBookCloudUploaderRESTAgent {
 private:
     AddressBookCloudUploaderRESTAgent(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-        std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo);
+        std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient);
 
     bool initialize(std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
 
@@ -52,7 +51,8 @@ public:
     static std::shared_ptr<AddressBookCloudUploaderRESTAgent> create(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient);
 
     virtual ~AddressBookCloudUploaderRESTAgent() = default;
 
@@ -135,6 +135,7 @@ private:
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> m_authDelegate;
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> m_deviceInfo;
+    std::shared_ptr<aace::engine::alexa::HttpClient> m_httpClient;
 
     /// ACMS REST endpoint used for uploading.
     std::string m_acmsEndpoint;
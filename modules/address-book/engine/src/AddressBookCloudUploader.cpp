@@ -98,12 +98,19 @@ std::shared_ptr<AddressBookCloudUploader> AddressBookCloudUploader::create(
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
     NetworkInfoObserver::NetworkStatus networkStatus,
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) {
     try {
         auto addressBookCloudUploader = std::shared_ptr<AddressBookCloudUploader>(new AddressBookCloudUploader());
         ThrowIfNot(
             addressBookCloudUploader->initialize(
-                addressBookService, authDelegate, deviceInfo, networkStatus, networkObserver, alexaEndpoints),
+                addressBookService,
+                authDelegate,
+                deviceInfo,
+                networkStatus,
+                networkObserver,
+                alexaEndpoints,
+                httpClient),
             "initializeAddressBookCloudUploaderFailed");
 
         return addressBookCloudUploader;
@@ -119,7 +126,8 @@ bool AddressBookCloudUploader::initialize(
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
     NetworkInfoObserver::NetworkStatus networkStatus,
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) {
     try {
         m_addressBookService = addressBookService;
         m_authDelegate = authDelegate;
@@ -128,7 +136,7 @@ bool AddressBookCloudUploader::initialize(
         m_networkObserver = networkObserver;
 
         m_addressBookCloudUploaderRESTAgent = aace::engine::addressBook::AddressBookCloudUploaderRESTAgent::create(
-            authDelegate, m_deviceInfo, alexaEndpoints);
+            authDelegate, m_deviceInfo, alexaEndpoints, httpClient);
         ThrowIfNull(m_addressBookCloudUploaderRESTAgent, "createAddressBookCloudRESTAgentFailed");
 
         m_authDelegate->addAuthObserver(shared_from_this());
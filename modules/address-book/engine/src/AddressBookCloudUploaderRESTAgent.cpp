@@ -68,6 +68,9 @@ const std::string AUTO_SDK_NAVIGATION_ADDRESS_ADDRESS_BOOK_TYPE = "automotivePos
 /// Default value for the Address Book Name @c ACMS
 const std::string AUTO_SDK_DEFAULT_ADDRESS_BOOK_NAME = "AutoSDK";
 
+/// Identifies the address book requests to the shared @c HttpClient
+static const std::string HTTP_CLIENT_ID = "addressBook";
+
 /// Default value for the HTTP request timeout.
 static const std::chrono::seconds DEFAULT_HTTP_TIMEOUT = std::chrono::seconds(60);
 
@@ -100,18 +103,25 @@ static const std::string GET_ADDRESS_BOOK_QUERY = "?addressBookSourceIds=";
 
 AddressBookCloudUploaderRESTAgent::AddressBookCloudUploaderRESTAgent(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo) :
-        m_authDelegate(authDelegate), m_deviceInfo(deviceInfo), m_acmsEndpoint(DEFAULT_ACMS_ENDPOINT) {
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) :
+        m_authDelegate(authDelegate),
+        m_deviceInfo(deviceInfo),
+        m_httpClient(httpClient),
+        m_acmsEndpoint(DEFAULT_ACMS_ENDPOINT) {
 }
 
 std::shared_ptr<AddressBookCloudUploaderRESTAgent> AddressBookCloudUploaderRESTAgent::create(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) {
     try {
+        ThrowIfNull(httpClient, "nullHttpClient");
+
         std::shared_ptr<AddressBookCloudUploaderRESTAgent> addressBookCloudRESTAgent =
             std::shared_ptr<AddressBookCloudUploaderRESTAgent>(
-                new AddressBookCloudUploaderRESTAgent(authDelegate, deviceInfo));
+                new AddressBookCloudUploaderRESTAgent(authDelegate, deviceInfo, httpClient));
         ThrowIfNot(
             addressBookCloudRESTAgent->initialize(alexaEndpoints), "initializeAddressBookCloudUploaderRESTAgentFailed");
 
@@ -169,49 +179,19 @@ AddressBookCloudUploaderRESTAgent::HTTPResponse AddressBookCloudUploaderRESTAgen
     const std::vector<std::string> headerLines,
     const std::string& data,
     std::chrono::seconds timeout) {
-    try {
-        // Creating the HttpPost on every doPost is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpPost = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPost::create();
-        ThrowIfNull(httpPost, "nullHttpPost");
-
-        return httpPost->doPost(url, headerLines, data, timeout);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "doPost").d("reason", ex.what()));
-        return AddressBookCloudUploaderRESTAgent::HTTPResponse();
-    }
+    return m_httpClient->doPost(HTTP_CLIENT_ID, url, headerLines, data, timeout);
 }
 
 AddressBookCloudUploaderRESTAgent::HTTPResponse AddressBookCloudUploaderRESTAgent::doGet(
     const std::string& url,
     const std::vector<std::string>& headers) {
-    try {
-        // Creating the HttpGet on every doGet is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-        ThrowIfNull(httpGet, "nullHttpGet");
-
-        return httpGet->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "doGet").d("reason", ex.what()));
-        return AddressBookCloudUploaderRESTAgent::HTTPResponse();
-    }
+    return m_httpClient->doGet(HTTP_CLIENT_ID, url, headers, DEFAULT_HTTP_TIMEOUT);
 }
 
 AddressBookCloudUploaderRESTAgent::HTTPResponse AddressBookCloudUploaderRESTAgent::doDelete(
     const std::string& url,
     const std::vector<std::string>& headers) {
-    try {
-        // Creating the HttpDelete on every doDelete is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpDelete = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpDelete::create();
-        ThrowIfNull(httpDelete, "nullHttpDelete");
-
-        return httpDelete->doDelete(url, headers, DEFAULT_HTTP_TIMEOUT);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "doDelete").d("reason", ex.what()));
-        return AddressBookCloudUploaderRESTAgent::HTTPResponse();
-    }
+    return m_httpClient->doDelete(HTTP_CLIENT_ID, url, headers, DEFAULT_HTTP_TIMEOUT);
 }
 
 std::string AddressBookCloudUploaderRESTAgent::getHTTPErrorString(const HTTPResponse& response) {
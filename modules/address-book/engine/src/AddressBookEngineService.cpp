@@ -106,8 +106,17 @@ bool AddressBookEngineService::registerPlatformInterfaceType(
             getContext()->getServiceInterface<aace::engine::alexa::AlexaEndpointInterface>("aace.alexa");
         ThrowIfNull(alexaEndpoints, "alexaEndpointsInvalid");
 
+        auto httpClient = getContext()->getServiceInterface<aace::engine::alexa::HttpClient>("aace.alexa");
+        ThrowIfNull(httpClient, "httpClientInvalid");
+
         m_addressBookCloudUploader = aace::engine::addressBook::AddressBookCloudUploader::create(
-            m_addressBookEngineImpl, authDelegate, deviceInfo, networkStatus, networkObserver, alexaEndpoints);
+            m_addressBookEngineImpl,
+            authDelegate,
+            deviceInfo,
+            networkStatus,
+            networkObserver,
+            alexaEndpoints,
+            httpClient);
         ThrowIfNull(m_addressBookCloudUploader, "createAddressBookCloudUploaderFailed");
 
         // set the engine interface reference
@@ -126,7 +126,8 @@ public:
             std::move(deviceInfo),
             aace::network::NetworkInfoProvider::NetworkStatus::CONNECTED,
             m_mockNetworkObservableInterface,
-            m_alexaEndpointInterface);
+            m_alexaEndpointInterface,
+            aace::engine::alexa::HttpClient::create());
     }
 
     void TearDown() override {
@@ -74,10 +74,12 @@
 #include <System/SoftwareInfoSender.h>
 #include <System/UserInactivityMonitor.h>
 
+#include "AACE/Engine/Alexa/HttpClient.h"
 #include "AACE/Engine/Alexa/LocaleAssetsManager.h"
 #include "AACE/Engine/Alexa/ExternalMediaAdapterRegistrationInterface.h"
 #include "AACE/Engine/Audio/AudioEngineService.h"
 #include "AACE/Engine/Core/EngineService.h"
+#include "AACE/Engine/Location/LocationCache.h"
 #include "AACE/Engine/Location/LocationEngineService.h"
 #include "AACE/Engine/Logger/LoggerEngineService.h"
 #include "AACE/Engine/Network/NetworkEngineService.h"
@@ -279,7 +281,7 @@ public:
 
 protected:
     bool initialize() override;
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configureFromValue(const rapidjson::Value& configuration) override;
     bool setup() override;
     bool start() override;
     bool stop() override;
@@ -368,6 +370,7 @@ private:
     std::shared_ptr<AlexaEngineGlobalSettingsObserver> m_globalSettingsObserver;
     std::shared_ptr<AlexaEngineSoftwareInfoSenderObserver> m_softwareInfoSenderObserver;
     std::shared_ptr<AuthDelegateRouter> m_authDelegateRouter;
+    std::shared_ptr<HttpClient> m_httpClient;
     std::shared_ptr<HttpPutDelegate> m_httpPutDelegate;
     std::shared_ptr<PlaybackRouterDelegate> m_playbackRouterDelegate;
     std::shared_ptr<SystemSoundPlayer> m_systemSoundPlayer;
@@ -400,6 +403,8 @@ private:
     bool m_previousAVSConnectionState = false;
     bool m_speakerManagerEnabled;
     std::string m_timezone;
+    /// Size of the AudioPlayer prefetch buffer in bytes, or 0 if prefetch is disabled.
+    size_t m_audioPlayerPrefetchBufferSize = 0;
 
     // engine implementation object references
     std::shared_ptr<aace::engine::alexa::AlertsEngineImpl> m_alertsEngineImpl;
@@ -446,12 +451,12 @@ class AlexaEngineLocationStateProvider
         , public alexaClientSDK::avsCommon::utils::RequiresShutdown {
 private:
     AlexaEngineLocationStateProvider(
-        std::shared_ptr<aace::location::LocationProvider> locationProvider,
+        std::shared_ptr<aace::engine::location::LocationCache> locationCache,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager);
 
 public:
     static std::shared_ptr<AlexaEngineLocationStateProvider> create(
-        std::shared_ptr<aace::location::LocationProvider> locationProvider,
+        std::shared_ptr<aace::engine::location::LocationCache> locationCache,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager);
 
     void provideState(
@@ -466,10 +471,19 @@ private:
         const alexaClientSDK::avsCommon::avs::NamespaceAndName& stateProviderName,
         const unsigned int stateRequestToken);
 
+    /**
+     * Builds the context payload for a location
+     */
+    static std::string buildPayload(aace::location::Location location);
+
 private:
-    std::shared_ptr<aace::location::LocationProvider> m_locationProvider;
+    std::shared_ptr<aace::engine::location::LocationCache> m_locationCache;
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> m_contextManager;
     alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
+
+    /// The last context payload, reused while the cached location has the same version
+    std::string m_payload;
+    uint64_t m_payloadVersion = 0;
 };
 
 //
@@ -542,14 +556,19 @@ private:
 // HttpPutDelegate
 //
 // AVS CapabilitiesDelegate HttpPut reference cannot be updated when the network interface changes, and to avoid
-// changing to the AVS module, the HttpPutDelete shall help in delegating the HTTP calls which then ensure that
-// curl (inside the libcurlUtils ) uses latest configured curl options.
+// changing to the AVS module, the HttpPutDelete shall help in delegating the HTTP calls to the shared HttpClient,
+// which applies the latest configured curl options to each request.
 class HttpPutDelegate : public alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPutInterface {
 public:
+    HttpPutDelegate(std::shared_ptr<HttpClient> httpClient);
+
     alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse doPut(
         const std::string& url,
         const std::vector<std::string>& headers,
         const std::string& data) override;
+
+private:
+    std::shared_ptr<HttpClient> m_httpClient;
 };
 
 }  // namespace alexa
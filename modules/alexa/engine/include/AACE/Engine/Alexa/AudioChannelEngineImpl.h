@@ -17,7 +17,7 @@
 #define AACE_ENGINE_ALEXA_AUDIO_CHANNEL_ENGINE_IMPL_H
 
 #include <istream>
-#include <set>
+#include <map>
 #include <atomic>
 
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
@@ -33,6 +33,9 @@
 #include <AACE/Alexa/AlexaEngineInterfaces.h>
 #include <AACE/Engine/Audio/AudioOutputChannelInterface.h>
 
+#include "AudioPrefetcher.h"
+#include "MediaPositionClock.h"
+
 namespace aace {
 namespace engine {
 namespace alexa {
@@ -68,6 +71,7 @@ public:
     //
     void onMediaStateChanged(MediaState state) override;
     void onMediaError(MediaError error, const std::string& description) override;
+    void onMediaPositionChanged(int64_t position) override;
 
     //
     // alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface
@@ -131,6 +135,13 @@ protected:
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ChannelVolumeInterface> getChannelVolumeInterface();
 
+    /**
+     * Enables prebuffering of the next source. When enabled, a source set while the current source
+     * is active is held as the next source, and URL sources are prefetched with @c prefetcher until
+     * the next source is played.
+     */
+    void setAudioPrefetcher(std::shared_ptr<AudioPrefetcher> prefetcher);
+
 private:
     enum class PendingEventState { NONE, PLAYBACK_STARTED, PLAYBACK_PAUSED, PLAYBACK_RESUMED, PLAYBACK_STOPPED };
 
@@ -140,11 +151,22 @@ private:
     void sendEvent(PendingEventState state);
     void resetSource();
 
+    // next source methods
+    bool isPrebufferRequest();
+    SourceId setNextSource(
+        const std::string& url,
+        std::shared_ptr<class AttachmentReaderAudioStream> attachmentStream,
+        std::chrono::milliseconds offset,
+        bool repeat);
+    bool promoteNextSource();
+    void resetNextSource();
+
     //
     // MediaPlayerEngineInterface executor methods
     //
     void executeMediaStateChanged(SourceId id, MediaState state);
     void executeMediaError(SourceId id, MediaError error, const std::string& description);
+    void executeMediaPositionChanged(SourceId id, int64_t position);
     void executePlaybackStarted(SourceId id);
     void executePlaybackFinished(SourceId id);
     void executePlaybackPaused(SourceId id);
@@ -153,6 +175,7 @@ private:
     void executePlaybackError(SourceId id, MediaError error, const std::string& description);
     void executeBufferUnderrun(SourceId id);
     void executeBufferRefilled(SourceId id);
+    void executeNextSourceStopped(SourceId id, std::chrono::milliseconds offset);
 
     friend std::ostream& operator<<(std::ostream& stream, const PendingEventState& state);
 
@@ -167,9 +190,13 @@ private:
     // mutex to serialize access to m_mediaPlayerObservers
     std::mutex m_mediaPlayerObserverMutex;
 
-    // access to m_mediaPlayerObservers is protected by m_mediaPlayerObserverMutex
+    // access to m_mediaPlayerObservers is protected by m_mediaPlayerObserverMutex. Each observer is notified once, and
+    // counts the players of the pool it was added through, so removing it from one player keeps it for the other.
     using MediaPlayerObserverInterface = alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface;
-    std::set<std::weak_ptr<MediaPlayerObserverInterface>, std::owner_less<std::weak_ptr<MediaPlayerObserverInterface>>>
+    std::map<
+        std::weak_ptr<MediaPlayerObserverInterface>,
+        size_t,
+        std::owner_less<std::weak_ptr<MediaPlayerObserverInterface>>>
         m_mediaPlayerObservers;
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerManagerInterface> m_speakerManager;
@@ -185,6 +212,17 @@ private:
     MediaState m_currentMediaState;
     MediaStateChangeInitiator m_mediaStateChangeInitiator;
 
+    // playback position of the current source, re-anchored on platform media state and position changes
+    MediaPositionClock m_positionClock;
+
+    // the source prebuffered while the current source is active
+    std::shared_ptr<AudioPrefetcher> m_prefetcher;
+    SourceId m_nextId;
+    std::string m_nextUrl;
+    std::chrono::milliseconds m_nextOffset;
+    bool m_nextRepeat;
+    std::shared_ptr<class AttachmentReaderAudioStream> m_nextAttachmentStream;
+
     // executor used to send asynchronous events back to observer
     alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
 
@@ -219,6 +257,62 @@ inline std::ostream& operator<<(std::ostream& stream, const AudioChannelEngineIm
     return stream;
 }
 
+//
+// PooledAudioChannelPlayer
+//
+
+/**
+ * A player of the pool of media players of an @c AudioChannelEngineImpl that prebuffers the next source. Each player
+ * of the pool is its own object, which controls only the source that was last set through it, so stopping or
+ * releasing one player does not affect the source of the other player.
+ */
+class PooledAudioChannelPlayer : public alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface {
+public:
+    PooledAudioChannelPlayer(std::shared_ptr<AudioChannelEngineImpl> audioChannel);
+
+    //
+    // alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface
+    //
+    SourceId setSource(
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
+        const alexaClientSDK::avsCommon::utils::AudioFormat* format,
+        const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config) override;
+    SourceId setSource(
+        std::shared_ptr<std::istream> stream,
+        bool repeat,
+        const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config,
+        alexaClientSDK::avsCommon::utils::MediaType format) override;
+    SourceId setSource(
+        const std::string& url,
+        std::chrono::milliseconds offset,
+        const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config,
+        bool repeat) override;
+    bool play(SourceId id) override;
+    bool stop(SourceId id) override;
+    bool pause(SourceId id) override;
+    bool resume(SourceId id) override;
+    std::chrono::milliseconds getOffset(SourceId id) override;
+    uint64_t getNumBytesBuffered() override;
+    alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState>
+    getMediaPlayerState(SourceId id) override;
+    void addObserver(
+        std::shared_ptr<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface> observer) override;
+    void removeObserver(
+        std::shared_ptr<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface> observer) override;
+
+private:
+    /// Records the source set through this player, and returns it.
+    SourceId setSourceId(SourceId id);
+
+    /// Returns whether @c id is the source of this player.
+    bool ownsSource(SourceId id);
+
+private:
+    std::shared_ptr<AudioChannelEngineImpl> m_audioChannel;
+    SourceId m_sourceId;
+    std::mutex m_mutex;
+};
+
 //
 // AttachmentReaderAudioStream
 //
@@ -227,25 +321,46 @@ class AttachmentReaderAudioStream : public aace::audio::AudioStream {
 private:
     AttachmentReaderAudioStream(
         std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
-        const AudioFormat& audioFormat = AudioFormat::UNKNOWN);
+        const AudioFormat& audioFormat = AudioFormat::UNKNOWN,
+        MediaType mediaType = MediaType::UNKNOWN);
 
 public:
     static std::shared_ptr<AttachmentReaderAudioStream> create(
         std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
         const alexaClientSDK::avsCommon::utils::AudioFormat* format);
 
+    /**
+     * Creates a stream of content whose format is known to the engine, such as a download of a URL.
+     */
+    static std::shared_ptr<AttachmentReaderAudioStream> create(
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
+        const AudioFormat& audioFormat,
+        MediaType mediaType);
+
     // aace::audio::AudioStream
     ssize_t read(char* data, const size_t size) override;
+    ssize_t readBlocking(char* data, const size_t size, std::chrono::milliseconds timeout) override;
     bool isClosed() override;
     AudioFormat getAudioFormat() override;
+    MediaType getMediaType() override;
+    ReadStatistics getReadStatistics() override;
 
     void close();
 
+private:
+    ssize_t readAttachment(char* data, const size_t size, std::chrono::milliseconds timeout);
+
 private:
     std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> m_attachmentReader;
     alexaClientSDK::avsCommon::avs::attachment::AttachmentReader::ReadStatus m_status;
     std::atomic<bool> m_closed;
     AudioFormat m_audioFormat;
+    MediaType m_mediaType;
+
+    // read counters reported by getReadStatistics()
+    std::atomic<uint64_t> m_bytesRead;
+    std::atomic<uint64_t> m_readCount;
+    std::atomic<uint64_t> m_underrunCount;
 };
 
 //
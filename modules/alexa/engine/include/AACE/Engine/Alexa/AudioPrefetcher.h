@@ -0,0 +1,124 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_AUDIO_PREFETCHER_H
+#define AACE_ENGINE_ALEXA_AUDIO_PREFETCHER_H
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <AVSCommon/AVS/Attachment/AttachmentReader.h>
+#include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
+#include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterfaceFactoryInterface.h>
+#include <AVSCommon/Utils/HTTPContent.h>
+
+#include <AACE/Audio/AudioStream.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * Downloads the beginning of the next queued AudioPlayer URL into a bounded in-memory buffer
+ * while the current item is still playing, so the platform can start the next item without
+ * waiting for DNS, TLS and initial buffering.
+ *
+ * At most two downloads are held at a time: the pending item, and the item that was most
+ * recently acquired and is still being streamed to the platform. Each download is backed by
+ * a buffer of @c maxBufferSize bytes, and the download is throttled once the buffer is full.
+ */
+class AudioPrefetcher {
+private:
+    AudioPrefetcher(
+        size_t maxBufferSize,
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface>
+            contentFetcherFactory);
+
+public:
+    /**
+     * Creates an AudioPrefetcher.
+     *
+     * @param maxBufferSize The size of the buffer of each download, in bytes
+     * @param contentFetcherFactory The factory of the downloads, or @c nullptr to download with libcurl
+     */
+    static std::shared_ptr<AudioPrefetcher> create(
+        size_t maxBufferSize,
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface>
+            contentFetcherFactory = nullptr);
+
+    /**
+     * Starts downloading @c url into the prefetch buffer, replacing any pending download.
+     *
+     * @return @c true if the download was started, @c false if the url cannot be prefetched
+     */
+    bool prefetch(const std::string& url);
+
+    /**
+     * Returns a stream of the prefetched content for @c url, or @c nullptr if @c url was not prefetched, or if the
+     * server has not responded yet. The stream continues with the rest of the download once the prefetched data has
+     * been read. This method does not block, so the caller can fall back to playing @c url directly.
+     */
+    std::shared_ptr<aace::audio::AudioStream> acquire(const std::string& url);
+
+    /**
+     * Cancels the pending download, if any.
+     */
+    void cancel();
+
+    /**
+     * Cancels all downloads.
+     */
+    void shutdown();
+
+private:
+    struct Download {
+        ~Download();
+
+        std::string url;
+        std::unique_ptr<alexaClientSDK::avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher;
+        std::unique_ptr<alexaClientSDK::avsCommon::utils::HTTPContent> content;
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> reader;
+        std::chrono::steady_clock::time_point startTime;
+    };
+
+    static bool isPrefetchable(const std::string& url);
+
+    /// Returns the media type of a download from the content type of its response
+    static aace::audio::AudioStream::MediaType getMediaType(const std::string& contentType);
+
+private:
+    size_t m_maxBufferSize;
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface>
+        m_contentFetcherFactory;
+
+    // the download of the next queued item
+    std::unique_ptr<Download> m_pending;
+
+    // the download currently being streamed to the platform
+    std::unique_ptr<Download> m_active;
+
+    bool m_shutdown;
+
+    // guards the downloads, which are released outside of the lock since releasing a download waits for its fetcher
+    std::mutex m_mutex;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_AUDIO_PREFETCHER_H
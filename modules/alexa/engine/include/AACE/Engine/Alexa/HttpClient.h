@@ -0,0 +1,185 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_HTTP_CLIENT_H
+#define AACE_ENGINE_ALEXA_HTTP_CLIENT_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * Performs the HTTP requests of the Engine's REST clients over a shared pool of libcurl handles.
+ *
+ * The handles are kept between requests, and share one DNS cache, TLS session cache and connection cache, so
+ * consecutive requests to the same host reuse an open connection instead of connecting and negotiating TLS again.
+ * HTTP/2 is negotiated where the server supports it.
+ *
+ * Each client identifies itself with a client ID, and the number of concurrent requests of a client is limited so
+ * one client cannot hold all of the connections. A request that would exceed the limit waits for a request of the
+ * same client to complete, for at most the timeout of the request.
+ *
+ * Handles apply the network interface set with @c CurlEasyHandleWrapper::setInterfaceName() for each request.
+ * @c resetConnections() closes the idle connections when the network interface changes.
+ */
+class HttpClient {
+public:
+    using HTTPResponse = alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse;
+
+    /// The default maximum number of idle handles kept for reuse
+    static const size_t DEFAULT_MAX_IDLE_CONNECTIONS = 4;
+
+    /// The default maximum number of concurrent requests of a client
+    static const size_t DEFAULT_MAX_CONCURRENT_REQUESTS = 2;
+
+    /// The timeout of requests that do not specify one
+    static const std::chrono::seconds DEFAULT_REQUEST_TIMEOUT;
+
+    /**
+     * Creates an @c HttpClient.
+     *
+     * @param [in] maxIdleConnections The maximum number of idle handles kept for reuse
+     * @param [in] maxConcurrentRequests The maximum number of concurrent requests of a client, unless set for the
+     *             client with @c setMaxConcurrentRequests(). Must be at least 1.
+     */
+    static std::shared_ptr<HttpClient> create(
+        size_t maxIdleConnections = DEFAULT_MAX_IDLE_CONNECTIONS,
+        size_t maxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS);
+
+    ~HttpClient();
+
+    HTTPResponse doGet(
+        const std::string& clientId,
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        std::chrono::seconds timeout = DEFAULT_REQUEST_TIMEOUT);
+
+    HTTPResponse doPost(
+        const std::string& clientId,
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout = DEFAULT_REQUEST_TIMEOUT);
+
+    /**
+     * Posts @c data as form data, with the names and values URL encoded.
+     */
+    HTTPResponse doPost(
+        const std::string& clientId,
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::vector<std::pair<std::string, std::string>>& data,
+        std::chrono::seconds timeout = DEFAULT_REQUEST_TIMEOUT);
+
+    HTTPResponse doPut(
+        const std::string& clientId,
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout = DEFAULT_REQUEST_TIMEOUT);
+
+    HTTPResponse doDelete(
+        const std::string& clientId,
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        std::chrono::seconds timeout = DEFAULT_REQUEST_TIMEOUT);
+
+    /**
+     * Sets the maximum number of concurrent requests of a client.
+     *
+     * @return @c false if @c maxConcurrentRequests is 0
+     */
+    bool setMaxConcurrentRequests(const std::string& clientId, size_t maxConcurrentRequests);
+
+    /**
+     * Closes the idle connections and releases the pooled handles. Requests in progress complete on their
+     * connection, which is closed when the request completes.
+     */
+    void resetConnections();
+
+private:
+    enum class Method { GET, POST, PUT, DELETE };
+
+    /// Owns the libcurl share handle used by the pooled handles
+    class Share;
+
+    /// A handle leased for one request
+    struct Lease {
+        std::shared_ptr<Share> share;
+        std::unique_ptr<alexaClientSDK::avsCommon::utils::libcurlUtils::CurlEasyHandleWrapper> curl;
+        uint64_t generation;
+    };
+
+    HttpClient(size_t maxIdleConnections, size_t maxConcurrentRequests);
+
+    HTTPResponse doRequest(
+        Method method,
+        const std::string& clientId,
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout);
+
+    bool acquireRequestSlot(const std::string& clientId, std::chrono::steady_clock::time_point deadline);
+    void releaseRequestSlot(const std::string& clientId);
+
+    Lease acquireHandle();
+    void releaseHandle(Lease lease);
+
+    static std::string urlEncode(const std::string& value);
+
+    static HTTPResponse perform(
+        Lease& lease,
+        Method method,
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout);
+
+private:
+    size_t m_maxIdleConnections;
+    size_t m_maxConcurrentRequests;
+
+    std::unordered_map<std::string, size_t> m_clientMaxConcurrentRequests;
+    std::unordered_map<std::string, size_t> m_clientActiveRequests;
+    std::condition_variable m_requestSlotReleased;
+
+    std::shared_ptr<Share> m_share;
+    std::vector<std::unique_ptr<alexaClientSDK::avsCommon::utils::libcurlUtils::CurlEasyHandleWrapper>> m_idleHandles;
+
+    /// Incremented by @c resetConnections(), so handles leased before the reset are not returned to the pool
+    uint64_t m_generation;
+
+    std::mutex m_mutex;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_HTTP_CLIENT_H
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_MEDIA_POSITION_CLOCK_H
+#define AACE_ENGINE_ALEXA_MEDIA_POSITION_CLOCK_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * Interpolates the playback position of a platform media player between position reports.
+ *
+ * The clock is anchored on a position reported by the platform. While running, the position
+ * advances with @c std::chrono::steady_clock from the anchor, and while stopped it is held at
+ * the anchor. An anchor position of @c TIME_UNKNOWN is never advanced.
+ */
+class MediaPositionClock {
+public:
+    static const int64_t TIME_UNKNOWN = -1;
+
+    MediaPositionClock();
+
+    /**
+     * Anchors the clock on @c position and sets whether the position advances from it.
+     */
+    void anchor(int64_t position, bool running);
+
+    /**
+     * Anchors the clock on @c position without changing whether the position advances.
+     */
+    void reanchor(int64_t position);
+
+    /**
+     * Returns the interpolated playback position in milliseconds, or @c TIME_UNKNOWN.
+     */
+    int64_t getPosition();
+
+    bool isRunning();
+
+private:
+    std::chrono::steady_clock::time_point m_anchorTime;
+    int64_t m_anchorPosition;
+    bool m_running;
+
+    std::mutex m_mutex;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_MEDIA_POSITION_CLOCK_H
@@ -16,7 +16,11 @@
 #ifndef AACE_ENGINE_ALEXA_INTERFACE_WAKEWORD_VERIFIER_H
 #define AACE_ENGINE_ALEXA_INTERFACE_WAKEWORD_VERIFIER_H
 
+#include <chrono>
 #include <memory>
+#include <string>
+
+#include <AVSCommon/AVS/AudioInputStream.h>
 
 namespace aace {
 namespace engine {
@@ -28,6 +32,25 @@ public:
     virtual ~WakewordVerifier() = default;
 
     virtual bool verify(const std::string& wakeword, const std::chrono::milliseconds& timeout) = 0;
+
+    /**
+     * Verifies a detection with the audio it was detected in. Returns @c true if the detection should be cancelled.
+     * The default implementation ignores the audio and calls @c verify().
+     *
+     * @param wakeword The detected wakeword.
+     * @param stream The stream the wakeword was detected in.
+     * @param beginIndex The index of the first sample of the wakeword, or @c UNSPECIFIED_INDEX.
+     * @param endIndex The index of the last sample of the wakeword, or @c UNSPECIFIED_INDEX.
+     * @param timeout The maximum time to wait for the verification.
+     */
+    virtual bool verifyDetection(
+        const std::string& wakeword,
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index beginIndex,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex,
+        const std::chrono::milliseconds& timeout) {
+        return verify(wakeword, timeout);
+    }
 };
 
 }  // namespace alexa
@@ -28,7 +28,6 @@
 #include <AVSCommon/SDKInterfaces/AVSGatewayManagerInterface.h>
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/Utils/LibcurlUtils/LibcurlHTTP2ConnectionFactory.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpPut.h>
 #include <AVSGatewayManager/Storage/AVSGatewayManagerStorage.h>
 #include <CapabilitiesDelegate/Storage/SQLiteCapabilitiesDelegateStorage.h>
 #include <CertifiedSender/SQLiteMessageStorage.h>
@@ -65,6 +64,9 @@ static const std::string TAG("aace.alexa.AlexaEngineService");
 // name of the table used for the local storage database
 static const std::string ALEXA_SERVICE_LOCAL_STORAGE_TABLE = "aace.alexa";
 
+// default AudioPlayer prefetch buffer size, about 30 seconds of 128 kbps audio
+static const size_t DEFAULT_AUDIO_PLAYER_PREFETCH_BUFFER_SIZE = 512 * 1024;
+
 // state provider constants
 static const alexaClientSDK::avsCommon::avs::NamespaceAndName LOCATION_STATE{"Geolocation", "GeolocationState"};
 
@@ -145,7 +147,8 @@ bool AlexaEngineService::registerProperties() {
                 std::placeholders::_2,
                 std::placeholders::_3,
                 std::placeholders::_4),
-            std::bind(&AlexaEngineService::getProperty_firmwareVersion, this)));
+            std::bind(&AlexaEngineService::getProperty_firmwareVersion, this),
+            true));
 
         // Register property - WAKEWORD_SUPPORTED
         propertyManager->registerProperty(aace::engine::propertyManager::PropertyDescription(
@@ -163,13 +166,15 @@ bool AlexaEngineService::registerProperties() {
                 std::placeholders::_2,
                 std::placeholders::_3,
                 std::placeholders::_4),
-            std::bind(&AlexaEngineService::getProperty_locale, this)));
+            std::bind(&AlexaEngineService::getProperty_locale, this),
+            true));
 
         // Register property - SUPPORTED_LOCALES
         propertyManager->registerProperty(aace::engine::propertyManager::PropertyDescription(
             aace::alexa::property::SUPPORTED_LOCALES,
             nullptr,
-            std::bind(&AlexaEngineService::getProperty_supportedLocales, this)));
+            std::bind(&AlexaEngineService::getProperty_supportedLocales, this),
+            true));
 
         // Register property - COUNTRY_SUPPORTED
         propertyManager->registerProperty(aace::engine::propertyManager::PropertyDescription(
@@ -199,7 +204,8 @@ bool AlexaEngineService::registerProperties() {
                 std::placeholders::_2,
                 std::placeholders::_3,
                 std::placeholders::_4),
-            std::bind(&AlexaEngineService::getProperty_timezone, this)));
+            std::bind(&AlexaEngineService::getProperty_timezone, this),
+            true));
 
         return true;
     } catch (std::exception& ex) {
@@ -232,8 +238,13 @@ bool AlexaEngineService::configureDeviceSDK(std::shared_ptr<std::istream> config
         m_authDelegateRouter = std::make_shared<AuthDelegateRouter>();
         m_authDelegateRouter->addAuthObserver(shared_from_this());
 
-        // Create the HTTP put delegate - Creates an HTTPPut handler instance on each put
-        m_httpPutDelegate = std::shared_ptr<HttpPutDelegate>(new HttpPutDelegate());
+        // Create the HTTP client - Performs the HTTP requests of the Engine's REST clients over pooled connections
+        m_httpClient = HttpClient::create();
+        ThrowIfNull(m_httpClient, "createHttpClientFailed");
+        ThrowIfNot(registerServiceInterface<HttpClient>(m_httpClient), "registerHttpClientServiceInterfaceFailed");
+
+        // Create the HTTP put delegate - Performs the capabilities delegate puts with the HTTP client
+        m_httpPutDelegate = std::shared_ptr<HttpPutDelegate>(new HttpPutDelegate(m_httpClient));
         ThrowIfNull(m_httpPutDelegate, "couldNotCreateHttpPutDelegate");
 
         // Create the capabilities delegate - Allows the client to publish the device's capabilities to Alexa through
@@ -509,23 +520,18 @@ bool AlexaEngineService::configureDeviceSDK(std::shared_ptr<std::istream> config
     }
 }
 
-bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool AlexaEngineService::configureFromValue(const rapidjson::Value& configuration) {
     try {
-        auto document = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(document, "parseConfigurationStreamFailed");
+        ThrowIfNot(configuration.IsObject(), "invalidConfiguration");
 
-        auto alexaConfigRoot = document->GetObject();
+        auto alexaConfigRoot = configuration.GetObject();
 
+        // copy the device sdk config from "aace.alexa" first, since the defaults below are added to it
         rapidjson::Document deviceSDKConfig(rapidjson::kObjectType);
-        auto deviceSDKConfigRoot = deviceSDKConfig.GetObject();
-
-        // copy the device sdk config from "aace.alexa" first
         if (alexaConfigRoot.HasMember("avsDeviceSDK") && alexaConfigRoot["avsDeviceSDK"].IsObject()) {
-            ThrowIfNot(
-                aace::engine::utils::json::merge(
-                    deviceSDKConfigRoot, alexaConfigRoot["avsDeviceSDK"].GetObject(), deviceSDKConfig.GetAllocator()),
-                "mergeConfigurationFailed");
+            deviceSDKConfig.CopyFrom(alexaConfigRoot["avsDeviceSDK"], deviceSDKConfig.GetAllocator());
         }
+        auto deviceSDKConfigRoot = deviceSDKConfig.GetObject();
 
         if (alexaConfigRoot.HasMember("system") && alexaConfigRoot["system"].IsObject()) {
             auto system = alexaConfigRoot["system"].GetObject();
@@ -543,6 +549,21 @@ bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration)
             }
         }
 
+        if (alexaConfigRoot.HasMember("audioPlayer") && alexaConfigRoot["audioPlayer"].IsObject()) {
+            auto audioPlayer = alexaConfigRoot["audioPlayer"].GetObject();
+
+            if (audioPlayer.HasMember("prefetch") && audioPlayer["prefetch"].IsObject()) {
+                auto prefetch = audioPlayer["prefetch"].GetObject();
+
+                if (prefetch.HasMember("enabled") && prefetch["enabled"].IsBool() && prefetch["enabled"].GetBool()) {
+                    m_audioPlayerPrefetchBufferSize = DEFAULT_AUDIO_PLAYER_PREFETCH_BUFFER_SIZE;
+                    if (prefetch.HasMember("maxBufferSize") && prefetch["maxBufferSize"].IsUint()) {
+                        m_audioPlayerPrefetchBufferSize = prefetch["maxBufferSize"].GetUint();
+                    }
+                }
+            }
+        }
+
         if (alexaConfigRoot.HasMember("speechRecognizer") && alexaConfigRoot["speechRecognizer"].IsObject()) {
             auto speechRecognizer = alexaConfigRoot["speechRecognizer"].GetObject();
 
@@ -659,10 +680,10 @@ bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration)
                 m_timezone = deviceSDKConfigRoot["deviceSettings"]["defaultTimezone"].GetString();
             }
         }
-        rapidjson::StringBuffer buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        deviceSDKConfig.Accept(writer);
-        AACE_DEBUG(LX(TAG, "Final config").m(buffer.GetString()));
+
+        // the device sdk config is serialized once, for both the log and the device sdk
+        auto deviceSDKConfigStream = aace::engine::utils::json::toStream(deviceSDKConfig, false);
+        AACE_DEBUG(LX(TAG, "Final config").m(deviceSDKConfigStream->str()));
 
         // configure defaults
         m_audioFormat.sampleRateHz = 16000;
@@ -688,8 +709,7 @@ bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration)
             "registerWakewordObservableInterfaceFailed");
 
         // configure the avs device sdk
-        ThrowIfNot(
-            configureDeviceSDK(aace::engine::utils::json::toStream(deviceSDKConfig)), "configureDeviceSDKFailed");
+        ThrowIfNot(configureDeviceSDK(deviceSDKConfigStream), "configureDeviceSDKFailed");
 
         m_configured = true;
 
@@ -740,12 +760,12 @@ bool AlexaEngineService::setup() {
             m_connectionManager->setAVSGateway(getAVSGateway());
         }
 
-        // get the location provider interface from the location service
-        auto locationProvider = getContext()->getServiceInterface<aace::location::LocationProvider>("aace.location");
+        // get the location cache interface from the location service
+        auto locationCache = getContext()->getServiceInterface<aace::engine::location::LocationCache>("aace.location");
 
-        if (locationProvider != nullptr) {
+        if (locationCache != nullptr) {
             // create the alexa engine location state provider
-            m_locationStateProvider = AlexaEngineLocationStateProvider::create(locationProvider, m_contextManager);
+            m_locationStateProvider = AlexaEngineLocationStateProvider::create(locationCache, m_contextManager);
             ThrowIfNull(m_locationStateProvider, "createLocationStateProviderFailed");
 
             // add the location state to the context manager
@@ -1664,6 +1684,8 @@ void AlexaEngineService::onNetworkInterfaceChangeStatusChanged(
                 if (currentNetworkInterface != networkInterface) {
                     alexaClientSDK::avsCommon::utils::libcurlUtils::CurlEasyHandleWrapper::setInterfaceName(
                         networkInterface);
+                    // close the pooled connections bound to the previous network interface
+                    m_httpClient->resetConnections();
                 }
             } else if (NetworkInfoObserver::NetworkInterfaceChangeStatus::COMPLETED == status) {
                 // Enable the AVS connection if it was previously disabled at the begin of
@@ -1858,7 +1880,8 @@ bool AlexaEngineService::registerPlatformInterfaceType(std::shared_ptr<aace::ale
             m_playbackRouterDelegate,
             m_certifiedSender,
             m_audioPlayerObserverDelegate,
-            m_authDelegateRouter);
+            m_authDelegateRouter,
+            m_audioPlayerPrefetchBufferSize);
         ThrowIfNull(m_audioPlayerEngineImpl, "createAudioPlayerEngineImplFailed");
         m_renderPlayerInfoCardsProviderInterfaces.insert(m_audioPlayerEngineImpl);
 
@@ -2319,23 +2342,23 @@ void AlexaEngineService::removeWakewordObserver(std::shared_ptr<WakewordObserver
 //
 
 std::shared_ptr<AlexaEngineLocationStateProvider> AlexaEngineLocationStateProvider::create(
-    std::shared_ptr<aace::location::LocationProvider> locationProvider,
+    std::shared_ptr<aace::engine::location::LocationCache> locationCache,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager) {
     return std::shared_ptr<AlexaEngineLocationStateProvider>(
-        new AlexaEngineLocationStateProvider(locationProvider, contextManager));
+        new AlexaEngineLocationStateProvider(locationCache, contextManager));
 }
 
 AlexaEngineLocationStateProvider::AlexaEngineLocationStateProvider(
-    std::shared_ptr<aace::location::LocationProvider> locationProvider,
+    std::shared_ptr<aace::engine::location::LocationCache> locationCache,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG + ".AlexaEngineLocationStateProvider"),
-        m_locationProvider(locationProvider),
+        m_locationCache(locationCache),
         m_contextManager(contextManager) {
 }
 
 void AlexaEngineLocationStateProvider::doShutdown() {
     m_executor.shutdown();
-    m_locationProvider.reset();
+    m_locationCache.reset();
     m_contextManager.reset();
 }
 
@@ -2352,50 +2375,21 @@ void AlexaEngineLocationStateProvider::executeProvideState(
     try {
         ThrowIfNull(m_contextManager, "contextManagerIsNull");
 
-        aace::location::Location location = m_locationProvider->getLocation();
+        uint64_t version = 0;
+        aace::location::Location location = m_locationCache->getLocation(version);
 
         if (location.isValid()) {
-            // build the context payload
-            rapidjson::Document document(rapidjson::kObjectType);
-
-            // add timestamp
-            std::string time = location.getTimeAsString();
-
-            document.AddMember(
-                "timestamp",
-                rapidjson::Value().SetString(time.c_str(), time.length(), document.GetAllocator()),
-                document.GetAllocator());
-
-            // add location coordinate
-            rapidjson::Value coordinate(rapidjson::kObjectType);
-
-            coordinate.AddMember("latitudeInDegrees", location.getLatitude(), document.GetAllocator());
-            coordinate.AddMember("longitudeInDegrees", location.getLongitude(), document.GetAllocator());
-            coordinate.AddMember(
-                "accuracyInMeters",
-                location.getAccuracy() != aace::location::Location::UNDEFINED ? location.getAccuracy() : 0,
-                document.GetAllocator());
-
-            document.AddMember("coordinate", coordinate, document.GetAllocator());
-
-            // add location altitude
-            if (location.getAltitude() != aace::location::Location::UNDEFINED) {
-                rapidjson::Value altitude(rapidjson::kObjectType);
-
-                altitude.AddMember("altitudeInMeters", location.getAltitude(), document.GetAllocator());
-                altitude.AddMember(
-                    "accuracyInMeters",
-                    location.getAccuracy() != aace::location::Location::UNDEFINED ? location.getAccuracy() : 0,
-                    document.GetAllocator());
-
-                document.AddMember("altitude", altitude, document.GetAllocator());
+            // the payload is rebuilt only when the cached location changed, or the location is not cached
+            if (version == 0 || version != m_payloadVersion) {
+                m_payload = buildPayload(location);
+                m_payloadVersion = version;
             }
 
             // set the context location state
             ThrowIf(
                 m_contextManager->setState(
                     LOCATION_STATE,
-                    aace::engine::utils::json::toString(document),
+                    m_payload,
                     alexaClientSDK::avsCommon::avs::StateRefreshPolicy::ALWAYS,
                     stateRequestToken) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS,
                 "contextManagerSetStateFailed");
@@ -2413,6 +2407,46 @@ void AlexaEngineLocationStateProvider::executeProvideState(
     }
 }
 
+std::string AlexaEngineLocationStateProvider::buildPayload(aace::location::Location location) {
+    // build the context payload
+    rapidjson::Document document(rapidjson::kObjectType);
+
+    // add timestamp
+    std::string time = location.getTimeAsString();
+
+    document.AddMember(
+        "timestamp",
+        rapidjson::Value().SetString(time.c_str(), time.length(), document.GetAllocator()),
+        document.GetAllocator());
+
+    // add location coordinate
+    rapidjson::Value coordinate(rapidjson::kObjectType);
+
+    coordinate.AddMember("latitudeInDegrees", location.getLatitude(), document.GetAllocator());
+    coordinate.AddMember("longitudeInDegrees", location.getLongitude(), document.GetAllocator());
+    coordinate.AddMember(
+        "accuracyInMeters",
+        location.getAccuracy() != aace::location::Location::UNDEFINED ? location.getAccuracy() : 0,
+        document.GetAllocator());
+
+    document.AddMember("coordinate", coordinate, document.GetAllocator());
+
+    // add location altitude
+    if (location.getAltitude() != aace::location::Location::UNDEFINED) {
+        rapidjson::Value altitude(rapidjson::kObjectType);
+
+        altitude.AddMember("altitudeInMeters", location.getAltitude(), document.GetAllocator());
+        altitude.AddMember(
+            "accuracyInMeters",
+            location.getAccuracy() != aace::location::Location::UNDEFINED ? location.getAccuracy() : 0,
+            document.GetAllocator());
+
+        document.AddMember("altitude", altitude, document.GetAllocator());
+    }
+
+    return aace::engine::utils::json::toString(document);
+}
+
 //
 // SoftwareInfoSenderObserverInterface
 //
@@ -2546,22 +2580,14 @@ void PlaybackRouterDelegate::setDelegate(
 // HTTPPutDelegate
 //
 
+HttpPutDelegate::HttpPutDelegate(std::shared_ptr<HttpClient> httpClient) : m_httpClient(httpClient) {
+}
+
 alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse HttpPutDelegate::doPut(
     const std::string& url,
     const std::vector<std::string>& headers,
     const std::string& data) {
-    try {
-        // Creating the HttpPut on every doPut is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpPut = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPut::create();
-        ThrowIfNull(httpPut, "httpPutCreateFailed");
-
-        return httpPut->doPut(url, headers, data);
-
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "doPut").d("reason", ex.what()));
-        return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
-    }
+    return m_httpClient->doPut("capabilitiesDelegate", url, headers, data);
 }
 
 }  // namespace alexa
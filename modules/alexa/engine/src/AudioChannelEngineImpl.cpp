@@ -13,6 +13,9 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <thread>
+
 #include <SpeakerManager/DefaultChannelVolumeFactory.h>
 
 #include "AACE/Engine/Alexa/AlexaMetrics.h"
@@ -43,7 +46,10 @@ AudioChannelEngineImpl::AudioChannelEngineImpl(
         m_volume(DEFAULT_SPEAKER_VOLUME),
         m_pendingEventState(PendingEventState::NONE),
         m_currentMediaState(MediaState::STOPPED),
-        m_mediaStateChangeInitiator(MediaStateChangeInitiator::NONE) {
+        m_mediaStateChangeInitiator(MediaStateChangeInitiator::NONE),
+        m_nextId(ERROR),
+        m_nextOffset(std::chrono::milliseconds(0)),
+        m_nextRepeat(false) {
 }
 
 bool AudioChannelEngineImpl::initializeAudioChannel(
@@ -93,6 +99,16 @@ void AudioChannelEngineImpl::doShutdown() {
         reader->close();
     }
 
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        resetNextSource();
+    }
+
+    if (m_prefetcher != nullptr) {
+        m_prefetcher->shutdown();
+        m_prefetcher.reset();
+    }
+
     // reset the media observer reference
     {
         std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
@@ -137,7 +153,7 @@ void AudioChannelEngineImpl::sendEvent(PendingEventState state) {
 }
 
 int64_t AudioChannelEngineImpl::getMediaPosition() {
-    return m_audioOutputChannel->getPosition();
+    return m_positionClock.getPosition();
 }
 
 int64_t AudioChannelEngineImpl::getMediaDuration() {
@@ -155,6 +171,11 @@ std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ChannelVolumeInterface
     return m_channelVolumeInterface;
 }
 
+void AudioChannelEngineImpl::setAudioPrefetcher(std::shared_ptr<AudioPrefetcher> prefetcher) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_prefetcher = prefetcher;
+}
+
 //
 // aace::engine::MediaPlayerEngineInterface
 //
@@ -174,6 +195,12 @@ void AudioChannelEngineImpl::executeMediaStateChanged(SourceId id, MediaState st
                          .d("pendingEvent", m_pendingEventState)
                          .d("id", id));
 
+        // the platform position is only read when the media state changes, and is interpolated
+        // by the position clock while the media is playing
+        if (m_audioOutputChannel != nullptr) {
+            m_positionClock.anchor(m_audioOutputChannel->getPosition(), state == MediaState::PLAYING);
+        }
+
         // return if the current media state is the same as the new state and no pending event
         if (m_currentMediaState == state && m_pendingEventState == PendingEventState::NONE) {
             return;
@@ -314,21 +341,38 @@ void AudioChannelEngineImpl::onMediaError(MediaError error, const std::string& d
     m_pendingEventState = PendingEventState::NONE;
 }
 
+void AudioChannelEngineImpl::onMediaPositionChanged(int64_t position) {
+    auto id = m_currentId;
+    m_executor.submit([this, id, position] { executeMediaPositionChanged(id, position); });
+}
+
+void AudioChannelEngineImpl::executeMediaPositionChanged(SourceId id, int64_t position) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    AACE_VERBOSE(LX(TAG).d("position", position).d("id", id));
+
+    // a late position of the previous source must not move the position of the source that replaced it
+    ReturnIf(id == ERROR || id != m_currentId);
+    m_positionClock.reanchor(position);
+}
+
 void AudioChannelEngineImpl::executeMediaError(SourceId id, MediaError error, const std::string& description) {
     try {
         ThrowIf(id == ERROR, "invalidSource");
 
+        // playback does not continue after an error
+        m_positionClock.anchor(m_positionClock.getPosition(), false);
+
         {
             std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
 
             for (auto&& observer : m_mediaPlayerObservers) {
-                if (auto observer_lock = observer.lock()) {
+                if (auto observer_lock = observer.first.lock()) {
                     observer_lock->onPlaybackError(
                         id,
                         static_cast<alexaClientSDK::avsCommon::utils::mediaPlayer::ErrorType>(error),
                         description,
                         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-                            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+                            std::chrono::milliseconds(m_positionClock.getPosition())});
                 }
             }
         }
@@ -363,11 +407,11 @@ void AudioChannelEngineImpl::executePlaybackStarted(SourceId id) {
         {
             std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
             for (auto&& observer : m_mediaPlayerObservers) {
-                if (auto observer_lock = observer.lock()) {
+                if (auto observer_lock = observer.first.lock()) {
                     observer_lock->onPlaybackStarted(
                         id,
                         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-                            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+                            std::chrono::milliseconds(m_positionClock.getPosition())});
                 }
             }
         }
@@ -386,17 +430,17 @@ void AudioChannelEngineImpl::executePlaybackFinished(SourceId id) {
         {
             std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
             for (auto&& observer : m_mediaPlayerObservers) {
-                if (auto observer_lock = observer.lock()) {
+                if (auto observer_lock = observer.first.lock()) {
                     observer_lock->onPlaybackFinished(
                         id,
                         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-                            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+                            std::chrono::milliseconds(m_positionClock.getPosition())});
                 }
             }
         }
 
         // save the player offset
-        m_savedOffset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        m_savedOffset = std::chrono::milliseconds(m_positionClock.getPosition());
 
         m_currentId = ERROR;
 
@@ -411,16 +455,16 @@ void AudioChannelEngineImpl::executePlaybackPaused(SourceId id) {
         ThrowIf(id == ERROR, "invalidSource");
 
         // save the player offset
-        m_savedOffset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        m_savedOffset = std::chrono::milliseconds(m_positionClock.getPosition());
 
         {
             std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
             for (auto&& observer : m_mediaPlayerObservers) {
-                if (auto observer_lock = observer.lock()) {
+                if (auto observer_lock = observer.first.lock()) {
                     observer_lock->onPlaybackPaused(
                         id,
                         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-                            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+                            std::chrono::milliseconds(m_positionClock.getPosition())});
                 }
             }
         }
@@ -436,11 +480,11 @@ void AudioChannelEngineImpl::executePlaybackResumed(SourceId id) {
         {
             std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
             for (auto&& observer : m_mediaPlayerObservers) {
-                if (auto observer_lock = observer.lock()) {
+                if (auto observer_lock = observer.first.lock()) {
                     observer_lock->onPlaybackResumed(
                         id,
                         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-                            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+                            std::chrono::milliseconds(m_positionClock.getPosition())});
                 }
             }
         }
@@ -454,16 +498,16 @@ void AudioChannelEngineImpl::executePlaybackStopped(SourceId id) {
         ThrowIf(id == ERROR, "invalidSource");
 
         // save the player offset
-        m_savedOffset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        m_savedOffset = std::chrono::milliseconds(m_positionClock.getPosition());
 
         {
             std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
             for (auto&& observer : m_mediaPlayerObservers) {
-                if (auto observer_lock = observer.lock()) {
+                if (auto observer_lock = observer.first.lock()) {
                     observer_lock->onPlaybackStopped(
                         id,
                         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-                            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+                            std::chrono::milliseconds(m_positionClock.getPosition())});
                 }
             }
         }
@@ -479,13 +523,13 @@ void AudioChannelEngineImpl::executePlaybackError(SourceId id, MediaError error,
         {
             std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
             for (auto&& observer : m_mediaPlayerObservers) {
-                if (auto observer_lock = observer.lock()) {
+                if (auto observer_lock = observer.first.lock()) {
                     observer_lock->onPlaybackError(
                         id,
                         static_cast<alexaClientSDK::avsCommon::utils::mediaPlayer::ErrorType>(error),
                         description,
                         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-                            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+                            std::chrono::milliseconds(m_positionClock.getPosition())});
                 }
             }
         }
@@ -503,11 +547,11 @@ void AudioChannelEngineImpl::executeBufferUnderrun(SourceId id) {
         {
             std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
             for (auto&& observer : m_mediaPlayerObservers) {
-                if (auto observer_lock = observer.lock()) {
+                if (auto observer_lock = observer.first.lock()) {
                     observer_lock->onBufferUnderrun(
                         id,
                         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-                            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+                            std::chrono::milliseconds(m_positionClock.getPosition())});
                 }
             }
         }
@@ -523,11 +567,29 @@ void AudioChannelEngineImpl::executeBufferRefilled(SourceId id) {
         {
             std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
             for (auto&& observer : m_mediaPlayerObservers) {
-                if (auto observer_lock = observer.lock()) {
+                if (auto observer_lock = observer.first.lock()) {
                     observer_lock->onBufferRefilled(
                         id,
                         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-                            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+                            std::chrono::milliseconds(m_positionClock.getPosition())});
+                }
+            }
+        }
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("id", id));
+    }
+}
+
+void AudioChannelEngineImpl::executeNextSourceStopped(SourceId id, std::chrono::milliseconds offset) {
+    try {
+        ThrowIf(id == ERROR, "invalidSource");
+
+        {
+            std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
+            for (auto&& observer : m_mediaPlayerObservers) {
+                if (auto observer_lock = observer.first.lock()) {
+                    observer_lock->onPlaybackStopped(
+                        id, alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{offset});
                 }
             }
         }
@@ -543,6 +605,119 @@ void AudioChannelEngineImpl::resetSource() {
     m_mediaStateChangeInitiator = MediaStateChangeInitiator::NONE;
     m_url.clear();
     m_savedOffset = std::chrono::milliseconds(0);
+    m_positionClock.anchor(0, false);
+}
+
+//
+// next source
+//
+
+bool AudioChannelEngineImpl::isPrebufferRequest() {
+    // with prebuffering enabled, a source that is set while the current source has not been stopped
+    // is the next queued item, and must not interrupt the current source. The current source counts as
+    // stopped as soon as stop() is called, since the platform reports the stop asynchronously.
+    return m_prefetcher != nullptr && m_currentId != ERROR &&
+           m_pendingEventState != PendingEventState::PLAYBACK_STOPPED &&
+           m_mediaStateChangeInitiator != MediaStateChangeInitiator::STOP;
+}
+
+AudioChannelEngineImpl::SourceId AudioChannelEngineImpl::setNextSource(
+    const std::string& url,
+    std::shared_ptr<AttachmentReaderAudioStream> attachmentStream,
+    std::chrono::milliseconds offset,
+    bool repeat) {
+    try {
+        resetNextSource();
+
+        m_nextId = nextId();
+        m_nextUrl = url;
+        m_nextOffset = offset;
+        m_nextRepeat = repeat;
+        m_nextAttachmentStream = attachmentStream;
+
+        // only content played from the start can be served from the prefetch buffer
+        if (!url.empty() && offset.count() == 0 && !repeat) {
+            m_prefetcher->prefetch(url);
+        }
+
+        AACE_DEBUG(LX(TAG).d("nextId", m_nextId).d("currentId", m_currentId));
+
+        return m_nextId;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        resetNextSource();
+        return ERROR;
+    }
+}
+
+bool AudioChannelEngineImpl::promoteNextSource() {
+    try {
+        auto id = m_nextId;
+        auto url = m_nextUrl;
+        auto offset = m_nextOffset;
+        auto repeat = m_nextRepeat;
+        auto attachmentStream = m_nextAttachmentStream;
+
+        // clear the next source without cancelling the prefetch, which is acquired below
+        m_nextId = ERROR;
+        m_nextUrl.clear();
+        m_nextOffset = std::chrono::milliseconds(0);
+        m_nextRepeat = false;
+        m_nextAttachmentStream.reset();
+
+        resetSource();
+        m_currentId = id;
+
+        auto outputChannel = m_audioOutputChannel;
+        ReturnIf(outputChannel == nullptr, true);
+
+        if (attachmentStream != nullptr) {
+            m_attachmentReader = attachmentStream;
+            ThrowIfNot(outputChannel->prepare(attachmentStream, false), "audioOutputChannelSetStreamFailed");
+            return true;
+        }
+
+        m_url = url;
+
+        // the prefetched data starts at the beginning of the content, so a source with an offset is always
+        // played from the url
+        std::shared_ptr<aace::audio::AudioStream> prefetchedStream;
+        if (m_prefetcher != nullptr) {
+            if (offset.count() == 0 && !repeat) {
+                prefetchedStream = m_prefetcher->acquire(url);
+            } else {
+                m_prefetcher->cancel();
+            }
+        }
+
+        if (prefetchedStream != nullptr) {
+            ThrowIfNot(outputChannel->prepare(prefetchedStream, false), "audioOutputChannelSetStreamFailed");
+        } else {
+            ThrowIfNot(outputChannel->prepare(url, repeat), "platformMediaPlayerPrepareFailed");
+            ThrowIfNot(outputChannel->setPosition(offset.count()), "platformMediaPlayerSetPositionFailed");
+            m_positionClock.anchor(offset.count(), false);
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("id", m_currentId));
+        resetSource();
+        return false;
+    }
+}
+
+void AudioChannelEngineImpl::resetNextSource() {
+    if (m_nextAttachmentStream != nullptr) {
+        m_nextAttachmentStream->close();
+        m_nextAttachmentStream.reset();
+    }
+    if (m_prefetcher != nullptr) {
+        m_prefetcher->cancel();
+    }
+    m_nextId = ERROR;
+    m_nextUrl.clear();
+    m_nextOffset = std::chrono::milliseconds(0);
+    m_nextRepeat = false;
 }
 
 //
@@ -558,6 +733,12 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
     try {
         AACE_DEBUG(LX(TAG).d("type", "attachment"));
 
+        if (isPrebufferRequest()) {
+            auto reader = AttachmentReaderAudioStream::create(attachmentReader, format);
+            return reader != nullptr ? setNextSource("", reader, std::chrono::milliseconds(0), false) : ERROR;
+        }
+
+        resetNextSource();
         resetSource();
 
         m_currentId = nextId();
@@ -586,6 +767,7 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
     try {
         AACE_DEBUG(LX(TAG).d("type", "stream"));
 
+        resetNextSource();
         resetSource();
 
         ThrowIfNot(stream->good(), "invalidStream");
@@ -632,6 +814,11 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
     try {
         AACE_DEBUG(LX(TAG).d("type", "url").sensitive("url", url));
 
+        if (isPrebufferRequest()) {
+            return setNextSource(url, nullptr, offset, repeat);
+        }
+
+        resetNextSource();
         resetSource();
 
         m_url = url;
@@ -641,6 +828,7 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
         if (outputChannel != nullptr) {
             ThrowIfNot(outputChannel->prepare(m_url, repeat), "platformMediaPlayerPrepareFailed");
             ThrowIfNot(outputChannel->setPosition(offset.count()), "platformMediaPlayerSetPositionFailed");
+            m_positionClock.anchor(offset.count(), false);
         }
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()).d("url", url).d("repeat", repeat).d("id", m_currentId));
@@ -656,6 +844,11 @@ bool AudioChannelEngineImpl::play(alexaClientSDK::avsCommon::utils::mediaPlayer:
     try {
         AACE_VERBOSE(LX(TAG).d("id", id));
 
+        // playing the prebuffered source makes it the current source
+        if (id != ERROR && id == m_nextId) {
+            ThrowIfNot(promoteNextSource(), "promoteNextSourceFailed");
+        }
+
         ThrowIfNot(validateSource(id), "invalidSource");
 
         // return false if audio is already playing
@@ -689,6 +882,14 @@ bool AudioChannelEngineImpl::stop(alexaClientSDK::avsCommon::utils::mediaPlayer:
     try {
         AACE_VERBOSE(LX(TAG).d("id", id));
 
+        // stopping the prebuffered source discards it without affecting the current source
+        if (id != ERROR && id == m_nextId) {
+            auto offset = m_nextOffset;
+            resetNextSource();
+            m_executor.submit([this, id, offset] { executeNextSourceStopped(id, offset); });
+            return true;
+        }
+
         ThrowIfNot(validateSource(id), "invalidSource");
 
         // return false if audio is already stopped
@@ -791,9 +992,10 @@ bool AudioChannelEngineImpl::resume(alexaClientSDK::avsCommon::utils::mediaPlaye
 std::chrono::milliseconds AudioChannelEngineImpl::getOffset(
     alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
     try {
+        ReturnIf(id != ERROR && id == m_nextId, m_nextOffset);
         ReturnIf(m_currentId == ERROR || m_currentId != id, m_savedOffset);
 
-        std::chrono::milliseconds offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        std::chrono::milliseconds offset = std::chrono::milliseconds(m_positionClock.getPosition());
         ThrowIf(offset.count() < 0, "invalidMediaTime");
 
         return offset;
@@ -822,21 +1024,27 @@ AudioChannelEngineImpl::getMediaPlayerState(SourceId id) {
         alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState>();
     if (m_audioOutputChannel != nullptr && m_currentId == id)
         optional.set(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+            std::chrono::milliseconds(m_positionClock.getPosition())});
+    else if (id != ERROR && m_nextId == id)
+        optional.set(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{m_nextOffset});
     return optional;
 }
 
 void AudioChannelEngineImpl::addObserver(
     std::shared_ptr<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface> observer) {
     std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
-    m_mediaPlayerObservers.insert(observer);
+    m_mediaPlayerObservers[observer]++;
 }
 
 void AudioChannelEngineImpl::removeObserver(
     std::shared_ptr<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface> observer) {
     std::unique_lock<std::mutex> lock(m_mediaPlayerObserverMutex);
-    auto numberErased = m_mediaPlayerObservers.erase(observer);
-    AACE_DEBUG(LX(TAG).d("removed observers", numberErased));
+    auto it = m_mediaPlayerObservers.find(observer);
+    ReturnIf(it == m_mediaPlayerObservers.end());
+    if (--it->second == 0) {
+        m_mediaPlayerObservers.erase(it);
+        AACE_DEBUG(LX(TAG).m("observerRemoved"));
+    }
 }
 
 bool AudioChannelEngineImpl::validateSource(
@@ -915,6 +1123,94 @@ void AudioChannelEngineImpl::onAuthStateChange(
     }
 }
 
+//
+// PooledAudioChannelPlayer
+//
+
+PooledAudioChannelPlayer::PooledAudioChannelPlayer(std::shared_ptr<AudioChannelEngineImpl> audioChannel) :
+        m_audioChannel(audioChannel), m_sourceId(ERROR) {
+}
+
+PooledAudioChannelPlayer::SourceId PooledAudioChannelPlayer::setSourceId(SourceId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sourceId = id;
+    return id;
+}
+
+bool PooledAudioChannelPlayer::ownsSource(SourceId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id == ERROR || id != m_sourceId) {
+        AACE_WARN(LX(TAG + ".PooledAudioChannelPlayer").d("reason", "sourceOfOtherPlayer").d("id", id));
+        return false;
+    }
+    return true;
+}
+
+PooledAudioChannelPlayer::SourceId PooledAudioChannelPlayer::setSource(
+    std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
+    const alexaClientSDK::avsCommon::utils::AudioFormat* format,
+    const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config) {
+    return setSourceId(m_audioChannel->setSource(attachmentReader, format, config));
+}
+
+PooledAudioChannelPlayer::SourceId PooledAudioChannelPlayer::setSource(
+    std::shared_ptr<std::istream> stream,
+    bool repeat,
+    const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config,
+    alexaClientSDK::avsCommon::utils::MediaType format) {
+    return setSourceId(m_audioChannel->setSource(stream, repeat, config, format));
+}
+
+PooledAudioChannelPlayer::SourceId PooledAudioChannelPlayer::setSource(
+    const std::string& url,
+    std::chrono::milliseconds offset,
+    const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config,
+    bool repeat) {
+    return setSourceId(m_audioChannel->setSource(url, offset, config, repeat));
+}
+
+bool PooledAudioChannelPlayer::play(SourceId id) {
+    return ownsSource(id) && m_audioChannel->play(id);
+}
+
+bool PooledAudioChannelPlayer::stop(SourceId id) {
+    return ownsSource(id) && m_audioChannel->stop(id);
+}
+
+bool PooledAudioChannelPlayer::pause(SourceId id) {
+    return ownsSource(id) && m_audioChannel->pause(id);
+}
+
+bool PooledAudioChannelPlayer::resume(SourceId id) {
+    return ownsSource(id) && m_audioChannel->resume(id);
+}
+
+std::chrono::milliseconds PooledAudioChannelPlayer::getOffset(SourceId id) {
+    return ownsSource(id) ? m_audioChannel->getOffset(id) : std::chrono::milliseconds(0);
+}
+
+uint64_t PooledAudioChannelPlayer::getNumBytesBuffered() {
+    return m_audioChannel->getNumBytesBuffered();
+}
+
+alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState>
+PooledAudioChannelPlayer::getMediaPlayerState(SourceId id) {
+    ReturnIfNot(
+        ownsSource(id),
+        alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState>());
+    return m_audioChannel->getMediaPlayerState(id);
+}
+
+void PooledAudioChannelPlayer::addObserver(
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface> observer) {
+    m_audioChannel->addObserver(observer);
+}
+
+void PooledAudioChannelPlayer::removeObserver(
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface> observer) {
+    m_audioChannel->removeObserver(observer);
+}
+
 //
 // AttachmentReaderStream
 //
@@ -930,13 +1226,24 @@ static AudioFormat DEFAULT_ATTACHMENT_AUDIO_FORMAT = AudioFormat(
     0,
     0);
 
+/// Maximum time @c read() waits for attachment data before returning with no data.
+static constexpr std::chrono::milliseconds DEFAULT_ATTACHMENT_READ_TIMEOUT(100);
+
+/// Interval used to poll attachment readers that return at once when they are empty, such as NONBLOCKING readers.
+static constexpr std::chrono::milliseconds ATTACHMENT_POLL_INTERVAL(10);
+
 AttachmentReaderAudioStream::AttachmentReaderAudioStream(
     std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
-    const AudioFormat& format) :
+    const AudioFormat& format,
+    MediaType mediaType) :
         m_attachmentReader(attachmentReader),
         m_status(alexaClientSDK::avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK),
         m_closed(false),
-        m_audioFormat(format) {
+        m_audioFormat(format),
+        m_mediaType(mediaType),
+        m_bytesRead(0),
+        m_readCount(0),
+        m_underrunCount(0) {
 }
 
 std::shared_ptr<AttachmentReaderAudioStream> AttachmentReaderAudioStream::create(
@@ -995,15 +1302,64 @@ std::shared_ptr<AttachmentReaderAudioStream> AttachmentReaderAudioStream::create
     }
 }
 
+std::shared_ptr<AttachmentReaderAudioStream> AttachmentReaderAudioStream::create(
+    std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
+    const AudioFormat& audioFormat,
+    MediaType mediaType) {
+    try {
+        ThrowIfNull(attachmentReader, "invalidAttachmentReader");
+        return std::shared_ptr<AttachmentReaderAudioStream>(
+            new AttachmentReaderAudioStream(attachmentReader, audioFormat, mediaType));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
 ssize_t AttachmentReaderAudioStream::read(char* data, const size_t size) {
+    ssize_t count = readAttachment(data, size, DEFAULT_ATTACHMENT_READ_TIMEOUT);
+    if (count == 0 && !m_closed) {
+        m_underrunCount++;
+    }
+    return count;
+}
+
+ssize_t AttachmentReaderAudioStream::readBlocking(char* data, const size_t size, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        // a BLOCKING reader waits for the remaining time, but a NONBLOCKING reader ignores the timeout and returns at
+        // once, so it is polled until the deadline. A zero timeout means wait forever for the attachment reader, so
+        // always wait at least a millisecond.
+        auto remaining =
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        ssize_t count = readAttachment(data, size, std::max(remaining, std::chrono::milliseconds(1)));
+
+        auto now = std::chrono::steady_clock::now();
+        if (count != 0 || m_closed || now >= deadline) {
+            if (count == 0 && !m_closed) {
+                m_underrunCount++;
+            }
+            return count;
+        }
+        std::this_thread::sleep_for(
+            std::min<std::chrono::steady_clock::duration>(ATTACHMENT_POLL_INTERVAL, deadline - now));
+    }
+}
+
+ssize_t AttachmentReaderAudioStream::readAttachment(
+    char* data,
+    const size_t size,
+    std::chrono::milliseconds timeout) {
     try {
-        ssize_t count =
-            m_attachmentReader->read(static_cast<void*>(data), size, &m_status, std::chrono::milliseconds(100));
+        ssize_t count = m_attachmentReader->read(static_cast<void*>(data), size, &m_status, timeout);
 
         if (m_status >= alexaClientSDK::avsCommon::avs::attachment::AttachmentReader::ReadStatus::CLOSED) {
             m_closed = true;
         }
 
+        m_readCount++;
+        m_bytesRead += count;
+
         return count;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG + ".AttachmentReaderAudioStream").d("reason", ex.what()).d("size", size));
@@ -1015,6 +1371,11 @@ ssize_t AttachmentReaderAudioStream::read(char* data, const size_t size) {
 void AttachmentReaderAudioStream::close() {
     m_attachmentReader->close(alexaClientSDK::avsCommon::avs::attachment::AttachmentReader::ClosePoint::IMMEDIATELY);
     m_closed = true;
+
+    AACE_DEBUG(LX(TAG + ".AttachmentReaderAudioStream")
+                   .d("bytesRead", m_bytesRead.load())
+                   .d("readCount", m_readCount.load())
+                   .d("underrunCount", m_underrunCount.load()));
 }
 
 bool AttachmentReaderAudioStream::isClosed() {
@@ -1025,6 +1386,18 @@ AudioFormat AttachmentReaderAudioStream::getAudioFormat() {
     return m_audioFormat;
 }
 
+aace::audio::AudioStream::MediaType AttachmentReaderAudioStream::getMediaType() {
+    return m_mediaType;
+}
+
+AttachmentReaderAudioStream::ReadStatistics AttachmentReaderAudioStream::getReadStatistics() {
+    ReadStatistics statistics;
+    statistics.bytesRead = m_bytesRead;
+    statistics.readCount = m_readCount;
+    statistics.underrunCount = m_underrunCount;
+    return statistics;
+}
+
 //
 // IStreamAudioStream
 //
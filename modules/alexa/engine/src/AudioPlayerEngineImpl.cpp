@@ -43,12 +43,28 @@ bool AudioPlayerEngineImpl::initialize(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::PlaybackRouterInterface> playbackRouter,
     std::shared_ptr<alexaClientSDK::certifiedSender::CertifiedSender> certifiedSender,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AudioPlayerObserverInterface> audioPlayerObserverDelegate,
-    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate) {
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
+    size_t prefetchBufferSize) {
     try {
         ThrowIfNot(
             initializeAudioChannel(audioOutputChannel, speakerManager, authDelegate), "initializeAudioChannelFailed");
 
-        auto factory = alexaClientSDK::mediaPlayer::PooledMediaPlayerFactory::create({shared_from_this()});
+        std::vector<std::shared_ptr<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface>> mediaPlayers;
+
+        // when prefetch is enabled the channel also serves the prebuffered next source, so the pool has a second
+        // player to allow the AudioPlayer to set the next source during playback. Each player of the pool is its own
+        // object, which only controls the source set through it.
+        if (prefetchBufferSize > 0) {
+            auto prefetcher = AudioPrefetcher::create(prefetchBufferSize);
+            ThrowIfNull(prefetcher, "createAudioPrefetcherFailed");
+            setAudioPrefetcher(prefetcher);
+            mediaPlayers.push_back(std::make_shared<PooledAudioChannelPlayer>(shared_from_this()));
+            mediaPlayers.push_back(std::make_shared<PooledAudioChannelPlayer>(shared_from_this()));
+        } else {
+            mediaPlayers.push_back(shared_from_this());
+        }
+
+        auto factory = alexaClientSDK::mediaPlayer::PooledMediaPlayerFactory::create(mediaPlayers);
         // temporary
         std::vector<std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ChannelVolumeInterface>>
             audioChannelVolumeInterfaces{getChannelVolumeInterface()};
@@ -95,7 +111,8 @@ std::shared_ptr<AudioPlayerEngineImpl> AudioPlayerEngineImpl::create(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::PlaybackRouterInterface> playbackRouter,
     std::shared_ptr<alexaClientSDK::certifiedSender::CertifiedSender> certifiedSender,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AudioPlayerObserverInterface> audioPlayerObserverDelegate,
-    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate) {
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
+    size_t prefetchBufferSize) {
     std::shared_ptr<AudioPlayerEngineImpl> audioPlayerEngineImpl = nullptr;
 
     try {
@@ -136,7 +153,8 @@ std::shared_ptr<AudioPlayerEngineImpl> AudioPlayerEngineImpl::create(
                 playbackRouter,
                 certifiedSender,
                 audioPlayerObserverDelegate,
-                authDelegate),
+                authDelegate,
+                prefetchBufferSize),
             "initializeAudioPlayerEngineImplFailed");
 
         // set the platform's engine interface reference
@@ -0,0 +1,229 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <regex>
+
+#include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
+
+#include "AACE/Engine/Alexa/AudioChannelEngineImpl.h"
+#include "AACE/Engine/Alexa/AudioPrefetcher.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.alexa.AudioPrefetcher");
+
+using InProcessSDS = alexaClientSDK::avsCommon::utils::sds::InProcessSDS;
+using InProcessAttachment = alexaClientSDK::avsCommon::avs::attachment::InProcessAttachment;
+using AttachmentReader = alexaClientSDK::avsCommon::avs::attachment::AttachmentReader;
+using AttachmentWriter = alexaClientSDK::avsCommon::avs::attachment::AttachmentWriter;
+using HTTPContentFetcherInterface = alexaClientSDK::avsCommon::sdkInterfaces::HTTPContentFetcherInterface;
+using AudioFormat = aace::audio::AudioFormat;
+using MediaType = aace::audio::AudioStream::MediaType;
+
+/// The format of MPEG content, whose other properties are read from the content by the platform
+static AudioFormat MP3_AUDIO_FORMAT = AudioFormat(
+    AudioFormat::Encoding::MP3,
+    AudioFormat::SampleFormat::UNKNOWN,
+    AudioFormat::Layout::UNKNOWN,
+    AudioFormat::Endianness::UNKNOWN,
+    0,
+    0,
+    0);
+
+AudioPrefetcher::AudioPrefetcher(
+    size_t maxBufferSize,
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface>
+        contentFetcherFactory) :
+        m_maxBufferSize(maxBufferSize), m_contentFetcherFactory(contentFetcherFactory), m_shutdown(false) {
+}
+
+std::shared_ptr<AudioPrefetcher> AudioPrefetcher::create(
+    size_t maxBufferSize,
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface>
+        contentFetcherFactory) {
+    try {
+        ThrowIf(maxBufferSize == 0, "invalidMaxBufferSize");
+
+        if (contentFetcherFactory == nullptr) {
+            contentFetcherFactory =
+                std::make_shared<alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPContentFetcherFactory>();
+        }
+
+        return std::shared_ptr<AudioPrefetcher>(new AudioPrefetcher(maxBufferSize, contentFetcherFactory));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "create").d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+AudioPrefetcher::Download::~Download() {
+    // close the reader before releasing the fetcher so a writer blocked on a full buffer is released
+    if (reader != nullptr) {
+        reader->close(AttachmentReader::ClosePoint::IMMEDIATELY);
+    }
+    content.reset();
+    contentFetcher.reset();
+}
+
+bool AudioPrefetcher::isPrefetchable(const std::string& url) {
+    // playlists have to be resolved by the platform media player, so only direct http(s) media is prefetched
+    static std::regex regex_http(R"(^(http|https):\/\/.+)", std::regex::optimize | std::regex::icase);
+    static std::regex regex_playlist(
+        R"(^(http|https):\/\/.+\.(ashx|m3u|m3u8|pls)(\?.*)?$)", std::regex::optimize | std::regex::icase);
+    return std::regex_match(url, regex_http) && !std::regex_match(url, regex_playlist);
+}
+
+MediaType AudioPrefetcher::getMediaType(const std::string& contentType) {
+    // the parameters of the content type, such as the charset, are ignored
+    auto type = contentType.substr(0, contentType.find(';'));
+    type.erase(std::remove_if(type.begin(), type.end(), [](unsigned char c) { return std::isspace(c); }), type.end());
+    std::transform(type.begin(), type.end(), type.begin(), [](unsigned char c) { return std::tolower(c); });
+
+    if (type == "audio/mpeg" || type == "audio/mp3" || type == "audio/mpeg3" || type == "audio/x-mpeg") {
+        return MediaType::MPEG;
+    }
+    if (type == "audio/wav" || type == "audio/wave" || type == "audio/x-wav" || type == "audio/vnd.wave") {
+        return MediaType::WAV;
+    }
+    return MediaType::UNKNOWN;
+}
+
+bool AudioPrefetcher::prefetch(const std::string& url) {
+    // the replaced download is released after the lock
+    std::unique_ptr<Download> replaced;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    try {
+        AACE_DEBUG(LX(TAG).sensitive("url", url));
+
+        replaced = std::move(m_pending);
+
+        ReturnIf(m_shutdown, false);
+        ReturnIfNot(isPrefetchable(url), false);
+
+        // create the bounded buffer that holds the prefetched data
+        auto bufferSize = InProcessSDS::calculateBufferSize(m_maxBufferSize);
+        auto buffer = std::make_shared<alexaClientSDK::avsCommon::utils::sds::InProcessSDSTraits::Buffer>(bufferSize);
+        auto sds = InProcessSDS::create(buffer);
+        ThrowIfNull(sds, "createSharedDataStreamFailed");
+
+        auto attachment = std::make_shared<InProcessAttachment>(url, std::move(sds));
+
+        // the reader is created before the writer so the writer blocks instead of overwriting unread data
+        std::unique_ptr<Download> download(new Download());
+        download->url = url;
+        download->startTime = std::chrono::steady_clock::now();
+        download->reader = attachment->createReader(alexaClientSDK::avsCommon::utils::sds::ReaderPolicy::BLOCKING);
+        ThrowIfNull(download->reader, "createAttachmentReaderFailed");
+
+        std::unique_ptr<AttachmentWriter> writer =
+            attachment->createWriter(alexaClientSDK::avsCommon::utils::sds::WriterPolicy::BLOCKING);
+        ThrowIfNull(writer, "createAttachmentWriterFailed");
+
+        download->contentFetcher = m_contentFetcherFactory->create(url);
+        ThrowIfNull(download->contentFetcher, "createContentFetcherFailed");
+
+        download->content = download->contentFetcher->getContent(
+            HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY, std::move(writer));
+        ThrowIfNull(download->content, "getContentFailed");
+
+        m_pending = std::move(download);
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("url", url));
+        m_pending.reset();
+        return false;
+    }
+}
+
+std::shared_ptr<aace::audio::AudioStream> AudioPrefetcher::acquire(const std::string& url) {
+    std::unique_ptr<Download> download;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ReturnIf(m_pending == nullptr || m_pending->url != url, nullptr);
+        download = std::move(m_pending);
+    }
+
+    try {
+        // the status code is only available once the server has responded, so the download is only used if it is
+        // already known to succeed, and the caller falls back to the url instead of waiting for the server
+        if (!download->content->isReady(std::chrono::milliseconds::zero())) {
+            AACE_WARN(LX(TAG).d("reason", "prefetchNotReady"));
+            return nullptr;
+        }
+        if (!download->content->isStatusCodeSuccess()) {
+            AACE_WARN(LX(TAG).d("reason", "prefetchFailed").d("statusCode", download->content->getStatusCode()));
+            return nullptr;
+        }
+
+        // the url can serve content of any format, so the format of the stream is the one the server reports, and
+        // is left unknown for the platform to detect if the server reports another type
+        auto contentType = download->content->getContentType();
+        auto mediaType = getMediaType(contentType);
+        auto stream = AttachmentReaderAudioStream::create(
+            download->reader, mediaType == MediaType::MPEG ? MP3_AUDIO_FORMAT : AudioFormat::UNKNOWN, mediaType);
+        ThrowIfNull(stream, "createAudioStreamFailed");
+
+        // the time between starting the prefetch and starting playback is the connection
+        // and buffering time the platform no longer has to wait for
+        auto leadTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - download->startTime);
+        AACE_INFO(LX(TAG)
+                      .m("prefetchAcquired")
+                      .d("contentType", contentType)
+                      .d("prefetchLeadTimeMs", leadTime.count())
+                      .d("prefetchedBytes", download->reader->getNumUnreadBytes()));
+
+        // keep the download alive while the platform streams the rest of the content, and release the previous
+        // download after the lock
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ReturnIf(m_shutdown, nullptr);
+            std::swap(m_active, download);
+        }
+
+        return stream;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+void AudioPrefetcher::cancel() {
+    std::unique_ptr<Download> pending;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    pending = std::move(m_pending);
+}
+
+void AudioPrefetcher::shutdown() {
+    std::unique_ptr<Download> pending;
+    std::unique_ptr<Download> active;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shutdown = true;
+    pending = std::move(m_pending);
+    active = std::move(m_active);
+}
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
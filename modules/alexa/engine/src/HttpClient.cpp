@@ -0,0 +1,365 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cctype>
+
+#include <curl/curl.h>
+
+#include "AACE/Engine/Alexa/HttpClient.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.alexa.HttpClient");
+
+using CurlEasyHandleWrapper = alexaClientSDK::avsCommon::utils::libcurlUtils::CurlEasyHandleWrapper;
+
+const size_t HttpClient::DEFAULT_MAX_IDLE_CONNECTIONS;
+const size_t HttpClient::DEFAULT_MAX_CONCURRENT_REQUESTS;
+const std::chrono::seconds HttpClient::DEFAULT_REQUEST_TIMEOUT = std::chrono::seconds(60);
+
+//
+// HttpClient::Share
+//
+
+class HttpClient::Share {
+public:
+    static std::shared_ptr<Share> create() {
+        try {
+            auto share = std::shared_ptr<Share>(new Share());
+            ThrowIfNull(share->m_handle, "curlShareInitFailed");
+            ThrowIfNot(curl_share_setopt(share->m_handle, CURLSHOPT_LOCKFUNC, lock) == CURLSHE_OK, "setLockFailed");
+            ThrowIfNot(
+                curl_share_setopt(share->m_handle, CURLSHOPT_UNLOCKFUNC, unlock) == CURLSHE_OK, "setUnlockFailed");
+            ThrowIfNot(
+                curl_share_setopt(share->m_handle, CURLSHOPT_USERDATA, share.get()) == CURLSHE_OK,
+                "setUserDataFailed");
+            ThrowIfNot(
+                curl_share_setopt(share->m_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS) == CURLSHE_OK,
+                "shareDNSCacheFailed");
+            ThrowIfNot(
+                curl_share_setopt(share->m_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION) == CURLSHE_OK,
+                "shareSSLSessionCacheFailed");
+#if LIBCURL_VERSION_NUM >= 0x073900
+            // the connection cache can be shared since libcurl 7.57.0, otherwise each pooled handle keeps its own
+            ThrowIfNot(
+                curl_share_setopt(share->m_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT) == CURLSHE_OK,
+                "shareConnectionCacheFailed");
+#endif
+            return share;
+        } catch (std::exception& ex) {
+            AACE_ERROR(LX(TAG, "Share::create").d("reason", ex.what()));
+            return nullptr;
+        }
+    }
+
+    ~Share() {
+        if (m_handle != nullptr) {
+            curl_share_cleanup(m_handle);
+        }
+    }
+
+    CURLSH* get() {
+        return m_handle;
+    }
+
+private:
+    Share() : m_handle(curl_share_init()) {
+    }
+
+    static void lock(CURL* handle, curl_lock_data data, curl_lock_access access, void* userData) {
+        static_cast<Share*>(userData)->m_mutexes[data].lock();
+    }
+
+    static void unlock(CURL* handle, curl_lock_data data, void* userData) {
+        static_cast<Share*>(userData)->m_mutexes[data].unlock();
+    }
+
+private:
+    CURLSH* m_handle;
+    std::mutex m_mutexes[CURL_LOCK_DATA_LAST];
+};
+
+//
+// HttpClient
+//
+
+HttpClient::HttpClient(size_t maxIdleConnections, size_t maxConcurrentRequests) :
+        m_maxIdleConnections(maxIdleConnections), m_maxConcurrentRequests(maxConcurrentRequests), m_generation(0) {
+}
+
+std::shared_ptr<HttpClient> HttpClient::create(size_t maxIdleConnections, size_t maxConcurrentRequests) {
+    try {
+        ThrowIf(maxConcurrentRequests == 0, "invalidMaxConcurrentRequests");
+
+        auto httpClient = std::shared_ptr<HttpClient>(new HttpClient(maxIdleConnections, maxConcurrentRequests));
+
+        // requests are still pooled without a share, but do not share the DNS, TLS session and connection caches
+        httpClient->m_share = Share::create();
+        if (httpClient->m_share == nullptr) {
+            AACE_WARN(LX(TAG, "create").d("reason", "createShareFailed"));
+        }
+
+        return httpClient;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "create").d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+HttpClient::~HttpClient() {
+    // the handles must be released before the share they use
+    m_idleHandles.clear();
+    m_share.reset();
+}
+
+HttpClient::HTTPResponse HttpClient::doGet(
+    const std::string& clientId,
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    std::chrono::seconds timeout) {
+    return doRequest(Method::GET, clientId, url, headers, "", timeout);
+}
+
+HttpClient::HTTPResponse HttpClient::doPost(
+    const std::string& clientId,
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::string& data,
+    std::chrono::seconds timeout) {
+    return doRequest(Method::POST, clientId, url, headers, data, timeout);
+}
+
+HttpClient::HTTPResponse HttpClient::doPost(
+    const std::string& clientId,
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::vector<std::pair<std::string, std::string>>& data,
+    std::chrono::seconds timeout) {
+    std::string formData;
+    for (auto& field : data) {
+        formData += (formData.empty() ? "" : "&") + urlEncode(field.first) + "=" + urlEncode(field.second);
+    }
+    return doRequest(Method::POST, clientId, url, headers, formData, timeout);
+}
+
+HttpClient::HTTPResponse HttpClient::doPut(
+    const std::string& clientId,
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::string& data,
+    std::chrono::seconds timeout) {
+    return doRequest(Method::PUT, clientId, url, headers, data, timeout);
+}
+
+HttpClient::HTTPResponse HttpClient::doDelete(
+    const std::string& clientId,
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    std::chrono::seconds timeout) {
+    return doRequest(Method::DELETE, clientId, url, headers, "", timeout);
+}
+
+bool HttpClient::setMaxConcurrentRequests(const std::string& clientId, size_t maxConcurrentRequests) {
+    try {
+        ThrowIf(maxConcurrentRequests == 0, "invalidMaxConcurrentRequests");
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_clientMaxConcurrentRequests[clientId] = maxConcurrentRequests;
+        m_requestSlotReleased.notify_all();
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "setMaxConcurrentRequests").d("reason", ex.what()).d("clientId", clientId));
+        return false;
+    }
+}
+
+void HttpClient::resetConnections() {
+    AACE_INFO(LX(TAG, "resetConnections"));
+
+    std::vector<std::unique_ptr<CurlEasyHandleWrapper>> idleHandles;
+    std::shared_ptr<Share> share = Share::create();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        idleHandles.swap(m_idleHandles);
+        m_share.swap(share);
+        m_generation++;
+    }
+
+    // the idle handles are released before the previous share, which closes its connections once the requests in
+    // progress release it
+    idleHandles.clear();
+    share.reset();
+}
+
+HttpClient::HTTPResponse HttpClient::doRequest(
+    Method method,
+    const std::string& clientId,
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::string& data,
+    std::chrono::seconds timeout) {
+    try {
+        ThrowIfNot(
+            acquireRequestSlot(clientId, std::chrono::steady_clock::now() + timeout),
+            "concurrentRequestLimitWaitTimedOut");
+
+        HTTPResponse response;
+        try {
+            auto lease = acquireHandle();
+            response = perform(lease, method, url, headers, data, timeout);
+
+            // a handle is only reused after a successful request
+            releaseHandle(std::move(lease));
+        } catch (...) {
+            releaseRequestSlot(clientId);
+            throw;
+        }
+        releaseRequestSlot(clientId);
+
+        return response;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "doRequest").d("reason", ex.what()).d("clientId", clientId));
+        return HTTPResponse();
+    }
+}
+
+bool HttpClient::acquireRequestSlot(const std::string& clientId, std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto hasRequestSlot = [this, &clientId]() {
+        auto it = m_clientMaxConcurrentRequests.find(clientId);
+        auto maxConcurrentRequests = it != m_clientMaxConcurrentRequests.end() ? it->second : m_maxConcurrentRequests;
+        return m_clientActiveRequests[clientId] < maxConcurrentRequests;
+    };
+    ReturnIfNot(m_requestSlotReleased.wait_until(lock, deadline, hasRequestSlot), false);
+    m_clientActiveRequests[clientId]++;
+    return true;
+}
+
+void HttpClient::releaseRequestSlot(const std::string& clientId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_clientActiveRequests[clientId]--;
+    m_requestSlotReleased.notify_all();
+}
+
+HttpClient::Lease HttpClient::acquireHandle() {
+    Lease lease;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        lease.share = m_share;
+        lease.generation = m_generation;
+        if (!m_idleHandles.empty()) {
+            lease.curl = std::move(m_idleHandles.back());
+            m_idleHandles.pop_back();
+        }
+    }
+
+    if (lease.curl == nullptr) {
+        lease.curl = std::unique_ptr<CurlEasyHandleWrapper>(new CurlEasyHandleWrapper());
+        ThrowIfNot(lease.curl->isValid(), "createCurlHandleFailed");
+    }
+
+    return lease;
+}
+
+void HttpClient::releaseHandle(Lease lease) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (lease.generation == m_generation && m_idleHandles.size() < m_maxIdleConnections) {
+        m_idleHandles.push_back(std::move(lease.curl));
+    }
+}
+
+std::string HttpClient::urlEncode(const std::string& value) {
+    static const char* HEX_DIGITS = "0123456789ABCDEF";
+    std::string encoded;
+    for (unsigned char c : value) {
+        if (std::isalnum(c) || c == '-' || c == '.' || c == '_' || c == '~') {
+            encoded += static_cast<char>(c);
+        } else {
+            encoded += '%';
+            encoded += HEX_DIGITS[c >> 4];
+            encoded += HEX_DIGITS[c & 0x0F];
+        }
+    }
+    return encoded;
+}
+
+static size_t writeCallback(char* buffer, size_t blockSize, size_t numBlocks, void* userData) {
+    auto size = blockSize * numBlocks;
+    static_cast<std::string*>(userData)->append(buffer, size);
+    return size;
+}
+
+HttpClient::HTTPResponse HttpClient::perform(
+    Lease& lease,
+    Method method,
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::string& data,
+    std::chrono::seconds timeout) {
+    auto curl = lease.curl.get();
+
+    // resetting the handle keeps its connections, and applies the current network interface
+    ThrowIfNot(curl->reset(), "resetCurlHandleFailed");
+    if (lease.share != nullptr) {
+        ThrowIfNot(curl->setopt(CURLOPT_SHARE, lease.share->get()), "setShareFailed");
+    }
+#ifdef CURL_HTTP_VERSION_2TLS
+    ThrowIfNot(curl->setopt(CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2TLS)), "setHttpVersionFailed");
+#endif
+    ThrowIfNot(curl->setURL(url), "setUrlFailed");
+    ThrowIfNot(curl->setTransferTimeout(static_cast<long>(timeout.count())), "setTransferTimeoutFailed");
+
+    switch (method) {
+        case Method::GET:
+            ThrowIfNot(curl->setTransferType(CurlEasyHandleWrapper::TransferType::kGET), "setTransferTypeFailed");
+            break;
+        case Method::POST:
+            ThrowIfNot(curl->setopt(CURLOPT_POSTFIELDSIZE, static_cast<long>(data.size())), "setPostDataSizeFailed");
+            ThrowIfNot(curl->setopt(CURLOPT_POSTFIELDS, data.c_str()), "setPostDataFailed");
+            break;
+        case Method::PUT:
+            // the data is sent from memory as with POST, which does not need a read callback
+            ThrowIfNot(curl->setopt(CURLOPT_CUSTOMREQUEST, "PUT"), "setCustomRequestFailed");
+            ThrowIfNot(curl->setopt(CURLOPT_POSTFIELDSIZE, static_cast<long>(data.size())), "setPostDataSizeFailed");
+            ThrowIfNot(curl->setopt(CURLOPT_POSTFIELDS, data.c_str()), "setPostDataFailed");
+            break;
+        case Method::DELETE:
+            ThrowIfNot(curl->setTransferType(CurlEasyHandleWrapper::TransferType::kDELETE), "setTransferTypeFailed");
+            break;
+    }
+
+    for (auto& header : headers) {
+        ThrowIfNot(curl->addHTTPHeader(header), "addHttpHeaderFailed");
+    }
+
+    std::string body;
+    ThrowIfNot(curl->setWriteCallback(writeCallback, &body), "setWriteCallbackFailed");
+
+    auto result = curl->perform();
+    ThrowIfNot(result == CURLE_OK, curl_easy_strerror(result));
+
+    HTTPResponse response;
+    response.code = curl->getHTTPResponseCode();
+    response.body = body;
+
+    return response;
+}
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/Alexa/MediaPositionClock.h"
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+const int64_t MediaPositionClock::TIME_UNKNOWN;
+
+MediaPositionClock::MediaPositionClock() :
+        m_anchorTime(std::chrono::steady_clock::now()), m_anchorPosition(0), m_running(false) {
+}
+
+void MediaPositionClock::anchor(int64_t position, bool running) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_anchorTime = std::chrono::steady_clock::now();
+    m_anchorPosition = position < 0 ? TIME_UNKNOWN : position;
+    m_running = running;
+}
+
+void MediaPositionClock::reanchor(int64_t position) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_anchorTime = std::chrono::steady_clock::now();
+    m_anchorPosition = position < 0 ? TIME_UNKNOWN : position;
+}
+
+int64_t MediaPositionClock::getPosition() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_running || m_anchorPosition == TIME_UNKNOWN) {
+        return m_anchorPosition;
+    }
+
+    auto elapsed =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_anchorTime);
+
+    return m_anchorPosition + elapsed.count();
+}
+
+bool MediaPositionClock::isRunning() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_running;
+}
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
@@ -449,8 +449,9 @@ void SpeechRecognizerEngineImpl::onKeyWordDetected(
     std::shared_ptr<const std::vector<char>> KWDMetadata) {
     if (m_state == AudioInputProcessorObserverInterface::State::IDLE &&
         m_speechRecognizerPlatformInterface->wakewordDetected(keyword)) {
-        m_executor.submit([this, beginIndex, endIndex, keyword] {
-            if (m_wakewordVerifier && m_wakewordVerifier->verify(keyword, VERIFICATION_TIMEOUT)) {
+        m_executor.submit([this, stream, beginIndex, endIndex, keyword] {
+            if (m_wakewordVerifier &&
+                m_wakewordVerifier->verifyDetection(keyword, stream, beginIndex, endIndex, VERIFICATION_TIMEOUT)) {
                 AACE_INFO(LX(TAG, "onKeyWordDetected: Cancelled by Wakeword Verifier"));
                 return;
             }
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Attachment/AttachmentReader.h>
+#include <AACE/Engine/Alexa/AudioChannelEngineImpl.h>
+
+using aace::engine::alexa::AttachmentReaderAudioStream;
+using alexaClientSDK::avsCommon::avs::attachment::AttachmentReader;
+
+static const std::chrono::milliseconds READ_TIMEOUT(100);
+
+/// An attachment reader that never blocks, like the NONBLOCKING readers of the AVS attachments.
+class NonBlockingAttachmentReader : public AttachmentReader {
+public:
+    size_t read(void* buf, std::size_t numBytes, ReadStatus* readStatus, std::chrono::milliseconds) override {
+        m_readCount++;
+        if (m_closed) {
+            *readStatus = ReadStatus::CLOSED;
+            return 0;
+        }
+        if (!m_available || numBytes == 0) {
+            *readStatus = ReadStatus::OK_WOULDBLOCK;
+            return 0;
+        }
+        m_available = false;
+        static_cast<char*>(buf)[0] = 1;
+        *readStatus = ReadStatus::OK;
+        return 1;
+    }
+
+    bool seek(uint64_t) override {
+        return false;
+    }
+
+    uint64_t getNumUnreadBytes() override {
+        return m_available ? 1 : 0;
+    }
+
+    void close(ClosePoint) override {
+        m_closed = true;
+    }
+
+    std::atomic<bool> m_available{false};
+    std::atomic<bool> m_closed{false};
+    std::atomic<int> m_readCount{0};
+};
+
+TEST(AttachmentReaderAudioStreamTest, readBlockingWaitsForTimeoutWhenEmpty) {
+    auto reader = std::make_shared<NonBlockingAttachmentReader>();
+    auto stream = AttachmentReaderAudioStream::create(reader, nullptr);
+    ASSERT_NE(stream, nullptr);
+
+    char data[16];
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(stream->readBlocking(data, sizeof(data), READ_TIMEOUT), 0);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GE(elapsed, READ_TIMEOUT);
+    EXPECT_LT(elapsed, READ_TIMEOUT * 3);
+    EXPECT_FALSE(stream->isClosed());
+
+    // the reader is polled, not spun on
+    EXPECT_LE(reader->m_readCount, 20);
+    EXPECT_EQ(stream->getReadStatistics().underrunCount, 1u);
+}
+
+TEST(AttachmentReaderAudioStreamTest, readBlockingReturnsWhenDataArrives) {
+    auto reader = std::make_shared<NonBlockingAttachmentReader>();
+    auto stream = AttachmentReaderAudioStream::create(reader, nullptr);
+    ASSERT_NE(stream, nullptr);
+
+    std::thread writer([reader] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        reader->m_available = true;
+    });
+
+    char data[16];
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(stream->readBlocking(data, sizeof(data), std::chrono::seconds(2)), 1);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    writer.join();
+}
+
+TEST(AttachmentReaderAudioStreamTest, readBlockingReturnsWhenClosed) {
+    auto reader = std::make_shared<NonBlockingAttachmentReader>();
+    auto stream = AttachmentReaderAudioStream::create(reader, nullptr);
+    ASSERT_NE(stream, nullptr);
+
+    std::thread closer([reader] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        reader->m_closed = true;
+    });
+
+    char data[16];
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(stream->readBlocking(data, sizeof(data), std::chrono::seconds(2)), 0);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    EXPECT_TRUE(stream->isClosed());
+    closer.join();
+}
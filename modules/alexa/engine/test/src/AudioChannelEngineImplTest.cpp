@@ -0,0 +1,302 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
+#include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterfaceFactoryInterface.h>
+#include <AVSCommon/SDKInterfaces/test/MockSpeakerManager.h>
+#include <AVSCommon/Utils/HTTPContent.h>
+
+#include <AACE/Engine/Alexa/AudioChannelEngineImpl.h>
+#include <AACE/Engine/Alexa/AudioPrefetcher.h>
+#include <AACE/Test/Audio/MockAudioOutputChannelInterface.h>
+
+using namespace alexaClientSDK::avsCommon;
+using aace::engine::alexa::AudioChannelEngineImpl;
+using aace::engine::alexa::AudioPrefetcher;
+using aace::engine::alexa::PooledAudioChannelPlayer;
+using SourceId = utils::mediaPlayer::MediaPlayerInterface::SourceId;
+
+static const std::string CURRENT_URL("https://example.com/current.mp3");
+static const std::string NEXT_URL("https://example.com/next.mp3");
+static const size_t PREFETCH_BUFFER_SIZE = 64 * 1024;
+
+/// A download whose response is sent by the test.
+class FakeContentFetcher : public sdkInterfaces::HTTPContentFetcherInterface {
+public:
+    FakeContentFetcher(const std::string& url, std::future<long> statusCode, const std::string& contentType) :
+            m_url(url), m_statusCode(std::move(statusCode)), m_contentType(contentType) {
+    }
+
+    State getState() override {
+        return State::BODY_DONE;
+    }
+
+    std::string getUrl() const override {
+        return m_url;
+    }
+
+    Header getHeader(std::atomic<bool>*) override {
+        return Header();
+    }
+
+    bool getBody(std::shared_ptr<avs::attachment::AttachmentWriter>) override {
+        return false;
+    }
+
+    void shutdown() override {
+    }
+
+    std::unique_ptr<utils::HTTPContent> getContent(
+        FetchOptions,
+        std::unique_ptr<avs::attachment::AttachmentWriter> writer,
+        const std::vector<std::string>&) override {
+        // the beginning of the content is in the buffer when the server responds
+        static const char data[1024] = {};
+        avs::attachment::AttachmentWriter::WriteStatus writeStatus;
+        writer->write(data, sizeof(data), &writeStatus);
+
+        std::promise<std::string> contentType;
+        contentType.set_value(m_contentType);
+        return std::unique_ptr<utils::HTTPContent>(
+            new utils::HTTPContent(std::move(m_statusCode), contentType.get_future(), nullptr));
+    }
+
+private:
+    std::string m_url;
+    std::future<long> m_statusCode;
+    std::string m_contentType;
+};
+
+/// Creates downloads that wait for the test to send the response of the server.
+class FakeContentFetcherFactory : public sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface {
+public:
+    std::unique_ptr<sdkInterfaces::HTTPContentFetcherInterface> create(const std::string& url) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_createCount++;
+        m_responses.emplace_back();
+        return std::unique_ptr<sdkInterfaces::HTTPContentFetcherInterface>(
+            new FakeContentFetcher(url, m_responses.back().get_future(), m_contentType));
+    }
+
+    /// Sends the response of the server to the downloads created so far.
+    void respond(long statusCode) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& response : m_responses) {
+            response.set_value(statusCode);
+        }
+        m_responses.clear();
+    }
+
+    std::atomic<int> m_createCount{0};
+
+    /// The content type of the responses
+    std::string m_contentType = "audio/mpeg";
+
+private:
+    std::mutex m_mutex;
+    std::vector<std::promise<long>> m_responses;
+};
+
+/// Exposes the prefetcher of the channel, which the AudioPlayer enables.
+class TestAudioChannel : public AudioChannelEngineImpl {
+public:
+    TestAudioChannel() : AudioChannelEngineImpl(sdkInterfaces::ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME) {
+    }
+
+    using AudioChannelEngineImpl::setAudioPrefetcher;
+};
+
+class AudioChannelEngineImplTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_audioOutputChannel =
+            std::make_shared<testing::NiceMock<aace::test::audio::MockAudioOutputChannelInterface>>();
+        ON_CALL(*m_audioOutputChannel, prepare(testing::An<const std::string&>(), testing::_))
+            .WillByDefault(testing::Return(true));
+        ON_CALL(*m_audioOutputChannel, prepare(testing::An<std::shared_ptr<aace::audio::AudioStream>>(), testing::_))
+            .WillByDefault(testing::Return(true));
+        ON_CALL(*m_audioOutputChannel, play()).WillByDefault(testing::Return(true));
+        ON_CALL(*m_audioOutputChannel, stop()).WillByDefault(testing::Return(true));
+        ON_CALL(*m_audioOutputChannel, setPosition(testing::_)).WillByDefault(testing::Return(true));
+
+        m_speakerManager = std::make_shared<testing::NiceMock<sdkInterfaces::test::MockSpeakerManager>>();
+        m_contentFetcherFactory = std::make_shared<FakeContentFetcherFactory>();
+
+        m_audioChannel = std::make_shared<TestAudioChannel>();
+        ASSERT_TRUE(m_audioChannel->initializeAudioChannel(m_audioOutputChannel, m_speakerManager));
+        m_audioChannel->setAudioPrefetcher(AudioPrefetcher::create(PREFETCH_BUFFER_SIZE, m_contentFetcherFactory));
+    }
+
+    void TearDown() override {
+        m_audioChannel->shutdown();
+    }
+
+    /// Sets and plays the current source, which the next source is queued behind.
+    SourceId playCurrentSource() {
+        auto id = m_audioChannel->setSource(CURRENT_URL, std::chrono::milliseconds(0), {}, false);
+        EXPECT_NE(id, utils::mediaPlayer::MediaPlayerInterface::ERROR);
+        EXPECT_TRUE(m_audioChannel->play(id));
+        return id;
+    }
+
+protected:
+    std::shared_ptr<testing::NiceMock<aace::test::audio::MockAudioOutputChannelInterface>> m_audioOutputChannel;
+    std::shared_ptr<testing::NiceMock<sdkInterfaces::test::MockSpeakerManager>> m_speakerManager;
+    std::shared_ptr<FakeContentFetcherFactory> m_contentFetcherFactory;
+    std::shared_ptr<TestAudioChannel> m_audioChannel;
+};
+
+TEST_F(AudioChannelEngineImplTest, playsNextSourceFromPrefetchedStream) {
+    auto currentId = playCurrentSource();
+
+    // the next source does not interrupt the current source
+    EXPECT_CALL(*m_audioOutputChannel, prepare(NEXT_URL, testing::_)).Times(0);
+    EXPECT_CALL(*m_audioOutputChannel, stop()).Times(0);
+    auto nextId = m_audioChannel->setSource(NEXT_URL, std::chrono::milliseconds(0), {}, false);
+    ASSERT_NE(nextId, utils::mediaPlayer::MediaPlayerInterface::ERROR);
+    EXPECT_NE(nextId, currentId);
+    EXPECT_EQ(m_contentFetcherFactory->m_createCount, 1);
+    testing::Mock::VerifyAndClearExpectations(m_audioOutputChannel.get());
+
+    m_contentFetcherFactory->respond(200);
+
+    std::shared_ptr<aace::audio::AudioStream> stream;
+    EXPECT_CALL(*m_audioOutputChannel, prepare(testing::An<std::shared_ptr<aace::audio::AudioStream>>(), false))
+        .WillOnce(testing::DoAll(testing::SaveArg<0>(&stream), testing::Return(true)));
+    EXPECT_CALL(*m_audioOutputChannel, prepare(NEXT_URL, testing::_)).Times(0);
+    EXPECT_TRUE(m_audioChannel->play(nextId));
+    EXPECT_EQ(m_audioChannel->getOffset(nextId), std::chrono::milliseconds(0));
+
+    // the format of the stream is the content type of the response
+    ASSERT_NE(stream, nullptr);
+    EXPECT_EQ(stream->getMediaType(), aace::audio::AudioStream::MediaType::MPEG);
+    EXPECT_EQ(stream->getAudioFormat().getEncoding(), aace::audio::AudioFormat::Encoding::MP3);
+}
+
+TEST_F(AudioChannelEngineImplTest, leavesFormatOfPrefetchedStreamUnknownForOtherContentTypes) {
+    m_contentFetcherFactory->m_contentType = "audio/aac";
+    playCurrentSource();
+    auto nextId = m_audioChannel->setSource(NEXT_URL, std::chrono::milliseconds(0), {}, false);
+    m_contentFetcherFactory->respond(200);
+
+    std::shared_ptr<aace::audio::AudioStream> stream;
+    EXPECT_CALL(*m_audioOutputChannel, prepare(testing::An<std::shared_ptr<aace::audio::AudioStream>>(), false))
+        .WillOnce(testing::DoAll(testing::SaveArg<0>(&stream), testing::Return(true)));
+    EXPECT_TRUE(m_audioChannel->play(nextId));
+
+    ASSERT_NE(stream, nullptr);
+    EXPECT_EQ(stream->getMediaType(), aace::audio::AudioStream::MediaType::UNKNOWN);
+    EXPECT_EQ(stream->getAudioFormat().getEncoding(), aace::audio::AudioFormat::Encoding::UNKNOWN);
+}
+
+TEST_F(AudioChannelEngineImplTest, playsNextSourceFromUrlWhenPrefetchIsNotReady) {
+    playCurrentSource();
+    auto nextId = m_audioChannel->setSource(NEXT_URL, std::chrono::milliseconds(0), {}, false);
+    ASSERT_NE(nextId, utils::mediaPlayer::MediaPlayerInterface::ERROR);
+
+    // the server has not responded, so playing does not wait for it
+    EXPECT_CALL(*m_audioOutputChannel, prepare(NEXT_URL, false)).WillOnce(testing::Return(true));
+    EXPECT_CALL(*m_audioOutputChannel, prepare(testing::An<std::shared_ptr<aace::audio::AudioStream>>(), testing::_))
+        .Times(0);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(m_audioChannel->play(nextId));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+    m_contentFetcherFactory->respond(200);
+}
+
+TEST_F(AudioChannelEngineImplTest, playsNextSourceFromUrlWhenPrefetchFailed) {
+    playCurrentSource();
+    auto nextId = m_audioChannel->setSource(NEXT_URL, std::chrono::milliseconds(0), {}, false);
+    m_contentFetcherFactory->respond(404);
+
+    EXPECT_CALL(*m_audioOutputChannel, prepare(NEXT_URL, false)).WillOnce(testing::Return(true));
+    EXPECT_TRUE(m_audioChannel->play(nextId));
+}
+
+TEST_F(AudioChannelEngineImplTest, stopsNextSourceWithoutStoppingCurrentSource) {
+    auto currentId = playCurrentSource();
+    auto nextId = m_audioChannel->setSource(NEXT_URL, std::chrono::milliseconds(0), {}, false);
+    m_contentFetcherFactory->respond(200);
+
+    EXPECT_CALL(*m_audioOutputChannel, stop()).Times(0);
+    EXPECT_TRUE(m_audioChannel->stop(nextId));
+    testing::Mock::VerifyAndClearExpectations(m_audioOutputChannel.get());
+
+    // the cancelled next source can no longer be played, and the current source is still valid
+    EXPECT_CALL(*m_audioOutputChannel, prepare(testing::An<std::shared_ptr<aace::audio::AudioStream>>(), testing::_))
+        .Times(0);
+    EXPECT_FALSE(m_audioChannel->play(nextId));
+    EXPECT_TRUE(m_audioChannel->stop(currentId));
+}
+
+TEST_F(AudioChannelEngineImplTest, playsNextSourceWithOffsetFromUrl) {
+    const std::chrono::milliseconds offset(5000);
+    playCurrentSource();
+
+    // content played from an offset is not prefetched
+    auto nextId = m_audioChannel->setSource(NEXT_URL, offset, {}, false);
+    ASSERT_NE(nextId, utils::mediaPlayer::MediaPlayerInterface::ERROR);
+    EXPECT_EQ(m_contentFetcherFactory->m_createCount, 0);
+    EXPECT_EQ(m_audioChannel->getOffset(nextId), offset);
+
+    EXPECT_CALL(*m_audioOutputChannel, prepare(NEXT_URL, false)).WillOnce(testing::Return(true));
+    EXPECT_CALL(*m_audioOutputChannel, setPosition(offset.count())).WillOnce(testing::Return(true));
+    EXPECT_TRUE(m_audioChannel->play(nextId));
+    EXPECT_EQ(m_audioChannel->getOffset(nextId), offset);
+}
+
+TEST_F(AudioChannelEngineImplTest, replacesCurrentSourceAfterStopBeforePlatformStopped) {
+    auto currentId = playCurrentSource();
+
+    // the platform has not reported the stop yet, but the source that follows the stop replaces the current source
+    EXPECT_TRUE(m_audioChannel->stop(currentId));
+    EXPECT_CALL(*m_audioOutputChannel, prepare(NEXT_URL, false)).WillOnce(testing::Return(true));
+    auto id = m_audioChannel->setSource(NEXT_URL, std::chrono::milliseconds(0), {}, false);
+    ASSERT_NE(id, utils::mediaPlayer::MediaPlayerInterface::ERROR);
+    EXPECT_EQ(m_contentFetcherFactory->m_createCount, 0);
+    EXPECT_TRUE(m_audioChannel->play(id));
+
+    m_contentFetcherFactory->respond(200);
+}
+
+TEST_F(AudioChannelEngineImplTest, pooledPlayersControlOnlyTheirOwnSource) {
+    PooledAudioChannelPlayer currentPlayer(m_audioChannel);
+    PooledAudioChannelPlayer nextPlayer(m_audioChannel);
+    auto currentId = currentPlayer.setSource(CURRENT_URL, std::chrono::milliseconds(0), {}, false);
+    ASSERT_NE(currentId, utils::mediaPlayer::MediaPlayerInterface::ERROR);
+    EXPECT_TRUE(currentPlayer.play(currentId));
+    auto nextId = nextPlayer.setSource(NEXT_URL, std::chrono::milliseconds(0), {}, false);
+    ASSERT_NE(nextId, utils::mediaPlayer::MediaPlayerInterface::ERROR);
+    m_contentFetcherFactory->respond(200);
+
+    // neither player stops the source of the other
+    EXPECT_CALL(*m_audioOutputChannel, stop()).Times(0);
+    EXPECT_FALSE(nextPlayer.stop(currentId));
+    EXPECT_FALSE(currentPlayer.stop(nextId));
+    testing::Mock::VerifyAndClearExpectations(m_audioOutputChannel.get());
+
+    EXPECT_TRUE(nextPlayer.stop(nextId));
+    EXPECT_TRUE(currentPlayer.stop(currentId));
+}
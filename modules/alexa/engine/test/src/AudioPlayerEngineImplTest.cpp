@@ -84,7 +84,8 @@ protected:
         }
     }
 
-    std::shared_ptr<aace::engine::alexa::AudioPlayerEngineImpl> createAudioPlayerEngineImpl() {
+    std::shared_ptr<aace::engine::alexa::AudioPlayerEngineImpl> createAudioPlayerEngineImpl(
+        size_t prefetchBufferSize = 0) {
         if (m_configured == false) {
             configure();
         }
@@ -103,7 +104,8 @@ protected:
             m_alexaMockFactory->getPlaybackRouterMock(),
             m_alexaMockFactory->getCertifiedSenderMock(),
             m_alexaMockFactory->getAudioPlayerObserverInterfaceMock(),
-            m_alexaMockFactory->getAuthDelegateInterfaceMock());
+            m_alexaMockFactory->getAuthDelegateInterfaceMock(),
+            prefetchBufferSize);
 
         return audioPlayerEngineImpl;
     }
@@ -123,6 +125,13 @@ TEST_F(AudioPlayerEngineImplTest, create) {
     audioPlayerEngineImpl->shutdown();
 }
 
+TEST_F(AudioPlayerEngineImplTest, createWithPrefetchEnabled) {
+    auto audioPlayerEngineImpl = createAudioPlayerEngineImpl(64 * 1024);
+    ASSERT_NE(audioPlayerEngineImpl, nullptr) << "AudioPlayerEngineImpl pointer expected to be not null";
+
+    audioPlayerEngineImpl->shutdown();
+}
+
 TEST_F(AudioPlayerEngineImplTest, createWithPlatformInterfaceAsNull) {
     EXPECT_CALL(*m_alexaMockFactory->getDirectiveSequencerInterfaceMock(), doShutdown());
 
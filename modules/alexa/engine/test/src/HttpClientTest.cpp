@@ -0,0 +1,256 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AACE/Engine/Alexa/HttpClient.h>
+
+using aace::engine::alexa::HttpClient;
+
+/**
+ * A local HTTP/1.1 server that answers each request with its method and body, and counts the connections it
+ * accepts and the requests it serves concurrently.
+ */
+class StubHttpServer {
+public:
+    StubHttpServer() : m_socket(-1), m_port(0), m_connections(0), m_activeRequests(0), m_maxActiveRequests(0) {
+    }
+
+    ~StubHttpServer() {
+        stop();
+    }
+
+    bool start() {
+        m_socket = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        if (m_socket < 0 || bind(m_socket, reinterpret_cast<sockaddr*>(&address), length) != 0 ||
+            listen(m_socket, 16) != 0 || getsockname(m_socket, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+            return false;
+        }
+        m_port = ntohs(address.sin_port);
+        m_acceptThread = std::thread(&StubHttpServer::acceptLoop, this);
+        return true;
+    }
+
+    void stop() {
+        if (m_socket >= 0) {
+            shutdown(m_socket, SHUT_RDWR);
+            close(m_socket);
+            m_socket = -1;
+        }
+        if (m_acceptThread.joinable()) {
+            m_acceptThread.join();
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto client : m_clients) {
+            shutdown(client, SHUT_RDWR);
+        }
+        for (auto& thread : m_connectionThreads) {
+            thread.join();
+        }
+        for (auto client : m_clients) {
+            close(client);
+        }
+        m_connectionThreads.clear();
+        m_clients.clear();
+    }
+
+    std::string getUrl(const std::string& path) {
+        return "http://127.0.0.1:" + std::to_string(m_port) + path;
+    }
+
+    void setResponseDelay(std::chrono::milliseconds delay) {
+        m_responseDelay = delay;
+    }
+
+    int getConnections() {
+        return m_connections;
+    }
+
+    int getMaxActiveRequests() {
+        return m_maxActiveRequests;
+    }
+
+private:
+    void acceptLoop() {
+        int client;
+        while ((client = accept(m_socket, nullptr, nullptr)) >= 0) {
+            m_connections++;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_clients.push_back(client);
+            m_connectionThreads.emplace_back(&StubHttpServer::connectionLoop, this, client);
+        }
+    }
+
+    void connectionLoop(int client) {
+        std::string buffer;
+        char data[4096];
+        ssize_t size;
+        while ((size = recv(client, data, sizeof(data), 0)) > 0) {
+            buffer.append(data, size);
+            size_t headerEnd;
+            while ((headerEnd = buffer.find("\r\n\r\n")) != std::string::npos) {
+                auto header = buffer.substr(0, headerEnd);
+                size_t contentLength = 0;
+                auto lowerHeader = header;
+                std::transform(lowerHeader.begin(), lowerHeader.end(), lowerHeader.begin(), ::tolower);
+                auto contentLengthStart = lowerHeader.find("content-length:");
+                if (contentLengthStart != std::string::npos) {
+                    contentLength = std::stoul(header.substr(contentLengthStart + 15));
+                }
+                if (buffer.size() < headerEnd + 4 + contentLength) {
+                    break;
+                }
+                auto body = header.substr(0, header.find(' ')) + " " + buffer.substr(headerEnd + 4, contentLength);
+                buffer.erase(0, headerEnd + 4 + contentLength);
+
+                auto activeRequests = ++m_activeRequests;
+                int maxActiveRequests = m_maxActiveRequests;
+                while (activeRequests > maxActiveRequests &&
+                       !m_maxActiveRequests.compare_exchange_weak(maxActiveRequests, activeRequests)) {
+                }
+                std::this_thread::sleep_for(m_responseDelay.load());
+                m_activeRequests--;
+
+                auto response =
+                    "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+                send(client, response.data(), response.size(), MSG_NOSIGNAL);
+            }
+        }
+    }
+
+private:
+    int m_socket;
+    int m_port;
+    std::atomic<int> m_connections;
+    std::atomic<int> m_activeRequests;
+    std::atomic<int> m_maxActiveRequests;
+    std::atomic<std::chrono::milliseconds> m_responseDelay{std::chrono::milliseconds(0)};
+
+    std::thread m_acceptThread;
+    std::vector<std::thread> m_connectionThreads;
+    std::vector<int> m_clients;
+    std::mutex m_mutex;
+};
+
+class HttpClientTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        ASSERT_TRUE(m_server.start());
+        m_httpClient = HttpClient::create();
+        ASSERT_NE(m_httpClient, nullptr);
+    }
+
+    void TearDown() override {
+        m_httpClient.reset();
+        m_server.stop();
+    }
+
+protected:
+    StubHttpServer m_server;
+    std::shared_ptr<HttpClient> m_httpClient;
+};
+
+TEST_F(HttpClientTest, createWithInvalidMaxConcurrentRequests) {
+    EXPECT_EQ(HttpClient::create(1, 0), nullptr);
+}
+
+TEST_F(HttpClientTest, sendsRequestMethodAndData) {
+    auto response = m_httpClient->doGet("test", m_server.getUrl("/get"), {});
+    EXPECT_EQ(response.code, 200);
+    EXPECT_EQ(response.body, "GET ");
+
+    response = m_httpClient->doPost("test", m_server.getUrl("/post"), {"Content-Type: text/plain"}, "post data");
+    EXPECT_EQ(response.code, 200);
+    EXPECT_EQ(response.body, "POST post data");
+
+    response = m_httpClient->doPost("test", m_server.getUrl("/form"), {}, {{"code", "a b&c"}, {"user_code", "x~y"}});
+    EXPECT_EQ(response.body, "POST code=a%20b%26c&user_code=x~y");
+
+    response = m_httpClient->doPut("test", m_server.getUrl("/put"), {}, "put data");
+    EXPECT_EQ(response.body, "PUT put data");
+
+    response = m_httpClient->doDelete("test", m_server.getUrl("/delete"), {});
+    EXPECT_EQ(response.body, "DELETE ");
+}
+
+TEST_F(HttpClientTest, reusesConnection) {
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(m_httpClient->doGet(i % 2 ? "first" : "second", m_server.getUrl("/"), {}).code, 200);
+    }
+    EXPECT_EQ(m_server.getConnections(), 1);
+}
+
+TEST_F(HttpClientTest, resetConnectionsReconnects) {
+    EXPECT_EQ(m_httpClient->doGet("test", m_server.getUrl("/"), {}).code, 200);
+    m_httpClient->resetConnections();
+    EXPECT_EQ(m_httpClient->doGet("test", m_server.getUrl("/"), {}).code, 200);
+    EXPECT_EQ(m_server.getConnections(), 2);
+}
+
+TEST_F(HttpClientTest, failedRequestReturnsEmptyResponse) {
+    auto url = m_server.getUrl("/");
+    m_server.stop();
+    EXPECT_EQ(m_httpClient->doGet("test", url, {}).code, 0);
+}
+
+TEST_F(HttpClientTest, limitsConcurrentRequestsOfClient) {
+    ASSERT_TRUE(m_httpClient->setMaxConcurrentRequests("test", 1));
+    EXPECT_FALSE(m_httpClient->setMaxConcurrentRequests("test", 0));
+    m_server.setResponseDelay(std::chrono::milliseconds(50));
+
+    std::vector<std::thread> threads;
+    std::atomic<int> succeeded(0);
+    for (int i = 0; i < 3; i++) {
+        threads.emplace_back([this, &succeeded]() {
+            if (m_httpClient->doGet("test", m_server.getUrl("/"), {}).code == 200) {
+                succeeded++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(succeeded, 3);
+    EXPECT_EQ(m_server.getMaxActiveRequests(), 1);
+}
+
+TEST_F(HttpClientTest, concurrentRequestLimitWaitTimesOut) {
+    m_server.setResponseDelay(std::chrono::milliseconds(1500));
+    ASSERT_TRUE(m_httpClient->setMaxConcurrentRequests("test", 1));
+
+    std::thread slowRequest([this]() { m_httpClient->doGet("test", m_server.getUrl("/"), {}); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    EXPECT_EQ(m_httpClient->doGet("test", m_server.getUrl("/"), {}, std::chrono::seconds(1)).code, 0);
+    slowRequest.join();
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <AACE/Engine/Alexa/MediaPositionClock.h>
+
+using aace::engine::alexa::MediaPositionClock;
+
+static const std::chrono::milliseconds ADVANCE_DURATION(50);
+
+TEST(MediaPositionClockTest, holdsPositionWhenStopped) {
+    MediaPositionClock clock;
+    EXPECT_EQ(clock.getPosition(), 0);
+
+    clock.anchor(1000, false);
+    std::this_thread::sleep_for(ADVANCE_DURATION);
+    EXPECT_EQ(clock.getPosition(), 1000);
+    EXPECT_FALSE(clock.isRunning());
+}
+
+TEST(MediaPositionClockTest, advancesPositionWhenRunning) {
+    MediaPositionClock clock;
+
+    clock.anchor(1000, true);
+    std::this_thread::sleep_for(ADVANCE_DURATION);
+    EXPECT_GE(clock.getPosition(), 1000 + ADVANCE_DURATION.count());
+    EXPECT_TRUE(clock.isRunning());
+
+    clock.anchor(clock.getPosition(), false);
+    auto position = clock.getPosition();
+    std::this_thread::sleep_for(ADVANCE_DURATION);
+    EXPECT_EQ(clock.getPosition(), position);
+}
+
+TEST(MediaPositionClockTest, reanchorKeepsRunningState) {
+    MediaPositionClock clock;
+
+    clock.anchor(1000, true);
+    clock.reanchor(30000);
+    EXPECT_TRUE(clock.isRunning());
+    EXPECT_GE(clock.getPosition(), 30000);
+    EXPECT_LT(clock.getPosition(), 31000);
+
+    clock.anchor(0, false);
+    clock.reanchor(5000);
+    EXPECT_FALSE(clock.isRunning());
+    EXPECT_EQ(clock.getPosition(), 5000);
+}
+
+TEST(MediaPositionClockTest, unknownPositionDoesNotAdvance) {
+    MediaPositionClock clock;
+
+    clock.anchor(MediaPositionClock::TIME_UNKNOWN, true);
+    std::this_thread::sleep_for(ADVANCE_DURATION);
+    EXPECT_EQ(clock.getPosition(), MediaPositionClock::TIME_UNKNOWN);
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_ASSET_BUNDLE_H
+#define AACE_ENGINE_CAR_CONTROL_ASSET_BUNDLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * A read-only, compact representation of a set of assets. Each unique string
+ * is stored once in an interned string table, and assets are indexed by ID so
+ * the friendly names of an asset can be looked up without parsing JSON.
+ *
+ * A bundle is produced at build time by @c tools/compile-assets.py, or at
+ * runtime from assets JSON. The bundle data may be a static array linked into
+ * the Engine, a file mapped into memory, or a buffer owned by the bundle.
+ * See @c compile-assets.py for the binary layout.
+ */
+class AssetBundle {
+public:
+    /// Alias for readability. Pair of friendly name literal text to its locale
+    using NameLocalePair = std::pair<const char*, const char*>;
+
+    /**
+     * Create a bundle that references @c data without copying it. The data must
+     * outlive the bundle.
+     *
+     * @return The bundle, or @c nullptr if @c data is not a valid bundle
+     */
+    static std::shared_ptr<AssetBundle> create(const unsigned char* data, size_t size);
+
+    /**
+     * Create a bundle from the file at @c path. A binary bundle is mapped into
+     * memory, and any other file is compiled as assets JSON.
+     *
+     * @return The bundle, or @c nullptr if the file could not be loaded
+     */
+    static std::shared_ptr<AssetBundle> createFromFile(const std::string& path);
+
+    /**
+     * Create a bundle by compiling the assets JSON in @c stream.
+     *
+     * @return The bundle, or @c nullptr if the JSON is malformed or missing values
+     */
+    static std::shared_ptr<AssetBundle> compile(std::istream& stream);
+
+    /// Destructor
+    ~AssetBundle();
+
+    /**
+     * Append the friendly name and locale pairs of the asset with the given ID
+     * to @c names. The pairs point into the bundle and are valid for the
+     * lifetime of the bundle.
+     *
+     * @return @c true if the bundle contains the asset, otherwise @c false
+     */
+    bool getFriendlyNames(const std::string& assetId, std::vector<NameLocalePair>& names) const;
+
+    /// @return The number of assets in the bundle
+    size_t getAssetCount() const;
+
+    /// @return The size in bytes of the bundle data
+    size_t getSize() const;
+
+private:
+    AssetBundle();
+
+    bool initialize(const unsigned char* data, size_t size);
+    uint32_t read(size_t offset) const;
+
+private:
+    const unsigned char* m_data;
+    size_t m_size;
+
+    /// Storage for a bundle compiled at runtime or read from a file that could not be mapped
+    std::vector<unsigned char> m_buffer;
+
+    /// The mapped file, if the bundle was mapped into memory
+    void* m_mapping;
+    size_t m_mappingSize;
+
+    uint32_t m_assetCount;
+    uint32_t m_entryCount;
+    size_t m_assetsOffset;
+    size_t m_entriesOffset;
+    const char* m_strings;
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_ASSET_BUNDLE_H
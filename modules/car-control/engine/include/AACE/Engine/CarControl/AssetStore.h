@@ -16,12 +16,12 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_ASSET_STORE_H
 #define AACE_ENGINE_CAR_CONTROL_ASSET_STORE_H
 
-#include <istream>
+#include <memory>
 #include <string>
-#include <unordered_map>
-#include <utility>
 #include <vector>
 
+#include <AACE/Engine/CarControl/AssetBundle.h>
+
 namespace aace {
 namespace engine {
 namespace carControl {
@@ -32,11 +32,15 @@ namespace carControl {
  * friendly names and locales associated with each asset ID. Literal friendly 
  * names of assets may be retrieved by asset ID when constructing a discovery 
  * message with assets translated to text.
+ *
+ * Assets are held in @c AssetBundle instances, which store each unique string
+ * once. If an asset ID is defined by more than one set of assets, the
+ * definition that was added first is used.
  */
 class AssetStore {
 public:
     /// Alias for readability. Pair of friendly name literal text to its locale
-    using NameLocalePair = std::pair<std::string, std::string>;
+    using NameLocalePair = AssetBundle::NameLocalePair;
 
     /// Destructor
     ~AssetStore();
@@ -44,7 +48,8 @@ public:
     /**
      * Ingest the assets file at the given path and populate the AssetStore
      * with the text/locale pairs. The contents of the file must contain the
-     * assets JSON in the expected schema.
+     * assets JSON in the expected schema, or a binary asset bundle compiled
+     * by @c tools/compile-assets.py.
      *
      * @param path The path of the assets file to ingest
      * @return @c true if the assets were ingested successfully; @c false if 
@@ -53,7 +58,9 @@ public:
     bool addAssets(const std::string& path);
 
     /**
-     * Ingest the default set of 1P assets from @c AssetsDefault.h. This is an
+     * Ingest the default set of 1P assets. When the Engine is built with the
+     * precompiled default asset bundle, the bundle linked into the Engine is
+     * used without parsing, otherwise @c AssetsDefault.h is parsed. This is an
      * alternative to calling @c addAssets with a path to the default assets and
      * should be used if no 1P assets path is provided in 'aace.carControl' 
      * configuration.
@@ -68,9 +75,10 @@ public:
      * asset ID.
      *
      * @param The ID of the asset
-     * @return A list of pairs of friendly name and locale strings for the asset
+     * @return A list of pairs of friendly name and locale strings for the asset.
+     * The strings are owned by the AssetStore and are valid until @c clear() is called.
      */
-    const std::vector<NameLocalePair>& getFriendlyNames(const std::string& assetId) const;
+    std::vector<NameLocalePair> getFriendlyNames(const std::string& assetId) const;
 
     /**
      * Clear the contents of the AssetStore
@@ -78,29 +86,8 @@ public:
     void clear();
 
 private:
-    /**
-     * Ingest the assets from the istream and populate the AssetStore with the
-     * friendly name text / locale pairs. The contents of the stream must 
-     * contain the assets JSON in the expected schema.
-     *
-     * @param stream The istream containing the assets to ingest
-     * @return true if the assets were ingested successfully; false if there was
-     * an issue such as malformed or missing values
-     */
-    bool addAssets(std::istream& stream);
-
-    /**
-     * A map of asset ID to a list of friendly name text / locale pairs used to
-     * describe the asset. It contains an entry for all assets ingested by the
-     * AssetStore.
-     */
-    std::unordered_map<std::string, std::vector<NameLocalePair>> m_assets;
-
-    /**
-     * An empty list to be returned from @c getFriendlyNames() if the specified ID
-     * isn't present in the AssetStore
-     */
-    std::vector<NameLocalePair> m_empty;
+    /// The ingested asset bundles, in the order they were added
+    std::vector<std::shared_ptr<AssetBundle>> m_bundles;
 };
 
 }  // namespace carControl
@@ -18,11 +18,18 @@
 
 #include <AVSCommon/Utils/RequiresShutdown.h>
 
+#include <chrono>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 #include "AACE/CarControl/CarControl.h"
+#include "AACE/CarControl/CarControlEngineInterfaces.h"
 #include "AACE/Engine/CarControl/CarControlServiceInterface.h"
+#include "AACE/Engine/CarControl/CommandBatcher.h"
+#include "AACE/Engine/CarControl/ControllerStateCache.h"
 
 namespace aace {
 namespace engine {
@@ -30,10 +37,29 @@ namespace carControl {
 
 class CarControlEngineImpl
         : public CarControlServiceInterface
-        , public alexaClientSDK::avsCommon::utils::RequiresShutdown {
+        , public aace::carControl::CarControlEngineInterface
+        , public alexaClientSDK::avsCommon::utils::RequiresShutdown
+        , public std::enable_shared_from_this<CarControlEngineImpl> {
 public:
+    /**
+     * Create a @c CarControlEngineImpl
+     *
+     * @param platformInterface The @c CarControl platform interface
+     * @param stateCacheEnabled Whether controller states are cached from the state changes reported by the platform
+     * @param changeReportWindow The time over which reported state changes are coalesced before they are reported
+     * to Alexa, if the state cache is enabled
+     * @param commandBatchingEnabled Whether commands arriving together are delivered to the platform in one batch
+     * @param commandBatchWindow The time the first command of a batch waits for other commands, if command batching
+     * is enabled
+     * @param timers The timers on which state changes are reported, required if the state cache is enabled
+     */
     static std::shared_ptr<CarControlEngineImpl> create(
-        std::shared_ptr<aace::carControl::CarControl> platformInterface);
+        std::shared_ptr<aace::carControl::CarControl> platformInterface,
+        bool stateCacheEnabled = false,
+        std::chrono::milliseconds changeReportWindow = std::chrono::milliseconds(0),
+        bool commandBatchingEnabled = false,
+        std::chrono::milliseconds commandBatchWindow = std::chrono::milliseconds(0),
+        std::shared_ptr<aace::engine::utils::threading::TimerWheel> timers = nullptr);
 
     CarControlEngineImpl(std::shared_ptr<aace::carControl::CarControl> platformInterface);
 
@@ -56,13 +82,68 @@ public:
     bool adjustModeControllerValue(const std::string& endpointId, const std::string& instance, int delta) override;
     bool getModeControllerValue(const std::string& endpointId, const std::string& instance, std::string& value)
         override;
+
+    bool isStateCacheEnabled() override;
+    void addControllerStateObserver(
+        const std::string& endpointId,
+        const std::string& instance,
+        std::shared_ptr<ControllerStateObserverInterface> observer) override;
+    /// @}
+
+    /// @name @c CarControlEngineInterface methods
+    /// @{
+    void onPowerControllerStateChanged(const std::string& endpointId, bool isOn) override;
+    void onToggleControllerStateChanged(const std::string& endpointId, const std::string& controllerId, bool isOn)
+        override;
+    void onRangeControllerValueChanged(const std::string& endpointId, const std::string& controllerId, double value)
+        override;
+    void onModeControllerValueChanged(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        const std::string& value) override;
     /// @}
 
 protected:
     void doShutdown() override;
 
+private:
+    /**
+     * Notifies the state observers of the controllers that changed
+     */
+    void notifyStateChanged(const std::vector<ControllerStateCache::Change>& changed);
+
+    /// Alias to improve readability
+    using ControllerCommand = aace::carControl::CarControl::ControllerCommand;
+
+    /**
+     * Executes a command in a batch, if command batching is enabled, or directly otherwise, and removes the cached
+     * state of the controller if the command succeeded
+     */
+    bool executeCommand(const ControllerCommand& command);
+
+    /**
+     * Executes a command with the per-controller method of the platform interface
+     */
+    bool executeSingleCommand(const ControllerCommand& command);
+
+    /**
+     * Executes a batch of commands with the platform interface, falling back to the per-controller methods if the
+     * platform does not execute batches
+     */
+    void executeCommandBatch(const std::vector<ControllerCommand>& commands, std::vector<bool>& results);
+
 private:
     std::shared_ptr<aace::carControl::CarControl> m_platformInterface;
+
+    /// The cache of controller states, or @c nullptr if the state cache is disabled
+    std::shared_ptr<ControllerStateCache> m_stateCache;
+
+    /// The batcher of commands, or @c nullptr if command batching is disabled
+    std::shared_ptr<CommandBatcher> m_commandBatcher;
+
+    /// The state observers of the controllers, by endpoint ID and instance
+    std::map<ControllerStateCache::ControllerKey, std::weak_ptr<ControllerStateObserverInterface>> m_stateObservers;
+    std::mutex m_stateObserversMutex;
 };
 
 }  // namespace carControl
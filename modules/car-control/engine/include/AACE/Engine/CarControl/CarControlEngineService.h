@@ -16,15 +16,18 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_ENGINE_SERVICE_H
 #define AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_ENGINE_SERVICE_H
 
+#include <chrono>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <unordered_map>
 
 #include "AACE/CarControl/CarControl.h"
+#include "AACE/Engine/Alexa/AlexaEngineService.h"
 #include "AACE/Engine/CarControl/AssetStore.h"
 #include "AACE/Engine/CarControl/CarControlEngineImpl.h"
 #include "AACE/Engine/CarControl/Endpoint.h"
 #include "AACE/Engine/Storage/StorageEngineService.h"
+#include "AACE/Engine/Utils/Threading/TimerWheel.h"
 
 namespace aace {
 namespace engine {
@@ -36,7 +39,11 @@ class CarControlEngineService
         : public aace::engine::core::EngineService
         , public std::enable_shared_from_this<CarControlEngineService> {
 public:
-    DESCRIBE("aace.carControl", VERSION("1.0"), DEPENDS(aace::engine::storage::StorageEngineService))
+    DESCRIBE(
+        "aace.carControl",
+        VERSION("1.0"),
+        DEPENDS(aace::engine::alexa::AlexaEngineService),
+        DEPENDS(aace::engine::storage::StorageEngineService))
 public:
     virtual ~CarControlEngineService();
 
@@ -100,6 +107,21 @@ private:
     /// Whether the @c CarControlEngineService has been configured
     bool m_configured = false;
 
+    /// Whether controller states reported by the platform are cached and reported to Alexa proactively
+    bool m_stateCacheEnabled;
+
+    /// The time over which state changes reported by the platform are coalesced
+    std::chrono::milliseconds m_changeReportWindow;
+
+    /// The timers of the state change reports, which outlive the engine implementation
+    std::shared_ptr<aace::engine::utils::threading::TimerWheel> m_timers;
+
+    /// Whether commands arriving together are delivered to the platform in one batch
+    bool m_commandBatchingEnabled;
+
+    /// The time the first command of a batch waits for other commands to join the batch
+    std::chrono::milliseconds m_commandBatchWindow;
+
     /// The capability configuration for the Alexa.Automotive.ZoneDefinitions capability generated at translation time
     json m_zonesCapabilityConfig;
 };
@@ -16,12 +16,32 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_SERVICE_INTERFACE_H
 #define AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_SERVICE_INTERFACE_H
 
+#include <memory>
 #include <string>
 
+#include <AVSCommon/SDKInterfaces/AlexaStateChangeCauseType.h>
+
 namespace aace {
 namespace engine {
 namespace carControl {
 
+/**
+ * Observer of the controller state changes reported by the platform
+ */
+class ControllerStateObserverInterface {
+public:
+    virtual ~ControllerStateObserverInterface() = default;
+
+    /**
+     * Notifies the observer that the state of the controller changed
+     *
+     * @param [in] cause @c VOICE_INTERACTION if the change follows a command sent to the controller, or
+     * @c PHYSICAL_INTERACTION if it was made on the vehicle
+     */
+    virtual void onControllerStateChanged(
+        alexaClientSDK::avsCommon::sdkInterfaces::AlexaStateChangeCauseType cause) = 0;
+};
+
 /**
  * Interface for the car control engine, with responsibilities as follows:
  *  @li Provides access to invoke the capability controllers of the @c CarControl platform interface
@@ -143,6 +163,29 @@ public:
         const std::string& endpointId,
         const std::string& instance,
         std::string& value) = 0;
+
+    /**
+     * Check whether controller states are cached from the state changes reported by the platform. Controllers report
+     * their state to Alexa only when the states are cached.
+     *
+     * @return @c true if controller states are cached
+     */
+    virtual bool isStateCacheEnabled() {
+        return false;
+    }
+
+    /**
+     * Add an observer of the state changes of the controller identified by @c endpointId and @c instance.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] instance The instance of the controller, or an empty string for a power controller.
+     * @param [in] observer The observer to notify.
+     */
+    virtual void addControllerStateObserver(
+        const std::string& endpointId,
+        const std::string& instance,
+        std::shared_ptr<ControllerStateObserverInterface> observer) {
+    }
 };
 
 }  // namespace carControl
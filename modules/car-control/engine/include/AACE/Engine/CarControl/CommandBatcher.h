@@ -0,0 +1,96 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_COMMAND_BATCHER_H
+#define AACE_ENGINE_CAR_CONTROL_COMMAND_BATCHER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "AACE/CarControl/CarControl.h"
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * Collects controller commands that arrive concurrently and executes them together.
+ *
+ * Alexa sends a separate directive to each endpoint targeted by an utterance such as "turn on all seat heaters", and
+ * the directives are handled concurrently by the capability agents of the endpoints. The first command to arrive
+ * opens a batch and waits for the batch window; commands arriving in the window join the batch. The batch is then
+ * passed to the @c ExecuteHandler once, and each caller returns the result of its own command.
+ */
+class CommandBatcher {
+public:
+    /// Alias to improve readability
+    using ControllerCommand = aace::carControl::CarControl::ControllerCommand;
+
+    /// Executes a batch of commands and sets the result of each command
+    using ExecuteHandler =
+        std::function<void(const std::vector<ControllerCommand>& commands, std::vector<bool>& results)>;
+
+    /**
+     * Create a @c CommandBatcher
+     *
+     * @param batchWindow The time the first command of a batch waits for other commands to join the batch
+     * @param executeHandler The handler that executes each batch
+     * @return The @c CommandBatcher, or @c nullptr if the arguments are invalid
+     */
+    static std::shared_ptr<CommandBatcher> create(std::chrono::milliseconds batchWindow, ExecuteHandler executeHandler);
+
+    /**
+     * Adds a command to the current batch and waits until the batch is executed.
+     *
+     * @return The result of the command, or @c false if the batcher is shut down
+     */
+    bool execute(const ControllerCommand& command);
+
+    /**
+     * Fails the commands of the open batch without executing them, and all later commands.
+     */
+    void shutdown();
+
+private:
+    /// A batch of commands and their results
+    struct Batch {
+        std::vector<ControllerCommand> commands;
+        std::vector<bool> results;
+        bool executed = false;
+    };
+
+    CommandBatcher(std::chrono::milliseconds batchWindow, ExecuteHandler executeHandler);
+
+private:
+    std::chrono::milliseconds m_batchWindow;
+    ExecuteHandler m_executeHandler;
+
+    /// The batch that new commands join, or @c nullptr if no batch is open
+    std::shared_ptr<Batch> m_openBatch;
+    bool m_shutdown;
+
+    std::mutex m_mutex;
+    std::condition_variable m_trigger;
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_COMMAND_BATCHER_H
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_CONTROLLER_STATE_CACHE_H
+#define AACE_ENGINE_CAR_CONTROL_CONTROLLER_STATE_CACHE_H
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "AACE/Engine/Utils/Threading/TimerWheel.h"
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * Caches the controller states that the platform reports with state change notifications, so state queries can be
+ * answered without a synchronous call to the platform.
+ *
+ * Changes are reported to the @c ChangeHandler from a timer of a @c TimerWheel, on the thread of the wheel. The
+ * handler is called once per @c changeReportWindow with every controller that changed in the window, so a burst of
+ * changes, such as all HVAC zones moving together or a value ramping through intermediate settings, results in one
+ * report per controller. Each change tells whether it follows a command sent to the controller, or was made on the
+ * vehicle.
+ */
+class ControllerStateCache : public std::enable_shared_from_this<ControllerStateCache> {
+public:
+    /// Identifies a controller by endpoint ID and instance. The instance of a power controller is empty.
+    using ControllerKey = std::pair<std::string, std::string>;
+
+    /// A controller whose state changed
+    struct Change {
+        ControllerKey key;
+
+        /// Whether the change is the first change reported after a command was sent to the controller
+        bool followsCommand;
+    };
+
+    /// Called with the controllers whose state changed
+    using ChangeHandler = std::function<void(const std::vector<Change>& changed)>;
+
+    /**
+     * Creates a @c ControllerStateCache.
+     *
+     * @param changeReportWindow The time over which changes are coalesced before they are reported
+     * @param changeHandler The handler of the changes
+     * @param timers The timers of the reports. The cache does not keep the wheel, which must outlive it and must not
+     * be released by the change handler.
+     */
+    static std::shared_ptr<ControllerStateCache> create(
+        std::chrono::milliseconds changeReportWindow,
+        ChangeHandler changeHandler,
+        std::shared_ptr<aace::engine::utils::threading::TimerWheel> timers);
+
+    ~ControllerStateCache();
+
+    void setPowerState(const std::string& endpointId, bool isOn);
+    bool getPowerState(const std::string& endpointId, bool& isOn);
+
+    void setToggleState(const std::string& endpointId, const std::string& instance, bool isOn);
+    bool getToggleState(const std::string& endpointId, const std::string& instance, bool& isOn);
+
+    void setRangeValue(const std::string& endpointId, const std::string& instance, double value);
+    bool getRangeValue(const std::string& endpointId, const std::string& instance, double& value);
+
+    void setModeValue(const std::string& endpointId, const std::string& instance, const std::string& value);
+    bool getModeValue(const std::string& endpointId, const std::string& instance, std::string& value);
+
+    /**
+     * Records a command about to be sent to a controller. The cached state is outdated by the command, so it is
+     * removed and queried from the platform until the platform reports the state again. The next change the platform
+     * reports for the controller, including a change reported while the command executes, is reported as following
+     * the command if it is reported within a few seconds.
+     */
+    void beginCommand(const std::string& endpointId, const std::string& instance);
+
+    /**
+     * Forgets a command that failed, so the next change of the controller is not reported as following it.
+     */
+    void cancelCommand(const std::string& endpointId, const std::string& instance);
+
+    /**
+     * Stops reporting changes. Pending changes are discarded, and a report in progress on another thread completes
+     * before this returns.
+     */
+    void shutdown();
+
+private:
+    struct State {
+        enum class Type { POWER, TOGGLE, RANGE, MODE };
+
+        Type type;
+        bool isOn;
+        double rangeValue;
+        std::string modeValue;
+
+        bool operator==(const State& other) const;
+    };
+
+    ControllerStateCache(
+        std::chrono::milliseconds changeReportWindow,
+        ChangeHandler changeHandler,
+        std::shared_ptr<aace::engine::utils::threading::TimerWheel> timers);
+
+    void update(const ControllerKey& key, const State& state);
+    bool get(const ControllerKey& key, State::Type type, State& state);
+    void reportChanges();
+
+private:
+    std::chrono::milliseconds m_changeReportWindow;
+    ChangeHandler m_changeHandler;
+    /// Not owned, so that a report ending the last reference to the cache does not release the wheel from its thread
+    std::weak_ptr<aace::engine::utils::threading::TimerWheel> m_timers;
+
+    std::map<ControllerKey, State> m_states;
+
+    /// The controllers whose change was reported in the window, and whether the change follows a command
+    std::map<ControllerKey, bool> m_pendingChanges;
+
+    /// The controllers a command was sent to, and when, until the platform reports their next change
+    std::map<ControllerKey, std::chrono::steady_clock::time_point> m_commands;
+    bool m_shutdown;
+
+    /// The timer that closes the window of the pending changes, if any
+    aace::engine::utils::threading::TimerWheel::TimerId m_reportTimer;
+
+    /// The thread calling the change handler, if any
+    std::thread::id m_reportingThread;
+
+    std::mutex m_mutex;
+
+    /// Held while the changes are reported, so that @c shutdown() can wait for a report in progress
+    std::mutex m_reportMutex;
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_CONTROLLER_STATE_CACHE_H
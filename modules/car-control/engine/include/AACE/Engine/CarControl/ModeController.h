@@ -16,6 +16,10 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_MODECONTROLLER_H
 #define AACE_ENGINE_CAR_CONTROL_MODECONTROLLER_H
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <AVSCommon/SDKInterfaces/ModeController/ModeControllerInterface.h>
 #include <Endpoints/EndpointBuilder.h>
 
@@ -33,6 +37,7 @@ namespace carControl {
 class ModeController
         : public PrimitiveController
         , public alexaClientSDK::avsCommon::sdkInterfaces::modeController::ModeControllerInterface
+        , public ControllerStateObserverInterface
         , public std::enable_shared_from_this<ModeController> {
 public:
     /// Aliases to improve readability
@@ -75,6 +80,11 @@ public:
     void removeObserver(const std::shared_ptr<ModeControllerObserverInterface>& observer) override;
     /// @}
 
+    /// @name ControllerStateObserverInterface methods
+    /// @{
+    void onControllerStateChanged(AlexaStateChangeCauseType cause) override;
+    /// @}
+
 private:
     /**
      * ModeController constructor
@@ -90,6 +100,10 @@ private:
 
     /// The list of modes supported by this controller
     std::vector<std::string> m_supportedModes;
+
+    /// The observers notified when the platform reports a change of the state of this controller
+    std::vector<std::shared_ptr<ModeControllerObserverInterface>> m_observers;
+    std::mutex m_observersMutex;
 };
 
 }  // namespace carControl
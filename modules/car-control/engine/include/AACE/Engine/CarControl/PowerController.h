@@ -16,6 +16,10 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_POWERCONTROLLER_H
 #define AACE_ENGINE_CAR_CONTROL_POWERCONTROLLER_H
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <AVSCommon/SDKInterfaces/PowerController/PowerControllerInterface.h>
 #include <Endpoints/EndpointBuilder.h>
 
@@ -31,6 +35,7 @@ namespace carControl {
 class PowerController
         : public CapabilityController
         , public alexaClientSDK::avsCommon::sdkInterfaces::powerController::PowerControllerInterface
+        , public ControllerStateObserverInterface
         , public std::enable_shared_from_this<PowerController> {
 public:
     /// Aliases to improve readability
@@ -66,11 +71,20 @@ public:
     void removeObserver(const std::shared_ptr<PowerControllerObserverInterface>& observer) override;
     /// @}
 
+    /// @name ControllerStateObserverInterface methods
+    /// @{
+    void onControllerStateChanged(AlexaStateChangeCauseType cause) override;
+    /// @}
+
 private:
     /**
      * PowerController constructor.
      */
     PowerController(const std::string& endpointId, const std::string& interface);
+
+    /// The observers notified when the platform reports a change of the state of this controller
+    std::vector<std::shared_ptr<PowerControllerObserverInterface>> m_observers;
+    std::mutex m_observersMutex;
 };
 
 }  // namespace carControl
@@ -16,6 +16,10 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_RANGECONTROLLER_H
 #define AACE_ENGINE_CAR_CONTROL_RANGECONTROLLER_H
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <AVSCommon/SDKInterfaces/RangeController/RangeControllerInterface.h>
 #include <Endpoints/EndpointBuilder.h>
 
@@ -33,6 +37,7 @@ namespace carControl {
 class RangeController
         : public PrimitiveController
         , public alexaClientSDK::avsCommon::sdkInterfaces::rangeController::RangeControllerInterface
+        , public ControllerStateObserverInterface
         , public std::enable_shared_from_this<RangeController> {
 public:
     /// Aliases to improve readability
@@ -77,6 +82,11 @@ public:
     void removeObserver(const std::shared_ptr<RangeControllerObserverInterface>& observer) override;
     /// @}
 
+    /// @name ControllerStateObserverInterface methods
+    /// @{
+    void onControllerStateChanged(AlexaStateChangeCauseType cause) override;
+    /// @}
+
 private:
     /**
      * RangeController constructor.
@@ -99,6 +109,10 @@ private:
     double m_maximum;
     /// The precision of range increments allowed for this controller
     double m_precision;
+
+    /// The observers notified when the platform reports a change of the state of this controller
+    std::vector<std::shared_ptr<RangeControllerObserverInterface>> m_observers;
+    std::mutex m_observersMutex;
 };
 
 }  // namespace carControl
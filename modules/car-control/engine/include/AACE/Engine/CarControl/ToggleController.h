@@ -16,6 +16,10 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_TOGGLECONTROLLER_H
 #define AACE_ENGINE_CAR_CONTROL_TOGGLECONTROLLER_H
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <AVSCommon/SDKInterfaces/ToggleController/ToggleControllerInterface.h>
 #include <Endpoints/EndpointBuilder.h>
 
@@ -33,6 +37,7 @@ namespace carControl {
 class ToggleController
         : public PrimitiveController
         , public alexaClientSDK::avsCommon::sdkInterfaces::toggleController::ToggleControllerInterface
+        , public ControllerStateObserverInterface
         , public std::enable_shared_from_this<ToggleController> {
 public:
     /// Aliases to improve readability
@@ -75,6 +80,11 @@ public:
     void removeObserver(const std::shared_ptr<ToggleControllerObserverInterface>& observer) override;
     /// @}
 
+    /// @name ControllerStateObserverInterface methods
+    /// @{
+    void onControllerStateChanged(AlexaStateChangeCauseType cause) override;
+    /// @}
+
 private:
     /**
      * ToggleController constructor
@@ -87,6 +97,10 @@ private:
 
     /// The attributes of this ToggleController
     ToggleControllerAttributes m_attributes;
+
+    /// The observers notified when the platform reports a change of the state of this controller
+    std::vector<std::shared_ptr<ToggleControllerObserverInterface>> m_observers;
+    std::mutex m_observersMutex;
 };
 
 }  // namespace carControl
@@ -0,0 +1,329 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/CarControl/AssetBundle.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// JSON for Modern C++
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.carControl.AssetBundle");
+
+/// The first bytes of every bundle
+static const char BUNDLE_MAGIC[] = {'A', 'A', 'C', 'B'};
+
+/// The bundle layout version
+static const uint32_t BUNDLE_VERSION = 1;
+
+/// Size of the header: magic, version, asset count, entry count, string table size
+static const size_t HEADER_SIZE = 20;
+
+/// Size of an asset record: asset ID offset, first entry, entry count
+static const size_t ASSET_RECORD_SIZE = 12;
+
+/// Size of an entry: friendly name offset, locale offset
+static const size_t ENTRY_SIZE = 8;
+
+namespace {
+
+/// Builds the binary layout of a bundle. See @c tools/compile-assets.py.
+class BundleWriter {
+public:
+    uint32_t intern(const std::string& value) {
+        auto it = m_offsets.find(value);
+        if (it != m_offsets.end()) {
+            return it->second;
+        }
+        auto offset = static_cast<uint32_t>(m_strings.size());
+        m_strings.insert(m_strings.end(), value.begin(), value.end());
+        m_strings.push_back('\0');
+        m_offsets.emplace(value, offset);
+        return offset;
+    }
+
+    /// Adds an asset. Returns @c false if an asset with the same ID was already added.
+    bool add(const std::string& assetId, std::vector<std::pair<uint32_t, uint32_t>> entries) {
+        return m_assets.emplace(assetId, std::move(entries)).second;
+    }
+
+    std::vector<unsigned char> write() {
+        // std::map orders asset IDs by their bytes, which matches the strcmp used for lookup
+        std::vector<unsigned char> records;
+        std::vector<unsigned char> entries;
+        uint32_t entryCount = 0;
+        for (auto& asset : m_assets) {
+            append(records, intern(asset.first));
+            append(records, entryCount);
+            append(records, static_cast<uint32_t>(asset.second.size()));
+            for (auto& entry : asset.second) {
+                append(entries, entry.first);
+                append(entries, entry.second);
+            }
+            entryCount += static_cast<uint32_t>(asset.second.size());
+        }
+
+        std::vector<unsigned char> bundle(std::begin(BUNDLE_MAGIC), std::end(BUNDLE_MAGIC));
+        append(bundle, BUNDLE_VERSION);
+        append(bundle, static_cast<uint32_t>(m_assets.size()));
+        append(bundle, entryCount);
+        append(bundle, static_cast<uint32_t>(m_strings.size()));
+        bundle.insert(bundle.end(), records.begin(), records.end());
+        bundle.insert(bundle.end(), entries.begin(), entries.end());
+        bundle.insert(bundle.end(), m_strings.begin(), m_strings.end());
+        return bundle;
+    }
+
+private:
+    static void append(std::vector<unsigned char>& data, uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            data.push_back(static_cast<unsigned char>((value >> shift) & 0xff));
+        }
+    }
+
+    std::unordered_map<std::string, uint32_t> m_offsets;
+    std::vector<unsigned char> m_strings;
+    std::map<std::string, std::vector<std::pair<uint32_t, uint32_t>>> m_assets;
+};
+
+}  // namespace
+
+AssetBundle::AssetBundle() :
+        m_data(nullptr),
+        m_size(0),
+        m_mapping(nullptr),
+        m_mappingSize(0),
+        m_assetCount(0),
+        m_entryCount(0),
+        m_assetsOffset(0),
+        m_entriesOffset(0),
+        m_strings(nullptr) {
+}
+
+AssetBundle::~AssetBundle() {
+    if (m_mapping != nullptr) {
+        munmap(m_mapping, m_mappingSize);
+    }
+}
+
+std::shared_ptr<AssetBundle> AssetBundle::create(const unsigned char* data, size_t size) {
+    try {
+        ThrowIfNull(data, "invalidData");
+        auto bundle = std::shared_ptr<AssetBundle>(new AssetBundle());
+        ThrowIfNot(bundle->initialize(data, size), "initializeFailed");
+        return bundle;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::shared_ptr<AssetBundle> AssetBundle::createFromFile(const std::string& path) {
+    int fd = -1;
+    try {
+        std::ifstream ifs(path, std::ios::binary);
+        ThrowIfNot(ifs.good(), "openFileFailed");
+
+        char magic[sizeof(BUNDLE_MAGIC)] = {};
+        ifs.read(magic, sizeof(magic));
+        if (!ifs || std::memcmp(magic, BUNDLE_MAGIC, sizeof(magic)) != 0) {
+            // not a binary bundle, so compile the file as assets JSON
+            ifs.clear();
+            ifs.seekg(0);
+            return compile(ifs);
+        }
+        ifs.close();
+
+        auto bundle = std::shared_ptr<AssetBundle>(new AssetBundle());
+
+        fd = open(path.c_str(), O_RDONLY);
+        ThrowIf(fd < 0, "openFileFailed");
+        struct stat st;
+        ThrowIf(fstat(fd, &st) != 0, "statFileFailed");
+        auto size = static_cast<size_t>(st.st_size);
+
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            bundle->m_mapping = mapping;
+            bundle->m_mappingSize = size;
+            ThrowIfNot(bundle->initialize(static_cast<const unsigned char*>(mapping), size), "initializeFailed");
+        } else {
+            AACE_WARN(LX(TAG).m("mapFileFailed").d("errno", errno));
+            ifs.open(path, std::ios::binary);
+            bundle->m_buffer.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+            ThrowIfNot(bundle->initialize(bundle->m_buffer.data(), bundle->m_buffer.size()), "initializeFailed");
+        }
+        close(fd);
+
+        return bundle;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("path", path));
+        if (fd >= 0) {
+            close(fd);
+        }
+        return nullptr;
+    }
+}
+
+std::shared_ptr<AssetBundle> AssetBundle::compile(std::istream& stream) {
+    try {
+        ThrowIfNot(stream.good(), "invalidStream");
+        BundleWriter writer;
+        json j = json::parse(stream);
+        for (auto& assetObject : j.at("assets")) {
+            // 'entries' will hold all synonyms for all locales for all values
+            std::vector<std::pair<uint32_t, uint32_t>> entries;
+            std::string assetId = assetObject.at("assetId").get<std::string>();
+            for (auto& valueObject : assetObject.at("values")) {
+                uint32_t defaultValue = writer.intern(valueObject.at("defaultValue").get<std::string>());
+                std::vector<uint32_t> synonyms;
+                if (valueObject.contains("synonyms")) {
+                    for (auto& synonym : valueObject.at("synonyms")) {
+                        synonyms.push_back(writer.intern(synonym.get<std::string>()));
+                    }
+                }
+                // For every locale, add the defaultValue and each synonym
+                // to the list of names for this assetId
+                for (auto& localeValue : valueObject.at("locales")) {
+                    uint32_t locale = writer.intern(localeValue.get<std::string>());
+                    entries.push_back({defaultValue, locale});
+                    for (auto synonym : synonyms) {
+                        entries.push_back({synonym, locale});
+                    }
+                }
+            }
+            ThrowIf(entries.empty(), "noAssetFriendlyNameFor " + assetId);
+            if (!writer.add(assetId, std::move(entries))) {
+                AACE_WARN(LX(TAG).m("duplicateAssetIgnored").d("assetId", assetId));
+            }
+        }
+
+        auto bundle = std::shared_ptr<AssetBundle>(new AssetBundle());
+        bundle->m_buffer = writer.write();
+        ThrowIfNot(bundle->initialize(bundle->m_buffer.data(), bundle->m_buffer.size()), "initializeFailed");
+        return bundle;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+uint32_t AssetBundle::read(size_t offset) const {
+    return static_cast<uint32_t>(m_data[offset]) | (static_cast<uint32_t>(m_data[offset + 1]) << 8) |
+           (static_cast<uint32_t>(m_data[offset + 2]) << 16) | (static_cast<uint32_t>(m_data[offset + 3]) << 24);
+}
+
+bool AssetBundle::initialize(const unsigned char* data, size_t size) {
+    try {
+        m_data = data;
+        m_size = size;
+
+        ThrowIf(size < HEADER_SIZE, "bundleTooSmall");
+        ThrowIf(std::memcmp(data, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC)) != 0, "invalidBundleMagic");
+        ThrowIf(read(4) != BUNDLE_VERSION, "unsupportedBundleVersion");
+
+        m_assetCount = read(8);
+        m_entryCount = read(12);
+        uint64_t stringTableSize = read(16);
+
+        // every offset in the bundle is validated once here, so lookups do not need bounds checks
+        uint64_t expectedSize = HEADER_SIZE + static_cast<uint64_t>(m_assetCount) * ASSET_RECORD_SIZE +
+                                static_cast<uint64_t>(m_entryCount) * ENTRY_SIZE + stringTableSize;
+        ThrowIf(expectedSize != size, "invalidBundleSize");
+        ThrowIf(stringTableSize == 0 || data[size - 1] != '\0', "invalidStringTable");
+
+        m_assetsOffset = HEADER_SIZE;
+        m_entriesOffset = m_assetsOffset + static_cast<size_t>(m_assetCount) * ASSET_RECORD_SIZE;
+        m_strings = reinterpret_cast<const char*>(data + size - stringTableSize);
+
+        const char* previousId = nullptr;
+        for (uint32_t i = 0; i < m_assetCount; i++) {
+            size_t record = m_assetsOffset + static_cast<size_t>(i) * ASSET_RECORD_SIZE;
+            ThrowIf(read(record) >= stringTableSize, "invalidAssetIdOffset");
+            ThrowIf(static_cast<uint64_t>(read(record + 4)) + read(record + 8) > m_entryCount, "invalidAssetEntries");
+            const char* assetId = m_strings + read(record);
+            ThrowIf(previousId != nullptr && std::strcmp(previousId, assetId) >= 0, "assetsNotSorted");
+            previousId = assetId;
+        }
+        for (uint32_t i = 0; i < m_entryCount; i++) {
+            size_t entry = m_entriesOffset + static_cast<size_t>(i) * ENTRY_SIZE;
+            ThrowIf(read(entry) >= stringTableSize || read(entry + 4) >= stringTableSize, "invalidEntryOffset");
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        m_data = nullptr;
+        m_size = 0;
+        m_assetCount = 0;
+        m_entryCount = 0;
+        return false;
+    }
+}
+
+bool AssetBundle::getFriendlyNames(const std::string& assetId, std::vector<NameLocalePair>& names) const {
+    // binary search the asset records, which are sorted by asset ID
+    size_t low = 0;
+    size_t high = m_assetCount;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        size_t record = m_assetsOffset + mid * ASSET_RECORD_SIZE;
+        int result = std::strcmp(m_strings + read(record), assetId.c_str());
+        if (result < 0) {
+            low = mid + 1;
+        } else if (result > 0) {
+            high = mid;
+        } else {
+            uint32_t first = read(record + 4);
+            uint32_t count = read(record + 8);
+            names.reserve(names.size() + count);
+            for (uint32_t i = first; i < first + count; i++) {
+                size_t entry = m_entriesOffset + static_cast<size_t>(i) * ENTRY_SIZE;
+                names.emplace_back(m_strings + read(entry), m_strings + read(entry + 4));
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t AssetBundle::getAssetCount() const {
+    return m_assetCount;
+}
+
+size_t AssetBundle::getSize() const {
+    return m_size;
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
@@ -14,14 +14,15 @@
  */
 
 #include <AACE/Engine/CarControl/AssetStore.h>
-#include <AACE/Engine/CarControl/AssetsDefault.h>
 #include <AACE/Engine/Core/EngineMacros.h>
 
+#ifdef AAC_CAR_CONTROL_ASSETS_BUNDLE
+// Generated at build time from assets/assets-1P.json by tools/compile-assets.py
+#include <AssetsDefaultBundle.h>
+#else
+#include <AACE/Engine/CarControl/AssetsDefault.h>
 #include <sstream>
-
-// JSON for Modern C++
-#include <nlohmann/json.hpp>
-using json = nlohmann::json;
+#endif
 
 namespace aace {
 namespace engine {
@@ -36,51 +37,30 @@ AssetStore::~AssetStore() {
 
 bool AssetStore::addAssets(const std::string& path) {
     try {
-        std::ifstream ifs(path);
-        return addAssets(ifs);
+        auto bundle = AssetBundle::createFromFile(path);
+        ThrowIfNull(bundle, "createAssetBundleFailed");
+        m_bundles.push_back(bundle);
+        AACE_DEBUG(LX(TAG).d("assetCount", bundle->getAssetCount()).d("bundleSize", bundle->getSize()));
+        return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        clear();
         return false;
     }
 }
 
 bool AssetStore::addDefaultAssets() {
-    std::stringstream stream(ASSETS_DEFAULT);
-    return addAssets(stream);
-}
-
-bool AssetStore::addAssets(std::istream& stream) {
     try {
-        if (stream.good()) {
-            json j = json::parse(stream);
-            json assetArray = j.at("assets");
-            for (auto& assetItem : assetArray.items()) {
-                // For each asset, add an entry to the asset map
-                // 'names' will hold all synonyms for all locales for all values
-                std::vector<NameLocalePair> names;
-                auto assetObject = assetItem.value();
-                std::string assetId = assetObject["assetId"];
-                json valuesArray = assetObject["values"];
-                for (auto& valueItem : valuesArray.items()) {
-                    json valueObject = valueItem.value();
-                    std::string defaultValue = valueObject["defaultValue"];
-                    json synonyms = valueObject["synonyms"];
-                    std::vector<std::string> locales = valueObject.at("locales");
-                    // For every locale, add the defaultValue and each synonym
-                    // to the list of names for this assetId
-                    for (auto locale = locales.begin(); locale != locales.end(); ++locale) {
-                        names.push_back({defaultValue, *locale});
-                        for (auto& synonym : synonyms.items()) {
-                            names.push_back({synonym.value(), *locale});
-                        }
-                    }
-                }
-                ThrowIf(names.empty(), "noAssetFriendlyNameFor " + assetId);
-                m_assets.emplace(assetId, names);
-            }
-            return true;
-        }
-        return false;
+#ifdef AAC_CAR_CONTROL_ASSETS_BUNDLE
+        auto bundle = AssetBundle::create(ASSETS_DEFAULT_BUNDLE, ASSETS_DEFAULT_BUNDLE_SIZE);
+#else
+        std::stringstream stream(ASSETS_DEFAULT);
+        auto bundle = AssetBundle::compile(stream);
+#endif
+        ThrowIfNull(bundle, "createAssetBundleFailed");
+        m_bundles.push_back(bundle);
+        AACE_DEBUG(LX(TAG).d("assetCount", bundle->getAssetCount()).d("bundleSize", bundle->getSize()));
+        return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         clear();
@@ -88,20 +68,18 @@ bool AssetStore::addAssets(std::istream& stream) {
     }
 }
 
-const std::vector<AssetStore::NameLocalePair>& AssetStore::getFriendlyNames(const std::string& assetId) const {
-    auto iter = m_assets.find(assetId);
-    if (iter != m_assets.end()) {
-        return iter->second;
-    } else {
-        return m_empty;
+std::vector<AssetStore::NameLocalePair> AssetStore::getFriendlyNames(const std::string& assetId) const {
+    std::vector<NameLocalePair> names;
+    for (auto& bundle : m_bundles) {
+        if (bundle->getFriendlyNames(assetId, names)) {
+            break;
+        }
     }
+    return names;
 }
 
 void AssetStore::clear() {
-    for (auto value : m_assets) {
-        value.second.clear();
-    }
-    m_assets.clear();
+    m_bundles.clear();
 }
 
 }  // namespace carControl
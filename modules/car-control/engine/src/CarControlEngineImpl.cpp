@@ -15,20 +15,66 @@
 
 #include "AACE/Engine/CarControl/CarControlEngineImpl.h"
 
+#include <algorithm>
+
 #include "AACE/Engine/Core/EngineMacros.h"
 
 namespace aace {
 namespace engine {
 namespace carControl {
 
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.carControl.CarControlEngineImpl");
+
 static const std::string MODE_CONTROLLER_TAG("aace.engine.carControl.ModeController");
 static const std::string POWER_CONTROLLER_TAG("aace.engine.carControl.PowerController");
 static const std::string RANGE_CONTROLLER_TAG("aace.engine.carControl.RangeController");
 static const std::string TOGGLE_CONTROLLER_TAG("aace.engine.carControl.ToggleController");
 
 std::shared_ptr<CarControlEngineImpl> CarControlEngineImpl::create(
-    std::shared_ptr<aace::carControl::CarControl> platformInterface) {
-    return std::make_shared<CarControlEngineImpl>(platformInterface);
+    std::shared_ptr<aace::carControl::CarControl> platformInterface,
+    bool stateCacheEnabled,
+    std::chrono::milliseconds changeReportWindow,
+    bool commandBatchingEnabled,
+    std::chrono::milliseconds commandBatchWindow,
+    std::shared_ptr<aace::engine::utils::threading::TimerWheel> timers) {
+    try {
+        ThrowIfNull(platformInterface, "invalidPlatformInterface");
+        auto carControlEngineImpl = std::make_shared<CarControlEngineImpl>(platformInterface);
+
+        if (stateCacheEnabled) {
+            std::weak_ptr<CarControlEngineImpl> wp = carControlEngineImpl;
+            carControlEngineImpl->m_stateCache = ControllerStateCache::create(
+                changeReportWindow,
+                [wp](const std::vector<ControllerStateCache::Change>& changed) {
+                    if (auto carControlEngineImpl = wp.lock()) {
+                        carControlEngineImpl->notifyStateChanged(changed);
+                    }
+                },
+                timers);
+            ThrowIfNull(carControlEngineImpl->m_stateCache, "createControllerStateCacheFailed");
+            AACE_INFO(LX(TAG).m("stateCacheEnabled").d("changeReportWindowMs", changeReportWindow.count()));
+        }
+
+        if (commandBatchingEnabled) {
+            std::weak_ptr<CarControlEngineImpl> wp = carControlEngineImpl;
+            carControlEngineImpl->m_commandBatcher = CommandBatcher::create(
+                commandBatchWindow, [wp](const std::vector<ControllerCommand>& commands, std::vector<bool>& results) {
+                    if (auto carControlEngineImpl = wp.lock()) {
+                        carControlEngineImpl->executeCommandBatch(commands, results);
+                    }
+                });
+            ThrowIfNull(carControlEngineImpl->m_commandBatcher, "createCommandBatcherFailed");
+            AACE_INFO(LX(TAG).m("commandBatchingEnabled").d("commandBatchWindowMs", commandBatchWindow.count()));
+        }
+
+        platformInterface->setEngineInterface(carControlEngineImpl);
+
+        return carControlEngineImpl;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
 }
 
 CarControlEngineImpl::CarControlEngineImpl(std::shared_ptr<aace::carControl::CarControl> platformInterface) :
@@ -38,15 +84,18 @@ CarControlEngineImpl::CarControlEngineImpl(std::shared_ptr<aace::carControl::Car
 
 bool CarControlEngineImpl::turnPowerControllerOn(const std::string& endpointId) {
     AACE_DEBUG(LX(POWER_CONTROLLER_TAG).sensitive("endpoint", endpointId).sensitive("name", "TurnOn"));
-    return m_platformInterface->turnPowerControllerOn(endpointId);
+    return executeCommand({ControllerCommand::Action::TURN_POWER_ON, endpointId, "", 0, "", 0});
 }
 
 bool CarControlEngineImpl::turnPowerControllerOff(const std::string& endpointId) {
     AACE_DEBUG(LX(POWER_CONTROLLER_TAG).sensitive("endpoint", endpointId).sensitive("name", "TurnOff"));
-    return m_platformInterface->turnPowerControllerOff(endpointId);
+    return executeCommand({ControllerCommand::Action::TURN_POWER_OFF, endpointId, "", 0, "", 0});
 }
 
 bool CarControlEngineImpl::isPowerControllerOn(const std::string& endpointId, bool& isOn) {
+    if (m_stateCache != nullptr && m_stateCache->getPowerState(endpointId, isOn)) {
+        return true;
+    }
     return m_platformInterface->isPowerControllerOn(endpointId, isOn);
 }
 
@@ -55,7 +104,7 @@ bool CarControlEngineImpl::turnToggleControllerOn(const std::string& endpointId,
                    .sensitive("endpoint", endpointId)
                    .sensitive("name", "TurnOn")
                    .sensitive("instance", instance));
-    return m_platformInterface->turnToggleControllerOn(endpointId, instance);
+    return executeCommand({ControllerCommand::Action::TURN_TOGGLE_ON, endpointId, instance, 0, "", 0});
 }
 
 bool CarControlEngineImpl::turnToggleControllerOff(const std::string& endpointId, const std::string& instance) {
@@ -63,13 +112,16 @@ bool CarControlEngineImpl::turnToggleControllerOff(const std::string& endpointId
                    .sensitive("endpoint", endpointId)
                    .sensitive("name", "TurnOff")
                    .sensitive("instance", instance));
-    return m_platformInterface->turnToggleControllerOff(endpointId, instance);
+    return executeCommand({ControllerCommand::Action::TURN_TOGGLE_OFF, endpointId, instance, 0, "", 0});
 }
 
 bool CarControlEngineImpl::isToggleControllerOn(
     const std::string& endpointId,
     const std::string& instance,
     bool& isOn) {
+    if (m_stateCache != nullptr && m_stateCache->getToggleState(endpointId, instance, isOn)) {
+        return true;
+    }
     return m_platformInterface->isToggleControllerOn(endpointId, instance, isOn);
 }
 
@@ -82,7 +134,7 @@ bool CarControlEngineImpl::setRangeControllerValue(
                    .sensitive("name", "SetRangeValue")
                    .sensitive("instance", instance)
                    .sensitive("rangeValue", value));
-    return m_platformInterface->setRangeControllerValue(endpointId, instance, value);
+    return executeCommand({ControllerCommand::Action::SET_RANGE_VALUE, endpointId, instance, value, "", 0});
 }
 
 bool CarControlEngineImpl::adjustRangeControllerValue(
@@ -94,13 +146,16 @@ bool CarControlEngineImpl::adjustRangeControllerValue(
                    .sensitive("name", "AdjustRangeValue")
                    .sensitive("instance", instance)
                    .sensitive("rangeValueDelta", delta));
-    return m_platformInterface->adjustRangeControllerValue(endpointId, instance, delta);
+    return executeCommand({ControllerCommand::Action::ADJUST_RANGE_VALUE, endpointId, instance, delta, "", 0});
 }
 
 bool CarControlEngineImpl::getRangeControllerValue(
     const std::string& endpointId,
     const std::string& instance,
     double& value) {
+    if (m_stateCache != nullptr && m_stateCache->getRangeValue(endpointId, instance, value)) {
+        return true;
+    }
     return m_platformInterface->getRangeControllerValue(endpointId, instance, value);
 }
 
@@ -113,7 +168,7 @@ bool CarControlEngineImpl::setModeControllerValue(
                    .sensitive("name", "SetMode")
                    .sensitive("instance", instance)
                    .sensitive("mode", value));
-    return m_platformInterface->setModeControllerValue(endpointId, instance, value);
+    return executeCommand({ControllerCommand::Action::SET_MODE_VALUE, endpointId, instance, 0, value, 0});
 }
 
 bool CarControlEngineImpl::adjustModeControllerValue(
@@ -125,20 +180,167 @@ bool CarControlEngineImpl::adjustModeControllerValue(
                    .sensitive("name", "AdjustMode")
                    .sensitive("instance", instance)
                    .sensitive("modeDelta", delta));
-    return m_platformInterface->adjustModeControllerValue(endpointId, instance, delta);
+    return executeCommand({ControllerCommand::Action::ADJUST_MODE_VALUE, endpointId, instance, 0, "", delta});
 }
 
 bool CarControlEngineImpl::getModeControllerValue(
     const std::string& endpointId,
     const std::string& instance,
     std::string& value) {
+    if (m_stateCache != nullptr && m_stateCache->getModeValue(endpointId, instance, value)) {
+        return true;
+    }
     return m_platformInterface->getModeControllerValue(endpointId, instance, value);
 }
 
+bool CarControlEngineImpl::isStateCacheEnabled() {
+    return m_stateCache != nullptr;
+}
+
+void CarControlEngineImpl::addControllerStateObserver(
+    const std::string& endpointId,
+    const std::string& instance,
+    std::shared_ptr<ControllerStateObserverInterface> observer) {
+    std::lock_guard<std::mutex> lock(m_stateObserversMutex);
+    m_stateObservers[{endpointId, instance}] = observer;
+}
+
+void CarControlEngineImpl::onPowerControllerStateChanged(const std::string& endpointId, bool isOn) {
+    AACE_DEBUG(LX(POWER_CONTROLLER_TAG).sensitive("endpoint", endpointId).sensitive("isOn", isOn));
+    if (m_stateCache != nullptr) {
+        m_stateCache->setPowerState(endpointId, isOn);
+    }
+}
+
+void CarControlEngineImpl::onToggleControllerStateChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    bool isOn) {
+    AACE_DEBUG(LX(TOGGLE_CONTROLLER_TAG)
+                   .sensitive("endpoint", endpointId)
+                   .sensitive("instance", controllerId)
+                   .sensitive("isOn", isOn));
+    if (m_stateCache != nullptr) {
+        m_stateCache->setToggleState(endpointId, controllerId, isOn);
+    }
+}
+
+void CarControlEngineImpl::onRangeControllerValueChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    double value) {
+    AACE_DEBUG(LX(RANGE_CONTROLLER_TAG)
+                   .sensitive("endpoint", endpointId)
+                   .sensitive("instance", controllerId)
+                   .sensitive("rangeValue", value));
+    if (m_stateCache != nullptr) {
+        m_stateCache->setRangeValue(endpointId, controllerId, value);
+    }
+}
+
+void CarControlEngineImpl::onModeControllerValueChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    const std::string& value) {
+    AACE_DEBUG(LX(MODE_CONTROLLER_TAG)
+                   .sensitive("endpoint", endpointId)
+                   .sensitive("instance", controllerId)
+                   .sensitive("mode", value));
+    if (m_stateCache != nullptr) {
+        m_stateCache->setModeValue(endpointId, controllerId, value);
+    }
+}
+
+void CarControlEngineImpl::notifyStateChanged(const std::vector<ControllerStateCache::Change>& changed) {
+    using AlexaStateChangeCauseType = alexaClientSDK::avsCommon::sdkInterfaces::AlexaStateChangeCauseType;
+
+    std::vector<std::pair<std::shared_ptr<ControllerStateObserverInterface>, AlexaStateChangeCauseType>> observers;
+    {
+        std::lock_guard<std::mutex> lock(m_stateObserversMutex);
+        for (auto& change : changed) {
+            auto it = m_stateObservers.find(change.key);
+            if (it != m_stateObservers.end()) {
+                if (auto observer = it->second.lock()) {
+                    // a change that follows a command is the result of the directive that sent the command
+                    observers.emplace_back(
+                        observer,
+                        change.followsCommand ? AlexaStateChangeCauseType::VOICE_INTERACTION
+                                              : AlexaStateChangeCauseType::PHYSICAL_INTERACTION);
+                }
+            }
+        }
+    }
+    AACE_DEBUG(LX(TAG).d("changed", changed.size()).d("observers", observers.size()));
+    for (auto& observer : observers) {
+        observer.first->onControllerStateChanged(observer.second);
+    }
+}
+
+bool CarControlEngineImpl::executeCommand(const ControllerCommand& command) {
+    // the command is recorded before it is sent, since the platform may report the new state while executing it
+    if (m_stateCache != nullptr) {
+        m_stateCache->beginCommand(command.endpointId, command.controllerId);
+    }
+    bool success = m_commandBatcher != nullptr ? m_commandBatcher->execute(command) : executeSingleCommand(command);
+    if (!success && m_stateCache != nullptr) {
+        m_stateCache->cancelCommand(command.endpointId, command.controllerId);
+    }
+    return success;
+}
+
+bool CarControlEngineImpl::executeSingleCommand(const ControllerCommand& command) {
+    switch (command.action) {
+        case ControllerCommand::Action::TURN_POWER_ON:
+            return m_platformInterface->turnPowerControllerOn(command.endpointId);
+        case ControllerCommand::Action::TURN_POWER_OFF:
+            return m_platformInterface->turnPowerControllerOff(command.endpointId);
+        case ControllerCommand::Action::TURN_TOGGLE_ON:
+            return m_platformInterface->turnToggleControllerOn(command.endpointId, command.controllerId);
+        case ControllerCommand::Action::TURN_TOGGLE_OFF:
+            return m_platformInterface->turnToggleControllerOff(command.endpointId, command.controllerId);
+        case ControllerCommand::Action::SET_RANGE_VALUE:
+            return m_platformInterface->setRangeControllerValue(
+                command.endpointId, command.controllerId, command.rangeValue);
+        case ControllerCommand::Action::ADJUST_RANGE_VALUE:
+            return m_platformInterface->adjustRangeControllerValue(
+                command.endpointId, command.controllerId, command.rangeValue);
+        case ControllerCommand::Action::SET_MODE_VALUE:
+            return m_platformInterface->setModeControllerValue(
+                command.endpointId, command.controllerId, command.modeValue);
+        case ControllerCommand::Action::ADJUST_MODE_VALUE:
+            return m_platformInterface->adjustModeControllerValue(
+                command.endpointId, command.controllerId, command.modeDelta);
+    }
+    return false;
+}
+
+void CarControlEngineImpl::executeCommandBatch(
+    const std::vector<ControllerCommand>& commands,
+    std::vector<bool>& results) {
+    if (m_platformInterface->executeControllerCommands(commands, results)) {
+        return;
+    }
+    // the platform does not execute commands in batches, so each command is sent to its controller
+    AACE_DEBUG(LX(TAG).m("executingCommandsIndividually").d("commands", commands.size()));
+    std::fill(results.begin(), results.end(), false);
+    for (size_t i = 0; i < commands.size(); i++) {
+        results[i] = executeSingleCommand(commands[i]);
+    }
+}
+
 void CarControlEngineImpl::doShutdown() {
+    if (m_commandBatcher != nullptr) {
+        m_commandBatcher->shutdown();
+    }
+    if (m_stateCache != nullptr) {
+        m_stateCache->shutdown();
+    }
     if (m_platformInterface != nullptr) {
+        m_platformInterface->setEngineInterface(nullptr);
         m_platformInterface.reset();
     }
+    std::lock_guard<std::mutex> lock(m_stateObserversMutex);
+    m_stateObservers.clear();
 }
 
 }  // namespace carControl
@@ -25,6 +25,7 @@
 #include "AACE/Engine/CarControl/ZoneDefinitions.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 #include "AACE/Engine/Storage/StorageEngineService.h"
+#include "AACE/Engine/Utils/Hash/SHA256.h"
 
 namespace aace {
 namespace engine {
@@ -42,6 +43,8 @@ static const std::string AACE_STORAGE_SERVICE_KEY = "aace.storage";
 static const std::string CAR_CONTROL_CONFIG_TABLE = "carControl";
 /// The key for the 'configutation' in the database 'carControl' table
 static const std::string CAR_CONTROL_CONFIG_KEY = "configuration";
+/// The key for the hash of the 'configuration' in the database 'carControl' table
+static const std::string CAR_CONTROL_CONFIG_HASH_KEY = "configurationHash";
 
 /// The key for the 'endpoints' node of configuration
 static const std::string CONFIG_KEY_ENDPOINTS = "endpoints";
@@ -51,6 +54,23 @@ static const std::string CONFIG_KEY_ASSETS = "assets";
 static const std::string CONFIG_KEY_DEFAULT_ASSETS_PATH = "defaultAssetsPath";
 /// The key for the 'customAssetsPath' node of configuration
 static const std::string CONFIG_KEY_CUSTOM_ASSETS_PATH = "customAssetsPath";
+/// The key for the 'stateCache' node of configuration
+static const std::string CONFIG_KEY_STATE_CACHE = "stateCache";
+/// The key for the 'enabled' node of the 'stateCache' configuration
+static const std::string CONFIG_KEY_STATE_CACHE_ENABLED = "enabled";
+/// The key for the 'changeReportWindowMs' node of the 'stateCache' configuration
+static const std::string CONFIG_KEY_CHANGE_REPORT_WINDOW = "changeReportWindowMs";
+/// The key for the 'commandBatching' node of configuration
+static const std::string CONFIG_KEY_COMMAND_BATCHING = "commandBatching";
+/// The key for the 'enabled' node of the 'commandBatching' configuration
+static const std::string CONFIG_KEY_COMMAND_BATCHING_ENABLED = "enabled";
+/// The key for the 'batchWindowMs' node of the 'commandBatching' configuration
+static const std::string CONFIG_KEY_COMMAND_BATCH_WINDOW = "batchWindowMs";
+
+/// The default time over which state changes reported by the platform are coalesced
+static const std::chrono::milliseconds DEFAULT_CHANGE_REPORT_WINDOW = std::chrono::milliseconds(250);
+/// The default time the first command of a batch waits for the commands to other endpoints
+static const std::chrono::milliseconds DEFAULT_COMMAND_BATCH_WINDOW = std::chrono::milliseconds(20);
 
 // The endpoint ID of the internal endpoint created for zones
 static const std::string INTERNAL_ENDPOINT_ID = "_AutoSDKInternalRoot";
@@ -59,7 +79,11 @@ static const std::string INTERNAL_ENDPOINT_ID = "_AutoSDKInternalRoot";
 REGISTER_SERVICE(CarControlEngineService);
 
 CarControlEngineService::CarControlEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description) {
+        aace::engine::core::EngineService(description),
+        m_stateCacheEnabled(false),
+        m_changeReportWindow(DEFAULT_CHANGE_REPORT_WINDOW),
+        m_commandBatchingEnabled(false),
+        m_commandBatchWindow(DEFAULT_COMMAND_BATCH_WINDOW) {
 }
 
 CarControlEngineService::~CarControlEngineService() = default;
@@ -105,6 +129,38 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
             ThrowIfNot(m_assetStore.addDefaultAssets(), "addDefaultAssetsFailed");
         }
 
+        // Cache controller states reported by the platform and report changes to Alexa proactively
+        if (jconfiguration.contains(CONFIG_KEY_STATE_CACHE) && jconfiguration[CONFIG_KEY_STATE_CACHE].is_object()) {
+            auto& stateCache = jconfiguration.at(CONFIG_KEY_STATE_CACHE);
+            if (stateCache.contains(CONFIG_KEY_STATE_CACHE_ENABLED)) {
+                ThrowIfNot(stateCache[CONFIG_KEY_STATE_CACHE_ENABLED].is_boolean(), "invalidStateCacheEnabled");
+                m_stateCacheEnabled = stateCache.at(CONFIG_KEY_STATE_CACHE_ENABLED).get<bool>();
+            }
+            if (stateCache.contains(CONFIG_KEY_CHANGE_REPORT_WINDOW)) {
+                ThrowIfNot(
+                    stateCache[CONFIG_KEY_CHANGE_REPORT_WINDOW].is_number_unsigned(), "invalidChangeReportWindowMs");
+                m_changeReportWindow =
+                    std::chrono::milliseconds(stateCache.at(CONFIG_KEY_CHANGE_REPORT_WINDOW).get<uint32_t>());
+            }
+        }
+
+        // Deliver commands that arrive together, such as commands to all seats of a zone, to the platform in one call
+        if (jconfiguration.contains(CONFIG_KEY_COMMAND_BATCHING) &&
+            jconfiguration[CONFIG_KEY_COMMAND_BATCHING].is_object()) {
+            auto& commandBatching = jconfiguration.at(CONFIG_KEY_COMMAND_BATCHING);
+            if (commandBatching.contains(CONFIG_KEY_COMMAND_BATCHING_ENABLED)) {
+                ThrowIfNot(
+                    commandBatching[CONFIG_KEY_COMMAND_BATCHING_ENABLED].is_boolean(), "invalidCommandBatchingEnabled");
+                m_commandBatchingEnabled = commandBatching.at(CONFIG_KEY_COMMAND_BATCHING_ENABLED).get<bool>();
+            }
+            if (commandBatching.contains(CONFIG_KEY_COMMAND_BATCH_WINDOW)) {
+                ThrowIfNot(
+                    commandBatching[CONFIG_KEY_COMMAND_BATCH_WINDOW].is_number_unsigned(), "invalidBatchWindowMs");
+                m_commandBatchWindow =
+                    std::chrono::milliseconds(commandBatching.at(CONFIG_KEY_COMMAND_BATCH_WINDOW).get<uint32_t>());
+            }
+        }
+
         // Translate zones config format from <2.2 to 2.3
         translateConfigForZones(jconfiguration);
 
@@ -122,8 +178,23 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
         auto localStorage =
             getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>(AACE_STORAGE_SERVICE_KEY);
         ThrowIfNull(localStorage, "invalidLocalStorage");
+        // The configuration is only rewritten when it changed since it was last stored. The dump is normalized since
+        // json objects keep their keys sorted, so the hash only depends on the content of the configuration.
         std::string s = jconfiguration.dump();
-        localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, s);
+        std::string hash = aace::engine::utils::hash::SHA256::hash(s);
+        if (localStorage->containsKey(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY) &&
+            localStorage->get(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_HASH_KEY, "") == hash) {
+            AACE_INFO(LX(TAG).m("storedConfigurationUnchanged").d("size", s.size()));
+        } else if (localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, s)) {
+            // the hash is written after the configuration, so an interrupted write is detected on the next start
+            if (!localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_HASH_KEY, hash)) {
+                AACE_WARN(LX(TAG).m("storeConfigurationHashFailed"));
+            }
+            AACE_INFO(LX(TAG).m("storedConfigurationUpdated").d("size", s.size()));
+        } else {
+            AACE_ERROR(LX(TAG).m("storeConfigurationFailed"));
+            localStorage->removeKey(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_HASH_KEY);
+        }
 
         m_configured = true;
         return true;
@@ -208,7 +279,16 @@ bool CarControlEngineService::registerPlatformInterfaceType(
     try {
         ThrowIfNotNull(m_carControlEngineImpl, "platformInterfaceAlreadyRegistered");
 
-        m_carControlEngineImpl = CarControlEngineImpl::create(platformInterface);
+        if (m_stateCacheEnabled) {
+            m_timers = std::make_shared<aace::engine::utils::threading::TimerWheel>();
+        }
+        m_carControlEngineImpl = CarControlEngineImpl::create(
+            platformInterface,
+            m_stateCacheEnabled,
+            m_changeReportWindow,
+            m_commandBatchingEnabled,
+            m_commandBatchWindow,
+            m_timers);
         ThrowIfNull(m_carControlEngineImpl, "createCarControlEngineImplFailed");
 
         ThrowIfNot(
@@ -237,6 +317,9 @@ bool CarControlEngineService::shutdown() {
         m_carControlEngineImpl->shutdown();
         m_carControlEngineImpl.reset();
     }
+    if (m_timers != nullptr) {
+        m_timers->shutdown();
+    }
 
     return true;
 }
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/CarControl/CommandBatcher.h"
+
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.carControl.CommandBatcher");
+
+CommandBatcher::CommandBatcher(std::chrono::milliseconds batchWindow, ExecuteHandler executeHandler) :
+        m_batchWindow(batchWindow), m_executeHandler(executeHandler), m_shutdown(false) {
+}
+
+std::shared_ptr<CommandBatcher> CommandBatcher::create(
+    std::chrono::milliseconds batchWindow,
+    ExecuteHandler executeHandler) {
+    try {
+        ThrowIf(batchWindow.count() < 0, "invalidBatchWindow");
+        ThrowIfNot(executeHandler, "invalidExecuteHandler");
+        return std::shared_ptr<CommandBatcher>(new CommandBatcher(batchWindow, executeHandler));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+bool CommandBatcher::execute(const ControllerCommand& command) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_shutdown) {
+        AACE_WARN(LX(TAG).d("reason", "batcherShutdown"));
+        return false;
+    }
+
+    if (m_openBatch == nullptr) {
+        m_openBatch = std::make_shared<Batch>();
+    }
+    auto batch = m_openBatch;
+    auto index = batch->commands.size();
+    batch->commands.push_back(command);
+
+    if (index > 0) {
+        // a later command waits for the caller that opened the batch to execute it
+        m_trigger.wait(lock, [batch]() { return batch->executed; });
+        return batch->results[index];
+    }
+
+    // the first command holds the batch open for the batch window, then executes it on the calling thread
+    m_trigger.wait_for(lock, m_batchWindow, [this]() { return m_shutdown; });
+    m_openBatch.reset();
+    bool shutdown = m_shutdown;
+    lock.unlock();
+
+    // the batch is closed, so its commands can be read without the lock
+    std::vector<bool> results(batch->commands.size(), false);
+    if (!shutdown) {
+        AACE_DEBUG(LX(TAG).m("executingBatch").d("commands", batch->commands.size()));
+        try {
+            m_executeHandler(batch->commands, results);
+            results.resize(batch->commands.size(), false);
+        } catch (std::exception& ex) {
+            // the waiters of the batch are still notified, with all of its commands failed
+            AACE_ERROR(LX(TAG).d("reason", ex.what()));
+            results.assign(batch->commands.size(), false);
+        }
+    }
+
+    lock.lock();
+    batch->results = std::move(results);
+    batch->executed = true;
+    lock.unlock();
+    m_trigger.notify_all();
+
+    return batch->results[0];
+}
+
+void CommandBatcher::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_trigger.notify_all();
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/CarControl/ControllerStateCache.h"
+
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+using aace::engine::utils::threading::TimerWheel;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.carControl.ControllerStateCache");
+
+/// The time within which a change reported by the platform is considered to result from a command sent to the
+/// controller. A change reported later is considered to be made on the vehicle.
+static const std::chrono::seconds COMMAND_CHANGE_TIMEOUT(10);
+
+bool ControllerStateCache::State::operator==(const State& other) const {
+    if (type != other.type) {
+        return false;
+    }
+    switch (type) {
+        case Type::POWER:
+        case Type::TOGGLE:
+            return isOn == other.isOn;
+        case Type::RANGE:
+            return rangeValue == other.rangeValue;
+        case Type::MODE:
+            return modeValue == other.modeValue;
+    }
+    return false;
+}
+
+ControllerStateCache::ControllerStateCache(
+    std::chrono::milliseconds changeReportWindow,
+    ChangeHandler changeHandler,
+    std::shared_ptr<TimerWheel> timers) :
+        m_changeReportWindow(changeReportWindow),
+        m_changeHandler(changeHandler),
+        m_timers(timers),
+        m_shutdown(false),
+        m_reportTimer(TimerWheel::INVALID_TIMER) {
+}
+
+std::shared_ptr<ControllerStateCache> ControllerStateCache::create(
+    std::chrono::milliseconds changeReportWindow,
+    ChangeHandler changeHandler,
+    std::shared_ptr<TimerWheel> timers) {
+    try {
+        ThrowIf(changeReportWindow.count() < 0, "invalidChangeReportWindow");
+        ThrowIfNot(changeHandler, "invalidChangeHandler");
+        ThrowIfNull(timers, "invalidTimers");
+        return std::shared_ptr<ControllerStateCache>(
+            new ControllerStateCache(changeReportWindow, changeHandler, timers));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+ControllerStateCache::~ControllerStateCache() {
+    shutdown();
+}
+
+void ControllerStateCache::shutdown() {
+    TimerWheel::TimerId reportTimer;
+    bool reporting;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+        m_pendingChanges.clear();
+        m_commands.clear();
+        reportTimer = m_reportTimer;
+        m_reportTimer = TimerWheel::INVALID_TIMER;
+        reporting = m_reportingThread == std::this_thread::get_id();
+    }
+    auto timers = m_timers.lock();
+    if (timers && reportTimer != TimerWheel::INVALID_TIMER) {
+        timers->cancel(reportTimer);
+    }
+    // the cache can be shut down by the change handler, which must not wait for itself
+    if (!reporting) {
+        std::lock_guard<std::mutex> lock(m_reportMutex);
+    }
+}
+
+void ControllerStateCache::setPowerState(const std::string& endpointId, bool isOn) {
+    update({endpointId, ""}, {State::Type::POWER, isOn, 0, ""});
+}
+
+bool ControllerStateCache::getPowerState(const std::string& endpointId, bool& isOn) {
+    State state;
+    ReturnIfNot(get({endpointId, ""}, State::Type::POWER, state), false);
+    isOn = state.isOn;
+    return true;
+}
+
+void ControllerStateCache::setToggleState(const std::string& endpointId, const std::string& instance, bool isOn) {
+    update({endpointId, instance}, {State::Type::TOGGLE, isOn, 0, ""});
+}
+
+bool ControllerStateCache::getToggleState(const std::string& endpointId, const std::string& instance, bool& isOn) {
+    State state;
+    ReturnIfNot(get({endpointId, instance}, State::Type::TOGGLE, state), false);
+    isOn = state.isOn;
+    return true;
+}
+
+void ControllerStateCache::setRangeValue(const std::string& endpointId, const std::string& instance, double value) {
+    update({endpointId, instance}, {State::Type::RANGE, false, value, ""});
+}
+
+bool ControllerStateCache::getRangeValue(const std::string& endpointId, const std::string& instance, double& value) {
+    State state;
+    ReturnIfNot(get({endpointId, instance}, State::Type::RANGE, state), false);
+    value = state.rangeValue;
+    return true;
+}
+
+void ControllerStateCache::setModeValue(
+    const std::string& endpointId,
+    const std::string& instance,
+    const std::string& value) {
+    update({endpointId, instance}, {State::Type::MODE, false, 0, value});
+}
+
+bool ControllerStateCache::getModeValue(
+    const std::string& endpointId,
+    const std::string& instance,
+    std::string& value) {
+    State state;
+    ReturnIfNot(get({endpointId, instance}, State::Type::MODE, state), false);
+    value = state.modeValue;
+    return true;
+}
+
+void ControllerStateCache::beginCommand(const std::string& endpointId, const std::string& instance) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_states.erase({endpointId, instance});
+    m_commands[{endpointId, instance}] = std::chrono::steady_clock::now();
+}
+
+void ControllerStateCache::cancelCommand(const std::string& endpointId, const std::string& instance) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_commands.erase({endpointId, instance});
+}
+
+void ControllerStateCache::update(const ControllerKey& key, const State& state) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ReturnIf(m_shutdown);
+
+    auto it = m_states.find(key);
+    if (it != m_states.end() && it->second == state) {
+        return;
+    }
+    m_states[key] = state;
+
+    bool followsCommand = false;
+    auto command = m_commands.find(key);
+    if (command != m_commands.end()) {
+        followsCommand = std::chrono::steady_clock::now() - command->second <= COMMAND_CHANGE_TIMEOUT;
+        m_commands.erase(command);
+    }
+
+    // the first change in a window schedules the report of the changes when the window closes
+    m_pendingChanges[key] = followsCommand;
+    auto timers = m_timers.lock();
+    if (timers && m_reportTimer == TimerWheel::INVALID_TIMER) {
+        std::weak_ptr<ControllerStateCache> weakSelf = shared_from_this();
+        m_reportTimer = timers->scheduleAfter(m_changeReportWindow, [weakSelf]() {
+            if (auto self = weakSelf.lock()) {
+                self->reportChanges();
+            }
+        });
+    }
+}
+
+bool ControllerStateCache::get(const ControllerKey& key, State::Type type, State& state) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_states.find(key);
+    ReturnIf(it == m_states.end() || it->second.type != type, false);
+    state = it->second;
+    return true;
+}
+
+void ControllerStateCache::reportChanges() {
+    std::lock_guard<std::mutex> reportLock(m_reportMutex);
+    std::vector<Change> changed;
+    {
+        // the changes made within the window that started with the first change
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_reportTimer = TimerWheel::INVALID_TIMER;
+        ReturnIf(m_shutdown || m_pendingChanges.empty());
+        for (auto& pending : m_pendingChanges) {
+            changed.push_back({pending.first, pending.second});
+        }
+        m_pendingChanges.clear();
+        m_reportingThread = std::this_thread::get_id();
+    }
+
+    AACE_DEBUG(LX(TAG).m("reportingChanges").d("count", changed.size()));
+    m_changeHandler(changed);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_reportingThread = std::thread::id();
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
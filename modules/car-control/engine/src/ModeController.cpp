@@ -15,6 +15,8 @@
 
 #include "AACE/Engine/CarControl/ModeController.h"
 
+#include <algorithm>
+
 #include <AVSCommon/AVS/CapabilitySemantics.h>
 #include <ModeController/ModeControllerAttributeBuilder.h>
 
@@ -119,7 +121,11 @@ void ModeController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilder>& builder) {
     m_carControlServiceInterface = carControlServiceInterface;
-    builder->withModeController(shared_from_this(), getInstance(), m_attributes, false, false, false);
+    bool reportState = carControlServiceInterface->isStateCacheEnabled();
+    builder->withModeController(shared_from_this(), getInstance(), m_attributes, reportState, reportState, false);
+    if (reportState) {
+        carControlServiceInterface->addControllerStateObserver(getEndpointId(), getInstance(), shared_from_this());
+    }
 }
 
 ModeControllerConfiguration ModeController::getConfiguration() {
@@ -183,12 +189,31 @@ ModeController::getMode() {
 }
 
 bool ModeController::addObserver(std::shared_ptr<ModeController::ModeControllerObserverInterface> observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    ReturnIf(observer == nullptr, false);
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.push_back(observer);
+    return true;
 }
 
 void ModeController::removeObserver(const std::shared_ptr<ModeController::ModeControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected removeObserver()"));
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+}
+
+void ModeController::onControllerStateChanged(AlexaStateChangeCauseType cause) {
+    auto state = getMode();
+    if (state.first != AlexaResponseType::SUCCESS || !state.second.hasValue()) {
+        AACE_WARN(LX(TAG).d("reason", "getStateFailed").sensitive("endpointId", getEndpointId()));
+        return;
+    }
+    std::vector<std::shared_ptr<ModeControllerObserverInterface>> observers;
+    {
+        std::lock_guard<std::mutex> lock(m_observersMutex);
+        observers = m_observers;
+    }
+    for (auto& observer : observers) {
+        observer->onModeChanged(state.second.value(), cause);
+    }
 }
 
 }  // namespace carControl
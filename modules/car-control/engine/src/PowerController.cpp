@@ -15,6 +15,8 @@
 
 #include "AACE/Engine/CarControl/PowerController.h"
 
+#include <algorithm>
+
 #include "AACE/Engine/Core/EngineMacros.h"
 
 namespace aace {
@@ -47,7 +49,12 @@ void PowerController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilder>& builder) {
     m_carControlServiceInterface = carControlServiceInterface;
-    builder->withPowerController(shared_from_this(), false, false);
+    // the state is reported proactively, and retrievable from the state cache, only if the platform reports changes
+    bool reportState = carControlServiceInterface->isStateCacheEnabled();
+    builder->withPowerController(shared_from_this(), reportState, reportState);
+    if (reportState) {
+        carControlServiceInterface->addControllerStateObserver(getEndpointId(), "", shared_from_this());
+    }
 }
 
 std::pair<AlexaResponseType, std::string> PowerController::setPowerState(
@@ -89,12 +96,31 @@ PowerController::getPowerState() {
 }
 
 bool PowerController::addObserver(std::shared_ptr<PowerControllerObserverInterface> observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    ReturnIf(observer == nullptr, false);
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.push_back(observer);
+    return true;
 }
 
 void PowerController::removeObserver(const std::shared_ptr<PowerControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected removeObserver()"));
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+}
+
+void PowerController::onControllerStateChanged(AlexaStateChangeCauseType cause) {
+    auto state = getPowerState();
+    if (state.first != AlexaResponseType::SUCCESS || !state.second.hasValue()) {
+        AACE_WARN(LX(TAG).d("reason", "getStateFailed").sensitive("endpointId", getEndpointId()));
+        return;
+    }
+    std::vector<std::shared_ptr<PowerControllerObserverInterface>> observers;
+    {
+        std::lock_guard<std::mutex> lock(m_observersMutex);
+        observers = m_observers;
+    }
+    for (auto& observer : observers) {
+        observer->onPowerStateChanged(state.second.value(), cause);
+    }
 }
 
 }  // namespace carControl
@@ -15,6 +15,8 @@
 
 #include "AACE/Engine/CarControl/RangeController.h"
 
+#include <algorithm>
+
 #include <AVSCommon/AVS/CapabilitySemantics.h>
 #include <RangeController/RangeControllerAttributeBuilder.h>
 
@@ -128,7 +130,11 @@ void RangeController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilder>& builder) {
     m_carControlServiceInterface = carControlServiceInterface;
-    builder->withRangeController(shared_from_this(), getInstance(), m_attributes, false, false, false);
+    bool reportState = carControlServiceInterface->isStateCacheEnabled();
+    builder->withRangeController(shared_from_this(), getInstance(), m_attributes, reportState, reportState, false);
+    if (reportState) {
+        carControlServiceInterface->addControllerStateObserver(getEndpointId(), getInstance(), shared_from_this());
+    }
 }
 
 RangeControllerConfiguration RangeController::getConfiguration() {
@@ -190,12 +196,31 @@ RangeController::getRangeState() {
 }
 
 bool RangeController::addObserver(std::shared_ptr<RangeControllerObserverInterface> observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    ReturnIf(observer == nullptr, false);
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.push_back(observer);
+    return true;
 }
 
 void RangeController::removeObserver(const std::shared_ptr<RangeControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected removeObserver()"));
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+}
+
+void RangeController::onControllerStateChanged(AlexaStateChangeCauseType cause) {
+    auto state = getRangeState();
+    if (state.first != AlexaResponseType::SUCCESS || !state.second.hasValue()) {
+        AACE_WARN(LX(TAG).d("reason", "getStateFailed").sensitive("endpointId", getEndpointId()));
+        return;
+    }
+    std::vector<std::shared_ptr<RangeControllerObserverInterface>> observers;
+    {
+        std::lock_guard<std::mutex> lock(m_observersMutex);
+        observers = m_observers;
+    }
+    for (auto& observer : observers) {
+        observer->onRangeChanged(state.second.value(), cause);
+    }
 }
 
 }  // namespace carControl
@@ -15,6 +15,8 @@
 
 #include "AACE/Engine/CarControl/ToggleController.h"
 
+#include <algorithm>
+
 #include <AVSCommon/AVS/CapabilitySemantics.h>
 #include <ToggleController/ToggleControllerAttributeBuilder.h>
 
@@ -83,7 +85,11 @@ void ToggleController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilder>& builder) {
     m_carControlServiceInterface = carControlServiceInterface;
-    builder->withToggleController(shared_from_this(), getInstance(), m_attributes, false, false, false);
+    bool reportState = carControlServiceInterface->isStateCacheEnabled();
+    builder->withToggleController(shared_from_this(), getInstance(), m_attributes, reportState, reportState, false);
+    if (reportState) {
+        carControlServiceInterface->addControllerStateObserver(getEndpointId(), getInstance(), shared_from_this());
+    }
 }
 
 std::pair<alexaClientSDK::avsCommon::avs::AlexaResponseType, std::string> ToggleController::setToggleState(
@@ -135,14 +141,33 @@ ToggleController::getToggleState() {
 bool ToggleController::addObserver(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::toggleController::ToggleControllerObserverInterface>
         observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    ReturnIf(observer == nullptr, false);
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.push_back(observer);
+    return true;
 }
 
 void ToggleController::removeObserver(
     const std::shared_ptr<
         alexaClientSDK::avsCommon::sdkInterfaces::toggleController::ToggleControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+}
+
+void ToggleController::onControllerStateChanged(AlexaStateChangeCauseType cause) {
+    auto state = getToggleState();
+    if (state.first != AlexaResponseType::SUCCESS || !state.second.hasValue()) {
+        AACE_WARN(LX(TAG).d("reason", "getStateFailed").sensitive("endpointId", getEndpointId()));
+        return;
+    }
+    std::vector<std::shared_ptr<ToggleControllerObserverInterface>> observers;
+    {
+        std::lock_guard<std::mutex> lock(m_observersMutex);
+        observers = m_observers;
+    }
+    for (auto& observer : observers) {
+        observer->onToggleStateChanged(state.second.value(), cause);
+    }
 }
 
 }  // namespace carControl
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "AACE/Engine/CarControl/AssetBundle.h"
+#include "AACE/Engine/CarControl/AssetStore.h"
+
+using aace::engine::carControl::AssetBundle;
+using aace::engine::carControl::AssetStore;
+
+static const std::string ASSETS_JSON = R"({
+  "assets": [
+    {"assetId": "My.Zeta", "values": [{"defaultValue": "zeta", "synonyms": ["z"], "locales": ["en-US", "en-CA"]}]},
+    {"assetId": "My.Alpha", "values": [{"defaultValue": "alpha", "locales": ["en-US"]}]}
+  ]
+})";
+
+// ASSETS_JSON compiled by tools/compile-assets.py
+alignas(4) static const unsigned char ASSETS_BUNDLE[] = {
+    0x41, 0x41, 0x43, 0x42, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x4d, 0x79, 0x2e, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x00, 0x61, 0x6c, 0x70,
+    0x68, 0x61, 0x00, 0x65, 0x6e, 0x2d, 0x55, 0x53, 0x00, 0x4d, 0x79, 0x2e, 0x5a, 0x65, 0x74, 0x61,
+    0x00, 0x7a, 0x65, 0x74, 0x61, 0x00, 0x7a, 0x00, 0x65, 0x6e, 0x2d, 0x43, 0x41, 0x00,
+};
+
+using Names = std::vector<std::pair<std::string, std::string>>;
+
+static Names getNames(const AssetBundle& bundle, const std::string& assetId) {
+    std::vector<AssetBundle::NameLocalePair> pairs;
+    bundle.getFriendlyNames(assetId, pairs);
+    return Names(pairs.begin(), pairs.end());
+}
+
+static void expectAssets(const AssetBundle& bundle) {
+    EXPECT_EQ(2u, bundle.getAssetCount());
+    EXPECT_EQ(
+        Names({{"zeta", "en-US"}, {"z", "en-US"}, {"zeta", "en-CA"}, {"z", "en-CA"}}), getNames(bundle, "My.Zeta"));
+    EXPECT_EQ(Names({{"alpha", "en-US"}}), getNames(bundle, "My.Alpha"));
+
+    std::vector<AssetBundle::NameLocalePair> names;
+    EXPECT_FALSE(bundle.getFriendlyNames("My.Missing", names));
+    EXPECT_TRUE(names.empty());
+}
+
+static std::string writeTempFile(const std::string& name, const std::string& contents) {
+    std::string path = ::testing::TempDir() + name;
+    std::ofstream ofs(path, std::ios::binary);
+    ofs << contents;
+    return path;
+}
+
+TEST(AssetBundleTest, readsPrecompiledBundle) {
+    auto bundle = AssetBundle::create(ASSETS_BUNDLE, sizeof(ASSETS_BUNDLE));
+    ASSERT_NE(nullptr, bundle);
+    EXPECT_EQ(sizeof(ASSETS_BUNDLE), bundle->getSize());
+    expectAssets(*bundle);
+}
+
+TEST(AssetBundleTest, compilesJson) {
+    std::stringstream stream(ASSETS_JSON);
+    auto bundle = AssetBundle::compile(stream);
+    ASSERT_NE(nullptr, bundle);
+    expectAssets(*bundle);
+}
+
+TEST(AssetBundleTest, internsStrings) {
+    std::stringstream stream(ASSETS_JSON);
+    auto bundle = AssetBundle::compile(stream);
+    ASSERT_NE(nullptr, bundle);
+
+    std::vector<AssetBundle::NameLocalePair> zeta;
+    std::vector<AssetBundle::NameLocalePair> alpha;
+    ASSERT_TRUE(bundle->getFriendlyNames("My.Zeta", zeta));
+    ASSERT_TRUE(bundle->getFriendlyNames("My.Alpha", alpha));
+    EXPECT_EQ(zeta[0].first, zeta[2].first);
+    EXPECT_EQ(zeta[0].second, alpha[0].second);
+}
+
+TEST(AssetBundleTest, usesFirstDefinitionOfDuplicateAsset) {
+    std::stringstream stream(R"({"assets": [
+        {"assetId": "My.Dup", "values": [{"defaultValue": "first", "locales": ["en-US"]}]},
+        {"assetId": "My.Dup", "values": [{"defaultValue": "second", "locales": ["en-US"]}]}
+    ]})");
+    auto bundle = AssetBundle::compile(stream);
+    ASSERT_NE(nullptr, bundle);
+    EXPECT_EQ(Names({{"first", "en-US"}}), getNames(*bundle, "My.Dup"));
+}
+
+TEST(AssetBundleTest, rejectsInvalidJson) {
+    std::stringstream missingLocales(R"({"assets": [{"assetId": "My.A", "values": [{"defaultValue": "a"}]}]})");
+    EXPECT_EQ(nullptr, AssetBundle::compile(missingLocales));
+
+    std::stringstream noNames(R"({"assets": [{"assetId": "My.A", "values": []}]})");
+    EXPECT_EQ(nullptr, AssetBundle::compile(noNames));
+}
+
+TEST(AssetBundleTest, rejectsCorruptBundle) {
+    std::vector<unsigned char> data(ASSETS_BUNDLE, ASSETS_BUNDLE + sizeof(ASSETS_BUNDLE));
+    EXPECT_EQ(nullptr, AssetBundle::create(data.data(), data.size() - 1));
+
+    auto badMagic = data;
+    badMagic[0] = 'X';
+    EXPECT_EQ(nullptr, AssetBundle::create(badMagic.data(), badMagic.size()));
+
+    // point the first entry's friendly name past the end of the string table
+    auto badOffset = data;
+    badOffset[20 + 2 * 12] = 0xff;
+    EXPECT_EQ(nullptr, AssetBundle::create(badOffset.data(), badOffset.size()));
+}
+
+TEST(AssetBundleTest, loadsBundleAndJsonFiles) {
+    auto bundlePath = writeTempFile(
+        "AssetBundleTest.bin", std::string(reinterpret_cast<const char*>(ASSETS_BUNDLE), sizeof(ASSETS_BUNDLE)));
+    auto bundle = AssetBundle::createFromFile(bundlePath);
+    ASSERT_NE(nullptr, bundle);
+    expectAssets(*bundle);
+
+    auto jsonPath = writeTempFile("AssetBundleTest.json", ASSETS_JSON);
+    bundle = AssetBundle::createFromFile(jsonPath);
+    ASSERT_NE(nullptr, bundle);
+    expectAssets(*bundle);
+
+    EXPECT_EQ(nullptr, AssetBundle::createFromFile(::testing::TempDir() + "AssetBundleTest.missing"));
+
+    std::remove(bundlePath.c_str());
+    std::remove(jsonPath.c_str());
+}
+
+TEST(AssetStoreTest, usesFirstAddedDefinition) {
+    auto defaultPath = writeTempFile("AssetStoreTest.json", ASSETS_JSON);
+    auto customPath = writeTempFile(
+        "AssetStoreTest.custom.json",
+        R"({"assets": [
+            {"assetId": "My.Alpha", "values": [{"defaultValue": "other", "locales": ["en-US"]}]},
+            {"assetId": "My.Beta", "values": [{"defaultValue": "beta", "locales": ["en-US"]}]}
+        ]})");
+
+    AssetStore store;
+    ASSERT_TRUE(store.addAssets(defaultPath));
+    ASSERT_TRUE(store.addAssets(customPath));
+
+    auto alpha = store.getFriendlyNames("My.Alpha");
+    ASSERT_EQ(1u, alpha.size());
+    EXPECT_STREQ("alpha", alpha[0].first);
+    auto beta = store.getFriendlyNames("My.Beta");
+    ASSERT_EQ(1u, beta.size());
+    EXPECT_STREQ("beta", beta[0].first);
+
+    store.clear();
+    EXPECT_TRUE(store.getFriendlyNames("My.Alpha").empty());
+
+    std::remove(defaultPath.c_str());
+    std::remove(customPath.c_str());
+}
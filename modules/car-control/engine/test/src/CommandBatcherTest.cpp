@@ -0,0 +1,128 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AACE/Engine/CarControl/CommandBatcher.h"
+
+using aace::engine::carControl::CommandBatcher;
+using ControllerCommand = CommandBatcher::ControllerCommand;
+
+class CommandBatcherTest : public ::testing::Test {
+protected:
+    std::shared_ptr<CommandBatcher> createBatcher(std::chrono::milliseconds window) {
+        return CommandBatcher::create(
+            window, [this](const std::vector<ControllerCommand>& commands, std::vector<bool>& results) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_batchSizes.push_back(commands.size());
+                // commands for endpoints starting with "broken" fail
+                for (size_t i = 0; i < commands.size(); i++) {
+                    results[i] = commands[i].endpointId.find("broken") != 0;
+                }
+            });
+    }
+
+    static ControllerCommand powerOn(const std::string& endpointId) {
+        return {ControllerCommand::Action::TURN_POWER_ON, endpointId, "", 0, "", 0};
+    }
+
+    std::mutex m_mutex;
+    std::vector<size_t> m_batchSizes;
+};
+
+TEST_F(CommandBatcherTest, executesSingleCommand) {
+    auto batcher = createBatcher(std::chrono::milliseconds(0));
+    ASSERT_NE(nullptr, batcher);
+
+    EXPECT_TRUE(batcher->execute(powerOn("heater")));
+    EXPECT_FALSE(batcher->execute(powerOn("broken.heater")));
+    EXPECT_EQ(std::vector<size_t>({1, 1}), m_batchSizes);
+}
+
+TEST_F(CommandBatcherTest, batchesConcurrentCommandsWithPerCommandResults) {
+    auto batcher = createBatcher(std::chrono::milliseconds(500));
+    ASSERT_NE(nullptr, batcher);
+
+    std::vector<std::string> endpoints = {"seat.driver", "seat.passenger", "broken.seat", "seat.rear"};
+    std::vector<int> results(endpoints.size(), -1);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < endpoints.size(); i++) {
+        threads.emplace_back([&, i]() { results[i] = batcher->execute(powerOn(endpoints[i])) ? 1 : 0; });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(std::vector<int>({1, 1, 0, 1}), results);
+    EXPECT_EQ(std::vector<size_t>({4}), m_batchSizes);
+}
+
+TEST_F(CommandBatcherTest, failsCommandsAfterShutdown) {
+    auto batcher = createBatcher(std::chrono::seconds(5));
+    ASSERT_NE(nullptr, batcher);
+
+    std::atomic<int> result(-1);
+    std::thread pending([&]() { result = batcher->execute(powerOn("heater")) ? 1 : 0; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    auto start = std::chrono::steady_clock::now();
+    batcher->shutdown();
+    pending.join();
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    EXPECT_EQ(0, result);
+    EXPECT_FALSE(batcher->execute(powerOn("heater")));
+    EXPECT_TRUE(m_batchSizes.empty());
+}
+
+TEST_F(CommandBatcherTest, failsAllCommandsOfBatchWhenHandlerThrows) {
+    std::atomic<int> batches(0);
+    auto batcher = CommandBatcher::create(
+        std::chrono::milliseconds(300),
+        [&batches](const std::vector<ControllerCommand>& commands, std::vector<bool>& results) {
+            results.assign(commands.size(), true);
+            if (batches++ == 0) {
+                throw std::runtime_error("handlerFailed");
+            }
+        });
+    ASSERT_NE(nullptr, batcher);
+
+    std::vector<int> results(3, -1);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); i++) {
+        threads.emplace_back([&, i]() { results[i] = batcher->execute(powerOn("heater")) ? 1 : 0; });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(std::vector<int>({0, 0, 0}), results);
+    EXPECT_EQ(1, batches);
+    EXPECT_TRUE(batcher->execute(powerOn("heater")));
+}
+
+TEST_F(CommandBatcherTest, rejectsInvalidArguments) {
+    auto handler = [](const std::vector<ControllerCommand>& commands, std::vector<bool>& results) {};
+    EXPECT_EQ(nullptr, CommandBatcher::create(std::chrono::milliseconds(-1), handler));
+    EXPECT_EQ(nullptr, CommandBatcher::create(std::chrono::milliseconds(10), nullptr));
+}
@@ -0,0 +1,260 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AACE/Engine/CarControl/ControllerStateCache.h"
+
+using aace::engine::carControl::ControllerStateCache;
+using aace::engine::utils::threading::TimerWheel;
+using ControllerKey = ControllerStateCache::ControllerKey;
+
+class ControllerStateCacheTest : public ::testing::Test {
+protected:
+    std::shared_ptr<ControllerStateCache> createCache(std::chrono::milliseconds window) {
+        return ControllerStateCache::create(
+            window,
+            [this](const std::vector<ControllerStateCache::Change>& changed) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                std::vector<ControllerKey> keys;
+                std::vector<bool> followsCommand;
+                for (auto& change : changed) {
+                    keys.push_back(change.key);
+                    followsCommand.push_back(change.followsCommand);
+                }
+                m_reports.push_back(keys);
+                m_followsCommand.push_back(followsCommand);
+                m_reported.notify_all();
+            },
+            m_timers);
+    }
+
+    bool waitForReports(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_reported.wait_for(
+            lock, std::chrono::seconds(2), [this, count]() { return m_reports.size() >= count; });
+    }
+
+    std::shared_ptr<TimerWheel> m_timers = std::make_shared<TimerWheel>(std::chrono::milliseconds(1));
+    std::mutex m_mutex;
+    std::condition_variable m_reported;
+    std::vector<std::vector<ControllerKey>> m_reports;
+    std::vector<std::vector<bool>> m_followsCommand;
+};
+
+TEST_F(ControllerStateCacheTest, servesReportedStates) {
+    auto cache = createCache(std::chrono::milliseconds(0));
+    ASSERT_NE(nullptr, cache);
+
+    bool isOn = false;
+    double rangeValue = 0;
+    std::string mode;
+    EXPECT_FALSE(cache->getPowerState("fan", isOn));
+
+    cache->setPowerState("fan", true);
+    cache->setToggleState("fan", "recirculate", true);
+    cache->setRangeValue("fan", "speed", 3);
+    cache->setModeValue("fan", "direction", "FEET");
+
+    EXPECT_TRUE(cache->getPowerState("fan", isOn));
+    EXPECT_TRUE(isOn);
+    EXPECT_TRUE(cache->getToggleState("fan", "recirculate", isOn));
+    EXPECT_TRUE(isOn);
+    EXPECT_TRUE(cache->getRangeValue("fan", "speed", rangeValue));
+    EXPECT_EQ(3, rangeValue);
+    EXPECT_TRUE(cache->getModeValue("fan", "direction", mode));
+    EXPECT_EQ("FEET", mode);
+
+    // a state is only served for the controller type that reported it
+    EXPECT_FALSE(cache->getModeValue("fan", "speed", mode));
+
+    cache->beginCommand("fan", "speed");
+    EXPECT_FALSE(cache->getRangeValue("fan", "speed", rangeValue));
+}
+
+TEST_F(ControllerStateCacheTest, coalescesChangesWithinWindow) {
+    auto cache = createCache(std::chrono::milliseconds(100));
+    ASSERT_NE(nullptr, cache);
+
+    for (int value = 16; value <= 22; value++) {
+        cache->setRangeValue("driverZone", "temperature", value);
+        cache->setRangeValue("passengerZone", "temperature", value);
+    }
+
+    ASSERT_TRUE(waitForReports(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ASSERT_EQ(1u, m_reports.size());
+    EXPECT_EQ(
+        std::vector<ControllerKey>({{"driverZone", "temperature"}, {"passengerZone", "temperature"}}), m_reports[0]);
+}
+
+TEST_F(ControllerStateCacheTest, ignoresUnchangedStates) {
+    auto cache = createCache(std::chrono::milliseconds(0));
+    ASSERT_NE(nullptr, cache);
+
+    cache->setPowerState("light", true);
+    ASSERT_TRUE(waitForReports(1));
+
+    cache->setPowerState("light", true);
+    cache->setPowerState("light", false);
+    ASSERT_TRUE(waitForReports(2));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EXPECT_EQ(2u, m_reports.size());
+}
+
+TEST_F(ControllerStateCacheTest, discardsChangesAfterShutdown) {
+    auto cache = createCache(std::chrono::milliseconds(1000));
+    ASSERT_NE(nullptr, cache);
+
+    cache->setPowerState("light", true);
+    cache->shutdown();
+    cache->setPowerState("light", false);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EXPECT_TRUE(m_reports.empty());
+}
+
+TEST_F(ControllerStateCacheTest, reportsWhetherChangesFollowCommands) {
+    auto cache = createCache(std::chrono::milliseconds(0));
+    ASSERT_NE(nullptr, cache);
+
+    cache->setPowerState("light", false);
+    ASSERT_TRUE(waitForReports(1));
+
+    // the change that follows a command, even to the state already reported, and then a change on the vehicle
+    cache->beginCommand("light", "");
+    cache->setPowerState("light", false);
+    ASSERT_TRUE(waitForReports(2));
+    cache->setPowerState("light", true);
+    ASSERT_TRUE(waitForReports(3));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EXPECT_EQ(std::vector<bool>({false}), m_followsCommand[0]);
+    EXPECT_EQ(std::vector<bool>({true}), m_followsCommand[1]);
+    EXPECT_EQ(std::vector<bool>({false}), m_followsCommand[2]);
+}
+
+TEST_F(ControllerStateCacheTest, keepsStateReportedWhileCommandExecutes) {
+    auto cache = createCache(std::chrono::milliseconds(0));
+    ASSERT_NE(nullptr, cache);
+
+    // a platform that reports the new state from inside its setter, the way the engine executes a command
+    auto turnOn = [&cache](const std::string& endpointId) {
+        cache->setPowerState(endpointId, true);
+        return true;
+    };
+    cache->setPowerState("light", false);
+    ASSERT_TRUE(waitForReports(1));
+
+    cache->beginCommand("light", "");
+    ASSERT_TRUE(turnOn("light"));
+    ASSERT_TRUE(waitForReports(2));
+
+    bool isOn = false;
+    EXPECT_TRUE(cache->getPowerState("light", isOn));
+    EXPECT_TRUE(isOn);
+
+    // the next change is made on the vehicle
+    cache->setPowerState("light", false);
+    ASSERT_TRUE(waitForReports(3));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EXPECT_EQ(std::vector<bool>({true}), m_followsCommand[1]);
+    EXPECT_EQ(std::vector<bool>({false}), m_followsCommand[2]);
+}
+
+TEST_F(ControllerStateCacheTest, forgetsCancelledCommands) {
+    auto cache = createCache(std::chrono::milliseconds(0));
+    ASSERT_NE(nullptr, cache);
+
+    cache->beginCommand("light", "");
+    cache->cancelCommand("light", "");
+    cache->setPowerState("light", true);
+    ASSERT_TRUE(waitForReports(1));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EXPECT_EQ(std::vector<bool>({false}), m_followsCommand[0]);
+}
+
+TEST_F(ControllerStateCacheTest, shutdownWaitsForReportInProgress) {
+    std::mutex mutex;
+    std::condition_variable trigger;
+    bool reporting = false;
+    bool reported = false;
+    auto cache = ControllerStateCache::create(
+        std::chrono::milliseconds(0),
+        [&](const std::vector<ControllerStateCache::Change>& changed) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                reporting = true;
+            }
+            trigger.notify_all();
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            std::lock_guard<std::mutex> lock(mutex);
+            reported = true;
+        },
+        m_timers);
+    ASSERT_NE(nullptr, cache);
+
+    cache->setPowerState("light", true);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(trigger.wait_for(lock, std::chrono::seconds(2), [&]() { return reporting; }));
+    }
+    cache->shutdown();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_TRUE(reported);
+}
+
+TEST_F(ControllerStateCacheTest, releasedByChangeHandler) {
+    std::shared_ptr<ControllerStateCache> cache;
+    std::mutex mutex;
+    std::condition_variable trigger;
+    bool released = false;
+    cache = ControllerStateCache::create(
+        std::chrono::milliseconds(0),
+        [&](const std::vector<ControllerStateCache::Change>& changed) {
+            std::lock_guard<std::mutex> lock(mutex);
+            cache->shutdown();
+            cache.reset();
+            released = true;
+            trigger.notify_all();
+        },
+        m_timers);
+    ASSERT_NE(nullptr, cache);
+
+    cache->setPowerState("light", true);
+    std::unique_lock<std::mutex> lock(mutex);
+    EXPECT_TRUE(trigger.wait_for(lock, std::chrono::seconds(2), [&]() { return released; }));
+}
+
+TEST_F(ControllerStateCacheTest, rejectsInvalidArguments) {
+    auto handler = [](const std::vector<ControllerStateCache::Change>& changed) {};
+    EXPECT_EQ(nullptr, ControllerStateCache::create(std::chrono::milliseconds(-1), handler, m_timers));
+    EXPECT_EQ(nullptr, ControllerStateCache::create(std::chrono::milliseconds(10), nullptr, m_timers));
+    EXPECT_EQ(nullptr, ControllerStateCache::create(std::chrono::milliseconds(10), handler, nullptr));
+}
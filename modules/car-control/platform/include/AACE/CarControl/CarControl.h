@@ -17,8 +17,12 @@
 #define AACE_CAR_CONTROL_CAR_CONTROL_H
 
 #include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "AACE/Core/PlatformInterface.h"
+#include "AACE/CarControl/CarControlEngineInterfaces.h"
 
 /** @file */
 
@@ -43,6 +47,46 @@ namespace carControl {
  */
 class CarControl : public aace::core::PlatformInterface {
 public:
+    /**
+     * A command to a single controller, delivered with other commands in @c executeControllerCommands().
+     */
+    struct ControllerCommand {
+        /**
+         * The action to perform on the controller
+         */
+        enum class Action {
+            /// Power on the endpoint. Corresponds to @c turnPowerControllerOn().
+            TURN_POWER_ON,
+            /// Power off the endpoint. Corresponds to @c turnPowerControllerOff().
+            TURN_POWER_OFF,
+            /// Turn on the toggle controller. Corresponds to @c turnToggleControllerOn().
+            TURN_TOGGLE_ON,
+            /// Turn off the toggle controller. Corresponds to @c turnToggleControllerOff().
+            TURN_TOGGLE_OFF,
+            /// Set the range setting to @c rangeValue. Corresponds to @c setRangeControllerValue().
+            SET_RANGE_VALUE,
+            /// Adjust the range setting by @c rangeValue. Corresponds to @c adjustRangeControllerValue().
+            ADJUST_RANGE_VALUE,
+            /// Set the mode to @c modeValue. Corresponds to @c setModeControllerValue().
+            SET_MODE_VALUE,
+            /// Adjust the mode by @c modeDelta. Corresponds to @c adjustModeControllerValue().
+            ADJUST_MODE_VALUE
+        };
+
+        /// The action to perform
+        Action action;
+        /// The unique identifier of the endpoint
+        std::string endpointId;
+        /// The unique identifier of the controller. Empty for power controller actions.
+        std::string controllerId;
+        /// The range setting or delta of a range controller action
+        double rangeValue;
+        /// The mode of a @c SET_MODE_VALUE action
+        std::string modeValue;
+        /// The delta of an @c ADJUST_MODE_VALUE action
+        int modeDelta;
+    };
+
     /**
      * CarControl constructor.
      */
@@ -175,6 +219,70 @@ public:
         const std::string& endpointId,
         const std::string& controllerId,
         std::string& value);
+
+    /**
+     * Notifies the platform implementation to execute several controller commands together, such as when the user
+     * asks to turn on the heaters of all seats. Commands for different endpoints that arrive within the batch window
+     * configured in 'aace.carControl.commandBatching' are delivered in one call, so the platform implementation can
+     * apply them in a single transaction on the vehicle bus.
+     *
+     * The Engine only calls this method if command batching is enabled in the 'aace.carControl' configuration.
+     *
+     * @param [in] commands The commands to execute.
+     * @param [out] results To be set by the implementation to the result of each command, in the order of
+     * @c commands. @c results has the same size as @c commands, and all of its elements are initially @c false.
+     * @return @c true if the commands were executed, or @c false if the implementation does not execute commands in
+     * batches, in which case none of the commands may have been executed and the Engine executes each command with the
+     * corresponding per-controller method instead.
+     */
+    virtual bool executeControllerCommands(const std::vector<ControllerCommand>& commands, std::vector<bool>& results);
+
+    /**
+     * Notifies the Engine that the power state of the controller identified by @c endpointId changed in the vehicle.
+     * When the state cache is enabled in the 'aace.carControl' configuration, the Engine answers state queries from
+     * the states reported with these notifications instead of querying the platform implementation.
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] isOn @c true if the controller is powered on.
+     */
+    void powerControllerStateChanged(const std::string& endpointId, bool isOn);
+    /**
+     * Notifies the Engine that the power state of the controller identified by @c endpointId and @c controllerId
+     * changed in the vehicle.
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] controllerId The unique identifier of the controller.
+     * @param [in] isOn @c true if the controller is turned on.
+     */
+    void toggleControllerStateChanged(const std::string& endpointId, const std::string& controllerId, bool isOn);
+    /**
+     * Notifies the Engine that the range setting of the controller identified by @c endpointId and @c controllerId
+     * changed in the vehicle.
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] controllerId The unique identifier of the controller.
+     * @param [in] value The current range setting.
+     */
+    void rangeControllerValueChanged(const std::string& endpointId, const std::string& controllerId, double value);
+    /**
+     * Notifies the Engine that the mode of the controller identified by @c endpointId and @c controllerId changed in
+     * the vehicle.
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] controllerId The unique identifier of the controller.
+     * @param [in] value The current mode.
+     */
+    void modeControllerValueChanged(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        const std::string& value);
+
+    /**
+     * @internal
+     * Sets the Engine interface delegate.
+     *
+     * Should *never* be called by the platform implementation.
+     */
+    void setEngineInterface(std::shared_ptr<aace::carControl::CarControlEngineInterface> carControlEngineInterface);
+
+private:
+    std::weak_ptr<aace::carControl::CarControlEngineInterface> m_carControlEngineInterface;
 };
 
 }  // namespace carControl
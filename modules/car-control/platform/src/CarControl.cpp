@@ -89,5 +89,47 @@ bool CarControl::getModeControllerValue(
     return false;
 }
 
+bool CarControl::executeControllerCommands(const std::vector<ControllerCommand>& commands, std::vector<bool>& results) {
+    return false;
+}
+
+void CarControl::powerControllerStateChanged(const std::string& endpointId, bool isOn) {
+    if (auto carControlEngineInterface_lock = m_carControlEngineInterface.lock()) {
+        carControlEngineInterface_lock->onPowerControllerStateChanged(endpointId, isOn);
+    }
+}
+
+void CarControl::toggleControllerStateChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    bool isOn) {
+    if (auto carControlEngineInterface_lock = m_carControlEngineInterface.lock()) {
+        carControlEngineInterface_lock->onToggleControllerStateChanged(endpointId, controllerId, isOn);
+    }
+}
+
+void CarControl::rangeControllerValueChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    double value) {
+    if (auto carControlEngineInterface_lock = m_carControlEngineInterface.lock()) {
+        carControlEngineInterface_lock->onRangeControllerValueChanged(endpointId, controllerId, value);
+    }
+}
+
+void CarControl::modeControllerValueChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    const std::string& value) {
+    if (auto carControlEngineInterface_lock = m_carControlEngineInterface.lock()) {
+        carControlEngineInterface_lock->onModeControllerValueChanged(endpointId, controllerId, value);
+    }
+}
+
+void CarControl::setEngineInterface(
+    std::shared_ptr<aace::carControl::CarControlEngineInterface> carControlEngineInterface) {
+    m_carControlEngineInterface = carControlEngineInterface;
+}
+
 }  // namespace carControl
 }  // namespace aace
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+#
+# Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License").
+# You may not use this file except in compliance with the License.
+# A copy of the License is located at
+#
+#     http://aws.amazon.com/apache2.0/
+#
+# or in the "license" file accompanying this file. This file is distributed
+# on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+# express or implied. See the License for the specific language governing
+# permissions and limitations under the License.
+#
+
+"""
+Compiles car control assets JSON files into a binary asset bundle.
+
+The bundle can be written as a binary file, which the Engine maps into memory when it is specified as
+'aace.carControl.assets.defaultAssetsPath' or 'aace.carControl.assets.customAssetsPath', or as a C++ header
+defining the bundle as a static byte array that is linked into the Engine.
+
+Bundle layout (all integers are 32-bit unsigned little-endian):
+
+    header      magic "AACB", version, asset count, entry count, string table size
+    assets      asset count records of (asset ID string offset, first entry, entry count), sorted by asset ID
+    entries     entry count records of (friendly name string offset, locale string offset)
+    strings     string table size bytes of NUL-terminated strings, each unique string stored once
+
+If an asset ID is defined more than once, the first definition is used.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+BUNDLE_MAGIC = b"AACB"
+BUNDLE_VERSION = 1
+
+
+class StringTable:
+    def __init__(self):
+        self.offsets = {}
+        self.data = bytearray()
+
+    def intern(self, value):
+        if value not in self.offsets:
+            self.offsets[value] = len(self.data)
+            self.data += value.encode("utf-8") + b"\0"
+        return self.offsets[value]
+
+
+def compile_assets(paths):
+    strings = StringTable()
+    assets = {}
+    for path in paths:
+        with open(path, "r", encoding="utf-8") as f:
+            document = json.load(f)
+        for asset in document["assets"]:
+            assetId = asset["assetId"]
+            if assetId in assets:
+                continue
+            names = []
+            for value in asset["values"]:
+                defaultValue = value["defaultValue"]
+                synonyms = value.get("synonyms") or []
+                for locale in value["locales"]:
+                    names.append((defaultValue, locale))
+                    names.extend((synonym, locale) for synonym in synonyms)
+            if not names:
+                raise ValueError("noAssetFriendlyNameFor " + assetId)
+            assets[assetId] = names
+
+    records = bytearray()
+    entries = bytearray()
+    entryCount = 0
+    # asset IDs are sorted by their UTF-8 bytes so the Engine can binary search them with strcmp
+    for assetId in sorted(assets, key=lambda s: s.encode("utf-8")):
+        names = assets[assetId]
+        records += struct.pack("<III", strings.intern(assetId), entryCount, len(names))
+        for name, locale in names:
+            entries += struct.pack("<II", strings.intern(name), strings.intern(locale))
+        entryCount += len(names)
+
+    header = BUNDLE_MAGIC + struct.pack("<IIII", BUNDLE_VERSION, len(assets), entryCount, len(strings.data))
+    return bytes(header + records + entries + strings.data)
+
+
+def write_header(bundle, path, symbol):
+    guard = "AACE_ENGINE_CAR_CONTROL_{}_H".format(symbol.upper())
+    with open(path, "w") as f:
+        f.write("// Generated by compile-assets.py. Do not edit.\n\n")
+        f.write("#ifndef {}\n#define {}\n\n".format(guard, guard))
+        f.write("#include <cstddef>\n\n")
+        f.write("alignas(4) static const unsigned char {}[] = {{\n".format(symbol))
+        for i in range(0, len(bundle), 16):
+            f.write("    " + ", ".join("0x{:02x}".format(b) for b in bundle[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        f.write("static const size_t {}_SIZE = sizeof({});\n\n".format(symbol, symbol))
+        f.write("#endif  // {}\n".format(guard))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile car control assets JSON into a binary asset bundle.")
+    parser.add_argument("inputs", nargs="+", help="assets JSON files, in order of precedence")
+    parser.add_argument("--output", help="path of the binary bundle to write")
+    parser.add_argument("--header", help="path of the C++ header to write")
+    parser.add_argument("--symbol", default="ASSETS_BUNDLE", help="name of the byte array in the C++ header")
+    args = parser.parse_args()
+
+    if not args.output and not args.header:
+        parser.error("at least one of --output or --header is required")
+
+    try:
+        bundle = compile_assets(args.inputs)
+    except (OSError, ValueError, KeyError, TypeError) as ex:
+        sys.stderr.write("compile-assets: {}\n".format(ex))
+        return 1
+
+    if args.output:
+        with open(args.output, "wb") as f:
+            f.write(bundle)
+    if args.header:
+        write_header(bundle, args.header, args.symbol)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
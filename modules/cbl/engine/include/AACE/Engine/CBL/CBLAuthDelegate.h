@@ -27,10 +27,11 @@
 
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
 #include <AVSCommon/SDKInterfaces/AuthObserverInterface.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
 #include <RegistrationManager/CustomerDataHandler.h>
 
+#include <AACE/Engine/Alexa/HttpClient.h>
+
 #include "CBLAuthDelegateConfiguration.h"
 #include "CBLAuthRequesterInterface.h"
 
@@ -46,6 +47,7 @@ public:
         std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
         std::shared_ptr<CBLAuthDelegateConfiguration> configuration,
         std::shared_ptr<CBLAuthRequesterInterface> cblAuthRequester,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient,
         bool enableUserProfile = false);
 
     ~CBLAuthDelegate();
@@ -75,6 +77,7 @@ private:
         std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
         std::shared_ptr<CBLAuthDelegateConfiguration> configuration,
         std::shared_ptr<CBLAuthRequesterInterface> cblAuthRequester,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient,
         bool enableUserProfile);
 
     bool initialize();
@@ -123,6 +126,7 @@ private:
 
     std::shared_ptr<CBLAuthRequesterInterface> m_cblAuthRequester;
     std::shared_ptr<CBLAuthDelegateConfiguration> m_configuration;
+    std::shared_ptr<aace::engine::alexa::HttpClient> m_httpClient;
 
     bool m_isStopping;
     bool m_authFailureReported;
@@ -26,6 +26,7 @@
 #include <AACE/CBL/CBL.h>
 #include <AACE/CBL/CBLEngineInterface.h>
 
+#include "AACE/Engine/Alexa/HttpClient.h"
 #include "AACE/Engine/Alexa/LocaleAssetsManager.h"
 
 #include "CBLAuthDelegate.h"
@@ -50,6 +51,7 @@ private:
         std::chrono::seconds codePairRequestTimeout,
         std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
         std::weak_ptr<aace::engine::alexa::LocaleAssetsManager> localeAssetManager,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient,
         bool enableUserProfile);
 
 public:
@@ -60,6 +62,7 @@ public:
         std::chrono::seconds codePairRequestTimeout,
         std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
         std::weak_ptr<aace::engine::alexa::LocaleAssetsManager> localeAssetManager,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient,
         bool enableUserProfile);
 
     void enable();
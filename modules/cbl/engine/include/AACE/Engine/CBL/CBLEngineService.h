@@ -36,7 +36,7 @@ public:
     virtual ~CBLEngineService() = default;
 
 protected:
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configureFromValue(const rapidjson::Value& configuration) override;
     bool start() override;
     bool stop() override;
     bool shutdown() override;
@@ -25,7 +25,6 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
-#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/RetryTimer.h>
@@ -114,6 +113,9 @@ static const std::string HEADER_LINE_URLENCODED = "Content-Type: application/x-w
 /// Prefix of HTTP header line specifying language.
 static const std::string HEADER_LINE_LANGUAGE_PREFIX = "Accept-Language: ";
 
+/// Identifies the CBL requests to the shared @c HttpClient
+static const std::string HTTP_CLIENT_ID = "cbl";
+
 /// Min time to wait between attempt to poll for a token while authentication is pending.
 static const std::chrono::seconds MIN_TOKEN_REQUEST_INTERVAL = std::chrono::seconds(5);
 
@@ -278,6 +280,7 @@ std::shared_ptr<CBLAuthDelegate> CBLAuthDelegate::create(
     std::shared_ptr<CustomerDataManager> customerDataManager,
     std::shared_ptr<CBLAuthDelegateConfiguration> configuration,
     std::shared_ptr<CBLAuthRequesterInterface> cblAuthRequester,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient,
     bool enableUserProfile) {
     try {
         AACE_DEBUG(LX(TAG));
@@ -285,9 +288,10 @@ std::shared_ptr<CBLAuthDelegate> CBLAuthDelegate::create(
         ThrowIfNull(customerDataManager, "nullDataManager");
         ThrowIfNull(configuration, "nullCBLAuthDelegateConfiguration");
         ThrowIfNull(cblAuthRequester, "nullCBLAuthRequester");
+        ThrowIfNull(httpClient, "nullHttpClient");
 
         std::shared_ptr<CBLAuthDelegate> cblAuthDelegate = std::shared_ptr<CBLAuthDelegate>(
-            new CBLAuthDelegate(customerDataManager, configuration, cblAuthRequester, enableUserProfile));
+            new CBLAuthDelegate(customerDataManager, configuration, cblAuthRequester, httpClient, enableUserProfile));
         return cblAuthDelegate;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -353,10 +357,12 @@ CBLAuthDelegate::CBLAuthDelegate(
     std::shared_ptr<CustomerDataManager> customerDataManager,
     std::shared_ptr<CBLAuthDelegateConfiguration> configuration,
     std::shared_ptr<CBLAuthRequesterInterface> cblAuthRequester,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient,
     bool enableUserProfile) :
         CustomerDataHandler{customerDataManager},
         m_cblAuthRequester{cblAuthRequester},
         m_configuration{configuration},
+        m_httpClient{httpClient},
         m_isStopping{false},
         m_authFailureReported{false},
         m_authState{AuthObserverInterface::State::UNINITIALIZED},
@@ -456,33 +462,13 @@ alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse CBLAuthDelegate::do
     const std::vector<std::string> headerLines,
     const std::vector<std::pair<std::string, std::string>>& data,
     std::chrono::seconds timeout) {
-    try {
-        // Creating the HttpPost on every doPost is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpPost = HttpPost::create();
-        ThrowIfNull(httpPost, "nullHttpPost");
-
-        return httpPost->doPost(url, headerLines, data, timeout);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
-    }
+    return m_httpClient->doPost(HTTP_CLIENT_ID, url, headerLines, data, timeout);
 }
 
 alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse CBLAuthDelegate::doGet(
     const std::string& url,
     const std::vector<std::string>& headers) {
-    try {
-        // Creating the HttpGet on every doGet is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-        ThrowIfNull(httpGet, "nullHttpGet");
-
-        return httpGet->doGet(url, headers, m_configuration->getRequestTimeout());
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
-    }
+    return m_httpClient->doGet(HTTP_CLIENT_ID, url, headers, m_configuration->getRequestTimeout());
 }
 
 CBLAuthDelegate::FlowState CBLAuthDelegate::handleStarting() {
@@ -34,6 +34,7 @@ std::shared_ptr<CBLEngineImpl> CBLEngineImpl::create(
     std::chrono::seconds codePairRequestTimeout,
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
     std::weak_ptr<aace::engine::alexa::LocaleAssetsManager> localeAssetManager,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient,
     bool enableUserProfile) {
     std::shared_ptr<CBLEngineImpl> cblEngineImpl = nullptr;
 
@@ -49,6 +50,7 @@ std::shared_ptr<CBLEngineImpl> CBLEngineImpl::create(
                 codePairRequestTimeout,
                 alexaEndpoints,
                 localeAssetManager,
+                httpClient,
                 enableUserProfile),
             "initializeCBLEngineImplFailed");
 
@@ -73,6 +75,7 @@ bool CBLEngineImpl::initialize(
     std::chrono::seconds codePairRequestTimeout,
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
     std::weak_ptr<aace::engine::alexa::LocaleAssetsManager> localeAssetManager,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient,
     bool enableUserProfile) {
     try {
         ThrowIfNull(customerDataManager, "invalidCustomerDataManager");
@@ -82,8 +85,8 @@ bool CBLEngineImpl::initialize(
             deviceInfo, codePairRequestTimeout, alexaEndpoints, localeAssetManager);
         ThrowIfNull(configuration, "nullCBLAuthDelegateConfiguration");
 
-        m_cblAuthDelegate =
-            CBLAuthDelegate::create(customerDataManager, configuration, shared_from_this(), enableUserProfile);
+        m_cblAuthDelegate = CBLAuthDelegate::create(
+            customerDataManager, configuration, shared_from_this(), httpClient, enableUserProfile);
         ThrowIfNull(m_cblAuthDelegate, "createCBLAuthDelegateFailed");
 
         return true;
@@ -41,12 +41,11 @@ CBLEngineService::CBLEngineService(const aace::engine::core::ServiceDescription&
         m_enableUserProfile(false) {
 }
 
-bool CBLEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool CBLEngineService::configureFromValue(const rapidjson::Value& configuration) {
     try {
-        auto document = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(document, "parseConfigurationStreamFailed");
+        ThrowIfNot(configuration.IsObject(), "invalidConfiguration");
 
-        auto cblConfigRoot = document->GetObject();
+        auto cblConfigRoot = configuration.GetObject();
 
         if (cblConfigRoot.HasMember("requestTimeout") && cblConfigRoot["requestTimeout"].IsUint()) {
             m_codePairRequestTimeout = std::chrono::seconds(cblConfigRoot["requestTimeout"].GetUint());
@@ -118,6 +117,9 @@ bool CBLEngineService::registerPlatformInterfaceType(std::shared_ptr<aace::cbl::
             getContext()->getServiceInterface<aace::engine::alexa::LocaleAssetsManager>("aace.alexa");
         ThrowIfNull(localeAssetManager, "invalidLocaleAssetManager");
 
+        auto httpClient = getContext()->getServiceInterface<aace::engine::alexa::HttpClient>("aace.alexa");
+        ThrowIfNull(httpClient, "invalidHttpClient");
+
         m_cblEngineImpl = aace::engine::cbl::CBLEngineImpl::create(
             cbl,
             customerDataManager,
@@ -125,6 +127,7 @@ bool CBLEngineService::registerPlatformInterfaceType(std::shared_ptr<aace::cbl::
             m_codePairRequestTimeout,
             alexaEndpoints,
             localeAssetManager,
+            httpClient,
             m_enableUserProfile);
         ThrowIfNull(m_cblEngineImpl, "createCBLEngineImplFailed");
 
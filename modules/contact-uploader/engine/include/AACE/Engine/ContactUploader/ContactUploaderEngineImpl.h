@@ -28,6 +28,7 @@
 
 #include <AACE/ContactUploader/ContactUploader.h>
 #include <AACE/ContactUploader/ContactUploaderEngineInterface.h>
+#include <AACE/Engine/Alexa/HttpClient.h>
 #include "ContactUploaderRESTAgent.h"
 
 namespace aace {
@@ -44,13 +45,15 @@ private:
 
     bool initialize(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-        std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo);
+        std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient);
 
 public:
     static std::shared_ptr<ContactUploaderEngineImpl> create(
         std::shared_ptr<aace::contactUploader::ContactUploader> contactUploaderPlatformInterface,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-        std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo);
+        std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient);
 
     using HTTPResponse = ContactUploaderRESTAgent::HTTPResponse;
     using AlexaAccountInfo = ContactUploaderRESTAgent::AlexaAccountInfo;
@@ -127,6 +130,7 @@ private:
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> m_authDelegate;
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> m_deviceInfo;
+    std::shared_ptr<aace::engine::alexa::HttpClient> m_httpClient;
 
     /// Contacts Queue
     std::queue<std::string> m_contactsQueue;
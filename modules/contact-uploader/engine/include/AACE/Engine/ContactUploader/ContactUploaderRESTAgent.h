@@ -23,14 +23,13 @@
 #include <queue>
 
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpDelete.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
 #include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
 #include <AVSCommon/Utils/DeviceInfo.h>
 
+#include <AACE/Engine/Alexa/HttpClient.h>
+
 namespace aace {
 namespace engine {
 namespace contactUploader {
@@ -39,14 +38,16 @@ class ContactUploaderRESTAgent {
 private:
     ContactUploaderRESTAgent(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-        std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo);
+        std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient);
 
 public:
     using HTTPResponse = alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse;
 
     static std::shared_ptr<ContactUploaderRESTAgent> create(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-        std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo);
+        std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient);
 
     virtual ~ContactUploaderRESTAgent() = default;
 
@@ -116,6 +117,7 @@ private:
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> m_authDelegate;
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> m_deviceInfo;
+    std::shared_ptr<aace::engine::alexa::HttpClient> m_httpClient;
 };
 
 }  // namespace contactUploader
@@ -57,14 +57,16 @@ ContactUploaderEngineImpl::ContactUploaderEngineImpl(
 
 bool ContactUploaderEngineImpl::initialize(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo) {
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) {
     try {
         m_authDelegate = authDelegate;
         m_deviceInfo = deviceInfo;
+        m_httpClient = httpClient;
 
         m_authDelegate->addAuthObserver(shared_from_this());
 
-        m_contactUploaderRESTAgent = ContactUploaderRESTAgent::create(m_authDelegate, m_deviceInfo);
+        m_contactUploaderRESTAgent = ContactUploaderRESTAgent::create(m_authDelegate, m_deviceInfo, m_httpClient);
         ThrowIfNull(m_contactUploaderRESTAgent, "nullContactUploaderRESTAgent");
 
         m_deleteAddressBookOnEngineStart = true;
@@ -79,15 +81,17 @@ bool ContactUploaderEngineImpl::initialize(
 std::shared_ptr<ContactUploaderEngineImpl> ContactUploaderEngineImpl::create(
     std::shared_ptr<aace::contactUploader::ContactUploader> contactUploaderPlatformInterface,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo) {
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) {
     try {
         ThrowIfNull(authDelegate, "nullAuthDelegateInterface");
+        ThrowIfNull(httpClient, "nullHttpClient");
 
         std::shared_ptr<ContactUploaderEngineImpl> contactUploaderEngineImpl =
             std::shared_ptr<ContactUploaderEngineImpl>(new ContactUploaderEngineImpl(contactUploaderPlatformInterface));
 
         ThrowIfNot(
-            contactUploaderEngineImpl->initialize(authDelegate, deviceInfo),
+            contactUploaderEngineImpl->initialize(authDelegate, deviceInfo, httpClient),
             "initializeContactUploaderEngineImplFailed");
 
         // set the platform engine interface reference
@@ -15,6 +15,7 @@
 
 #include "AACE/Engine/ContactUploader/ContactUploaderEngineService.h"
 #include "AACE/Engine/Alexa/AlexaEngineService.h"
+#include "AACE/Engine/Alexa/HttpClient.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 
 namespace aace {
@@ -64,6 +65,9 @@ bool ContactUploaderEngineService::registerPlatformInterfaceType(
         auto authDelegate = alexaComponentInterface->getAuthDelegate();
         ThrowIfNull(authDelegate, "authDeleteInterfaceInValid");
 
+        auto httpClient = getContext()->getServiceInterface<aace::engine::alexa::HttpClient>("aace.alexa");
+        ThrowIfNull(httpClient, "httpClientInvalid");
+
         auto config = alexaClientSDK::avsCommon::utils::configuration::ConfigurationNode::getRoot();
 
         // create device info
@@ -71,7 +75,7 @@ bool ContactUploaderEngineService::registerPlatformInterfaceType(
         ThrowIfNull(deviceInfo, "createDeviceInfoFailed");
 
         m_contactUploaderEngineImpl = aace::engine::contactUploader::ContactUploaderEngineImpl::create(
-            std::move(contactUploader), authDelegate, deviceInfo);
+            std::move(contactUploader), authDelegate, deviceInfo, httpClient);
         ThrowIfNull(m_contactUploaderEngineImpl, "createContactUploaderEngineImplFailed");
 
         return true;
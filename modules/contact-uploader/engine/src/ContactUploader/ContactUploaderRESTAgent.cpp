@@ -68,6 +68,9 @@ const std::string AUTO_SDK_DEFAULT_ADDRESS_BOOK_NAME = "AutoSDK";
 /// Default value for the HTTP request timeout.
 static const std::chrono::seconds DEFAULT_HTTP_TIMEOUT = std::chrono::seconds(60);
 
+/// Identifies the contact uploader requests to the shared @c HttpClient
+static const std::string HTTP_CLIENT_ID = "contactUploader";
+
 /// Default value for the HTTP retry on Network Error.
 static const int HTTP_RETRY_COUNT = 3;
 
@@ -97,16 +100,20 @@ static const std::string GET_ADDRESS_BOOK_QUERY = "?addressBookSourceIds=";
 
 ContactUploaderRESTAgent::ContactUploaderRESTAgent(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo) :
-        m_authDelegate(authDelegate), m_deviceInfo(deviceInfo) {
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) :
+        m_authDelegate(authDelegate), m_deviceInfo(deviceInfo), m_httpClient(httpClient) {
 }
 
 std::shared_ptr<ContactUploaderRESTAgent> ContactUploaderRESTAgent::create(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo) {
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) {
     try {
-        std::shared_ptr<ContactUploaderRESTAgent> contactUploaderRESTAgent =
-            std::shared_ptr<ContactUploaderRESTAgent>(new ContactUploaderRESTAgent(authDelegate, deviceInfo));
+        ThrowIfNull(httpClient, "nullHttpClient");
+
+        std::shared_ptr<ContactUploaderRESTAgent> contactUploaderRESTAgent = std::shared_ptr<ContactUploaderRESTAgent>(
+            new ContactUploaderRESTAgent(authDelegate, deviceInfo, httpClient));
         return contactUploaderRESTAgent;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "create").d("reason", ex.what()));
@@ -139,49 +146,19 @@ ContactUploaderRESTAgent::HTTPResponse ContactUploaderRESTAgent::doPost(
     const std::vector<std::string> headerLines,
     const std::string& data,
     std::chrono::seconds timeout) {
-    try {
-        // Creating the HttpPost on every doPost is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpPost = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPost::create();
-        ThrowIfNull(httpPost, "nullHttpPost");
-
-        return httpPost->doPost(url, headerLines, data, timeout);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "doPost").d("reason", ex.what()));
-        return ContactUploaderRESTAgent::HTTPResponse();
-    }
+    return m_httpClient->doPost(HTTP_CLIENT_ID, url, headerLines, data, timeout);
 }
 
 ContactUploaderRESTAgent::HTTPResponse ContactUploaderRESTAgent::doGet(
     const std::string& url,
     const std::vector<std::string>& headers) {
-    try {
-        // Creating the HttpGet on every doGet is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-        ThrowIfNull(httpGet, "nullHttpGet");
-
-        return httpGet->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "doGet").d("reason", ex.what()));
-        return ContactUploaderRESTAgent::HTTPResponse();
-    }
+    return m_httpClient->doGet(HTTP_CLIENT_ID, url, headers, DEFAULT_HTTP_TIMEOUT);
 }
 
 ContactUploaderRESTAgent::HTTPResponse ContactUploaderRESTAgent::doDelete(
     const std::string& url,
     const std::vector<std::string>& headers) {
-    try {
-        // Creating the HttpDelete on every doDelete is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpDelete = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpDelete::create();
-        ThrowIfNull(httpDelete, "nullHttpDelete");
-
-        return httpDelete->doDelete(url, headers, DEFAULT_HTTP_TIMEOUT);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "doDelete").d("reason", ex.what()));
-        return ContactUploaderRESTAgent::HTTPResponse();
-    }
+    return m_httpClient->doDelete(HTTP_CLIENT_ID, url, headers, DEFAULT_HTTP_TIMEOUT);
 }
 
 std::string ContactUploaderRESTAgent::getHTTPErrorString(const HTTPResponse& response) {
@@ -91,7 +91,7 @@ public:
         EXPECT_CALL( *m_mockAuthDelegate, removeAuthObserver(testing::_)).WillOnce(testing::Return());
 
         m_engineImpl = aace::engine::contactUploader::ContactUploaderEngineImpl::create(
-            m_mockPlatformInterface, m_mockAuthDelegate, m_deviceInfo );
+            m_mockPlatformInterface, m_mockAuthDelegate, m_deviceInfo, aace::engine::alexa::HttpClient::create() );
     }
 
     void TearDown() override {
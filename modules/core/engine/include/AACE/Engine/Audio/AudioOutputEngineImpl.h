@@ -54,6 +54,7 @@ public:
     // aace::audio::AudioOutputEngineInterface
     void onMediaStateChanged(MediaState state) override;
     void onMediaError(MediaError error, const std::string& description = "") override;
+    void onMediaPositionChanged(int64_t position) override;
 
 private:
     std::shared_ptr<aace::audio::AudioOutput> m_platformAudioOutput;
@@ -33,7 +33,10 @@ public:
         ENGINE_STOP_EXCEPTION,
         ENGINE_START_BEGIN,
         ENGINE_START_END,
-        ENGINE_START_EXCEPTION
+        ENGINE_START_EXCEPTION,
+        ENGINE_CONFIGURE_BEGIN,
+        ENGINE_CONFIGURE_END,
+        ENGINE_CONFIGURE_EXCEPTION
     };
 };
 
@@ -57,6 +60,15 @@ inline std::ostream& operator<<(std::ostream& stream, const CoreMetrics::Locatio
         case CoreMetrics::Location::ENGINE_START_EXCEPTION:
             stream << "ENGINE_START_EXCEPTION";
             break;
+        case CoreMetrics::Location::ENGINE_CONFIGURE_BEGIN:
+            stream << "ENGINE_CONFIGURE_BEGIN";
+            break;
+        case CoreMetrics::Location::ENGINE_CONFIGURE_END:
+            stream << "ENGINE_CONFIGURE_END";
+            break;
+        case CoreMetrics::Location::ENGINE_CONFIGURE_EXCEPTION:
+            stream << "ENGINE_CONFIGURE_EXCEPTION";
+            break;
     }
     return stream;
 }
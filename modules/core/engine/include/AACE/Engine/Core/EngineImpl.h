@@ -16,6 +16,7 @@
 #ifndef AACE_ENGINE_CORE_ENGINE_IMPL_H
 #define AACE_ENGINE_CORE_ENGINE_IMPL_H
 
+#include <functional>
 #include <vector>
 #include <unordered_map>
 
@@ -64,6 +65,12 @@ private:
     bool initialize();
     bool checkServices();
 
+    /**
+     * Calls @c handler for each engine service. When the parallel lifecycle is enabled, services are run
+     * concurrently, and each service is only run after the services it depends on have completed.
+     */
+    bool runServicePhase(const std::string& phase, std::function<bool(std::shared_ptr<EngineService>)> handler);
+
     std::shared_ptr<EngineService> getServiceFromPropertyKey(const std::string& key);
     bool registerProperties();
 
@@ -76,6 +83,10 @@ private:
     bool m_initialized = false;
     bool m_configured = false;
     bool m_setup = false;
+
+    // service lifecycle
+    bool m_parallelLifecycle = false;
+    size_t m_lifecycleThreadCount = 0;
 };
 
 }  // namespace core
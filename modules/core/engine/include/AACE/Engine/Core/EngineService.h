@@ -18,6 +18,7 @@
 
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <istream>
@@ -27,6 +28,8 @@
 
 #include <iostream>
 
+#include <rapidjson/document.h>
+
 #include "AACE/Engine/Core/ServiceDescription.h"
 #include "AACE/Core/PlatformInterface.h"
 
@@ -55,6 +58,7 @@ public:
     template <class T>
     bool registerServiceFactory(ServiceFactory fn) {
         auto key = typeid(T).name();
+        std::lock_guard<std::mutex> lock(m_serviceMapMutex);
         if (m_serviceFactoryMap.find(key) == m_serviceFactoryMap.end()) {
             m_serviceFactoryMap[key] = fn;
             return true;
@@ -66,6 +70,7 @@ public:
     template <class T>
     std::shared_ptr<T> getServiceInterface() {
         auto key = typeid(T).name();
+        std::lock_guard<std::mutex> lock(m_serviceMapMutex);
         auto it = m_serviceInterfaceMap.find(key);
         return it != m_serviceInterfaceMap.end() ? std::static_pointer_cast<T>(it->second.lock()) : nullptr;
     }
@@ -73,6 +78,13 @@ public:
 protected:
     virtual bool initialize();
     virtual bool configure(std::shared_ptr<std::istream> configuration);
+
+    /**
+     * Configures the service from its subtree of the merged engine configuration. The value is owned by the
+     * engine and is only valid for the duration of the call, so the service must copy anything it keeps.
+     * The default implementation serializes the value and calls @c configure() with the resulting stream.
+     */
+    virtual bool configureFromValue(const rapidjson::Value& configuration);
     virtual bool preRegister();
     virtual bool postRegister();
     virtual bool setup();
@@ -86,17 +98,21 @@ protected:
     template <class T>
     std::shared_ptr<T> newFactoryInstance(ServiceFactory defaultFactory) {
         auto key = typeid(T).name();
-        auto it = m_serviceFactoryMap.find(key);
-        if (it != m_serviceFactoryMap.end()) {
-            return std::static_pointer_cast<T>(it->second());
-        } else {
-            return std::static_pointer_cast<T>(defaultFactory());
+        ServiceFactory factory = defaultFactory;
+        {
+            std::lock_guard<std::mutex> lock(m_serviceMapMutex);
+            auto it = m_serviceFactoryMap.find(key);
+            if (it != m_serviceFactoryMap.end()) {
+                factory = it->second;
+            }
         }
+        return std::static_pointer_cast<T>(factory());
     }
 
     template <class T>
     bool registerServiceInterface(std::shared_ptr<T> serviceInterface) {
         auto key = typeid(T).name();
+        std::lock_guard<std::mutex> lock(m_serviceMapMutex);
         if (m_serviceInterfaceMap.find(key) == m_serviceInterfaceMap.end()) {
             m_serviceInterfaceMap[key] = serviceInterface;
             return true;
@@ -107,7 +123,7 @@ protected:
 
 private:
     bool handleInitializeEngineEvent(std::shared_ptr<aace::engine::core::EngineContext> context);
-    bool handleConfigureEngineEvent(std::shared_ptr<std::istream> configuration);
+    bool handleConfigureEngineEvent(const rapidjson::Value& configuration);
     bool handlePreRegisterEngineEvent();
     bool handlePostRegisterEngineEvent();
     bool handleSetupEngineEvent();
@@ -130,6 +146,10 @@ private:
     // service interface map
     std::unordered_map<std::string, std::weak_ptr<void>> m_serviceInterfaceMap;
 
+    // guards the service maps, which other services access from the lifecycle threads when the engine runs the
+    // lifecycle of independent services in parallel
+    std::mutex m_serviceMapMutex;
+
     // allow the EngineImpl call private functions in this class
     friend class aace::engine::core::EngineImpl;
 };
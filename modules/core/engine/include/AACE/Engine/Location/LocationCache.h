@@ -0,0 +1,116 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_LOCATION_LOCATION_CACHE_H
+#define AACE_ENGINE_LOCATION_LOCATION_CACHE_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "AACE/Location/LocationEngineInterfaces.h"
+#include "AACE/Location/LocationProvider.h"
+
+namespace aace {
+namespace engine {
+namespace location {
+
+/**
+ * Keeps the most recent location fix of the device, so location requests are served without a synchronous call to
+ * the platform @c LocationProvider while the fix is fresh.
+ *
+ * The platform pushes fixes with @c LocationProvider::locationChanged() at the rate of its location source. A fix is
+ * served while it is no older than the maximum age and, if a maximum accuracy is set, at least that accurate.
+ * Otherwise the platform is queried with @c LocationProvider::getLocation(), and the result is cached.
+ *
+ * The latest fix is always the one served, but the version of the cached location changes only when the device moved
+ * by more than the change threshold since the version changed. Consumers can reuse anything derived from a location,
+ * such as a serialized payload, for as long as the version is unchanged.
+ */
+class LocationCache : public aace::location::LocationProviderEngineInterface {
+public:
+    /**
+     * Create a @c LocationCache
+     *
+     * @param locationProvider The platform location provider, queried when no fresh fix is cached
+     * @param maxAge The maximum age of a cached fix that is served. A zero maximum age disables the cache.
+     * @param maxAccuracy The maximum accuracy radius in meters of a fix that is cached, or zero for no limit
+     * @param changeThreshold The distance in meters by which a fix has to move to change the version of the location
+     * @return The @c LocationCache, or @c nullptr if the arguments are invalid
+     */
+    static std::shared_ptr<LocationCache> create(
+        std::shared_ptr<aace::location::LocationProvider> locationProvider,
+        std::chrono::milliseconds maxAge,
+        double maxAccuracy,
+        double changeThreshold);
+
+    /**
+     * Returns the current location of the device, from the cache if a fresh fix is cached
+     *
+     * @param [out] version The version of the returned location, or zero if the location is not cached
+     * @return The current location, which is invalid if the location is not available
+     */
+    aace::location::Location getLocation(uint64_t& version);
+
+    /// @name @c LocationProviderEngineInterface methods
+    /// @{
+    void onLocationChanged(const aace::location::Location& location) override;
+    /// @}
+
+    /**
+     * Returns the great-circle distance in meters between two locations
+     */
+    static double getDistance(aace::location::Location from, aace::location::Location to);
+
+private:
+    LocationCache(
+        std::shared_ptr<aace::location::LocationProvider> locationProvider,
+        std::chrono::milliseconds maxAge,
+        double maxAccuracy,
+        double changeThreshold);
+
+    /**
+     * Caches @c location received at @c receivedTime. Must be called with @c m_mutex locked.
+     *
+     * @return @c true if the location is cached
+     */
+    bool updateLocked(aace::location::Location location, std::chrono::steady_clock::time_point receivedTime);
+
+private:
+    std::shared_ptr<aace::location::LocationProvider> m_locationProvider;
+    std::chrono::milliseconds m_maxAge;
+    double m_maxAccuracy;
+    double m_changeThreshold;
+
+    /// The latest fix, valid if @c m_version is not zero
+    aace::location::Location m_location;
+    /// The fix from which the current version was assigned, which later fixes are measured from
+    aace::location::Location m_versionLocation;
+    /// The time of the latest fix
+    std::chrono::steady_clock::time_point m_receivedTime;
+    /// The version of the cached location, incremented each time the device moved by more than the change threshold
+    uint64_t m_version;
+    /// The version of the last location that was cached, so versions are never reused after the cache is cleared
+    uint64_t m_lastVersion;
+
+    std::mutex m_mutex;
+};
+
+}  // namespace location
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_LOCATION_LOCATION_CACHE_H
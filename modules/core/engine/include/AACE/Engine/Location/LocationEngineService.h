@@ -16,7 +16,10 @@
 #ifndef AACE_ENGINE_LOCATION_LOCATION_ENGINE_SERVICE_H
 #define AACE_ENGINE_LOCATION_LOCATION_ENGINE_SERVICE_H
 
+#include <chrono>
+
 #include "AACE/Engine/Core/EngineService.h"
+#include "AACE/Engine/Location/LocationCache.h"
 #include "AACE/Location/LocationProvider.h"
 
 namespace aace {
@@ -34,6 +37,8 @@ public:
     virtual ~LocationEngineService() = default;
 
 protected:
+    bool configureFromValue(const rapidjson::Value& configuration) override;
+    bool shutdown() override;
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
 
 private:
@@ -48,6 +53,12 @@ private:
 
 private:
     std::shared_ptr<aace::location::LocationProvider> m_locationProvider;
+    std::shared_ptr<LocationCache> m_locationCache;
+
+    // location cache configuration
+    std::chrono::milliseconds m_cacheMaxAge;
+    double m_cacheMaxAccuracy;
+    double m_cacheChangeThreshold;
 };
 
 }  // namespace location
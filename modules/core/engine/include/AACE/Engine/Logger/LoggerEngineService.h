@@ -44,7 +44,7 @@ public:
 
 protected:
     bool initialize() override;
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configureFromValue(const rapidjson::Value& configuration) override;
     bool shutdown() override;
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
 
@@ -59,18 +59,32 @@ public:
     using Setter = std::function<bool(const std::string&, bool&, bool&, const SetterCallback&)>;
 
     PropertyDescription() = default;
-    PropertyDescription(const std::string& name, Setter setter, Getter getter);
+
+    /**
+     * @param [in] name The name used by the Engine to identify the property.
+     * @param [in] setter The function used to set the property, or @c nullptr
+     *        if the property is read only.
+     * @param [in] getter The function used to get the property.
+     * @param [in] snapshot @c true if the owner of the property reports every
+     *        change of the value that is not made through the setter with
+     *        PropertyManagerServiceInterface::updatePropertyValue(). The
+     *        Property Manager then serves the value from its snapshot instead
+     *        of calling the getter on every getProperty().
+     */
+    PropertyDescription(const std::string& name, Setter setter, Getter getter, bool snapshot = false);
     PropertyDescription(const PropertyDescription& other);
     PropertyDescription& operator=(const PropertyDescription& other) = default;
 
     Getter getter() const;
     Setter setter() const;
     std::string getPropertyName() const;
+    bool isSnapshotEnabled() const;
 
 private:
     Setter m_setter;
     Getter m_getter;
     std::string m_name;
+    bool m_snapshot = false;
 };
 
 }  // namespace propertyManager
@@ -16,6 +16,9 @@
 #ifndef AACE_ENGINE_PROPERTY_MANAGER_PROPERTY_LISTENER_INTERFACE_H
 #define AACE_ENGINE_PROPERTY_MANAGER_PROPERTY_LISTENER_INTERFACE_H
 
+#include <string>
+#include <unordered_map>
+
 namespace aace {
 namespace engine {
 namespace propertyManager {
@@ -39,6 +42,23 @@ public:
      * @param [in] newValue The new value of the property
      */
     virtual void propertyChanged(const std::string& name, const std::string& newValue) = 0;
+
+    /**
+     * Notifies the listener about the value changes of several properties it
+     * listens to that were set together, for example by
+     * @c aace::propertyManager::PropertyManager::setProperties(). Override this
+     * to handle related changes, such as locale and wake word, in one update.
+     * @note The listener should return immediately from this method.
+     *
+     * The default implementation calls propertyChanged() for each property.
+     *
+     * @param [in] properties The new values of the changed properties by name
+     */
+    virtual void propertiesChanged(const std::unordered_map<std::string, std::string>& properties) {
+        for (const auto& property : properties) {
+            propertyChanged(property.first, property.second);
+        }
+    }
 };
 
 }  // namespace propertyManager
@@ -48,6 +48,9 @@ public:
     // PropertyManagerEngineInterface
     virtual bool onSetProperty(const std::string& name, const std::string& value) override;
     virtual std::string onGetProperty(const std::string& name) override;
+    virtual bool onSetProperties(const std::vector<std::pair<std::string, std::string>>& properties) override;
+    virtual std::unordered_map<std::string, std::string> onGetProperties(
+        const std::vector<std::string>& names) override;
 
     /**
      * Called by the module that owns the property to notify the
@@ -61,6 +64,15 @@ public:
      */
     void handlePropertyChanged(const std::string& name, const std::string& value);
 
+    /**
+     * Called by the PropertyManagerEngineService to notify the
+     * PropertyManagerEngineImpl that several property values set together
+     * by an Engine component have changed.
+     *
+     * @param [in] properties The new property values by name.
+     */
+    void handlePropertiesChanged(const std::unordered_map<std::string, std::string>& properties);
+
     /**
      * Called by the PropertyManagerEngineService to notify the
      * PropertyManagerEngineImpl of a property state change.
@@ -77,6 +89,16 @@ public:
         const std::string& value,
         const aace::propertyManager::PropertyManagerEngineInterface::PropertyState state);
 
+    /**
+     * Called by the PropertyManagerEngineService to notify the
+     * PropertyManagerEngineImpl of the property state changes of a
+     * setProperties() operation.
+     *
+     * @param [in] changes The name, value, and state of each property change.
+     */
+    void propertiesStateChanged(
+        const std::vector<aace::propertyManager::PropertyManagerEngineInterface::PropertyStateChange>& changes);
+
 private:
     std::shared_ptr<aace::propertyManager::PropertyManager> m_platformPropertyManagerInterface;
 
@@ -48,6 +48,10 @@ public:
     virtual void removeListener(const std::string& name, std::shared_ptr<PropertyListenerInterface> listener) override;
     virtual bool setProperty(const std::string& name, const std::string& value, const bool& fromPlatform) override;
     virtual std::string getProperty(const std::string& name) override;
+    virtual bool setProperties(
+        const std::vector<std::pair<std::string, std::string>>& properties,
+        const bool& fromPlatform) override;
+    virtual std::unordered_map<std::string, std::string> getProperties(const std::vector<std::string>& names) override;
 
     // Callback function to notify the PropertyManagerEngineService the result
     // of setProperty() operation.
@@ -63,6 +67,14 @@ protected:
     bool shutdown() override;
 
 private:
+    // The progress of a setProperties() operation. Only accessed on the executor thread.
+    struct PropertyBatch {
+        bool fromPlatform;
+        size_t pending;
+        std::vector<aace::propertyManager::PropertyManagerEngineInterface::PropertyStateChange> states;
+        std::unordered_map<std::string, std::string> changed;
+    };
+
     // platform interface registration
     template <class T>
     bool registerPlatformInterfaceType(std::shared_ptr<aace::core::PlatformInterface> platformInterface) {
@@ -76,6 +88,27 @@ private:
     // propertyChanged() on every PropertyListenerInterface.
     void notifyPropertyChangeListeners(const std::string& key, const std::string& propertyValue);
 
+    // Notifies each listener once about the properties in @c properties that it
+    // listens to, by calling propertiesChanged() on the PropertyListenerInterface.
+    void notifyPropertiesChangeListeners(const std::unordered_map<std::string, std::string>& properties);
+
+    // Replaces the property snapshot with a copy that has @c name set to @c value.
+    // If @c replace is @c false, an existing value in the snapshot is kept.
+    void publishPropertyValue(const std::string& name, const std::string& value, bool replace = true);
+
+    // Publishes the current value of the property from its getter, after the property was set.
+    // Must be called on the executor thread.
+    void refreshPropertyValue(const std::string& name);
+
+    // Records the result of one property of a setProperties() operation, and
+    // notifies the platform and listeners when all properties are completed.
+    void handleBatchedPropertyResult(
+        std::shared_ptr<PropertyBatch> batch,
+        const std::string& name,
+        const std::string& value,
+        bool succeeded,
+        bool changed);
+
     // Notifies the platform and listeners about a successful set property
     // operation. Expects m_propertyManagerEngineImpl to be not null.
     void handleSetSuccess(
@@ -100,6 +133,14 @@ private:
         m_propertyListenerMap;
 
     std::mutex m_listenerMutex;
+
+    // Immutable map of the last known property values. getProperty() reads it without locking or
+    // calling the getters, and writers publish a modified copy with std::atomic_store().
+    std::shared_ptr<const std::unordered_map<std::string, std::string>> m_propertySnapshot;
+
+    // Serializes the writers of m_propertySnapshot
+    std::mutex m_snapshotMutex;
+
     std::shared_ptr<PropertyManagerEngineImpl> m_propertyManagerEngineImpl;
 
     alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
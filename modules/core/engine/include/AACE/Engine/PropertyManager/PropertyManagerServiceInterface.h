@@ -16,6 +16,11 @@
 #ifndef AACE_ENGINE_PROPERTY_PROPERTY_MANAGER_SERVICE_INTERFACE_H
 #define AACE_ENGINE_PROPERTY_PROPERTY_MANAGER_SERVICE_INTERFACE_H
 
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "PropertyDescription.h"
 #include "PropertyListenerInterface.h"
 
@@ -103,7 +108,9 @@ public:
     /**
      * Retrieves the setting for the property identified by
      * @c name from the Engine. This can be called by any internal
-     * module to retrieve a property.
+     * module to retrieve a property. The values of properties registered
+     * with snapshot enabled are read from an immutable snapshot without
+     * locking or calling the getter of the property.
      *
      * @param [in] name The name used by the Engine to identify the property.
      *        The name must be one of the property constants recognized
@@ -113,6 +120,33 @@ public:
      *        property value was not found.
      */
     virtual std::string getProperty(const std::string& name) = 0;
+
+    /**
+     * Sets several property values in the Engine as one operation. The
+     * properties are applied in order on the Property Manager's thread, and
+     * when all of them are completed each listener is notified once with the
+     * properties that changed, and the platform is notified once.
+     *
+     * @param [in] properties The names and values of the properties. Every
+     *        name must identify a registered property that can be set.
+     * @param [in] fromPlatform Flag to denote if the call to setProperties()
+     *        originated from the platform. If @c false, notify the platform via the
+     *        @c aace::propertyManager::PropertyManager::propertiesChanged().
+     * @return @c true if the properties were accepted, else @c false if a
+     *         property is not valid, in which case no property is set.
+     */
+    virtual bool setProperties(
+        const std::vector<std::pair<std::string, std::string>>& properties,
+        const bool& fromPlatform = false) = 0;
+
+    /**
+     * Retrieves the settings for several properties from the Engine.
+     *
+     * @param [in] names The names used by the Engine to identify the properties.
+     * @return The property values by name. Names of properties that were not
+     *         found are omitted.
+     */
+    virtual std::unordered_map<std::string, std::string> getProperties(const std::vector<std::string>& names) = 0;
 };
 
 }  // namespace propertyManager
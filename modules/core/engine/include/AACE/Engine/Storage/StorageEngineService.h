@@ -34,7 +34,7 @@ public:
     virtual ~StorageEngineService() = default;
 
 protected:
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configureFromValue(const rapidjson::Value& configuration) override;
 
 private:
     std::shared_ptr<LocalStorageInterface> m_localStorage;
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_HASH_SHA256_H
+#define AACE_ENGINE_UTILS_HASH_SHA256_H
+
+#include <string>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace hash {
+
+/**
+ * SHA-256 digest, used to detect changes to persisted content without comparing the content itself.
+ */
+class SHA256 {
+private:
+    SHA256() = default;
+
+public:
+    /**
+     * Computes the SHA-256 digest of @c data.
+     *
+     * @return The digest as a lowercase hex string
+     */
+    static std::string hash(const std::string& data);
+};
+
+}  // namespace hash
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_HASH_SHA256_H
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_THREADING_DEPENDENCY_TASK_RUNNER_H_
+#define AACE_ENGINE_UTILS_THREADING_DEPENDENCY_TASK_RUNNER_H_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace threading {
+
+/**
+ * A DependencyTaskRunner runs a set of tasks on a pool of worker threads, starting each task only after
+ * all of the tasks it depends on have completed successfully.
+ *
+ * Tasks are identified by the index returned from @c addTask(), and a task may only depend on tasks that
+ * were added before it, so the dependency graph is always acyclic. Ready tasks are started in the order
+ * they were added.
+ */
+class DependencyTaskRunner {
+public:
+    using Task = std::function<bool()>;
+
+    /**
+     * Adds a task to the runner.
+     *
+     * @param task The task to run. The task returns @c false if it failed.
+     * @param dependencies The indices of the tasks that must complete before @c task is started.
+     * @return The index of the task, or @c -1 if a dependency is invalid.
+     */
+    int addTask(Task task, const std::vector<int>& dependencies = {});
+
+    /**
+     * Runs all of the tasks and waits for them to complete. If a task fails, no further tasks are started,
+     * and tasks that are already running are allowed to complete. The tasks are removed from the runner
+     * when @c run() returns.
+     *
+     * @param threadCount The maximum number of tasks to run concurrently.
+     * @return @c true if all of the tasks completed successfully, else @c false.
+     */
+    bool run(size_t threadCount);
+
+private:
+    struct TaskEntry {
+        Task task;
+        size_t dependencyCount;
+        std::vector<size_t> dependents;
+    };
+
+    std::vector<TaskEntry> m_tasks;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_THREADING_DEPENDENCY_TASK_RUNNER_H_
@@ -0,0 +1,187 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_THREADING_TIMER_WHEEL_H_
+#define AACE_ENGINE_UTILS_THREADING_TIMER_WHEEL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace threading {
+
+/**
+ * A TimerWheel runs many timers, such as alerts and timeouts, on a single thread.
+ *
+ * The timers are kept in a hierarchical wheel of ticks: a first level of 256 slots of one tick each, and four levels
+ * of 64 slots that each span a full turn of the level below. Scheduling and cancelling a timer take constant time,
+ * whatever the number of timers, and the thread only wakes up for the next tick with a timer to run or to move down
+ * to a lower level.
+ *
+ * Timers scheduled on the system clock follow changes of the time of the device. Changes are detected by the thread
+ * within a second, or can be reported with @c onClockChanged(), and all of these timers are then rescheduled in a
+ * single pass.
+ *
+ * Tasks run on the thread of the wheel, outside of its lock, and may schedule and cancel timers. They must return
+ * quickly, and should submit longer work to an @c Executor. An exception thrown by a task is logged, and the wheel
+ * goes on with the next timers.
+ */
+class TimerWheel {
+public:
+    using Task = std::function<void()>;
+
+    /// Identifies a timer. @c INVALID_TIMER is never returned for a scheduled timer.
+    using TimerId = uint64_t;
+    static const TimerId INVALID_TIMER = 0;
+
+    /// The default duration of a tick.
+    static constexpr std::chrono::milliseconds DEFAULT_RESOLUTION = std::chrono::milliseconds(10);
+
+    /**
+     * Constructs a TimerWheel and starts its thread.
+     *
+     * @param resolution The duration of a tick. Timers run at most one tick late.
+     */
+    TimerWheel(std::chrono::milliseconds resolution = DEFAULT_RESOLUTION);
+
+    /**
+     * Destructs a TimerWheel, discarding the timers that did not run.
+     */
+    ~TimerWheel();
+
+    /**
+     * Schedules a task to run after a delay, measured on the steady clock.
+     *
+     * @param delay The delay before the task runs.
+     * @param task The task to run.
+     * @return The ID of the timer, or @c INVALID_TIMER if the task is invalid or the wheel is shut down.
+     */
+    TimerId scheduleAfter(std::chrono::milliseconds delay, Task task);
+
+    /**
+     * Schedules a task to run at a time of the system clock, following changes of the time of the device.
+     *
+     * @param time The time at which the task runs. A time in the past runs the task on the next tick.
+     * @param task The task to run.
+     * @return The ID of the timer, or @c INVALID_TIMER if the task is invalid or the wheel is shut down.
+     */
+    TimerId scheduleAt(std::chrono::system_clock::time_point time, Task task);
+
+    /**
+     * Cancels a timer.
+     *
+     * @param id The ID of the timer.
+     * @return @c true if the timer was cancelled before its task started, else @c false.
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * Reschedules the timers of the system clock after a change of the time of the device, without waiting for the
+     * thread to detect the change.
+     */
+    void onClockChanged();
+
+    /// Returns the number of timers waiting to run.
+    size_t size();
+
+    /// Discards the timers that did not run, stops the thread, and refuses any additional timers.
+    void shutdown();
+
+private:
+    using Tick = uint64_t;
+
+    struct Timer {
+        TimerId id;
+        std::chrono::steady_clock::time_point deadline;
+        bool systemClock;
+        std::chrono::system_clock::time_point time;  // the time of a timer of the system clock
+        Task task;
+        std::list<Timer>* slot;
+    };
+
+    using Slot = std::list<Timer>;
+
+    TimerId schedule(Timer timer);
+    Tick toTick(std::chrono::steady_clock::time_point time) const;
+    std::chrono::steady_clock::time_point toTime(Tick tick) const;
+
+    /// Moves a timer to the slot of its deadline. Must be called with the lock held.
+    void place(Slot& from, Slot::iterator timer);
+
+    /// Returns the next tick, from the current tick, with timers to run or to move down. Must be called with the lock
+    /// held and at least one timer scheduled.
+    Tick nextEventTick() const;
+
+    /// Processes the ticks up to a tick, moving the timers down and collecting the timers to run. Must be called with
+    /// the lock held.
+    void advance(Tick tick);
+
+    /// Moves the timers of the slot of a level that the current tick reaches to the lower levels. Must be called with
+    /// the lock held.
+    void cascade(size_t level);
+
+    /// Reschedules the timers of the system clock. Must be called with the lock held.
+    void rescheduleSystemClockTimers();
+
+    void loop();
+
+private:
+    static const size_t LEVEL_COUNT = 5;
+    static const size_t FIRST_LEVEL_BITS = 8;
+    static const size_t LEVEL_BITS = 6;
+
+    std::chrono::steady_clock::duration m_resolution;
+    std::chrono::steady_clock::time_point m_epoch;
+
+    /// The next tick to process.
+    Tick m_currentTick = 0;
+
+    std::vector<Slot> m_levels[LEVEL_COUNT];
+    std::unordered_map<TimerId, Slot::iterator> m_timers;
+    TimerId m_nextId = INVALID_TIMER + 1;
+    size_t m_systemClockTimerCount = 0;
+
+    /// The offset of the system clock from the steady clock when the timers of the system clock were scheduled.
+    std::chrono::system_clock::duration m_systemClockOffset;
+
+    /// The timers whose tick is processed, waiting for their task to run.
+    Slot m_expired;
+
+    /// The tick the thread waits for, or 0 if it is not waiting.
+    Tick m_wakeTick = 0;
+    bool m_shutdown = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeTrigger;
+
+    /// The thread must be declared last to be started after the wheel is initialized.
+    std::thread m_thread;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_THREADING_TIMER_WHEEL_H_
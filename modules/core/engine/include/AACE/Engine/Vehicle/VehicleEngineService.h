@@ -80,7 +80,7 @@ protected:
     /// @{
     bool initialize() override;
     bool setup() override;
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configureFromValue(const rapidjson::Value& configuration) override;
     /// @}
 
     /**
@@ -93,7 +93,7 @@ protected:
      * @param [out] propertyMap The map that will be updated if the key is present
      */
     void getVehicleConfigProperty(
-        rapidjson::Value& root,
+        const rapidjson::Value& root,
         const char* configKey,
         VehiclePropertyType propertyKey,
         std::unordered_map<VehiclePropertyType, std::string, EnumHash>& propertyMap);
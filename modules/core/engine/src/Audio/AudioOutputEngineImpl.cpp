@@ -182,6 +182,14 @@ void AudioOutputEngineImpl::onMediaError(MediaError error, const std::string& de
     }
 }
 
+void AudioOutputEngineImpl::onMediaPositionChanged(int64_t position) {
+    try {
+        Throw("unhandledMethod");
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+    }
+}
+
 }  // namespace audio
 }  // namespace engine
 }  // namespace aace
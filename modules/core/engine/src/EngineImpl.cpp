@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
+#include <thread>
 #include <unordered_map>
 #include <forward_list>
 #ifndef NO_SIGPIPE
@@ -25,6 +27,7 @@
 #include "AACE/Engine/Core/EngineVersion.h"
 #include "AACE/Engine/Core/CoreMetrics.h"
 #include "AACE/Engine/Utils/JSON/JSON.h"
+#include "AACE/Engine/Utils/Threading/DependencyTaskRunner.h"
 #include "AACE/Core/CoreProperties.h"
 
 // default Engine constructor
@@ -42,6 +45,12 @@ static const std::string USER_AGENT_NAME = "AlexaAutoSDK";
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.core.EngineImpl");
 
+// engine configuration key
+static const std::string ENGINE_CONFIG_KEY = "aace.engine";
+
+// number of service lifecycle threads used if the hardware concurrency is unknown
+static const size_t DEFAULT_LIFECYCLE_THREAD_COUNT = 4;
+
 std::shared_ptr<EngineImpl> EngineImpl::create() {
     try {
         auto engine = std::shared_ptr<EngineImpl>(new EngineImpl());
@@ -98,7 +107,7 @@ bool EngineImpl::registerProperties() {
         ThrowIfNull(propertyManager, "nullPropertyManagerServiceInterface");
 
         propertyManager->registerProperty(aace::engine::propertyManager::PropertyDescription(
-            aace::core::property::VERSION, nullptr, std::bind(&EngineImpl::getProperty_version, this)));
+            aace::core::property::VERSION, nullptr, std::bind(&EngineImpl::getProperty_version, this), true));
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "initialize").d("reason", ex.what()));
@@ -164,12 +173,15 @@ bool EngineImpl::configure(
 bool EngineImpl::configure(std::vector<std::shared_ptr<aace::core::config::EngineConfiguration>> configurationList) {
     try {
         AACE_DEBUG(LX(TAG, "configure").m("EngineConfigure"));
+        CORE_METRIC(LX(TAG, "configure"), aace::engine::core::CoreMetrics::Location::ENGINE_CONFIGURE_BEGIN);
 
         ThrowIfNot(m_initialized, "engineNotInitialized");
         ThrowIf(m_running, "engineRunning");
         ThrowIf(m_configured, "engineAlreadyConfigured");
         ThrowIf(configurationList.empty(), "invalidConfigurationList");
 
+        auto configureStart = std::chrono::steady_clock::now();
+
         // iterate through configuration objects and get streams for sdk initialization and
         // merge all configuration stream together before calling service config methods
         rapidjson::Document configuration(rapidjson::kObjectType);
@@ -182,38 +194,68 @@ bool EngineImpl::configure(std::vector<std::shared_ptr<aace::core::config::Engin
             auto document = aace::engine::utils::json::parse(next->getStream());
             ThrowIfNull(document, "parseConfigurationStreamFailed");
 
-            // merge the document with the main configuration
+            // merge the document with the main configuration. The first non-empty document becomes the
+            // main configuration as is, which avoids copying it when there is nothing to merge it with.
             ThrowIfNot(document->IsObject(), "invalidConfigurationStream");
-            ThrowIfNot(
-                aace::engine::utils::json::merge(root, document->GetObject(), configuration.GetAllocator()),
-                "mergeConfigurationFailed");
+            if (configuration.ObjectEmpty()) {
+                configuration.Swap(*document);
+            } else {
+                ThrowIfNot(
+                    aace::engine::utils::json::merge(root, document->GetObject(), configuration.GetAllocator()),
+                    "mergeConfigurationFailed");
+            }
         }
 
-        // iterate through registered engine services and call configure() for each module
-        for (auto nextService : m_orderedServiceList) {
-            auto config = root.FindMember(nextService->getDescription().getType().c_str());
+        // the engine configuration selects how the service lifecycle is run
+        auto engineConfig = root.FindMember(ENGINE_CONFIG_KEY.c_str());
+        if (engineConfig != root.end() && engineConfig->value.IsObject() &&
+            engineConfig->value.HasMember("lifecycle") && engineConfig->value["lifecycle"].IsObject()) {
+            auto lifecycle = engineConfig->value["lifecycle"].GetObject();
 
-            if (config != root.end()) {
-                rapidjson::Document subDocument;
-
-                subDocument.CopyFrom(config->value, subDocument.GetAllocator());
+            if (lifecycle.HasMember("parallel") && lifecycle["parallel"].IsBool()) {
+                m_parallelLifecycle = lifecycle["parallel"].GetBool();
+            }
 
-                ThrowIfNot(
-                    nextService->handleConfigureEngineEvent(aace::engine::utils::json::toStream(subDocument)),
-                    "Service failed to configure: " + nextService->getDescription().getType());
+            if (lifecycle.HasMember("threadCount") && lifecycle["threadCount"].IsUint()) {
+                m_lifecycleThreadCount = lifecycle["threadCount"].GetUint();
             }
         }
 
+        if (m_lifecycleThreadCount == 0) {
+            auto hardwareConcurrency = std::thread::hardware_concurrency();
+            m_lifecycleThreadCount = hardwareConcurrency > 0 ? hardwareConcurrency : DEFAULT_LIFECYCLE_THREAD_COUNT;
+        }
+
+        // call configure() for each service with a configuration, passing each service its subtree of
+        // the merged configuration rather than a copy
+        ThrowIfNot(
+            runServicePhase(
+                "configure",
+                [&root](std::shared_ptr<EngineService> service) {
+                    auto config = root.FindMember(service->getDescription().getType().c_str());
+                    return config == root.end() || service->handleConfigureEngineEvent(config->value);
+                }),
+            "configureServicesFailed");
+
         m_configured = true;
 
-        // iterate through registered engine modules and call handlePreRegisterEngineEvent() for each module
-        for (auto next : m_orderedServiceList) {
-            ThrowIfNot(next->handlePreRegisterEngineEvent(), "handlePreRegisterEngineEvent");
-        }
+        auto configureDuration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - configureStart);
+        AACE_INFO(LX(TAG, "configure").d("totalDurationMs", configureDuration.count()));
+
+        // call handlePreRegisterEngineEvent() for each service
+        ThrowIfNot(
+            runServicePhase(
+                "preRegister",
+                [](std::shared_ptr<EngineService> service) { return service->handlePreRegisterEngineEvent(); }),
+            "handlePreRegisterEngineEvent");
+
+        CORE_METRIC(LX(TAG, "configure"), aace::engine::core::CoreMetrics::Location::ENGINE_CONFIGURE_END);
 
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "configure").d("reason", ex.what()));
+        CORE_METRIC(LX(TAG, "configure"), aace::engine::core::CoreMetrics::Location::ENGINE_CONFIGURE_EXCEPTION);
         return false;
     }
 }
@@ -325,6 +367,71 @@ bool EngineImpl::checkServices() {
     }
 }
 
+bool EngineImpl::runServicePhase(
+    const std::string& phase,
+    std::function<bool(std::shared_ptr<EngineService>)> handler) {
+    try {
+        auto phaseStart = std::chrono::steady_clock::now();
+
+        auto runService = [phase, handler](std::shared_ptr<EngineService> service) {
+            auto start = std::chrono::steady_clock::now();
+            bool success = handler(service);
+            auto duration =
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+            const auto& type = service->getDescription().getType();
+            if (success) {
+                AACE_INFO(LX(TAG, phase).d("service", type).d("durationMs", duration.count()));
+            } else {
+                AACE_ERROR(LX(TAG, phase).d("reason", "serviceFailed").d("service", type));
+            }
+
+            return success;
+        };
+
+        bool success = true;
+
+        if (m_parallelLifecycle) {
+            aace::engine::utils::threading::DependencyTaskRunner runner;
+            std::unordered_map<std::string, int> taskIndexMap;
+
+            // the ordered service list is sorted by dependency, so each dependency has already been added
+            for (auto next : m_orderedServiceList) {
+                std::vector<int> dependencies;
+
+                for (auto& dependency : next->getDescription().getDependencies()) {
+                    auto it = taskIndexMap.find(dependency.getType());
+                    ThrowIf(it == taskIndexMap.end(), "unresolvedServiceDependency");
+                    dependencies.push_back(it->second);
+                }
+
+                auto index = runner.addTask([runService, next] { return runService(next); }, dependencies);
+                ThrowIf(index < 0, "addServiceTaskFailed");
+
+                taskIndexMap[next->getDescription().getType()] = index;
+            }
+
+            success = runner.run(m_lifecycleThreadCount);
+        } else {
+            for (auto next : m_orderedServiceList) {
+                if (!runService(next)) {
+                    success = false;
+                    break;
+                }
+            }
+        }
+
+        auto duration =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - phaseStart);
+        AACE_INFO(LX(TAG, phase).d("parallel", m_parallelLifecycle).d("durationMs", duration.count()));
+
+        return success;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "runServicePhase").d("reason", ex.what()).d("phase", phase));
+        return false;
+    }
+}
+
 bool EngineImpl::start() {
     try {
         AACE_DEBUG(LX(TAG, "start").m("EngineStart"));
@@ -336,24 +443,28 @@ bool EngineImpl::start() {
 
         // postRegister and setup are called for each service the first time the engine is started
         if (m_setup == false) {
-            // iterate through registered engine modules and call handlePostRegisterEngineEvent() for each module
-            for (auto next : m_orderedServiceList) {
-                ThrowIfNot(next->handlePostRegisterEngineEvent(), "handlePostRegisterEngineEvent");
-            }
+            // call handlePostRegisterEngineEvent() for each service
+            ThrowIfNot(
+                runServicePhase(
+                    "postRegister",
+                    [](std::shared_ptr<EngineService> service) { return service->handlePostRegisterEngineEvent(); }),
+                "handlePostRegisterEngineEvent");
 
-            // iterate through registered engine modules and call handleSetupEngineEvent() for each module
-            for (auto next : m_orderedServiceList) {
-                ThrowIfNot(next->handleSetupEngineEvent(), "handleSetupEngineEventFailed");
-            }
+            // call handleSetupEngineEvent() for each service
+            ThrowIfNot(
+                runServicePhase(
+                    "setup", [](std::shared_ptr<EngineService> service) { return service->handleSetupEngineEvent(); }),
+                "handleSetupEngineEventFailed");
 
             // set the engine setup flag to true
             m_setup = true;
         }
 
-        // iterate through registered engine modules and call handleStartEngineEvent() for each module
-        for (auto next : m_orderedServiceList) {
-            ThrowIfNot(next->handleStartEngineEvent(), "handleStartEngineEventFailed");
-        }
+        // call handleStartEngineEvent() for each service
+        ThrowIfNot(
+            runServicePhase(
+                "start", [](std::shared_ptr<EngineService> service) { return service->handleStartEngineEvent(); }),
+            "handleStartEngineEventFailed");
 
         // set the engine running flag to true
         m_running = true;
@@ -15,6 +15,7 @@
 
 #include "AACE/Engine/Core/EngineService.h"
 #include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/Utils/JSON/JSON.h"
 
 namespace aace {
 namespace engine {
@@ -62,11 +63,10 @@ bool EngineService::handleInitializeEngineEvent(std::shared_ptr<aace::engine::co
     }
 }
 
-bool EngineService::handleConfigureEngineEvent(std::shared_ptr<std::istream> configuration) {
+bool EngineService::handleConfigureEngineEvent(const rapidjson::Value& configuration) {
     try {
         ThrowIfNot(m_initialized, "serviceNotInitialized");
-        ThrowIfNull(configuration, "invalidConfiguration");
-        ThrowIfNot(configure(configuration), "configureServiceFailed");
+        ThrowIfNot(configureFromValue(configuration), "configureServiceFailed");
 
         return true;
     } catch (std::exception& ex) {
@@ -194,6 +194,10 @@ bool EngineService::configure(std::shared_ptr<std::istream> configuration) {
     return false;
 }
 
+bool EngineService::configureFromValue(const rapidjson::Value& configuration) {
+    return configure(aace::engine::utils::json::toStream(configuration, false));
+}
+
 bool EngineService::preRegister() {
     return true;
 }
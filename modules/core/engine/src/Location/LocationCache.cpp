@@ -0,0 +1,135 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cmath>
+
+#include "AACE/Engine/Location/LocationCache.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace location {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.location.LocationCache");
+
+/// The mean radius of the earth in meters
+static constexpr double EARTH_RADIUS_METERS = 6371008.8;
+
+/// Pi, for converting degrees to radians
+static constexpr double PI = 3.14159265358979323846;
+
+LocationCache::LocationCache(
+    std::shared_ptr<aace::location::LocationProvider> locationProvider,
+    std::chrono::milliseconds maxAge,
+    double maxAccuracy,
+    double changeThreshold) :
+        m_locationProvider(locationProvider),
+        m_maxAge(maxAge),
+        m_maxAccuracy(maxAccuracy),
+        m_changeThreshold(changeThreshold),
+        m_location(aace::location::Location::UNDEFINED, aace::location::Location::UNDEFINED),
+        m_versionLocation(aace::location::Location::UNDEFINED, aace::location::Location::UNDEFINED),
+        m_version(0),
+        m_lastVersion(0) {
+}
+
+std::shared_ptr<LocationCache> LocationCache::create(
+    std::shared_ptr<aace::location::LocationProvider> locationProvider,
+    std::chrono::milliseconds maxAge,
+    double maxAccuracy,
+    double changeThreshold) {
+    try {
+        ThrowIfNull(locationProvider, "invalidLocationProvider");
+        ThrowIf(maxAge.count() < 0, "invalidMaxAge");
+        ThrowIf(maxAccuracy < 0, "invalidMaxAccuracy");
+        ThrowIf(changeThreshold < 0, "invalidChangeThreshold");
+
+        return std::shared_ptr<LocationCache>(
+            new LocationCache(locationProvider, maxAge, maxAccuracy, changeThreshold));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "create").d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+aace::location::Location LocationCache::getLocation(uint64_t& version) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto age = std::chrono::steady_clock::now() - m_receivedTime;
+        if (m_maxAge.count() > 0 && m_version != 0 && age <= m_maxAge) {
+            version = m_version;
+            return m_location;
+        }
+    }
+
+    // the platform is queried without holding the lock, so fixes pushed in the meantime are not blocked
+    auto location = m_locationProvider->getLocation();
+    auto receivedTime = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_maxAge.count() > 0 && updateLocked(location, receivedTime)) {
+        version = m_version;
+        return m_location;
+    }
+    version = 0;
+    return location;
+}
+
+void LocationCache::onLocationChanged(const aace::location::Location& location) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    updateLocked(location, std::chrono::steady_clock::now());
+}
+
+bool LocationCache::updateLocked(
+    aace::location::Location location,
+    std::chrono::steady_clock::time_point receivedTime) {
+    if (!location.isValid()) {
+        // the location is lost, so the platform is queried until it reports a new fix
+        m_version = 0;
+        return false;
+    }
+
+    auto accuracy = location.getAccuracy();
+    if (m_maxAccuracy > 0 && (accuracy == aace::location::Location::UNDEFINED || accuracy > m_maxAccuracy)) {
+        AACE_DEBUG(LX(TAG).d("reason", "locationNotAccurateEnough").d("accuracy", accuracy));
+        return false;
+    }
+
+    // the latest fix is always served, but the version changes only when the device moved by more than the threshold
+    if (m_version == 0 || getDistance(m_versionLocation, location) > m_changeThreshold) {
+        m_versionLocation = location;
+        m_version = ++m_lastVersion;
+    }
+    m_location = location;
+    m_receivedTime = receivedTime;
+
+    return true;
+}
+
+double LocationCache::getDistance(aace::location::Location from, aace::location::Location to) {
+    // haversine formula
+    auto toRadians = [](double degrees) { return degrees * PI / 180.0; };
+    double deltaLatitude = toRadians(to.getLatitude() - from.getLatitude());
+    double deltaLongitude = toRadians(to.getLongitude() - from.getLongitude());
+    double a = std::sin(deltaLatitude / 2) * std::sin(deltaLatitude / 2) +
+               std::cos(toRadians(from.getLatitude())) * std::cos(toRadians(to.getLatitude())) *
+                   std::sin(deltaLongitude / 2) * std::sin(deltaLongitude / 2);
+    return 2 * EARTH_RADIUS_METERS * std::atan2(std::sqrt(a), std::sqrt(1 - a));
+}
+
+}  // namespace location
+}  // namespace engine
+}  // namespace aace
@@ -25,11 +25,56 @@ namespace location {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.location.LocationEngineService");
 
+// default maximum age of a cached location fix that is served
+static const std::chrono::milliseconds DEFAULT_CACHE_MAX_AGE = std::chrono::milliseconds(1000);
+
 // register the service
 REGISTER_SERVICE(LocationEngineService)
 
 LocationEngineService::LocationEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description) {
+        aace::engine::core::EngineService(description),
+        m_cacheMaxAge(DEFAULT_CACHE_MAX_AGE),
+        m_cacheMaxAccuracy(0),
+        m_cacheChangeThreshold(0) {
+}
+
+bool LocationEngineService::configureFromValue(const rapidjson::Value& configuration) {
+    try {
+        ThrowIfNot(configuration.IsObject(), "invalidConfiguration");
+
+        if (configuration.HasMember("cache") && configuration["cache"].IsObject()) {
+            const rapidjson::Value& cache = configuration["cache"];
+            if (cache.HasMember("maxAgeMs")) {
+                ThrowIfNot(cache["maxAgeMs"].IsUint(), "invalidMaxAgeMs");
+                m_cacheMaxAge = std::chrono::milliseconds(cache["maxAgeMs"].GetUint());
+            }
+            if (cache.HasMember("maxAccuracyMeters")) {
+                ThrowIfNot(
+                    cache["maxAccuracyMeters"].IsNumber() && cache["maxAccuracyMeters"].GetDouble() >= 0,
+                    "invalidMaxAccuracyMeters");
+                m_cacheMaxAccuracy = cache["maxAccuracyMeters"].GetDouble();
+            }
+            if (cache.HasMember("changeThresholdMeters")) {
+                ThrowIfNot(
+                    cache["changeThresholdMeters"].IsNumber() && cache["changeThresholdMeters"].GetDouble() >= 0,
+                    "invalidChangeThresholdMeters");
+                m_cacheChangeThreshold = cache["changeThresholdMeters"].GetDouble();
+            }
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "configure").d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool LocationEngineService::shutdown() {
+    if (m_locationProvider != nullptr) {
+        m_locationProvider->setEngineInterface(nullptr);
+    }
+    m_locationCache.reset();
+    return true;
 }
 
 bool LocationEngineService::registerPlatformInterface(
@@ -47,8 +92,17 @@ bool LocationEngineService::registerPlatformInterfaceType(
     std::shared_ptr<aace::location::LocationProvider> locationProvider) {
     try {
         ThrowIfNotNull(m_locationProvider, "platformInterfaceAlreadyRegistered");
+
+        // location requests from other services are served from the cache, which is updated by the fixes the platform
+        // pushes and queries the platform only when no fresh fix is available
+        m_locationCache =
+            LocationCache::create(locationProvider, m_cacheMaxAge, m_cacheMaxAccuracy, m_cacheChangeThreshold);
+        ThrowIfNull(m_locationCache, "createLocationCacheFailed");
+
         m_locationProvider = locationProvider;
+        m_locationProvider->setEngineInterface(m_locationCache);
         registerServiceInterface<aace::location::LocationProvider>(m_locationProvider);
+        registerServiceInterface<LocationCache>(m_locationCache);
 
         return true;
     } catch (std::exception& ex) {
@@ -64,12 +64,11 @@ bool LoggerEngineService::initialize() {
     }
 }
 
-bool LoggerEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool LoggerEngineService::configureFromValue(const rapidjson::Value& configuration) {
     try {
-        auto document = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(document, "parseConfigurationStreamFailed");
+        ThrowIfNot(configuration.IsObject(), "invalidConfiguration");
 
-        auto loggerConfigRoot = document->GetObject();
+        auto loggerConfigRoot = configuration.GetObject();
 
         if (loggerConfigRoot.HasMember("sinks") && loggerConfigRoot["sinks"].IsArray()) {
             auto sinks = loggerConfigRoot["sinks"].GetArray();
@@ -95,7 +94,7 @@ bool LoggerEngineService::configure(std::shared_ptr<std::istream> configuration)
                     auto sink = EngineLogger::getInstance()->getSink(obj["sink"].GetString());
 
                     if (sink != nullptr) {
-                        auto rule = createRule(obj["rule"].GetObject());
+                        auto rule = createRule(obj["rule"]);
 
                         if (rule != nullptr) {
                             sink->addRule(rule);
@@ -23,8 +23,8 @@ namespace propertyManager {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.core.PropertyDescription");
 
-PropertyDescription::PropertyDescription(const std::string& name, Setter setter, Getter getter) :
-        m_setter(setter), m_getter(getter), m_name(name) {
+PropertyDescription::PropertyDescription(const std::string& name, Setter setter, Getter getter, bool snapshot) :
+        m_setter(setter), m_getter(getter), m_name(name), m_snapshot(snapshot) {
 }
 
 PropertyDescription::PropertyDescription(const PropertyDescription& other) {
@@ -43,6 +43,10 @@ std::string PropertyDescription::getPropertyName() const {
     return m_name;
 }
 
+bool PropertyDescription::isSnapshotEnabled() const {
+    return m_snapshot;
+}
+
 }  // namespace propertyManager
 }  // namespace engine
 }  // namespace aace
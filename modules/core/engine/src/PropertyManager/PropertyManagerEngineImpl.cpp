@@ -90,6 +90,30 @@ std::string PropertyManagerEngineImpl::onGetProperty(const std::string& name) {
     }
 }
 
+bool PropertyManagerEngineImpl::onSetProperties(const std::vector<std::pair<std::string, std::string>>& properties) {
+    try {
+        auto m_propertyManagerServiceInterface_lock = m_propertyManagerServiceInterface.lock();
+        ThrowIfNull(m_propertyManagerServiceInterface_lock, "invalidPropertyManagerServiceInterfaceInstance");
+        ThrowIfNot(m_propertyManagerServiceInterface_lock->setProperties(properties, true), "setPropertiesFailed");
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+std::unordered_map<std::string, std::string> PropertyManagerEngineImpl::onGetProperties(
+    const std::vector<std::string>& names) {
+    try {
+        auto m_propertyManagerServiceInterface_lock = m_propertyManagerServiceInterface.lock();
+        ThrowIfNull(m_propertyManagerServiceInterface_lock, "invalidPropertyManagerServiceInterfaceInstance");
+        return m_propertyManagerServiceInterface_lock->getProperties(names);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return std::unordered_map<std::string, std::string>();
+    }
+}
+
 void PropertyManagerEngineImpl::handlePropertyChanged(const std::string& name, const std::string& value) {
     if (m_platformPropertyManagerInterface != nullptr) {
         m_platformPropertyManagerInterface->propertyChanged(name, value);
@@ -105,6 +129,20 @@ void PropertyManagerEngineImpl::propertyStateChanged(
     }
 }
 
+void PropertyManagerEngineImpl::handlePropertiesChanged(
+    const std::unordered_map<std::string, std::string>& properties) {
+    if (m_platformPropertyManagerInterface != nullptr) {
+        m_platformPropertyManagerInterface->propertiesChanged(properties);
+    }
+}
+
+void PropertyManagerEngineImpl::propertiesStateChanged(
+    const std::vector<aace::propertyManager::PropertyManager::PropertyStateChange>& changes) {
+    if (m_platformPropertyManagerInterface != nullptr) {
+        m_platformPropertyManagerInterface->propertiesStateChanged(changes);
+    }
+}
+
 void PropertyManagerEngineImpl::doShutdown() {
     if (m_platformPropertyManagerInterface != nullptr) {
         m_platformPropertyManagerInterface->setEngineInterface(nullptr);
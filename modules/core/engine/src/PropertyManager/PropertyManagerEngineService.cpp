@@ -32,7 +32,8 @@ static const std::string TAG("aace.propertyManager.PropertyManagerEngineService"
 REGISTER_SERVICE(PropertyManagerEngineService);
 
 PropertyManagerEngineService::PropertyManagerEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description) {
+        aace::engine::core::EngineService(description),
+        m_propertySnapshot(std::make_shared<const std::unordered_map<std::string, std::string>>()) {
 }
 
 bool PropertyManagerEngineService::initialize() {
@@ -144,6 +145,10 @@ bool PropertyManagerEngineService::setProperty(
                 };
                 auto result = it->second.setter()(value, changed, async, callback);
                 ReturnIf(result && async, true);
+                // the snapshot follows every successful set, whether or not the platform interface is registered
+                if (result) {
+                    refreshPropertyValue(name);
+                }
                 if (m_propertyManagerEngineImpl == nullptr) {
                     AACE_WARN(
                         LX(TAG).m("Null propertyManagerEngineImpl. PropertyManager platform interface not registered"));
@@ -212,11 +217,14 @@ void PropertyManagerEngineService::setPropertyResultCallback(
     const bool& fromPlatform,
     const std::string& result) {
     m_executor.submit([this, name, value, fromPlatform, result] {
+        auto succeeded = aace::engine::utils::string::equal(result, "SUCCEEDED");
+        if (succeeded) {
+            refreshPropertyValue(name);
+        }
         if (m_propertyManagerEngineImpl == nullptr) {
             AACE_WARN(LX(TAG).m("PropertyManager platform interface not registered"));
         } else {
-            aace::engine::utils::string::equal(result, "SUCCEEDED") ? handleSetSuccess(true, fromPlatform, name, value)
-                                                                    : handleSetFailed(fromPlatform, name, value);
+            succeeded ? handleSetSuccess(true, fromPlatform, name, value) : handleSetFailed(fromPlatform, name, value);
         }
     });
 }
@@ -227,15 +235,188 @@ std::string PropertyManagerEngineService::getProperty(const std::string& name) {
             AACE_WARN(LX(TAG).d("reason", "getPropertyCalledWhileEngineNotRunning"));
         }
         ThrowIf(name.empty(), "invalidPropertyName");
+        auto snapshot = std::atomic_load(&m_propertySnapshot);
+        auto snapshotIt = snapshot->find(name);
+        ReturnIf(snapshotIt != snapshot->end(), snapshotIt->second);
+
         auto it = m_propertyDescriptionMap.find(name);
         ThrowIf(it == m_propertyDescriptionMap.end(), "propertyNotFound");
-        return it->second.getter()();
+        auto value = it->second.getter()();
+        // publish the first value read while the engine is running, so later reads use the snapshot
+        if (it->second.isSnapshotEnabled() && isRunning()) {
+            publishPropertyValue(name, value, false);
+        }
+        return value;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()).d("name", name));
         return "";
     }
 }
 
+void PropertyManagerEngineService::publishPropertyValue(
+    const std::string& name,
+    const std::string& value,
+    bool replace) {
+    std::lock_guard<std::mutex> lock(m_snapshotMutex);
+    auto snapshot = std::atomic_load(&m_propertySnapshot);
+    auto it = snapshot->find(name);
+    if (it != snapshot->end() && (!replace || it->second == value)) {
+        return;
+    }
+    auto updated = std::make_shared<std::unordered_map<std::string, std::string>>(*snapshot);
+    (*updated)[name] = value;
+    std::shared_ptr<const std::unordered_map<std::string, std::string>> published = updated;
+    std::atomic_store(&m_propertySnapshot, published);
+}
+
+void PropertyManagerEngineService::refreshPropertyValue(const std::string& name) {
+    try {
+        auto it = m_propertyDescriptionMap.find(name);
+        ThrowIf(it == m_propertyDescriptionMap.end(), "propertyNotFound");
+        ReturnIf(!it->second.isSnapshotEnabled() || it->second.getter() == nullptr);
+        publishPropertyValue(name, it->second.getter()());
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("name", name));
+    }
+}
+
+bool PropertyManagerEngineService::setProperties(
+    const std::vector<std::pair<std::string, std::string>>& properties,
+    const bool& fromPlatform) {
+    try {
+        if (isRunning() == false) {
+            AACE_WARN(LX(TAG).d("reason", "setPropertiesCalledWhileEngineNotRunning"));
+        }
+        ThrowIf(properties.empty(), "noProperties");
+        // validate the whole batch before applying any property
+        for (const auto& property : properties) {
+            ThrowIf(property.first.empty(), "invalidPropertyName");
+            auto it = m_propertyDescriptionMap.find(property.first);
+            ThrowIf(it == m_propertyDescriptionMap.end(), "propertyNotFound:" + property.first);
+            ThrowIfNull(it->second.setter(), "readOnlyProperty:" + property.first);
+        }
+        m_executor.submit([this, properties, fromPlatform] {
+            auto batch = std::make_shared<PropertyBatch>();
+            batch->fromPlatform = fromPlatform;
+            batch->pending = properties.size();
+            for (const auto& property : properties) {
+                const auto& name = property.first;
+                const auto& value = property.second;
+                try {
+                    bool changed = false;
+                    bool async = false;
+                    auto callback =
+                        [this, batch](const std::string& name, const std::string& value, const std::string& state) {
+                            m_executor.submit([this, batch, name, value, state] {
+                                handleBatchedPropertyResult(
+                                    batch, name, value, aace::engine::utils::string::equal(state, "SUCCEEDED"), true);
+                            });
+                        };
+                    auto it = m_propertyDescriptionMap.find(name);
+                    ThrowIf(it == m_propertyDescriptionMap.end(), "propertyNotFound");
+                    auto result = it->second.setter()(value, changed, async, callback);
+                    if (!(result && async)) {
+                        handleBatchedPropertyResult(batch, name, value, result, changed);
+                    }
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG).d("reason", ex.what()).d("name", name));
+                    handleBatchedPropertyResult(batch, name, value, false, false);
+                }
+            }
+        });
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+void PropertyManagerEngineService::handleBatchedPropertyResult(
+    std::shared_ptr<PropertyBatch> batch,
+    const std::string& name,
+    const std::string& value,
+    bool succeeded,
+    bool changed) {
+    using PropertyState = aace::propertyManager::PropertyManagerEngineInterface::PropertyState;
+    batch->states.push_back({name, value, succeeded ? PropertyState::SUCCEEDED : PropertyState::FAILED});
+    if (succeeded) {
+        refreshPropertyValue(name);
+        if (changed) {
+            batch->changed[name] = value;
+        }
+    }
+    ReturnIf(--batch->pending > 0);
+
+    if (m_propertyManagerEngineImpl == nullptr) {
+        AACE_WARN(LX(TAG).m("Null propertyManagerEngineImpl. PropertyManager platform interface not registered"));
+        return;
+    }
+    // If setProperties() was initiated by the platform, report the state of every property,
+    // else report the properties that changed
+    if (batch->fromPlatform) {
+        m_propertyManagerEngineImpl->propertiesStateChanged(batch->states);
+    } else if (!batch->changed.empty()) {
+        m_propertyManagerEngineImpl->handlePropertiesChanged(batch->changed);
+    }
+    notifyPropertiesChangeListeners(batch->changed);
+}
+
+std::unordered_map<std::string, std::string> PropertyManagerEngineService::getProperties(
+    const std::vector<std::string>& names) {
+    std::unordered_map<std::string, std::string> properties;
+    if (isRunning() == false) {
+        AACE_WARN(LX(TAG).d("reason", "getPropertiesCalledWhileEngineNotRunning"));
+    }
+    auto snapshot = std::atomic_load(&m_propertySnapshot);
+    for (const auto& name : names) {
+        auto snapshotIt = snapshot->find(name);
+        if (snapshotIt != snapshot->end()) {
+            properties[name] = snapshotIt->second;
+            continue;
+        }
+        auto it = m_propertyDescriptionMap.find(name);
+        if (it == m_propertyDescriptionMap.end() || it->second.getter() == nullptr) {
+            AACE_WARN(LX(TAG).d("reason", "propertyNotFound").d("name", name));
+            continue;
+        }
+        try {
+            auto value = it->second.getter()();
+            if (it->second.isSnapshotEnabled() && isRunning()) {
+                publishPropertyValue(name, value, false);
+            }
+            properties[name] = value;
+        } catch (std::exception& ex) {
+            AACE_ERROR(LX(TAG).d("reason", ex.what()).d("name", name));
+        }
+    }
+    return properties;
+}
+
+void PropertyManagerEngineService::notifyPropertiesChangeListeners(
+    const std::unordered_map<std::string, std::string>& properties) {
+    // group the changed properties by listener, so each listener is notified once
+    std::unordered_map<std::shared_ptr<PropertyListenerInterface>, std::unordered_map<std::string, std::string>>
+        listenerProperties;
+    {
+        std::lock_guard<std::mutex> lock(m_listenerMutex);
+        for (const auto& property : properties) {
+            auto it = m_propertyListenerMap.find(property.first);
+            if (it != m_propertyListenerMap.end()) {
+                for (const auto& listener : it->second) {
+                    listenerProperties[listener].insert(property);
+                }
+            }
+        }
+    }
+    for (const auto& entry : listenerProperties) {
+        try {
+            entry.first->propertiesChanged(entry.second);
+        } catch (std::exception& ex) {
+            AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        }
+    }
+}
+
 void PropertyManagerEngineService::notifyPropertyChangeListeners(
     const std::string& name,
     const std::string& propertyValue) {
@@ -264,6 +445,9 @@ void PropertyManagerEngineService::updatePropertyValue(const std::string& name,
         auto it = m_propertyDescriptionMap.find(name);
         if (it != m_propertyDescriptionMap.end()) {
             auto propertyValue = it->second.getter()();
+            if (it->second.isSnapshotEnabled()) {
+                publishPropertyValue(name, propertyValue);
+            }
             notifyPropertyChangeListeners(name, propertyValue);
             if (m_propertyManagerEngineImpl != nullptr) {
                 m_propertyManagerEngineImpl->handlePropertyChanged(name, propertyValue);
@@ -282,6 +466,8 @@ bool PropertyManagerEngineService::shutdown() {
     m_executor.shutdown();
     m_propertyListenerMap.clear();
     m_propertyDescriptionMap.clear();
+    std::atomic_store(
+        &m_propertySnapshot, std::make_shared<const std::unordered_map<std::string, std::string>>());
     return true;
 }
 
@@ -37,12 +37,11 @@ StorageEngineService::StorageEngineService(const aace::engine::core::ServiceDesc
         aace::engine::core::EngineService(description) {
 }
 
-bool StorageEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool StorageEngineService::configureFromValue(const rapidjson::Value& configuration) {
     try {
-        auto document = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(document, "parseConfigurationStreamFailed");
+        ThrowIfNot(configuration.IsObject(), "invalidConfiguration");
 
-        auto storageConfigRoot = document->GetObject();
+        auto storageConfigRoot = configuration.GetObject();
 
         if (storageConfigRoot.HasMember("localStoragePath") && storageConfigRoot["localStoragePath"].IsString()) {
             ThrowIfNotNull(m_localStorage, "localStorageAlreadyConfigured");
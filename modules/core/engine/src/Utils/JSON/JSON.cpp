@@ -108,20 +108,20 @@ std::shared_ptr<rapidjson::Document> parse(const std::string& value, rapidjson::
     }
 }
 
-std::string toString(const rapidjson::Document& document, bool prettyPrint) {
-    auto stream = toStream(document, prettyPrint);
+std::string toString(const rapidjson::Value& value, bool prettyPrint) {
+    auto stream = toStream(value, prettyPrint);
     return stream != nullptr ? stream->str().c_str() : "";
 }
 
-std::shared_ptr<std::stringstream> toStream(const rapidjson::Document& document, bool prettyPrint) {
+std::shared_ptr<std::stringstream> toStream(const rapidjson::Value& value, bool prettyPrint) {
     rapidjson::StringBuffer buffer;
 
     if (prettyPrint) {
         rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
-        document.Accept(writer);
+        value.Accept(writer);
     } else {
         rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        document.Accept(writer);
+        value.Accept(writer);
     }
 
     return std::make_shared<std::stringstream>(buffer.GetString());
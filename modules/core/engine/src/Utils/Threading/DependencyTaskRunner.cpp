@@ -0,0 +1,124 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Utils/Threading/DependencyTaskRunner.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace threading {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.utils.threading.DependencyTaskRunner");
+
+int DependencyTaskRunner::addTask(Task task, const std::vector<int>& dependencies) {
+    try {
+        ThrowIfNot(task, "invalidTask");
+
+        auto index = m_tasks.size();
+
+        for (auto next : dependencies) {
+            ThrowIf(next < 0 || static_cast<size_t>(next) >= index, "invalidDependency");
+        }
+
+        m_tasks.push_back({task, dependencies.size(), {}});
+
+        for (auto next : dependencies) {
+            m_tasks[next].dependents.push_back(index);
+        }
+
+        return static_cast<int>(index);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "addTask").d("reason", ex.what()));
+        return -1;
+    }
+}
+
+bool DependencyTaskRunner::run(size_t threadCount) {
+    std::mutex mutex;
+    std::condition_variable trigger;
+    std::deque<size_t> ready;
+    size_t completed = 0;
+    bool failed = false;
+
+    for (size_t j = 0; j < m_tasks.size(); j++) {
+        if (m_tasks[j].dependencyCount == 0) {
+            ready.push_back(j);
+        }
+    }
+
+    auto worker = [this, &mutex, &trigger, &ready, &completed, &failed]() {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true) {
+            trigger.wait(lock, [&] { return failed || completed == m_tasks.size() || !ready.empty(); });
+
+            if (failed || completed == m_tasks.size()) {
+                return;
+            }
+
+            auto index = ready.front();
+            ready.pop_front();
+
+            lock.unlock();
+            bool success = false;
+            try {
+                success = m_tasks[index].task();
+            } catch (std::exception& ex) {
+                AACE_ERROR(LX(TAG, "run").d("reason", ex.what()).d("task", index));
+            }
+            lock.lock();
+
+            if (success) {
+                for (auto next : m_tasks[index].dependents) {
+                    if (--m_tasks[next].dependencyCount == 0) {
+                        ready.push_back(next);
+                    }
+                }
+                completed++;
+            } else {
+                failed = true;
+            }
+
+            trigger.notify_all();
+        }
+    };
+
+    threadCount = std::max<size_t>(1, std::min(threadCount, m_tasks.size()));
+
+    std::vector<std::thread> threads;
+    for (size_t j = 0; j < threadCount; j++) {
+        threads.emplace_back(worker);
+    }
+    for (auto& next : threads) {
+        next.join();
+    }
+
+    m_tasks.clear();
+
+    return !failed;
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,343 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Utils/Threading/TimerWheel.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace threading {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.utils.threading.TimerWheel");
+
+/// The interval at which the thread checks the system clock while timers of the system clock are scheduled.
+static const std::chrono::seconds CLOCK_CHECK_INTERVAL(1);
+
+/// The smallest change of the system clock relative to the steady clock that reschedules the timers of the system
+/// clock, above the adjustments of the clock synchronization.
+static const std::chrono::milliseconds CLOCK_CHANGE_THRESHOLD(500);
+
+const TimerWheel::TimerId TimerWheel::INVALID_TIMER;
+constexpr std::chrono::milliseconds TimerWheel::DEFAULT_RESOLUTION;
+
+/// Returns the offset of the system clock from the steady clock.
+static std::chrono::system_clock::duration getSystemClockOffset(
+    std::chrono::steady_clock::time_point steadyNow,
+    std::chrono::system_clock::time_point systemNow) {
+    return systemNow.time_since_epoch() -
+           std::chrono::duration_cast<std::chrono::system_clock::duration>(steadyNow.time_since_epoch());
+}
+
+TimerWheel::TimerWheel(std::chrono::milliseconds resolution) :
+        m_resolution(std::max(resolution, std::chrono::milliseconds(1))),
+        m_epoch(std::chrono::steady_clock::now()),
+        m_systemClockOffset(getSystemClockOffset(m_epoch, std::chrono::system_clock::now())) {
+    m_levels[0].resize(1 << FIRST_LEVEL_BITS);
+    for (size_t level = 1; level < LEVEL_COUNT; level++) {
+        m_levels[level].resize(1 << LEVEL_BITS);
+    }
+    m_thread = std::thread(&TimerWheel::loop, this);
+}
+
+TimerWheel::~TimerWheel() {
+    shutdown();
+}
+
+TimerWheel::TimerId TimerWheel::scheduleAfter(std::chrono::milliseconds delay, Task task) {
+    return schedule({INVALID_TIMER, std::chrono::steady_clock::now() + delay, false, {}, std::move(task), nullptr});
+}
+
+TimerWheel::TimerId TimerWheel::scheduleAt(std::chrono::system_clock::time_point time, Task task) {
+    return schedule({INVALID_TIMER, {}, true, time, std::move(task), nullptr});
+}
+
+TimerWheel::TimerId TimerWheel::schedule(Timer timer) {
+    try {
+        ThrowIfNot(timer.task, "invalidTask");
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ThrowIf(m_shutdown, "timerWheelShutdown");
+
+        if (timer.systemClock) {
+            // the deadline follows the system clock from the offset the other timers of the system clock use
+            auto systemNow = std::chrono::system_clock::now();
+            auto steadyNow = std::chrono::steady_clock::now();
+            if (m_systemClockTimerCount == 0) {
+                m_systemClockOffset = getSystemClockOffset(steadyNow, systemNow);
+            }
+            timer.deadline = steadyNow + (timer.time - systemNow);
+            m_systemClockTimerCount++;
+        }
+
+        timer.id = m_nextId++;
+        Slot pending;
+        pending.push_back(std::move(timer));
+        auto it = pending.begin();
+        place(pending, it);
+        m_timers[it->id] = it;
+
+        // the thread only needs to wake up earlier for the timer
+        if (toTick(it->deadline) < m_wakeTick) {
+            m_wakeTrigger.notify_one();
+        }
+
+        return it->id;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "schedule").d("reason", ex.what()));
+        return INVALID_TIMER;
+    }
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_timers.find(id);
+    ReturnIf(it == m_timers.end(), false);
+
+    if (it->second->systemClock) {
+        m_systemClockTimerCount--;
+    }
+    it->second->slot->erase(it->second);
+    m_timers.erase(it);
+
+    return true;
+}
+
+void TimerWheel::onClockChanged() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ReturnIf(m_systemClockTimerCount == 0);
+    rescheduleSystemClockTimers();
+    m_wakeTrigger.notify_one();
+}
+
+size_t TimerWheel::size() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_timers.size();
+}
+
+void TimerWheel::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ReturnIf(m_shutdown);
+        m_shutdown = true;
+        for (auto& level : m_levels) {
+            for (auto& slot : level) {
+                slot.clear();
+            }
+        }
+        m_expired.clear();
+        m_timers.clear();
+        m_systemClockTimerCount = 0;
+        m_wakeTrigger.notify_one();
+    }
+
+    if (m_thread.get_id() == std::this_thread::get_id()) {
+        // shut down by one of its tasks
+        m_thread.detach();
+    } else if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+TimerWheel::Tick TimerWheel::toTick(std::chrono::steady_clock::time_point time) const {
+    ReturnIf(time <= m_epoch, 0);
+
+    // the first tick at or after the time, so that no timer runs early
+    return (time - m_epoch + m_resolution - std::chrono::steady_clock::duration(1)) / m_resolution;
+}
+
+std::chrono::steady_clock::time_point TimerWheel::toTime(Tick tick) const {
+    return m_epoch + m_resolution * static_cast<std::chrono::steady_clock::rep>(tick);
+}
+
+void TimerWheel::place(Slot& from, Slot::iterator timer) {
+    Tick expires = std::max(toTick(timer->deadline), m_currentTick);
+    Tick delta = expires - m_currentTick;
+
+    // the level that holds the delta, where the slot of the deadline is not reached before it
+    size_t level = 0;
+    size_t bits = FIRST_LEVEL_BITS;
+    while (level < LEVEL_COUNT - 1 && delta >= (Tick(1) << bits)) {
+        level++;
+        bits += LEVEL_BITS;
+    }
+    if (delta >= (Tick(1) << bits)) {
+        // beyond the range of the wheel, the timer is placed again when its slot is reached
+        expires = m_currentTick + (Tick(1) << bits) - 1;
+    }
+
+    size_t shift = level == 0 ? 0 : bits - LEVEL_BITS;
+    auto& slot = m_levels[level][(expires >> shift) & (m_levels[level].size() - 1)];
+    slot.splice(slot.end(), from, timer);
+    timer->slot = &slot;
+}
+
+TimerWheel::Tick TimerWheel::nextEventTick() const {
+    const auto& first = m_levels[0];
+    size_t index = m_currentTick & (first.size() - 1);
+    Tick next = std::numeric_limits<Tick>::max();
+
+    // the timers of the first level run on the tick of their slot, in this turn or in the next turn
+    for (size_t offset = 0; offset < first.size(); offset++) {
+        if (!first[(index + offset) & (first.size() - 1)].empty()) {
+            next = m_currentTick + offset;
+            break;
+        }
+    }
+
+    // the timers of the other levels move down on the tick that reaches their slot
+    size_t shift = FIRST_LEVEL_BITS;
+    for (size_t level = 1; level < LEVEL_COUNT; level++, shift += LEVEL_BITS) {
+        const auto& slots = m_levels[level];
+        Tick turn = m_currentTick >> shift;
+        Tick start = (m_currentTick & ((Tick(1) << shift) - 1)) == 0 ? turn : turn + 1;
+        for (Tick position = start; position <= turn + slots.size(); position++) {
+            if (!slots[position & (slots.size() - 1)].empty()) {
+                next = std::min(next, position << shift);
+                break;
+            }
+        }
+    }
+
+    return next;
+}
+
+void TimerWheel::advance(Tick tick) {
+    auto& first = m_levels[0];
+
+    while (m_currentTick <= tick) {
+        // the ticks without timers to run or to move down are skipped
+        Tick next = nextEventTick();
+        if (next > tick) {
+            m_currentTick = tick + 1;
+            break;
+        }
+        m_currentTick = next;
+
+        size_t index = m_currentTick & (first.size() - 1);
+        if (index == 0) {
+            cascade(1);
+        }
+
+        auto& slot = first[index];
+        for (auto& timer : slot) {
+            timer.slot = &m_expired;
+        }
+        m_expired.splice(m_expired.end(), slot);
+        m_currentTick++;
+    }
+}
+
+void TimerWheel::cascade(size_t level) {
+    size_t shift = FIRST_LEVEL_BITS + (level - 1) * LEVEL_BITS;
+    auto& slots = m_levels[level];
+    size_t index = (m_currentTick >> shift) & (slots.size() - 1);
+
+    Slot moving;
+    moving.splice(moving.end(), slots[index]);
+    while (!moving.empty()) {
+        place(moving, moving.begin());
+    }
+
+    // the next level is reached when this level completes a turn
+    if (index == 0 && level + 1 < LEVEL_COUNT) {
+        cascade(level + 1);
+    }
+}
+
+void TimerWheel::rescheduleSystemClockTimers() {
+    auto systemNow = std::chrono::system_clock::now();
+    auto steadyNow = std::chrono::steady_clock::now();
+    m_systemClockOffset = getSystemClockOffset(steadyNow, systemNow);
+
+    size_t count = 0;
+    for (auto& next : m_timers) {
+        auto timer = next.second;
+        if (timer->systemClock && timer->slot != &m_expired) {
+            timer->deadline = steadyNow + (timer->time - systemNow);
+            place(*timer->slot, timer);
+            count++;
+        }
+    }
+    AACE_INFO(LX(TAG).m("rescheduledSystemClockTimers").d("count", count));
+}
+
+void TimerWheel::loop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_shutdown) {
+        m_wakeTick = 0;
+
+        if (m_systemClockTimerCount > 0) {
+            auto offset = getSystemClockOffset(std::chrono::steady_clock::now(), std::chrono::system_clock::now());
+            auto change = offset > m_systemClockOffset ? offset - m_systemClockOffset : m_systemClockOffset - offset;
+            if (change >= CLOCK_CHANGE_THRESHOLD) {
+                rescheduleSystemClockTimers();
+            }
+        }
+
+        // the ticks whose time has come
+        auto now = std::chrono::steady_clock::now();
+        Tick nowTick = static_cast<Tick>((now - m_epoch) / m_resolution);
+        if (m_currentTick <= nowTick) {
+            advance(nowTick);
+        }
+
+        // a task may cancel the timers that follow it, or shut down the wheel
+        while (!m_expired.empty() && !m_shutdown) {
+            auto& timer = m_expired.front();
+            auto task = std::move(timer.task);
+            if (timer.systemClock) {
+                m_systemClockTimerCount--;
+            }
+            m_timers.erase(timer.id);
+            m_expired.pop_front();
+
+            lock.unlock();
+            try {
+                task();
+            } catch (std::exception& ex) {
+                // a failing task must not stop the timers that follow it
+                AACE_ERROR(LX(TAG, "loop").d("reason", ex.what()));
+            } catch (...) {
+                AACE_ERROR(LX(TAG, "loop").d("reason", "unknownException"));
+            }
+            lock.lock();
+        }
+        if (m_shutdown) {
+            break;
+        }
+
+        if (m_timers.empty()) {
+            m_wakeTick = std::numeric_limits<Tick>::max();
+            m_wakeTrigger.wait(lock);
+            continue;
+        }
+        m_wakeTick = nextEventTick();
+        auto wakeTime = toTime(m_wakeTick);
+        if (m_systemClockTimerCount > 0) {
+            wakeTime = std::min(wakeTime, now + CLOCK_CHECK_INTERVAL);
+        }
+        m_wakeTrigger.wait_until(lock, wakeTime);
+    }
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
@@ -115,7 +115,8 @@ bool VehicleEngineService::registerProperties() {
                 std::placeholders::_2,
                 std::placeholders::_3,
                 std::placeholders::_4),
-            std::bind(&VehicleEngineService::getProperty_operatingCountry, this)));
+            std::bind(&VehicleEngineService::getProperty_operatingCountry, this),
+            true));
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -148,7 +149,7 @@ bool VehicleEngineService::setup() {
 }
 
 void VehicleEngineService::getVehicleConfigProperty(
-    rapidjson::Value& root,
+    const rapidjson::Value& root,
     const char* configKey,
     VehiclePropertyType propertyKey,
     std::unordered_map<VehiclePropertyType, std::string, EnumHash>& propertyMap) {
@@ -158,15 +159,14 @@ void VehicleEngineService::getVehicleConfigProperty(
     propertyMap[propertyKey] = value;
 }
 
-bool VehicleEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool VehicleEngineService::configureFromValue(const rapidjson::Value& configuration) {
     try {
-        auto document = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(document, "parseConfigurationStreamFailed");
+        ThrowIfNot(configuration.IsObject(), "invalidConfiguration");
 
-        auto vehicleConfigRoot = document->GetObject();
+        auto vehicleConfigRoot = configuration.GetObject();
 
         if (vehicleConfigRoot.HasMember("info") && vehicleConfigRoot["info"].IsObject()) {
-            rapidjson::Value info = vehicleConfigRoot["info"].GetObject();
+            const rapidjson::Value& info = vehicleConfigRoot["info"];
 
             getVehicleConfigProperty(info, "make", VehiclePropertyType::MAKE, m_vehiclePropertyMap);
             getVehicleConfigProperty(info, "model", VehiclePropertyType::MODEL, m_vehiclePropertyMap);
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AACE/Engine/Utils/Threading/DependencyTaskRunner.h"
+
+using aace::engine::utils::threading::DependencyTaskRunner;
+
+TEST(DependencyTaskRunnerTest, runsDependenciesFirst) {
+    DependencyTaskRunner runner;
+    std::mutex mutex;
+    std::vector<int> order;
+
+    auto record = [&mutex, &order](int id) {
+        return [&mutex, &order, id] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(id);
+            return true;
+        };
+    };
+
+    auto a = runner.addTask(record(0));
+    auto b = runner.addTask(record(1));
+    auto c = runner.addTask(record(2), {a, b});
+    runner.addTask(record(3), {c});
+
+    ASSERT_TRUE(runner.run(4));
+    ASSERT_EQ(order.size(), 4u);
+    EXPECT_EQ(order[2], 2);
+    EXPECT_EQ(order[3], 3);
+}
+
+TEST(DependencyTaskRunnerTest, runsIndependentTasksConcurrently) {
+    DependencyTaskRunner runner;
+    std::atomic<int> running(0);
+    std::atomic<int> maxRunning(0);
+
+    for (int j = 0; j < 4; j++) {
+        runner.addTask([&running, &maxRunning] {
+            int current = ++running;
+            int expected = maxRunning.load();
+            while (current > expected && !maxRunning.compare_exchange_weak(expected, current)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            running--;
+            return true;
+        });
+    }
+
+    ASSERT_TRUE(runner.run(4));
+    EXPECT_GT(maxRunning.load(), 1);
+}
+
+TEST(DependencyTaskRunnerTest, stopsAfterFailure) {
+    DependencyTaskRunner runner;
+    std::atomic<bool> dependentRan(false);
+
+    auto a = runner.addTask([] { return false; });
+    runner.addTask(
+        [&dependentRan] {
+            dependentRan = true;
+            return true;
+        },
+        {a});
+
+    EXPECT_FALSE(runner.run(2));
+    EXPECT_FALSE(dependentRan.load());
+}
+
+TEST(DependencyTaskRunnerTest, rejectsInvalidDependency) {
+    DependencyTaskRunner runner;
+    EXPECT_EQ(runner.addTask([] { return true; }, {0}), -1);
+    EXPECT_TRUE(runner.run(1));
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "AACE/Engine/Location/LocationCache.h"
+
+using aace::engine::location::LocationCache;
+using aace::location::Location;
+
+class MockLocationProvider : public aace::location::LocationProvider {
+public:
+    MockLocationProvider() : location(Location::UNDEFINED, Location::UNDEFINED), getLocationCount(0) {
+    }
+
+    Location getLocation() override {
+        getLocationCount++;
+        return location;
+    }
+
+    Location location;
+    int getLocationCount;
+};
+
+class LocationCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_locationProvider = std::make_shared<MockLocationProvider>();
+    }
+
+    std::shared_ptr<LocationCache> createCache(
+        std::chrono::milliseconds maxAge,
+        double maxAccuracy = 0,
+        double changeThreshold = 0) {
+        auto cache = LocationCache::create(m_locationProvider, maxAge, maxAccuracy, changeThreshold);
+        if (cache != nullptr) {
+            m_locationProvider->setEngineInterface(cache);
+        }
+        return cache;
+    }
+
+    std::shared_ptr<MockLocationProvider> m_locationProvider;
+};
+
+TEST_F(LocationCacheTest, servesPushedLocationWithoutQueryingPlatform) {
+    auto cache = createCache(std::chrono::seconds(10));
+    ASSERT_NE(nullptr, cache);
+
+    m_locationProvider->locationChanged(Location(47.6, -122.3, Location::UNDEFINED, 5));
+
+    uint64_t version = 0;
+    auto location = cache->getLocation(version);
+    EXPECT_TRUE(location.isValid());
+    EXPECT_DOUBLE_EQ(47.6, location.getLatitude());
+    EXPECT_NE(0u, version);
+    EXPECT_EQ(0, m_locationProvider->getLocationCount);
+}
+
+TEST_F(LocationCacheTest, queriesPlatformWhenLocationIsStale) {
+    auto cache = createCache(std::chrono::milliseconds(20));
+    ASSERT_NE(nullptr, cache);
+
+    m_locationProvider->locationChanged(Location(47.6, -122.3));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    m_locationProvider->location = Location(40.7, -74.0);
+    uint64_t version = 0;
+    auto location = cache->getLocation(version);
+    EXPECT_DOUBLE_EQ(40.7, location.getLatitude());
+    EXPECT_EQ(1, m_locationProvider->getLocationCount);
+
+    // the queried location is cached
+    cache->getLocation(version);
+    EXPECT_EQ(1, m_locationProvider->getLocationCount);
+}
+
+TEST_F(LocationCacheTest, ignoresInaccurateLocation) {
+    auto cache = createCache(std::chrono::seconds(10), 50);
+    ASSERT_NE(nullptr, cache);
+
+    m_locationProvider->locationChanged(Location(47.6, -122.3, Location::UNDEFINED, 500));
+    m_locationProvider->location = Location(40.7, -74.0, Location::UNDEFINED, 10);
+
+    uint64_t version = 0;
+    auto location = cache->getLocation(version);
+    EXPECT_DOUBLE_EQ(40.7, location.getLatitude());
+    EXPECT_EQ(1, m_locationProvider->getLocationCount);
+}
+
+TEST_F(LocationCacheTest, keepsVersionWithinChangeThreshold) {
+    auto cache = createCache(std::chrono::seconds(10), 0, 100);
+    ASSERT_NE(nullptr, cache);
+
+    uint64_t first = 0;
+    uint64_t second = 0;
+    uint64_t third = 0;
+    m_locationProvider->locationChanged(Location(47.6, -122.3));
+    cache->getLocation(first);
+
+    // about 11 meters north
+    m_locationProvider->locationChanged(Location(47.6001, -122.3));
+    auto location = cache->getLocation(second);
+    EXPECT_EQ(first, second);
+    EXPECT_DOUBLE_EQ(47.6001, location.getLatitude());
+
+    // about 1.1 kilometers north
+    m_locationProvider->locationChanged(Location(47.61, -122.3));
+    location = cache->getLocation(third);
+    EXPECT_NE(second, third);
+    EXPECT_DOUBLE_EQ(47.61, location.getLatitude());
+}
+
+TEST_F(LocationCacheTest, servesLatestFixOfSamePosition) {
+    auto cache = createCache(std::chrono::seconds(10));
+    ASSERT_NE(nullptr, cache);
+
+    auto firstTime = std::chrono::system_clock::now() - std::chrono::seconds(5);
+    auto secondTime = std::chrono::system_clock::now();
+    m_locationProvider->locationChanged(Location(47.6, -122.3, Location::UNDEFINED, 50, firstTime));
+    m_locationProvider->locationChanged(Location(47.6, -122.3, Location::UNDEFINED, 5, secondTime));
+
+    uint64_t version = 0;
+    auto location = cache->getLocation(version);
+    EXPECT_EQ(secondTime, location.getTime());
+    EXPECT_DOUBLE_EQ(5, location.getAccuracy());
+    EXPECT_NE(0u, version);
+}
+
+TEST_F(LocationCacheTest, invalidLocationClearsCache) {
+    auto cache = createCache(std::chrono::seconds(10));
+    ASSERT_NE(nullptr, cache);
+
+    m_locationProvider->locationChanged(Location(47.6, -122.3));
+    m_locationProvider->locationChanged(Location(Location::UNDEFINED, Location::UNDEFINED));
+
+    uint64_t version = 1;
+    auto location = cache->getLocation(version);
+    EXPECT_FALSE(location.isValid());
+    EXPECT_EQ(0u, version);
+    EXPECT_EQ(1, m_locationProvider->getLocationCount);
+}
+
+TEST_F(LocationCacheTest, measuresDistance) {
+    // Seattle to New York is about 3870 kilometers
+    double distance = LocationCache::getDistance(Location(47.6062, -122.3321), Location(40.7128, -74.0060));
+    EXPECT_NEAR(3870000, distance, 10000);
+    EXPECT_DOUBLE_EQ(0, LocationCache::getDistance(Location(47.6, -122.3), Location(47.6, -122.3)));
+}
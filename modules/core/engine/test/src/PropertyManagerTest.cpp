@@ -0,0 +1,185 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "AACE/Engine/Core/EngineImpl.h"
+#include "AACE/Test/Core/CoreTestHelper.h"
+#include "AACE/Core/CoreProperties.h"
+#include "AACE/PropertyManager/PropertyManager.h"
+#include "AACE/Vehicle/VehicleProperties.h"
+
+using namespace aace::test::core;
+
+/// Timeout for the asynchronous property manager callbacks
+static const std::chrono::seconds TIMEOUT(2);
+
+class MockPropertyManager : public aace::propertyManager::PropertyManager {
+public:
+    MOCK_METHOD3(propertyStateChanged, void(const std::string& name, const std::string& value, PropertyState state));
+    MOCK_METHOD2(propertyChanged, void(const std::string& name, const std::string& newValue));
+    MOCK_METHOD1(propertiesStateChanged, void(const std::vector<PropertyStateChange>& changes));
+};
+
+/// Test harness for the @c PropertyManager platform interface
+class PropertyManagerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_engine = aace::engine::core::EngineImpl::create();
+        ASSERT_NE(m_engine, nullptr) << "Create engine failed!";
+        ASSERT_TRUE(m_engine->configure(CoreTestHelper::createDefaultConfiguration())) << "Configure engine failed!";
+
+        m_propertyManager = std::make_shared<testing::StrictMock<MockPropertyManager>>();
+        ASSERT_TRUE(m_engine->registerPlatformInterface(m_propertyManager)) << "Register platform interface failed!";
+        ASSERT_TRUE(m_engine->start()) << "Start engine failed!";
+    }
+
+    void TearDown() override {
+        if (m_engine != nullptr) {
+            ASSERT_TRUE(m_engine->shutdown()) << "Shutdown engine failed!";
+            m_engine.reset();
+        }
+    }
+
+protected:
+    std::shared_ptr<aace::engine::core::EngineImpl> m_engine;
+    std::shared_ptr<testing::StrictMock<MockPropertyManager>> m_propertyManager;
+};
+
+TEST_F(PropertyManagerTest, setPropertiesWithInvalidProperties) {
+    ASSERT_FALSE(m_propertyManager->setProperties({})) << "Set empty properties did not fail!";
+    ASSERT_FALSE(m_propertyManager->setProperties({{"test-key", "test-value"}}))
+        << "Set invalid property did not fail!";
+    ASSERT_FALSE(m_propertyManager->setProperties({{aace::core::property::VERSION, "1.0"}}))
+        << "Set read only property did not fail!";
+
+    // no property of the batch is set when one of them is not valid
+    auto operatingCountry = m_propertyManager->getProperty(aace::vehicle::property::OPERATING_COUNTRY);
+    ASSERT_FALSE(m_propertyManager->setProperties(
+        {{aace::vehicle::property::OPERATING_COUNTRY, operatingCountry}, {"test-key", "test-value"}}))
+        << "Set batch with an invalid property did not fail!";
+}
+
+TEST_F(PropertyManagerTest, getProperties) {
+    auto properties = m_propertyManager->getProperties(
+        {aace::core::property::VERSION, aace::vehicle::property::OPERATING_COUNTRY, "test-key"});
+
+    ASSERT_EQ(properties.size(), 2u) << "Invalid property was not omitted!";
+    ASSERT_EQ(properties[aace::core::property::VERSION], m_engine->getProperty(aace::core::property::VERSION));
+    ASSERT_EQ(properties.count("test-key"), 0u);
+}
+
+TEST_F(PropertyManagerTest, setPropertiesReportsStatesOnce) {
+    auto operatingCountry = m_propertyManager->getProperty(aace::vehicle::property::OPERATING_COUNTRY);
+
+    std::promise<std::vector<aace::propertyManager::PropertyManager::PropertyStateChange>> statesPromise;
+    EXPECT_CALL(*m_propertyManager, propertiesStateChanged(testing::_))
+        .WillOnce(testing::Invoke(
+            [&statesPromise](const std::vector<aace::propertyManager::PropertyManager::PropertyStateChange>& changes) {
+                statesPromise.set_value(changes);
+            }));
+
+    ASSERT_TRUE(m_propertyManager->setProperties({{aace::vehicle::property::OPERATING_COUNTRY, operatingCountry},
+                                                  {aace::vehicle::property::OPERATING_COUNTRY, operatingCountry}}))
+        << "Set properties failed!";
+
+    auto statesFuture = statesPromise.get_future();
+    ASSERT_EQ(statesFuture.wait_for(TIMEOUT), std::future_status::ready) << "Property states were not reported!";
+    auto states = statesFuture.get();
+    ASSERT_EQ(states.size(), 2u);
+    for (const auto& state : states) {
+        EXPECT_EQ(state.name, aace::vehicle::property::OPERATING_COUNTRY);
+        EXPECT_EQ(state.value, operatingCountry);
+        EXPECT_EQ(state.state, aace::propertyManager::PropertyManager::PropertyState::SUCCEEDED);
+    }
+}
+
+TEST_F(PropertyManagerTest, concurrentGetProperty) {
+    auto version = m_engine->getProperty(aace::core::property::VERSION);
+    auto operatingCountry = m_propertyManager->getProperty(aace::vehicle::property::OPERATING_COUNTRY);
+
+    std::vector<std::thread> readers;
+    std::atomic<int> mismatches(0);
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([this, &version, &operatingCountry, &mismatches]() {
+            for (int j = 0; j < 1000; j++) {
+                if (m_propertyManager->getProperty(aace::core::property::VERSION) != version ||
+                    m_propertyManager->getProperty(aace::vehicle::property::OPERATING_COUNTRY) != operatingCountry) {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    ASSERT_EQ(mismatches, 0) << "Concurrent reads returned inconsistent values!";
+}
+
+/// Test harness for the properties of an engine without the @c PropertyManager platform interface
+class PropertyManagerSnapshotTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_engine = aace::engine::core::EngineImpl::create();
+        ASSERT_NE(m_engine, nullptr) << "Create engine failed!";
+        ASSERT_TRUE(m_engine->configure(CoreTestHelper::createDefaultConfiguration())) << "Configure engine failed!";
+        ASSERT_TRUE(m_engine->start()) << "Start engine failed!";
+    }
+
+    void TearDown() override {
+        if (m_engine != nullptr) {
+            ASSERT_TRUE(m_engine->shutdown()) << "Shutdown engine failed!";
+            m_engine.reset();
+        }
+    }
+
+    /// Waits for the engine to return a property value, as the property setters run asynchronously
+    bool waitForProperty(const std::string& name, const std::string& value) {
+        auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+        while (m_engine->getProperty(name) != value) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return true;
+    }
+
+protected:
+    std::shared_ptr<aace::engine::core::EngineImpl> m_engine;
+};
+
+TEST_F(PropertyManagerSnapshotTest, setPropertyUpdatesSnapshotWithoutPlatformInterface) {
+    // the first read while the engine is running publishes the value to the snapshot
+    auto operatingCountry = m_engine->getProperty(aace::vehicle::property::OPERATING_COUNTRY);
+    auto newOperatingCountry = operatingCountry == "DE" ? "FR" : "DE";
+
+    ASSERT_TRUE(m_engine->setProperty(aace::vehicle::property::OPERATING_COUNTRY, newOperatingCountry))
+        << "Set property failed!";
+    ASSERT_TRUE(waitForProperty(aace::vehicle::property::OPERATING_COUNTRY, newOperatingCountry))
+        << "Snapshot was not updated by the set!";
+
+    ASSERT_TRUE(m_engine->setProperty(aace::vehicle::property::OPERATING_COUNTRY, operatingCountry))
+        << "Set property failed!";
+    ASSERT_TRUE(waitForProperty(aace::vehicle::property::OPERATING_COUNTRY, operatingCountry))
+        << "Snapshot was not updated by the set!";
+}
@@ -0,0 +1,230 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "AACE/Engine/Utils/Threading/TimerWheel.h"
+
+using aace::engine::utils::threading::TimerWheel;
+
+/// Collects the tasks that ran, and waits for them.
+class TaskRecorder {
+public:
+    TimerWheel::Task record(int task) {
+        return [this, task] {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_order.push_back(task);
+            m_times.push_back(std::chrono::steady_clock::now());
+            m_trigger.notify_all();
+        };
+    }
+
+    bool waitFor(size_t count, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_trigger.wait_for(lock, timeout, [this, count] { return m_order.size() >= count; });
+    }
+
+    std::vector<int> getOrder() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_order;
+    }
+
+    std::vector<std::chrono::steady_clock::time_point> getTimes() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_times;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_trigger;
+    std::vector<int> m_order;
+    std::vector<std::chrono::steady_clock::time_point> m_times;
+};
+
+TEST(TimerWheelTest, runsTimersInOrderOfDeadline) {
+    TimerWheel wheel(std::chrono::milliseconds(1));
+    TaskRecorder recorder;
+
+    wheel.scheduleAfter(std::chrono::milliseconds(60), recorder.record(2));
+    wheel.scheduleAfter(std::chrono::milliseconds(20), recorder.record(0));
+    wheel.scheduleAt(std::chrono::system_clock::now() + std::chrono::milliseconds(40), recorder.record(1));
+
+    ASSERT_TRUE(recorder.waitFor(3));
+    EXPECT_EQ(recorder.getOrder(), std::vector<int>({0, 1, 2}));
+    EXPECT_EQ(wheel.size(), 0u);
+}
+
+TEST(TimerWheelTest, doesNotRunCancelledTimers) {
+    TimerWheel wheel(std::chrono::milliseconds(1));
+    TaskRecorder recorder;
+
+    auto cancelled = wheel.scheduleAfter(std::chrono::milliseconds(20), recorder.record(0));
+    wheel.scheduleAfter(std::chrono::milliseconds(40), recorder.record(1));
+    ASSERT_NE(cancelled, TimerWheel::INVALID_TIMER);
+    EXPECT_TRUE(wheel.cancel(cancelled));
+    EXPECT_FALSE(wheel.cancel(cancelled));
+
+    ASSERT_TRUE(recorder.waitFor(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(recorder.getOrder(), std::vector<int>({1}));
+}
+
+TEST(TimerWheelTest, runsTasksThatScheduleTimers) {
+    TimerWheel wheel(std::chrono::milliseconds(1));
+    TaskRecorder recorder;
+    auto next = recorder.record(1);
+
+    wheel.scheduleAfter(std::chrono::milliseconds(10), [&wheel, &recorder, next] {
+        recorder.record(0)();
+        wheel.scheduleAfter(std::chrono::milliseconds(10), next);
+    });
+
+    ASSERT_TRUE(recorder.waitFor(2));
+    EXPECT_EQ(recorder.getOrder(), std::vector<int>({0, 1}));
+}
+
+TEST(TimerWheelTest, runsTimersAfterTaskThrows) {
+    TimerWheel wheel(std::chrono::milliseconds(1));
+    TaskRecorder recorder;
+
+    wheel.scheduleAfter(std::chrono::milliseconds(10), [] { throw std::runtime_error("taskFailed"); });
+    wheel.scheduleAfter(std::chrono::milliseconds(10), recorder.record(0));
+    wheel.scheduleAfter(std::chrono::milliseconds(30), recorder.record(1));
+
+    ASSERT_TRUE(recorder.waitFor(2));
+    EXPECT_EQ(recorder.getOrder(), std::vector<int>({0, 1}));
+}
+
+TEST(TimerWheelTest, rejectsTimersAfterShutdown) {
+    TimerWheel wheel(std::chrono::milliseconds(1));
+    TaskRecorder recorder;
+
+    EXPECT_EQ(wheel.scheduleAfter(std::chrono::milliseconds(10), nullptr), TimerWheel::INVALID_TIMER);
+    wheel.scheduleAfter(std::chrono::milliseconds(20), recorder.record(0));
+    wheel.shutdown();
+    EXPECT_EQ(wheel.size(), 0u);
+    EXPECT_EQ(wheel.scheduleAfter(std::chrono::milliseconds(10), recorder.record(1)), TimerWheel::INVALID_TIMER);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    EXPECT_TRUE(recorder.getOrder().empty());
+}
+
+/**
+ * Timers across the first two levels of the wheel run in order, never before their deadline, and within a few ticks
+ * after it.
+ */
+TEST(TimerWheelTest, runsTimersOfSeveralLevelsOnTime) {
+    const auto resolution = std::chrono::milliseconds(1);
+    TimerWheel wheel(resolution);
+    TaskRecorder recorder;
+    std::mt19937 random(1);
+    std::vector<std::chrono::steady_clock::time_point> deadlines;
+
+    const int count = 500;
+    auto start = std::chrono::steady_clock::now();
+    for (int j = 0; j < count; j++) {
+        std::chrono::milliseconds delay(random() % 600);
+        deadlines.push_back(start + delay);
+        wheel.scheduleAfter(delay, recorder.record(j));
+    }
+
+    ASSERT_TRUE(recorder.waitFor(count));
+    auto order = recorder.getOrder();
+    auto times = recorder.getTimes();
+    std::chrono::steady_clock::duration maxLateness(0);
+    for (int j = 0; j < count; j++) {
+        auto deadline = deadlines[order[j]];
+        EXPECT_GE(times[j], deadline);
+        maxLateness = std::max(maxLateness, times[j] - deadline);
+    }
+    EXPECT_LT(maxLateness, std::chrono::milliseconds(100));
+}
+
+/**
+ * Schedules thousands of alerts over the next week, then adds and deletes alerts at random, like the reconciliation
+ * of alerts synchronized from the cloud, and reschedules all of them for a clock change. The same adds and deletes on
+ * a scheduler ordered by deadline, which takes logarithmic time per timer, are given for comparison. The durations are
+ * recorded as properties of the test. Disabled by default, run with --gtest_also_run_disabled_tests.
+ */
+TEST(TimerWheelTest, DISABLED_benchmarkAddAndDeleteAlerts) {
+    const int alertCount = 5000;
+    const int operationCount = 200000;
+    const std::chrono::milliseconds week = std::chrono::hours(24 * 7);
+    std::mt19937 random(1);
+    auto randomTime = [&random, &week] {
+        return std::chrono::system_clock::now() + std::chrono::milliseconds(random() % week.count());
+    };
+
+    TimerWheel wheel;
+    std::vector<TimerWheel::TimerId> alerts;
+    for (int j = 0; j < alertCount; j++) {
+        alerts.push_back(wheel.scheduleAt(randomTime(), [] {}));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int j = 0; j < operationCount; j++) {
+        auto& alert = alerts[random() % alerts.size()];
+        ASSERT_TRUE(wheel.cancel(alert));
+        alert = wheel.scheduleAt(randomTime(), [] {});
+    }
+    auto wheelDuration = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    wheel.onClockChanged();
+    auto rescheduleDuration = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(wheel.size(), alerts.size());
+
+    // the comparison scheduler: a map ordered by deadline and an index of the timers
+    std::mutex mutex;
+    std::multimap<std::chrono::system_clock::time_point, TimerWheel::Task> ordered;
+    std::map<TimerWheel::TimerId, decltype(ordered)::iterator> index;
+    TimerWheel::TimerId nextId = 1;
+    std::vector<TimerWheel::TimerId> orderedAlerts;
+    for (int j = 0; j < alertCount; j++) {
+        index[nextId] = ordered.emplace(randomTime(), [] {});
+        orderedAlerts.push_back(nextId++);
+    }
+
+    start = std::chrono::steady_clock::now();
+    for (int j = 0; j < operationCount; j++) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& alert = orderedAlerts[random() % orderedAlerts.size()];
+        auto it = index.find(alert);
+        ASSERT_NE(it, index.end());
+        ordered.erase(it->second);
+        index.erase(it);
+        index[nextId] = ordered.emplace(randomTime(), [] {});
+        alert = nextId++;
+    }
+    auto orderedDuration = std::chrono::steady_clock::now() - start;
+
+    auto perOperation = [operationCount](std::chrono::steady_clock::duration duration) {
+        return static_cast<int>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / operationCount);
+    };
+    RecordProperty("timerWheelNsPerDeleteAndAdd", perOperation(wheelDuration));
+    RecordProperty("orderedMapNsPerDeleteAndAdd", perOperation(orderedDuration));
+    RecordProperty(
+        "timerWheelUsToReschedule",
+        static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(rescheduleDuration).count()));
+}
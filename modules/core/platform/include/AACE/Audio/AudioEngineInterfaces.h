@@ -18,6 +18,7 @@
 
 /** @file */
 
+#include <cstdint>
 #include <iostream>
 
 namespace aace {
@@ -85,6 +86,8 @@ public:
     // media player interface
     virtual void onMediaStateChanged(MediaState state) = 0;
     virtual void onMediaError(MediaError error, const std::string& description) = 0;
+    virtual void onMediaPositionChanged(int64_t position) {
+    }
 };
 
 inline std::ostream& operator<<(std::ostream& stream, const AudioOutputEngineInterface::MediaState& state) {
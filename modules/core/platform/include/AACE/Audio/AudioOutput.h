@@ -152,7 +152,8 @@ public:
     /**
      * Returns the current playback position of the platform media player.
      * If the audio source is not playing, the most recent position played
-     * should be returned.
+     * should be returned. The Engine calls @c getPosition() when the media state changes, and interpolates
+     * the position between calls.
      *
      * @return The platform media player's playback position in milliseconds, 
      * or @c TIME_UNKNOWN if the current media position is unknown or invalid.
@@ -224,6 +225,19 @@ public:
      */
     void mediaError(MediaError error, const std::string& description = "");
 
+    /**
+     * Notifies the Engine that the playback position of the platform media player moved independently of the
+     * playback clock, such as after a seek, a stall, or a change in playback rate.
+     *
+     * The Engine tracks the playback position by advancing the position reported with the most recent
+     * @c mediaStateChanged() or @c mediaPositionChanged() call while the media is playing, so @c getPosition()
+     * is only called when the media state changes. The platform implementation does not need to call
+     * @c mediaPositionChanged() while playback progresses normally.
+     *
+     * @param [in] position The current playback position of the platform media player in milliseconds
+     */
+    void mediaPositionChanged(int64_t position);
+
     /**
      * @internal
      * Sets the Engine interface delegate.
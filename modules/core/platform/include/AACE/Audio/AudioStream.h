@@ -16,6 +16,8 @@
 #ifndef AACE_AUDIO_AUDIO_STREAM_H
 #define AACE_AUDIO_AUDIO_STREAM_H
 
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <vector>
 #include <string>
@@ -48,6 +50,20 @@ public:
         UNKNOWN
     };
 
+    /**
+     * Read counters for an @c AudioStream, used to diagnose playback starvation.
+     */
+    struct ReadStatistics {
+        /// The total number of bytes returned by the stream.
+        uint64_t bytesRead = 0;
+
+        /// The total number of read requests made on the stream.
+        uint64_t readCount = 0;
+
+        /// The number of read requests that returned no data while the stream was still open.
+        uint64_t underrunCount = 0;
+    };
+
     virtual ~AudioStream();
 
     /**
@@ -61,6 +77,22 @@ public:
      */
     virtual ssize_t read(char* data, const size_t size) = 0;
 
+    /**
+     * Reads audio data from the stream, blocking until data is available, the stream is closed,
+     * or the @c timeout expires. As much data as is currently available, up to @c size bytes,
+     * is returned in a single call, so platforms are encouraged to provide large buffers.
+     *
+     * Platforms should prefer this method to calling @c read() and sleeping when no data is returned,
+     * since the stream implementation can wake the caller as soon as data arrives.
+     *
+     * @param [out] data The buffer where audio data should be copied
+     * @param [in] size The size of the buffer
+     * @param [in] timeout The maximum amount of time to wait for data
+     * @return The number of bytes read, 0 if the end of stream is reached or no data was available before
+     * the timeout expired, or -1 if an error occurred
+     */
+    virtual ssize_t readBlocking(char* data, const size_t size, std::chrono::milliseconds timeout);
+
     /**
      * Checks if the audio stream from the no more data available to read.
      *
@@ -101,6 +133,14 @@ public:
      * @return List of meta-data properties for the @c AudioStream.
      */
     virtual std::vector<AudioStreamProperty> getProperties();
+
+    /**
+     * Returns the read counters for the @c AudioStream. Streams that do not track reads
+     * return zero for all counters.
+     *
+     * @return @c ReadStatistics for the @c AudioStream.
+     */
+    virtual ReadStatistics getReadStatistics();
 };
 
 /**
@@ -0,0 +1,39 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_LOCATION_LOCATION_ENGINE_INTERFACES_H
+#define AACE_LOCATION_LOCATION_ENGINE_INTERFACES_H
+
+#include "Location.h"
+
+/** @file */
+
+namespace aace {
+namespace location {
+
+/**
+ * LocationProviderEngineInterface
+ */
+class LocationProviderEngineInterface {
+public:
+    virtual ~LocationProviderEngineInterface() = default;
+
+    virtual void onLocationChanged(const aace::location::Location& location) = 0;
+};
+
+}  // namespace location
+}  // namespace aace
+
+#endif  // AACE_LOCATION_LOCATION_ENGINE_INTERFACES_H
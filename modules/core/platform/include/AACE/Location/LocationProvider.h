@@ -18,10 +18,12 @@
 
 #include <string>
 #include <chrono>
+#include <memory>
 
 #include "AACE/Core/PlatformInterface.h"
 
 #include "Location.h"
+#include "LocationEngineInterfaces.h"
 
 /** @file */
 
@@ -52,6 +54,28 @@ public:
      * @return The current country
      */
     virtual std::string getCountry();
+
+    /**
+     * Notifies the Engine of a new geolocation of the device. The platform implementation may call this method
+     * whenever a new location fix is available, at the rate of the location source. The Engine serves location
+     * requests from the most recent fix while it is fresh, according to the 'aace.location.cache' configuration, and
+     * only calls @c getLocation() when no fresh fix is available.
+     *
+     * @param [in] location The new location
+     */
+    void locationChanged(const aace::location::Location& location);
+
+    /**
+     * @internal
+     * Sets the Engine interface delegate.
+     *
+     * Should *never* be called by the platform implementation.
+     */
+    void setEngineInterface(
+        std::shared_ptr<aace::location::LocationProviderEngineInterface> locationProviderEngineInterface);
+
+private:
+    std::weak_ptr<aace::location::LocationProviderEngineInterface> m_locationProviderEngineInterface;
 };
 
 }  // namespace location
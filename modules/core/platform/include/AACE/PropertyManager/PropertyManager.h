@@ -18,6 +18,9 @@
 
 #include <iostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include "AACE/Core/PlatformInterface.h"
 #include "PropertyManagerEngineInterface.h"
 
@@ -43,6 +46,7 @@ public:
     virtual ~PropertyManager();
 
     using PropertyState = aace::propertyManager::PropertyManagerEngineInterface::PropertyState;
+    using PropertyStateChange = aace::propertyManager::PropertyManagerEngineInterface::PropertyStateChange;
     /**
      * Sets a property value in the Engine. setProperty() is an asynchronous
      * operation and the Engine will call propertyStateChanged() with the status
@@ -85,6 +89,40 @@ public:
      */
     std::string getProperty(const std::string& name);
 
+    /**
+     * Sets several property values in the Engine as one operation.
+     * setProperties() is asynchronous. The Engine applies the properties in
+     * order and calls propertiesStateChanged() once with the status of every
+     * property when all of them are completed. Engine components that listen
+     * to more than one of the properties are notified of the changes once.
+     *
+     * @param [in] properties The names and settings of the properties. Every
+     *        name must be one of the property constants recognized by the
+     *        Engine and identify a property that can be set.
+     * @return @c true if the properties were accepted, else @c false if a
+     *         property name is not valid, in which case no property is set.
+     */
+    bool setProperties(const std::vector<std::pair<std::string, std::string>>& properties);
+
+    /**
+     * Notifies the platform implementation of the status of the property
+     * changes after a call to setProperties().
+     *
+     * The default implementation calls propertyStateChanged() for each property.
+     *
+     * @param [in] changes The name, value, and state of each property change.
+     */
+    virtual void propertiesStateChanged(const std::vector<PropertyStateChange>& changes);
+
+    /**
+     * Retrieves the settings for several properties from the Engine.
+     *
+     * @param [in] names The names used by the Engine to identify the properties.
+     * @return The property values by name. Names that are not valid are
+     *         omitted.
+     */
+    std::unordered_map<std::string, std::string> getProperties(const std::vector<std::string>& names);
+
     /**
      * Notifies the platform implementation of a property setting change in the
      * Engine.
@@ -96,6 +134,18 @@ public:
      */
     virtual void propertyChanged(const std::string& name, const std::string& newValue) = 0;
 
+    /**
+     * Notifies the platform implementation of several property setting
+     * changes in the Engine that were applied together.
+     * @note This will not be called if the property setting changes were
+     * initiated by @c PropertyManager::setProperties()
+     *
+     * The default implementation calls propertyChanged() for each property.
+     *
+     * @param [in] properties The new values of the properties by name.
+     */
+    virtual void propertiesChanged(const std::unordered_map<std::string, std::string>& properties);
+
     /**
      * @internal
      * Sets the Engine interface delagate
@@ -16,6 +16,11 @@
 #ifndef AACE_PROPERTY_MANAGER_PROPERTY_MANAGER_ENGINE_INTERFACE_H
 #define AACE_PROPERTY_MANAGER_PROPERTY_MANAGER_ENGINE_INTERFACE_H
 
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 /** @file */
 
 namespace aace {
@@ -39,8 +44,24 @@ public:
         FAILED,
 
     };
+
+    /**
+     * Describes the result of a property change in a call to
+     * @c PropertyManager::setProperties().
+     */
+    struct PropertyStateChange {
+        /// The name used by the Engine to identify the property
+        std::string name;
+        /// The property value
+        std::string value;
+        /// The state of the property change
+        PropertyState state;
+    };
+
     virtual bool onSetProperty(const std::string& name, const std::string& value) = 0;
     virtual std::string onGetProperty(const std::string& name) = 0;
+    virtual bool onSetProperties(const std::vector<std::pair<std::string, std::string>>& properties) = 0;
+    virtual std::unordered_map<std::string, std::string> onGetProperties(const std::vector<std::string>& names) = 0;
 };
 
 }  // namespace propertyManager
@@ -36,6 +36,12 @@ void AudioOutput::mediaError(MediaError error, const std::string& description) {
     }
 }
 
+void AudioOutput::mediaPositionChanged(int64_t position) {
+    if (auto m_audioOutputEngineInterface_lock = m_audioOutputEngineInterface.lock()) {
+        m_audioOutputEngineInterface_lock->onMediaPositionChanged(position);
+    }
+}
+
 void AudioOutput::setEngineInterface(
     std::shared_ptr<aace::audio::AudioOutputEngineInterface> audioOutputEngineInterface) {
     m_audioOutputEngineInterface = audioOutputEngineInterface;
@@ -13,13 +13,29 @@
  * permissions and limitations under the License.
  */
 
+#include <thread>
+
 #include <AACE/Audio/AudioStream.h>
 
 namespace aace {
 namespace audio {
 
+/// Interval used to poll streams that do not implement a native blocking read.
+static constexpr std::chrono::milliseconds BLOCKING_READ_POLL_INTERVAL(10);
+
 AudioStream::~AudioStream() = default;
 
+ssize_t AudioStream::readBlocking(char* data, const size_t size, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        ssize_t count = read(data, size);
+        if (count != 0 || isClosed() || std::chrono::steady_clock::now() >= deadline) {
+            return count;
+        }
+        std::this_thread::sleep_for(BLOCKING_READ_POLL_INTERVAL);
+    }
+}
+
 AudioStream::Encoding AudioStream::getEncoding() {
     return getAudioFormat().getEncoding();
 }
@@ -36,5 +52,9 @@ AudioStream::MediaType AudioStream::getMediaType() {
     return MediaType::UNKNOWN;
 }
 
+AudioStream::ReadStatistics AudioStream::getReadStatistics() {
+    return {};
+}
+
 }  // namespace audio
 }  // namespace aace
@@ -24,5 +24,16 @@ std::string LocationProvider::getCountry() {
     return "";
 }
 
+void LocationProvider::locationChanged(const aace::location::Location& location) {
+    if (auto locationProviderEngineInterface_lock = m_locationProviderEngineInterface.lock()) {
+        locationProviderEngineInterface_lock->onLocationChanged(location);
+    }
+}
+
+void LocationProvider::setEngineInterface(
+    std::shared_ptr<aace::location::LocationProviderEngineInterface> locationProviderEngineInterface) {
+    m_locationProviderEngineInterface = locationProviderEngineInterface;
+}
+
 }  // namespace location
 }  // namespace aace
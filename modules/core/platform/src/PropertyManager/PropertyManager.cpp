@@ -29,6 +29,28 @@ std::string PropertyManager::getProperty(const std::string& name) {
     return m_propertyManagerEngineInterface != nullptr ? m_propertyManagerEngineInterface->onGetProperty(name) : "";
 }
 
+bool PropertyManager::setProperties(const std::vector<std::pair<std::string, std::string>>& properties) {
+    return m_propertyManagerEngineInterface != nullptr ? m_propertyManagerEngineInterface->onSetProperties(properties)
+                                                       : false;
+}
+
+void PropertyManager::propertiesStateChanged(const std::vector<PropertyStateChange>& changes) {
+    for (const auto& change : changes) {
+        propertyStateChanged(change.name, change.value, change.state);
+    }
+}
+
+std::unordered_map<std::string, std::string> PropertyManager::getProperties(const std::vector<std::string>& names) {
+    return m_propertyManagerEngineInterface != nullptr ? m_propertyManagerEngineInterface->onGetProperties(names)
+                                                       : std::unordered_map<std::string, std::string>();
+}
+
+void PropertyManager::propertiesChanged(const std::unordered_map<std::string, std::string>& properties) {
+    for (const auto& property : properties) {
+        propertyChanged(property.first, property.second);
+    }
+}
+
 void PropertyManager::setEngineInterface(
     std::shared_ptr<PropertyManagerEngineInterface> propertyManagerEngineInterface) {
     m_propertyManagerEngineInterface = propertyManagerEngineInterface;
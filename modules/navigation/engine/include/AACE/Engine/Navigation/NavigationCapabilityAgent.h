@@ -28,6 +28,7 @@
 #include <AVSCommon/SDKInterfaces/MessageSenderInterface.h>
 
 #include "NavigationHandlerInterface.h"
+#include "NavigationStateCache.h"
 
 namespace aace {
 namespace engine {
@@ -44,7 +45,8 @@ public:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-        const std::string& navigationProviderName);
+        const std::string& navigationProviderName,
+        std::shared_ptr<NavigationStateCache> navigationStateCache = nullptr);
 
     /**
      * Destructor.
@@ -93,7 +95,8 @@ private:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
-        const std::string& navigationProviderName);
+        const std::string& navigationProviderName,
+        std::shared_ptr<NavigationStateCache> navigationStateCache);
 
     // @name RequiresShutdown Functions
     /// @{
@@ -169,6 +172,11 @@ private:
         const alexaClientSDK::avsCommon::avs::NamespaceAndName& stateProviderName,
         const unsigned int stateRequestToken);
 
+    /**
+     * Updates the navigation state cache from the platform, unless the platform pushes the navigation state
+     */
+    void refreshNavigationState();
+
     // Executor functions for navigation event handling
     void executeNavigationEvent(aace::navigation::NavigationEngineInterface::EventName event);
     void executeNavigationError(
@@ -190,11 +198,6 @@ private:
     void showPreviousWaypointsError(std::string code, std::string description);
     void navigateToPreviousWaypointError(std::string code, std::string description);
 
-    /**
-     * Check Navigation State for validity
-     */
-    bool isNavigationStateValid(std::string navigationState);
-
     /**
      * @name Executor Thread Variables
      *
@@ -204,6 +207,9 @@ private:
     /// @{
     /// A set of observers to be notified when a @c StartNavigation directive is received
     std::shared_ptr<NavigationHandlerInterface> m_navigationHandler;
+
+    /// The version of the navigation state last set in the context
+    uint64_t m_navigationStateVersion;
     /// @}
 
     /// Set of capability configurations that will get published using the Capabilities API
@@ -218,8 +224,8 @@ private:
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> m_messageSender;
 
-    /// The last known NavigationState payload
-    std::string m_navigationStatePayload;
+    /// The navigation state reported in the context
+    std::shared_ptr<NavigationStateCache> m_navigationStateCache;
 };
 
 }  // namespace navigation
@@ -23,6 +23,7 @@
 
 #include "NavigationCapabilityAgent.h"
 #include "NavigationHandlerInterface.h"
+#include "NavigationStateCache.h"
 #include "DisplayManagerCapabilityAgent.h"
 #include "NavigationAssistanceCapabilityAgent.h"
 
@@ -38,7 +39,8 @@ class NavigationEngineImpl
 private:
     NavigationEngineImpl(
         std::shared_ptr<aace::navigation::Navigation> navigationPlatformInterface,
-        const std::string& navigationProviderName);
+        const std::string& navigationProviderName,
+        std::shared_ptr<NavigationStateCache> navigationStateCache);
 
     bool initialize(
         std::shared_ptr<alexaClientSDK::endpoints::EndpointBuilder> defaultEndpointBuilder,
@@ -53,7 +55,8 @@ public:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-        const std::string& navigationProviderName);
+        const std::string& navigationProviderName,
+        size_t maxShapesInContext = 3000);
 
     // NavigationHandlerInterface
     void showPreviousWaypoints() override;
@@ -73,6 +76,10 @@ public:
         aace::navigation::NavigationEngineInterface::ErrorCode code,
         const std::string& description) override;
     void onShowAlternativeRoutesSucceeded(const std::string& payload) override;
+    void onNavigationStateChanged(NavigationState state) override;
+    void onWaypointsChanged(const std::string& waypoints) override;
+    void onRouteShapesAdded(const std::vector<Coordinate>& shapes) override;
+    void onRouteShapesRemoved(int count) override;
 
 protected:
     void doShutdown() override;
@@ -82,6 +89,7 @@ private:
     std::shared_ptr<NavigationCapabilityAgent> m_navigationCapabilityAgent;
     std::shared_ptr<displaymanager::DisplayManagerCapabilityAgent> m_displayManagerCapabilityAgent;
     std::shared_ptr<navigationassistance::NavigationAssistanceCapabilityAgent> m_navigationAssistanceCapabilityAgent;
+    std::shared_ptr<NavigationStateCache> m_navigationStateCache;
     //    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveSequencerInterface> m_directiveSequencer;
     const std::string& m_navigationProviderName;
 };
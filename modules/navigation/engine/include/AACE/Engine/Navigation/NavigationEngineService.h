@@ -33,8 +33,22 @@ private:
 public:
     virtual ~NavigationEngineService() = default;
 
+    /**
+     * Reads the navigation configuration from the "aace.navigation" subtree of the engine configuration, which
+     * the engine passes to the service. Values missing from the configuration are left unchanged.
+     *
+     * @param [in] configuration The "aace.navigation" subtree of the engine configuration.
+     * @param [in,out] providerName The name of the navigation provider.
+     * @param [in,out] maxShapesInContext The maximum number of route shape points reported in the context.
+     * @return @c true if the configuration is valid, else @c false.
+     */
+    static bool readConfiguration(
+        const rapidjson::Value& configuration,
+        std::string& providerName,
+        size_t& maxShapesInContext);
+
 protected:
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configureFromValue(const rapidjson::Value& configuration) override;
 
     bool shutdown() override;
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
@@ -54,6 +68,9 @@ private:
 
     // Capability meta data for provider name passed by platform config
     std::string m_navigationProviderName;
+
+    // Maximum number of route shape points reported in the NavigationState context
+    size_t m_maxShapesInContext;
 };
 
 }  // namespace navigation
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_CACHE_H
+#define AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <rapidjson/document.h>
+
+#include <AACE/Navigation/Navigation.h>
+
+namespace aace {
+namespace engine {
+namespace navigation {
+
+/**
+ * Holds the navigation state reported to AVS in the NavigationState context.
+ *
+ * The state is either pulled from the platform as a full JSON payload with @c update(), or pushed by the platform
+ * as deltas with @c setState(), @c setWaypoints(), @c addShapes() and @c removeShapes(). The route shapes are kept
+ * in full and decimated to the configured point budget when the context is serialized. The serialized context is
+ * reused until the state changes, and the version returned with it only changes when the state changes.
+ */
+class NavigationStateCache {
+public:
+    using NavigationState = aace::navigation::NavigationEngineInterface::NavigationState;
+    using Coordinate = aace::navigation::NavigationEngineInterface::Coordinate;
+
+    /**
+     * Creates a @c NavigationStateCache.
+     *
+     * @param [in] maxShapes The maximum number of route shape points reported in the context. Must be at least 2.
+     */
+    static std::shared_ptr<NavigationStateCache> create(size_t maxShapes);
+
+    /**
+     * Replaces the state with a full NavigationState JSON payload pulled from the platform. An empty payload
+     * resets the state to @c NOT_NAVIGATING with no waypoints or shapes.
+     *
+     * @return @c false if the payload is not a valid NavigationState, in which case the state is not changed
+     */
+    bool update(const std::string& navigationState);
+
+    void setState(NavigationState state);
+
+    /**
+     * Replaces the waypoints with a JSON array of waypoint objects.
+     *
+     * @return @c false if the waypoints are not valid, in which case the waypoints are not changed
+     */
+    bool setWaypoints(const std::string& waypoints);
+
+    /// Appends points to the end of the route shapes
+    void addShapes(const std::vector<Coordinate>& shapes);
+
+    /// Removes @c count points from the start of the route shapes, or all of the points if there are fewer
+    void removeShapes(size_t count);
+
+    /// @return @c true if the platform has pushed any part of the state
+    bool isPushed();
+
+    /**
+     * Returns the serialized NavigationState context.
+     *
+     * @param [out] version Set to the version of the state, which changes only when the state changes
+     */
+    std::string getContext(uint64_t& version);
+
+    /// @return The serialized waypoints array
+    std::string getWaypoints();
+
+    /// @return The serialized decimated route shapes array
+    std::string getShapes();
+
+    /// @return The serialized first waypoint, or an empty object if there are no waypoints
+    std::string getFirstWaypoint();
+
+    /**
+     * Selects at most @c maxPoints of @c shapes that best preserve the route geometry. The first and last points
+     * are always kept, and the remaining budget is spent on the points that deviate most from the simplified route.
+     *
+     * @return The indices of the selected points in ascending order
+     */
+    static std::vector<size_t> decimate(const std::vector<Coordinate>& shapes, size_t maxPoints);
+
+    /// @return The 64-bit FNV-1a hash of @c value
+    static uint64_t hash(const std::string& value);
+
+private:
+    NavigationStateCache(size_t maxShapes);
+
+    static bool validateWaypoints(rapidjson::Value& waypoints);
+    void serializeLocked();
+
+private:
+    size_t m_maxShapes;
+
+    NavigationState m_state;
+    rapidjson::Document m_waypoints;
+    uint64_t m_waypointsHash;
+    std::deque<Coordinate> m_shapes;
+    bool m_pushed;
+
+    /// Hash of the last payload passed to @c update(), so an unchanged payload is not parsed again
+    uint64_t m_updateHash;
+
+    uint64_t m_version;
+    uint64_t m_serializedVersion;
+    std::string m_context;
+    std::string m_serializedWaypoints;
+    std::string m_serializedShapes;
+
+    std::mutex m_mutex;
+};
+
+}  // namespace navigation
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_CACHE_H
@@ -61,26 +61,9 @@ static const std::string NAVIGATION_CAPABILITY_INTERFACE_VERSION = "2.0";
 /// Navigation interface provider name key
 static const std::string CAPABILITY_INTERFACE_NAVIGATION_PROVIDER_NAME_KEY = "provider";
 
-/// NavigationState state accepted values
-static const std::string NAVIGATION_STATE_NAVIGATING = "NAVIGATING";
-static const std::string NAVIGATION_STATE_NOT_NAVIGATING = "NOT_NAVIGATING";
-static const std::string NAVIGATION_STATE_UNKNOWN = "UNKNOWN";
-
-// Waypoint Type accepted values
-static const std::string WAYPOINT_TYPE_SOURCE = "SOURCE";
-static const std::string WAYPOINT_TYPE_INTERIM = "INTERIM";
-static const std::string WAYPOINT_TYPE_DESTINATION = "DESTINATION";
-
-/// Default when provided NavigationState is empty
 // clang-format off
-static const std::string DEFAULT_NAVIGATION_STATE_PAYLOAD = R"({
-	"state": ")" + NAVIGATION_STATE_NOT_NAVIGATING + R"(",
-	"waypoints": [],
-	"shapes": []
-})";
-
-//// max number of shapes allowable in context
-static const int MAXIMUM_SHAPES_IN_CONTEXT = 3000;
+/// The maximum number of route shape points in the NavigationState context when none is configured
+static const size_t DEFAULT_MAXIMUM_SHAPES_IN_CONTEXT = 3000;
 
 // Navigation Event Strings
 static const std::string START_NAVIGATION_SUCCESS = "StartNavigationSuccess";
@@ -98,7 +81,7 @@ static const std::string NAVIGATE_TO_PREVIOUS_WAYPOINT_ERROR = "NavigateToPrevio
 static std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityConfiguration> getNavigationCapabilityConfiguration( const std::string& navigationProviderName );
 
 std::shared_ptr<NavigationCapabilityAgent> NavigationCapabilityAgent::create( std::shared_ptr<NavigationHandlerInterface> navigationHandler, std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionSender, std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
-std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager, const std::string& navigationProviderName )
+std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager, const std::string& navigationProviderName, std::shared_ptr<NavigationStateCache> navigationStateCache )
 {
     try
     {
@@ -106,8 +89,13 @@ std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterfac
         ThrowIfNull( exceptionSender, "nullExceptionSender" );
         ThrowIfNull( messageSender, "nullMessageSender" );
         ThrowIfNull( contextManager, "nullContextManager" );
+
+        if( navigationStateCache == nullptr ) {
+            navigationStateCache = NavigationStateCache::create( DEFAULT_MAXIMUM_SHAPES_IN_CONTEXT );
+            ThrowIfNull( navigationStateCache, "createNavigationStateCacheFailed" );
+        }
         
-        auto navigationCapabilityAgent = std::shared_ptr<NavigationCapabilityAgent>( new NavigationCapabilityAgent( navigationHandler, exceptionSender, contextManager, messageSender, navigationProviderName ) );
+        auto navigationCapabilityAgent = std::shared_ptr<NavigationCapabilityAgent>( new NavigationCapabilityAgent( navigationHandler, exceptionSender, contextManager, messageSender, navigationProviderName, navigationStateCache ) );
 
         ThrowIfNull( navigationCapabilityAgent, "nullNavigationCapabilityAgent" );
 
@@ -175,12 +163,15 @@ NavigationCapabilityAgent::NavigationCapabilityAgent(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
-        const std::string& navigationProviderName ) :
+        const std::string& navigationProviderName,
+        std::shared_ptr<NavigationStateCache> navigationStateCache ) :
             alexaClientSDK::avsCommon::avs::CapabilityAgent{ NAMESPACE, exceptionSender },
             alexaClientSDK::avsCommon::utils::RequiresShutdown{"NavigationCapabilityAgent"},
             m_navigationHandler{ navigationHandler },
+            m_navigationStateVersion{ 0 },
             m_contextManager{ contextManager },
-            m_messageSender{ messageSender } {
+            m_messageSender{ messageSender },
+            m_navigationStateCache{ navigationStateCache } {
         m_capabilityConfigurations.insert( getNavigationCapabilityConfiguration( navigationProviderName ) );
 }
 
@@ -325,23 +316,15 @@ void NavigationCapabilityAgent::executeProvideState( const alexaClientSDK::avsCo
     try
     {
         ThrowIfNull( m_contextManager, "contextManagerIsNull" );
-        bool payloadChanged = false; 
-        std::string payload;
-
-        payload = m_navigationHandler->getNavigationState();
+        refreshNavigationState();
 
-        if( payload.empty() && m_navigationStatePayload.compare(DEFAULT_NAVIGATION_STATE_PAYLOAD) != 0 ) {
-            payload = DEFAULT_NAVIGATION_STATE_PAYLOAD;
-            payloadChanged = true;
-        } else if ( !payload.empty() && payload.compare( m_navigationStatePayload ) != 0 ){
-            payloadChanged = true;
-        }
+        uint64_t version = 0;
+        std::string payload = m_navigationStateCache->getContext( version );
 
-        if( payloadChanged ) {
-            if ( isNavigationStateValid( payload )  ) {
-                // set the context NavigationState
-                ThrowIf( m_contextManager->setState( NAVIGATION_STATE, m_navigationStatePayload, alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateFailed" );
-            }
+        if( version != m_navigationStateVersion ) {
+            // set the context NavigationState
+            ThrowIf( m_contextManager->setState( NAVIGATION_STATE, payload, alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateFailed" );
+            m_navigationStateVersion = version;
         } else {
             // send empty if no change
             ThrowIf( m_contextManager->setState( NAVIGATION_STATE, "", alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateEmptyPayloadFailed" );
@@ -352,6 +335,14 @@ void NavigationCapabilityAgent::executeProvideState( const alexaClientSDK::avsCo
     }
 }
 
+void NavigationCapabilityAgent::refreshNavigationState()
+{
+    // a platform that pushes the navigation state keeps the cache up to date
+    if( !m_navigationStateCache->isPushed() ) {
+        m_navigationStateCache->update( m_navigationHandler->getNavigationState() );
+    }
+}
+
 void NavigationCapabilityAgent::executeNavigationEvent( aace::navigation::NavigationEngineInterface::EventName event )
 {
     switch( event ){
@@ -423,34 +414,10 @@ std::string NavigationCapabilityAgent::getWaypointErrorCode( aace::navigation::N
 //
     
 void NavigationCapabilityAgent::startNavigationSuccess() {
-    std::string navigationState;
-    navigationState = m_navigationHandler->getNavigationState();
-    rapidjson::Document context( rapidjson::kObjectType );
-    rapidjson::Document payload( rapidjson::kObjectType );
-    rapidjson::Document::AllocatorType& allocator = payload.GetAllocator();
-    
-    context.Parse( navigationState.c_str() );
-
-    rapidjson::Document waypointsArray( rapidjson::kArrayType );
-    if ( context.HasMember( "waypoints" ) ) {
-        for (auto &point : context["waypoints"].GetArray()) {
-            waypointsArray.PushBack(point, allocator);
-        }
-    }
-    payload.AddMember( "waypoints", waypointsArray, allocator );
-
-    rapidjson::Document shapesArray( rapidjson::kArrayType );
-    if ( context.HasMember( "shapes" ) ) {
-        for ( auto& point : context["shapes"].GetArray() ) {
-            shapesArray.PushBack( point, allocator );
-        }
-    }
-    payload.AddMember( "shapes", shapesArray, allocator );
+    refreshNavigationState();
+    std::string payload = "{\"waypoints\":" + m_navigationStateCache->getWaypoints() + ",\"shapes\":" + m_navigationStateCache->getShapes() + "}";
 
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer( buffer );
-    ThrowIfNot(payload.Accept( writer ), "failedToWriteJsonDocument" );
-    auto navEvent = buildJsonEventString( START_NAVIGATION_SUCCESS, "", buffer.GetString() );
+    auto navEvent = buildJsonEventString( START_NAVIGATION_SUCCESS, "", payload );
     auto request = std::make_shared<alexaClientSDK::avsCommon::avs::MessageRequest>( navEvent.second );
     m_messageSender->sendMessage( request );
 }
@@ -469,26 +436,10 @@ void NavigationCapabilityAgent::showPreviousWaypointsSuccess()
 
 void NavigationCapabilityAgent::navigateToPreviousWaypointSuccess()
 {
-    std::string navigationState;
-    navigationState = m_navigationHandler->getNavigationState();
-    rapidjson::Document context( rapidjson::kObjectType );
-    rapidjson::Document payload( rapidjson::kObjectType );
-    rapidjson::Document::AllocatorType& allocator = payload.GetAllocator();
-
-    context.Parse( navigationState.c_str() );
+    refreshNavigationState();
+    std::string payload = "{\"waypoint\":" + m_navigationStateCache->getFirstWaypoint() + "}";
 
-    rapidjson::Document waypointObject( rapidjson::kObjectType );
-    if ( context.HasMember( "waypoints" ) && context["waypoints"].GetArray().Size() > 0 ) {
-        payload.AddMember( "waypoint", context["waypoints"].GetArray()[0].GetObject(), allocator );
-    } else {
-        payload.AddMember( "waypoint", waypointObject, allocator );
-    }
-
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer( buffer );
-    ThrowIfNot(payload.Accept( writer ), "failedToWriteJsonDocument" );
-
-    auto navEvent = buildJsonEventString( NAVIGATE_TO_PREVIOUS_WAYPOINTS_SUCCESS, "", buffer.GetString() );
+    auto navEvent = buildJsonEventString( NAVIGATE_TO_PREVIOUS_WAYPOINTS_SUCCESS, "", payload );
     auto request = std::make_shared<alexaClientSDK::avsCommon::avs::MessageRequest>( navEvent.second );
     m_messageSender->sendMessage( request );
 }
@@ -550,122 +501,6 @@ void NavigationCapabilityAgent::showPreviousWaypointsError( std::string code, st
     m_messageSender->sendMessage( request );
 }
 
-bool NavigationCapabilityAgent::isNavigationStateValid( std::string navigationState )
-{
-    AACE_VERBOSE(LX(TAG).d("navigationState",navigationState));
-    try
-    {
-        rapidjson::Document document;
-        document.Parse<0>( navigationState.c_str() );
-        
-        if( document.HasParseError() ) {
-            rapidjson::ParseErrorCode ok = document.GetParseError();
-            AACE_ERROR(LX(TAG).d( "HasParseError", GetParseError_En(ok) ) );
-            Throw( "parseError" );
-        }
-        
-        ThrowIfNot( document.HasMember("state"), "stateKeyMissing");
-        
-        if( document[ "state" ].IsNull() || !document[ "state" ].IsString() ) {
-            Throw( "stateNotValid" );
-        }
-        std::string state = document[ "state" ].GetString();
-        if( ( state.compare(NAVIGATION_STATE_NAVIGATING) != 0 )
-           && ( state.compare(NAVIGATION_STATE_NOT_NAVIGATING) != 0 )
-           && ( state.compare(NAVIGATION_STATE_UNKNOWN) != 0 ) ) {
-            Throw( "stateValueNotValid" );
-        }
-        if ( document.HasMember("waypoints") ) {
-            if( !document[ "waypoints" ].IsArray() ) {
-                Throw( "waypointsArrayNotValid" );
-            }
-            
-            auto waypoints = document["waypoints"].GetArray();
-            for ( int i = 0; i < waypoints.Size() ; i++ ) {
-                auto waypoint  = waypoints[i].GetObject();
-                ThrowIfNot( waypoint.HasMember("type"), "waypointTypeMissing");
-                
-                std::string waypointType = waypoint["type"].GetString();
-                if( waypoint[ "type" ].IsNull() || !waypoint[ "type" ].IsString() ) {
-                    Throw( "waypointTypeNotValid" );
-                }
-                if( ( waypointType.compare(WAYPOINT_TYPE_SOURCE) != 0 ) &&
-                    ( waypointType.compare(WAYPOINT_TYPE_INTERIM) != 0 ) &&
-                    ( waypointType.compare(WAYPOINT_TYPE_DESTINATION) != 0 ) ) {
-                    Throw( "waypointTypeValueNotValid" );
-                }
-                if ( waypoint.HasMember("estimatedTimeOfArrival") ) {
-                    auto estimatedTimeOfArrival = waypoint["estimatedTimeOfArrival"].GetObject();
-                    ThrowIfNot( estimatedTimeOfArrival.HasMember("predicted"), "predictedTimeOfArrivalMissing");
-                    if ( ( estimatedTimeOfArrival.HasMember("ideal") && !estimatedTimeOfArrival["ideal"].IsString() ) ||
-                         ( estimatedTimeOfArrival.HasMember("predicted") && !estimatedTimeOfArrival["predicted"].IsString() ) ) {
-                        
-                        Throw( "estimatedTimeOfArrivalNotString" );
-                    }
-                }
-                if ( waypoint.HasMember("address") ) {
-                    auto address = waypoint["address"].GetObject();
-                    if ( ( address.HasMember("addressLine1") && !address["addressLine1"].IsString() ) ||
-                         ( address.HasMember("addressLine2") && !address["addressLine2"].IsString() ) ||
-                         ( address.HasMember("addressLine3") && !address["addressLine3"].IsString() ) ||
-                         ( address.HasMember("city") && !address["city"].IsString() ) ||
-                         ( address.HasMember("stateOrRegion") && !address["stateOrRegion"].IsString() ) ||
-                         ( address.HasMember("countryCode") && !address["countryCode"].IsString() ) ||
-                         ( address.HasMember("districtOrCounty") && !address["districtOrCounty"].IsString() ) ||
-                         ( address.HasMember("postalCode") && !address["postalCode"].IsString() )
-                    ) {
-                        Throw( "AddressNotString" );
-                    }
-                }
-                if ( waypoint.HasMember("name") ) {
-                    if ( waypoint[ "name" ].IsNull() || !waypoint[ "name" ].IsString() ) {
-                        Throw( "waypointNameNotValid" );
-                    }
-                }
-                
-                ThrowIfNot( waypoint.HasMember("coordinate"), "waypointcoordinateMissing");
-                auto coordinate = waypoint["coordinate"].GetArray();
-                if ( coordinate[0].IsNull() ) {
-                    Throw( "LatitudeNotValid" );
-                }
-                if ( coordinate[1].IsNull() ) {
-                    Throw( "LongitudeNotValid" );
-                }
-                if ( waypoint.HasMember("pointOfInterest") ) {
-                    auto poi = waypoint["pointOfInterest"].GetObject();
-                    if ( !poi.HasMember("id") && !poi.HasMember("name") && !poi.HasMember("phoneNumber") ) {
-                        waypoint.EraseMember("pointOfInterest");
-                    }
-                }
-            }
-        }
-        ThrowIfNot( document.HasMember("shapes"), "shapesKeyMissing" );
-
-        if( !document[ "shapes" ].IsArray() ) {
-            Throw( "shapesArrayNotValid" );
-        }
-        if ( document[ "waypoints" ].Size() != 0 && document[ "shapes" ].Size() < 2 ) {
-            AACE_WARN(LX(TAG).d("shapes","Shapes should not be less than 2 for local POI"));
-        }
-
-        if( document[ "shapes" ].Size() > MAXIMUM_SHAPES_IN_CONTEXT ) {
-            AACE_WARN(LX(TAG, "isNavigationStateValid").d("shapes", "Too many shapes in payload. Only using first 3000."));
-            ThrowIfNot( document[ "shapes" ].Erase(document[ "shapes" ].Begin() + MAXIMUM_SHAPES_IN_CONTEXT, document[ "shapes" ].End()), "unable to operate on shapes Array" );
-        }
-        rapidjson::StringBuffer buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer( buffer );
-        document.Accept( writer );
-        navigationState = buffer.GetString();
-        
-        // set current navigation state payload
-        m_navigationStatePayload = navigationState;
-        return true;
-    } catch( std::exception& ex ) {
-        AACE_ERROR(LX(TAG).d("reason",ex.what() ));
-        return false;
-    }
-}
-
 std::unordered_set<std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityConfiguration>> NavigationCapabilityAgent::getCapabilityConfigurations() {
     return m_capabilityConfigurations;
 }
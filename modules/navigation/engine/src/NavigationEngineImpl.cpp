@@ -30,9 +30,11 @@ static const std::string TAG("aace.navigation.NavigationEngineImpl");
 
 NavigationEngineImpl::NavigationEngineImpl(
     std::shared_ptr<aace::navigation::Navigation> navigationPlatformInterface,
-    const std::string& navigationProviderName) :
+    const std::string& navigationProviderName,
+    std::shared_ptr<NavigationStateCache> navigationStateCache) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
         m_navigationPlatformInterface(navigationPlatformInterface),
+        m_navigationStateCache(navigationStateCache),
         m_navigationProviderName{navigationProviderName} {
 }
 
@@ -43,7 +45,12 @@ bool NavigationEngineImpl::initialize(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager) {
     try {
         m_navigationCapabilityAgent = NavigationCapabilityAgent::create(
-            shared_from_this(), exceptionSender, messageSender, contextManager, m_navigationProviderName);
+            shared_from_this(),
+            exceptionSender,
+            messageSender,
+            contextManager,
+            m_navigationProviderName,
+            m_navigationStateCache);
         ThrowIfNull(m_navigationCapabilityAgent, "couldNotCreateNavigationCapabilityAgent");
 
         m_navigationAssistanceCapabilityAgent = navigationassistance::NavigationAssistanceCapabilityAgent::create(
@@ -73,15 +80,19 @@ std::shared_ptr<NavigationEngineImpl> NavigationEngineImpl::create(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionSender,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-    const std::string& navigationProviderName) {
+    const std::string& navigationProviderName,
+    size_t maxShapesInContext) {
     try {
         ThrowIfNull(navigationPlatformInterface, "nullNavigationPlatformInterface");
         ThrowIfNull(defaultEndpointBuilder, "nullDefaultEndpointBuilder");
         ThrowIfNull(exceptionSender, "nullPlatformInterface");
         ThrowIfNull(contextManager, "nullNavigationContextManager");
 
+        auto navigationStateCache = NavigationStateCache::create(maxShapesInContext);
+        ThrowIfNull(navigationStateCache, "createNavigationStateCacheFailed");
+
         std::shared_ptr<NavigationEngineImpl> navigationEngineImpl = std::shared_ptr<NavigationEngineImpl>(
-            new NavigationEngineImpl(navigationPlatformInterface, navigationProviderName));
+            new NavigationEngineImpl(navigationPlatformInterface, navigationProviderName, navigationStateCache));
 
         ThrowIfNot(
             navigationEngineImpl->initialize(defaultEndpointBuilder, exceptionSender, messageSender, contextManager),
@@ -244,6 +255,26 @@ void NavigationEngineImpl::onShowAlternativeRoutesSucceeded(const std::string& p
     m_displayManagerCapabilityAgent->showAlternativeRoutesSucceeded(payload);
 }
 
+void NavigationEngineImpl::onNavigationStateChanged(NavigationState state) {
+    m_navigationStateCache->setState(state);
+}
+
+void NavigationEngineImpl::onWaypointsChanged(const std::string& waypoints) {
+    if (!m_navigationStateCache->setWaypoints(waypoints)) {
+        AACE_WARN(LX(TAG, "onWaypointsChanged").d("reason", "invalidWaypoints"));
+    }
+}
+
+void NavigationEngineImpl::onRouteShapesAdded(const std::vector<Coordinate>& shapes) {
+    m_navigationStateCache->addShapes(shapes);
+}
+
+void NavigationEngineImpl::onRouteShapesRemoved(int count) {
+    if (count > 0) {
+        m_navigationStateCache->removeShapes(static_cast<size_t>(count));
+    }
+}
+
 }  // namespace navigation
 }  // namespace engine
 }  // namespace aace
@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <typeinfo>
 
 #include "AACE/Engine/Navigation/NavigationEngineService.h"
@@ -22,8 +23,6 @@
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
-#include <rapidjson/error/en.h>
-#include <rapidjson/istreamwrapper.h>
 
 namespace aace {
 namespace engine {
@@ -32,35 +31,46 @@ namespace navigation {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.navigation.NavigationEngineService");
 
+/// The maximum number of route shape points AVS accepts in the NavigationState context
+static const size_t MAXIMUM_SHAPES_IN_CONTEXT = 3000;
+
 // register the service
 REGISTER_SERVICE(NavigationEngineService);
 
 NavigationEngineService::NavigationEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description) {
+        aace::engine::core::EngineService(description),
+        m_maxShapesInContext(MAXIMUM_SHAPES_IN_CONTEXT) {
 }
 
-bool NavigationEngineService::configure(std::shared_ptr<std::istream> configuration) {
-    try {
-        rapidjson::IStreamWrapper isw(*configuration);
-        rapidjson::Document document;
+bool NavigationEngineService::configureFromValue(const rapidjson::Value& configuration) {
+    return readConfiguration(configuration, m_navigationProviderName, m_maxShapesInContext);
+}
 
-        document.ParseStream(isw);
+bool NavigationEngineService::readConfiguration(
+    const rapidjson::Value& configuration,
+    std::string& providerName,
+    size_t& maxShapesInContext) {
+    try {
+        ThrowIfNot(configuration.IsObject(), "invalidConfiguration");
 
-        ThrowIf(document.HasParseError(), GetParseError_En(document.GetParseError()));
-        ThrowIfNot(document.IsObject(), "invalidConfigurationStream");
+        auto navigation = configuration.GetObject();
 
-        auto root = document.GetObject();
+        if (navigation.HasMember("providerName") && navigation["providerName"].IsString()) {
+            providerName = navigation["providerName"].GetString();
+        }
 
-        if (root.HasMember("aace.navigation") && root["aace.navigation"].IsObject()) {
-            auto navigation = root["aace.navigation"].GetObject();
+        if (navigation.HasMember("navigationState") && navigation["navigationState"].IsObject()) {
+            auto navigationState = navigation["navigationState"].GetObject();
 
-            if (navigation.HasMember("providerName") && navigation["providerName"].IsString()) {
-                m_navigationProviderName = navigation["providerName"].GetString();
+            if (navigationState.HasMember("maxShapes") && navigationState["maxShapes"].IsUint()) {
+                size_t maxShapes = navigationState["maxShapes"].GetUint();
+                ThrowIf(maxShapes < 2, "invalidMaxShapes");
+                maxShapesInContext = std::min(maxShapes, MAXIMUM_SHAPES_IN_CONTEXT);
             }
         }
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "configure").d("reason", ex.what()));
+        AACE_ERROR(LX(TAG, "readConfiguration").d("reason", ex.what()));
         return false;
     }
 }
@@ -111,7 +121,8 @@ bool NavigationEngineService::registerPlatformInterfaceType(std::shared_ptr<aace
             exceptionSender,
             messageSender,
             contextManager,
-            m_navigationProviderName);
+            m_navigationProviderName,
+            m_maxShapesInContext);
         ThrowIfNull(m_navigationEngineImpl, "createNavigationEngineImplFailed");
 
         return true;
@@ -0,0 +1,443 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+#include <rapidjson/error/en.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "AACE/Engine/Navigation/NavigationStateCache.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace navigation {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.navigation.NavigationStateCache");
+
+/// NavigationState state accepted values
+static const std::string NAVIGATION_STATE_NAVIGATING = "NAVIGATING";
+static const std::string NAVIGATION_STATE_NOT_NAVIGATING = "NOT_NAVIGATING";
+static const std::string NAVIGATION_STATE_UNKNOWN = "UNKNOWN";
+
+// Waypoint Type accepted values
+static const std::string WAYPOINT_TYPE_SOURCE = "SOURCE";
+static const std::string WAYPOINT_TYPE_INTERIM = "INTERIM";
+static const std::string WAYPOINT_TYPE_DESTINATION = "DESTINATION";
+
+/// Waypoint address fields, which must be strings when present
+static const char* ADDRESS_FIELDS[] = {"addressLine1",
+                                       "addressLine2",
+                                       "addressLine3",
+                                       "city",
+                                       "stateOrRegion",
+                                       "countryCode",
+                                       "districtOrCounty",
+                                       "postalCode"};
+
+/// Decimal places of the serialized route shape coordinates, about 1 meter at the equator
+static const int SHAPE_COORDINATE_DECIMAL_PLACES = 5;
+
+/// 64-bit FNV-1a parameters
+static const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+static const uint64_t FNV_PRIME = 1099511628211ULL;
+
+static const double PI = 3.14159265358979323846;
+
+static std::string toString(NavigationStateCache::NavigationState state) {
+    switch (state) {
+        case NavigationStateCache::NavigationState::NAVIGATING:
+            return NAVIGATION_STATE_NAVIGATING;
+        case NavigationStateCache::NavigationState::NOT_NAVIGATING:
+            return NAVIGATION_STATE_NOT_NAVIGATING;
+        case NavigationStateCache::NavigationState::UNKNOWN:
+            return NAVIGATION_STATE_UNKNOWN;
+    }
+    return NAVIGATION_STATE_UNKNOWN;
+}
+
+static bool fromString(const std::string& value, NavigationStateCache::NavigationState& state) {
+    if (value == NAVIGATION_STATE_NAVIGATING) {
+        state = NavigationStateCache::NavigationState::NAVIGATING;
+    } else if (value == NAVIGATION_STATE_NOT_NAVIGATING) {
+        state = NavigationStateCache::NavigationState::NOT_NAVIGATING;
+    } else if (value == NAVIGATION_STATE_UNKNOWN) {
+        state = NavigationStateCache::NavigationState::UNKNOWN;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/// Coordinates may be numbers or numeric strings
+static double getCoordinateValue(const rapidjson::Value& value) {
+    if (value.IsNumber()) {
+        return value.GetDouble();
+    }
+    ThrowIfNot(value.IsString(), "shapeCoordinateNotValid");
+    return std::stod(value.GetString());
+}
+
+static std::string serialize(const rapidjson::Value& value) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    ThrowIfNot(value.Accept(writer), "failedToWriteJsonDocument");
+    return buffer.GetString();
+}
+
+NavigationStateCache::NavigationStateCache(size_t maxShapes) :
+        m_maxShapes(maxShapes),
+        m_state(NavigationState::NOT_NAVIGATING),
+        m_waypoints(rapidjson::kArrayType),
+        m_waypointsHash(hash("[]")),
+        m_pushed(false),
+        m_updateHash(hash("")),
+        m_version(1),
+        m_serializedVersion(0) {
+}
+
+std::shared_ptr<NavigationStateCache> NavigationStateCache::create(size_t maxShapes) {
+    try {
+        ThrowIf(maxShapes < 2, "invalidMaxShapes");
+        return std::shared_ptr<NavigationStateCache>(new NavigationStateCache(maxShapes));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "create").d("reason", ex.what()).d("maxShapes", maxShapes));
+        return nullptr;
+    }
+}
+
+bool NavigationStateCache::update(const std::string& navigationState) {
+    try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // the platform usually returns the same payload until the route changes, so skip parsing it again
+        auto payloadHash = hash(navigationState);
+        ReturnIf(payloadHash == m_updateHash, true);
+
+        NavigationState state = NavigationState::NOT_NAVIGATING;
+        rapidjson::Document waypoints(rapidjson::kArrayType);
+        std::deque<Coordinate> shapes;
+
+        if (!navigationState.empty()) {
+            rapidjson::Document document;
+            rapidjson::ParseResult result = document.Parse(navigationState.c_str());
+            if (!result) {
+                AACE_ERROR(LX(TAG, "update").d("reason", rapidjson::GetParseError_En(result.Code())));
+                Throw("parseError");
+            }
+            ThrowIfNot(document.IsObject(), "navigationStateNotValid");
+            ThrowIfNot(document.HasMember("state"), "stateKeyMissing");
+            ThrowIfNot(document["state"].IsString(), "stateNotValid");
+            ThrowIfNot(fromString(document["state"].GetString(), state), "stateValueNotValid");
+
+            if (document.HasMember("waypoints")) {
+                ThrowIfNot(document["waypoints"].IsArray(), "waypointsArrayNotValid");
+                ThrowIfNot(validateWaypoints(document["waypoints"]), "waypointsNotValid");
+                waypoints.CopyFrom(document["waypoints"], waypoints.GetAllocator());
+            }
+
+            ThrowIfNot(document.HasMember("shapes"), "shapesKeyMissing");
+            ThrowIfNot(document["shapes"].IsArray(), "shapesArrayNotValid");
+            for (auto& shape : document["shapes"].GetArray()) {
+                ThrowIfNot(shape.IsArray() && shape.Size() >= 2, "shapeNotValid");
+                shapes.push_back({getCoordinateValue(shape[0u]), getCoordinateValue(shape[1u])});
+            }
+            if (waypoints.Size() != 0 && shapes.size() < 2) {
+                AACE_WARN(LX(TAG, "update").d("shapes", "Shapes should not be less than 2 for local POI"));
+            }
+        }
+
+        m_state = state;
+        m_waypoints.Swap(waypoints);
+        m_waypointsHash = 0;
+        m_shapes.swap(shapes);
+        m_updateHash = payloadHash;
+        m_version++;
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "update").d("reason", ex.what()));
+        return false;
+    }
+}
+
+void NavigationStateCache::setState(NavigationState state) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pushed = true;
+    if (state != m_state) {
+        m_state = state;
+        m_version++;
+    }
+}
+
+bool NavigationStateCache::setWaypoints(const std::string& waypoints) {
+    try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pushed = true;
+
+        auto waypointsHash = hash(waypoints);
+        ReturnIf(waypointsHash == m_waypointsHash, true);
+
+        rapidjson::Document document;
+        rapidjson::ParseResult result = document.Parse(waypoints.c_str());
+        if (!result) {
+            AACE_ERROR(LX(TAG, "setWaypoints").d("reason", rapidjson::GetParseError_En(result.Code())));
+            Throw("parseError");
+        }
+        ThrowIfNot(document.IsArray(), "waypointsArrayNotValid");
+        ThrowIfNot(validateWaypoints(document), "waypointsNotValid");
+
+        m_waypoints.Swap(document);
+        m_waypointsHash = waypointsHash;
+        m_version++;
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "setWaypoints").d("reason", ex.what()));
+        return false;
+    }
+}
+
+void NavigationStateCache::addShapes(const std::vector<Coordinate>& shapes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pushed = true;
+    if (!shapes.empty()) {
+        m_shapes.insert(m_shapes.end(), shapes.begin(), shapes.end());
+        m_version++;
+    }
+}
+
+void NavigationStateCache::removeShapes(size_t count) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pushed = true;
+    count = std::min(count, m_shapes.size());
+    if (count > 0) {
+        m_shapes.erase(m_shapes.begin(), m_shapes.begin() + count);
+        m_version++;
+    }
+}
+
+bool NavigationStateCache::isPushed() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pushed;
+}
+
+std::string NavigationStateCache::getContext(uint64_t& version) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    serializeLocked();
+    version = m_version;
+    return m_context;
+}
+
+std::string NavigationStateCache::getWaypoints() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    serializeLocked();
+    return m_serializedWaypoints;
+}
+
+std::string NavigationStateCache::getShapes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    serializeLocked();
+    return m_serializedShapes;
+}
+
+std::string NavigationStateCache::getFirstWaypoint() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_waypoints.Empty() ? "{}" : serialize(m_waypoints[0u]);
+}
+
+void NavigationStateCache::serializeLocked() {
+    if (m_serializedVersion == m_version) {
+        return;
+    }
+
+    m_serializedWaypoints = serialize(m_waypoints);
+
+    std::vector<Coordinate> shapes(m_shapes.begin(), m_shapes.end());
+    std::vector<size_t> indices = decimate(shapes, m_maxShapes);
+    if (indices.size() < shapes.size()) {
+        AACE_DEBUG(LX(TAG, "serializeLocked").d("shapes", shapes.size()).d("decimatedShapes", indices.size()));
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.SetMaxDecimalPlaces(SHAPE_COORDINATE_DECIMAL_PLACES);
+    writer.StartArray();
+    for (auto index : indices) {
+        writer.StartArray();
+        writer.Double(shapes[index].latitude);
+        writer.Double(shapes[index].longitude);
+        writer.EndArray();
+    }
+    writer.EndArray();
+    m_serializedShapes = buffer.GetString();
+
+    m_context = "{\"state\":\"" + toString(m_state) + "\",\"waypoints\":" + m_serializedWaypoints +
+                ",\"shapes\":" + m_serializedShapes + "}";
+    m_serializedVersion = m_version;
+}
+
+bool NavigationStateCache::validateWaypoints(rapidjson::Value& waypoints) {
+    try {
+        for (auto& waypoint : waypoints.GetArray()) {
+            ThrowIfNot(waypoint.IsObject(), "waypointNotValid");
+            ThrowIfNot(waypoint.HasMember("type"), "waypointTypeMissing");
+            ThrowIfNot(waypoint["type"].IsString(), "waypointTypeNotValid");
+
+            std::string waypointType = waypoint["type"].GetString();
+            if (waypointType != WAYPOINT_TYPE_SOURCE && waypointType != WAYPOINT_TYPE_INTERIM &&
+                waypointType != WAYPOINT_TYPE_DESTINATION) {
+                Throw("waypointTypeValueNotValid");
+            }
+            if (waypoint.HasMember("estimatedTimeOfArrival")) {
+                auto& estimatedTimeOfArrival = waypoint["estimatedTimeOfArrival"];
+                ThrowIfNot(estimatedTimeOfArrival.IsObject(), "estimatedTimeOfArrivalNotValid");
+                ThrowIfNot(estimatedTimeOfArrival.HasMember("predicted"), "predictedTimeOfArrivalMissing");
+                if ((estimatedTimeOfArrival.HasMember("ideal") && !estimatedTimeOfArrival["ideal"].IsString()) ||
+                    !estimatedTimeOfArrival["predicted"].IsString()) {
+                    Throw("estimatedTimeOfArrivalNotString");
+                }
+            }
+            if (waypoint.HasMember("address")) {
+                auto& address = waypoint["address"];
+                ThrowIfNot(address.IsObject(), "addressNotValid");
+                for (auto field : ADDRESS_FIELDS) {
+                    if (address.HasMember(field) && !address[field].IsString()) {
+                        Throw("AddressNotString");
+                    }
+                }
+            }
+            if (waypoint.HasMember("name")) {
+                ThrowIfNot(waypoint["name"].IsString(), "waypointNameNotValid");
+            }
+
+            ThrowIfNot(waypoint.HasMember("coordinate"), "waypointcoordinateMissing");
+            auto& coordinate = waypoint["coordinate"];
+            ThrowIfNot(coordinate.IsArray() && coordinate.Size() >= 2, "coordinateNotValid");
+            ThrowIf(coordinate[0].IsNull(), "LatitudeNotValid");
+            ThrowIf(coordinate[1].IsNull(), "LongitudeNotValid");
+
+            if (waypoint.HasMember("pointOfInterest")) {
+                auto& poi = waypoint["pointOfInterest"];
+                if (!poi.IsObject() ||
+                    (!poi.HasMember("id") && !poi.HasMember("name") && !poi.HasMember("phoneNumber"))) {
+                    waypoint.EraseMember("pointOfInterest");
+                }
+            }
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "validateWaypoints").d("reason", ex.what()));
+        return false;
+    }
+}
+
+std::vector<size_t> NavigationStateCache::decimate(const std::vector<Coordinate>& shapes, size_t maxPoints) {
+    size_t count = shapes.size();
+    std::vector<size_t> indices;
+    if (count <= std::max<size_t>(maxPoints, 2)) {
+        for (size_t i = 0; i < count; i++) {
+            indices.push_back(i);
+        }
+        return indices;
+    }
+
+    // project the coordinates onto a plane scaled for the mean latitude of the route, which is accurate enough to
+    // compare the deviation of points from the route
+    double latitudeSum = 0;
+    for (auto& shape : shapes) {
+        latitudeSum += shape.latitude;
+    }
+    double longitudeScale = std::cos(latitudeSum / count * PI / 180);
+
+    // the squared distance of a point from the segment between two other points
+    auto distance = [&shapes, longitudeScale](size_t point, size_t first, size_t last) {
+        double px = shapes[point].longitude * longitudeScale, py = shapes[point].latitude;
+        double ax = shapes[first].longitude * longitudeScale, ay = shapes[first].latitude;
+        double bx = shapes[last].longitude * longitudeScale, by = shapes[last].latitude;
+        double dx = bx - ax, dy = by - ay;
+        double lengthSquared = dx * dx + dy * dy;
+        double t = lengthSquared > 0 ? std::max(0.0, std::min(1.0, ((px - ax) * dx + (py - ay) * dy) / lengthSquared))
+                                     : 0.0;
+        double ex = ax + t * dx - px, ey = ay + t * dy - py;
+        return ex * ex + ey * ey;
+    };
+
+    // a route segment with the point farthest from it
+    struct Segment {
+        size_t first;
+        size_t last;
+        size_t farthest;
+        double distance;
+
+        bool operator<(const Segment& other) const {
+            return distance < other.distance;
+        }
+    };
+
+    std::priority_queue<Segment> segments;
+    auto split = [&segments, &distance](size_t first, size_t last) {
+        Segment segment{first, last, first, 0};
+        for (size_t i = first + 1; i < last; i++) {
+            double d = distance(i, first, last);
+            if (d > segment.distance) {
+                segment.farthest = i;
+                segment.distance = d;
+            }
+        }
+        // points on the segment add nothing to the route geometry
+        if (segment.distance > 0) {
+            segments.push(segment);
+        }
+    };
+
+    // keep the ends of the route, then repeatedly keep the point that deviates most from the simplified route
+    std::vector<bool> selected(count, false);
+    selected[0] = selected[count - 1] = true;
+    size_t selectedCount = 2;
+    split(0, count - 1);
+    while (selectedCount < maxPoints && !segments.empty()) {
+        Segment segment = segments.top();
+        segments.pop();
+        selected[segment.farthest] = true;
+        selectedCount++;
+        split(segment.first, segment.farthest);
+        split(segment.farthest, segment.last);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (selected[i]) {
+            indices.push_back(i);
+        }
+    }
+    return indices;
+}
+
+uint64_t NavigationStateCache::hash(const std::string& value) {
+    uint64_t result = FNV_OFFSET_BASIS;
+    for (unsigned char c : value) {
+        result ^= c;
+        result *= FNV_PRIME;
+    }
+    return result;
+}
+
+}  // namespace navigation
+}  // namespace engine
+}  // namespace aace
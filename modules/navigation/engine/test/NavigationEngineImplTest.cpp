@@ -16,6 +16,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <future>
+
+#include <rapidjson/document.h>
+
 #include <AVSCommon/SDKInterfaces/CapabilitiesDelegateInterface.h>
 #include "AVSCommon/SDKInterfaces/test/MockExceptionEncounteredSender.h"
 #include "AVSCommon/SDKInterfaces/test/MockDirectiveSequencer.h"
@@ -24,6 +28,7 @@
 #include "AACE/Test/Alexa/AlexaTestHelper.h"
 #include "AACE/Navigation/Navigation.h"
 #include "AACE/Engine/Navigation/NavigationEngineImpl.h"
+#include "AACE/Engine/Navigation/NavigationEngineService.h"
 
 namespace aace {
 namespace test {
@@ -146,6 +151,79 @@ TEST_F(NavigationEngineImplTest, createWithNullContextManager) {
     EXPECT_EQ(nullptr, testNavigationEngineImpl);
 }
 
+/**
+ * Test that the maximum number of shapes read from the navigation configuration limits the context payload
+ */
+TEST_F(NavigationEngineImplTest, configuredMaxShapesLimitsContext) {
+    // the engine passes the "aace.navigation" subtree of the configuration to the service
+    rapidjson::Document configuration;
+    configuration.Parse(R"({"providerName": "TEST", "navigationState": {"maxShapes": 4}})");
+    std::string providerName = m_mockNavigationProviderName;
+    size_t maxShapes = 3000;
+    ASSERT_TRUE(
+        aace::engine::navigation::NavigationEngineService::readConfiguration(configuration, providerName, maxShapes));
+    EXPECT_EQ("TEST", providerName);
+    EXPECT_EQ(4u, maxShapes);
+
+    auto platformInterface = std::make_shared<testing::StrictMock<MockNavigationPlatformInterface>>();
+    auto contextManager = std::make_shared<
+        testing::NiceMock<alexaClientSDK::avsCommon::sdkInterfaces::test::MockContextManager>>();
+    const alexaClientSDK::avsCommon::avs::NamespaceAndName navigationState{"Navigation", "NavigationState"};
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::StateProviderInterface> stateProvider;
+    EXPECT_CALL(*contextManager, setStateProvider(navigationState, testing::NotNull()))
+        .WillOnce(testing::SaveArg<1>(&stateProvider));
+
+    auto navigationEngineImpl = aace::engine::navigation::NavigationEngineImpl::create(
+        platformInterface,
+        m_alexaMockFactory->getEndpointBuilderMock(),
+        m_alexaMockFactory->getExceptionEncounteredSenderInterfaceMock(),
+        m_alexaMockFactory->getMessageSenderInterfaceMock(),
+        contextManager,
+        providerName,
+        maxShapes);
+    ASSERT_NE(nullptr, navigationEngineImpl);
+    ASSERT_NE(nullptr, stateProvider);
+
+    std::string shapes;
+    for (int i = 0; i < 100; i++) {
+        shapes += (i > 0 ? "," : "") + std::string("[47.6,") + std::to_string(-122.0 + 0.001 * i) + "]";
+    }
+    EXPECT_CALL(*platformInterface, getNavigationState())
+        .WillOnce(testing::Return(R"({"state": "NAVIGATING", "waypoints": [], "shapes": [)" + shapes + "]}"));
+
+    std::promise<std::string> payloadPromise;
+    EXPECT_CALL(*contextManager, setState(navigationState, testing::_, testing::_, 1))
+        .WillOnce(testing::DoAll(
+            testing::Invoke([&payloadPromise](
+                                const alexaClientSDK::avsCommon::avs::NamespaceAndName&,
+                                const std::string& payload,
+                                alexaClientSDK::avsCommon::avs::StateRefreshPolicy,
+                                unsigned int) { payloadPromise.set_value(payload); }),
+            testing::Return(alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS)));
+
+    stateProvider->provideState(navigationState, 1);
+    auto payloadFuture = payloadPromise.get_future();
+    ASSERT_EQ(std::future_status::ready, payloadFuture.wait_for(std::chrono::seconds(2)));
+
+    rapidjson::Document context;
+    context.Parse(payloadFuture.get().c_str());
+    ASSERT_FALSE(context.HasParseError());
+    ASSERT_TRUE(context.HasMember("shapes"));
+    EXPECT_EQ(4u, context["shapes"].Size());
+
+    navigationEngineImpl->shutdown();
+}
+
+TEST_F(NavigationEngineImplTest, readConfigurationWithInvalidMaxShapes) {
+    rapidjson::Document configuration;
+    configuration.Parse(R"({"navigationState": {"maxShapes": 1}})");
+    std::string providerName;
+    size_t maxShapes = 3000;
+    EXPECT_FALSE(
+        aace::engine::navigation::NavigationEngineService::readConfiguration(configuration, providerName, maxShapes));
+    EXPECT_EQ(3000u, maxShapes);
+}
+
 }  // namespace unit
 }  // namespace test
 }  // namespace aace
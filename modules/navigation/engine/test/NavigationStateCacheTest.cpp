@@ -0,0 +1,192 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <rapidjson/document.h>
+
+#include "AACE/Engine/Navigation/NavigationStateCache.h"
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using NavigationStateCache = aace::engine::navigation::NavigationStateCache;
+
+static const std::string NAVIGATION_STATE_PAYLOAD = R"({
+    "state": "NAVIGATING",
+    "waypoints": [
+        {"type": "SOURCE", "coordinate": [47.6, -122.3], "pointOfInterest": {}},
+        {"type": "DESTINATION", "coordinate": [47.7, -122.2], "name": "home"}
+    ],
+    "shapes": [[47.6, -122.3], [47.65, -122.25], [47.7, -122.2]]
+})";
+
+static const std::string WAYPOINTS_PAYLOAD =
+    R"([{"type": "SOURCE", "coordinate": [47.6, -122.3]}, {"type": "DESTINATION", "coordinate": [47.7, -122.2]}])";
+
+class NavigationStateCacheTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_cache = NavigationStateCache::create(10);
+        ASSERT_NE(nullptr, m_cache);
+    }
+
+    rapidjson::Document getContext(uint64_t& version) {
+        rapidjson::Document document;
+        document.Parse(m_cache->getContext(version).c_str());
+        EXPECT_FALSE(document.HasParseError());
+        return document;
+    }
+
+protected:
+    std::shared_ptr<NavigationStateCache> m_cache;
+};
+
+TEST_F(NavigationStateCacheTest, createWithInvalidMaxShapes) {
+    EXPECT_EQ(nullptr, NavigationStateCache::create(1));
+}
+
+TEST_F(NavigationStateCacheTest, defaultContextIsNotNavigating) {
+    uint64_t version = 0;
+    auto context = getContext(version);
+    EXPECT_NE(0u, version);
+    EXPECT_STREQ("NOT_NAVIGATING", context["state"].GetString());
+    EXPECT_EQ(0u, context["waypoints"].Size());
+    EXPECT_EQ(0u, context["shapes"].Size());
+}
+
+TEST_F(NavigationStateCacheTest, updateChangesVersionOnlyWhenPayloadChanges) {
+    uint64_t initialVersion = 0;
+    m_cache->getContext(initialVersion);
+
+    ASSERT_TRUE(m_cache->update(NAVIGATION_STATE_PAYLOAD));
+    uint64_t version = 0;
+    auto context = getContext(version);
+    EXPECT_NE(initialVersion, version);
+    EXPECT_STREQ("NAVIGATING", context["state"].GetString());
+    EXPECT_EQ(2u, context["waypoints"].Size());
+    EXPECT_FALSE(context["waypoints"][0u].HasMember("pointOfInterest"));
+    EXPECT_EQ(3u, context["shapes"].Size());
+
+    ASSERT_TRUE(m_cache->update(NAVIGATION_STATE_PAYLOAD));
+    uint64_t unchangedVersion = 0;
+    m_cache->getContext(unchangedVersion);
+    EXPECT_EQ(version, unchangedVersion);
+    EXPECT_FALSE(m_cache->isPushed());
+
+    ASSERT_TRUE(m_cache->update(""));
+    context = getContext(version);
+    EXPECT_NE(unchangedVersion, version);
+    EXPECT_STREQ("NOT_NAVIGATING", context["state"].GetString());
+}
+
+TEST_F(NavigationStateCacheTest, invalidUpdateKeepsState) {
+    ASSERT_TRUE(m_cache->update(NAVIGATION_STATE_PAYLOAD));
+    uint64_t version = 0;
+    m_cache->getContext(version);
+
+    EXPECT_FALSE(m_cache->update("{"));
+    EXPECT_FALSE(m_cache->update(R"({"state": "DRIVING", "shapes": []})"));
+    EXPECT_FALSE(m_cache->update(R"({"state": "NAVIGATING", "waypoints": [{"type": "SOURCE"}], "shapes": []})"));
+    EXPECT_FALSE(m_cache->update(R"({"state": "NAVIGATING"})"));
+
+    uint64_t unchangedVersion = 0;
+    auto context = getContext(unchangedVersion);
+    EXPECT_EQ(version, unchangedVersion);
+    EXPECT_STREQ("NAVIGATING", context["state"].GetString());
+}
+
+TEST_F(NavigationStateCacheTest, pushedDeltasUpdateContext) {
+    m_cache->setState(NavigationStateCache::NavigationState::NAVIGATING);
+    ASSERT_TRUE(m_cache->setWaypoints(WAYPOINTS_PAYLOAD));
+    m_cache->addShapes({{47.6, -122.3}, {47.65, -122.25}});
+    m_cache->addShapes({{47.7, -122.2}});
+    EXPECT_TRUE(m_cache->isPushed());
+
+    uint64_t version = 0;
+    auto context = getContext(version);
+    EXPECT_STREQ("NAVIGATING", context["state"].GetString());
+    EXPECT_EQ(2u, context["waypoints"].Size());
+    ASSERT_EQ(3u, context["shapes"].Size());
+    EXPECT_DOUBLE_EQ(47.6, context["shapes"][0u][0u].GetDouble());
+
+    m_cache->removeShapes(1);
+    context = getContext(version);
+    ASSERT_EQ(2u, context["shapes"].Size());
+    EXPECT_DOUBLE_EQ(47.65, context["shapes"][0u][0u].GetDouble());
+
+    m_cache->removeShapes(100);
+    context = getContext(version);
+    EXPECT_EQ(0u, context["shapes"].Size());
+
+    EXPECT_FALSE(m_cache->setWaypoints(R"([{"type": "NOWHERE", "coordinate": [0, 0]}])"));
+    EXPECT_EQ(2u, getContext(version)["waypoints"].Size());
+
+    EXPECT_NE(std::string::npos, m_cache->getFirstWaypoint().find("SOURCE"));
+}
+
+TEST_F(NavigationStateCacheTest, unchangedPushKeepsVersion) {
+    m_cache->setState(NavigationStateCache::NavigationState::NAVIGATING);
+    ASSERT_TRUE(m_cache->setWaypoints(WAYPOINTS_PAYLOAD));
+    uint64_t version = 0;
+    m_cache->getContext(version);
+
+    m_cache->setState(NavigationStateCache::NavigationState::NAVIGATING);
+    ASSERT_TRUE(m_cache->setWaypoints(WAYPOINTS_PAYLOAD));
+    m_cache->addShapes({});
+    m_cache->removeShapes(1);
+
+    uint64_t unchangedVersion = 0;
+    m_cache->getContext(unchangedVersion);
+    EXPECT_EQ(version, unchangedVersion);
+}
+
+TEST_F(NavigationStateCacheTest, contextShapesAreDecimatedToBudget) {
+    std::vector<NavigationStateCache::Coordinate> shapes;
+    for (int i = 0; i < 1000; i++) {
+        shapes.push_back({47.0 + 0.001 * (i % 7), -122.0 + 0.001 * i});
+    }
+    m_cache->addShapes(shapes);
+
+    uint64_t version = 0;
+    auto context = getContext(version);
+    ASSERT_EQ(10u, context["shapes"].Size());
+    EXPECT_DOUBLE_EQ(-122.0, context["shapes"][0u][1u].GetDouble());
+    EXPECT_DOUBLE_EQ(-121.001, context["shapes"][9u][1u].GetDouble());
+}
+
+TEST_F(NavigationStateCacheTest, decimateKeepsEndsAndCorners) {
+    std::vector<NavigationStateCache::Coordinate> shapes;
+    for (int i = 0; i <= 100; i++) {
+        shapes.push_back({47.0, -122.0 + 0.001 * i});
+    }
+    for (int i = 1; i <= 100; i++) {
+        shapes.push_back({47.0 + 0.001 * i, -121.9});
+    }
+
+    EXPECT_EQ(std::vector<size_t>({0, 100, 200}), NavigationStateCache::decimate(shapes, 3));
+    EXPECT_EQ(shapes.size(), NavigationStateCache::decimate(shapes, shapes.size()).size());
+}
+
+TEST_F(NavigationStateCacheTest, hash) {
+    EXPECT_EQ(14695981039346656037ULL, NavigationStateCache::hash(""));
+    EXPECT_EQ(NavigationStateCache::hash("abc"), NavigationStateCache::hash("abc"));
+    EXPECT_NE(NavigationStateCache::hash("abc"), NavigationStateCache::hash("abd"));
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -42,6 +42,10 @@ public:
 
     using AlternateRouteType = aace::navigation::NavigationEngineInterface::AlternateRouteType;
 
+    using NavigationState = aace::navigation::NavigationEngineInterface::NavigationState;
+
+    using Coordinate = aace::navigation::NavigationEngineInterface::Coordinate;
+
     virtual ~Navigation();
 
     enum class ControlDisplay {
@@ -193,6 +197,9 @@ public:
      * @li state (required) : current navigation state
      * @li waypoints (required) : list of waypoints, which can be empty
      * @li shapes (required) : list of route shapes, which can be empty or limited to 3000 entries
+     *
+     * @note This method is not called after the platform implementation pushes the navigation state to the Engine
+     * with @c navigationStateChanged(), @c waypointsChanged(), @c routeShapesAdded() or @c routeShapesRemoved().
      */
 
     virtual std::string getNavigationState() = 0;
@@ -396,6 +403,41 @@ public:
      */
     void showAlternativeRoutesSucceeded(const std::string& payload);
 
+    /**
+     * Notifies the Engine of a change in the navigation state. Pushing the navigation state with this method,
+     * @c waypointsChanged(), @c routeShapesAdded() and @c routeShapesRemoved() replaces @c getNavigationState(),
+     * so the Engine no longer requests the full navigation state payload each time the context is needed.
+     *
+     * @param [in] state The current navigation state
+     */
+    void navigationStateChanged(NavigationState state);
+
+    /**
+     * Notifies the Engine that the waypoints of the route changed.
+     *
+     * @param [in] waypoints JSON array of all of the waypoints of the route, in the format of the @c waypoints
+     * field of the @c getNavigationState() payload. The array can be empty.
+     */
+    void waypointsChanged(const std::string& waypoints);
+
+    /**
+     * Notifies the Engine of route shape points added to the end of the route. The Engine keeps the full route
+     * and reduces it to the configured number of points when the navigation state is sent to AVS, so the
+     * platform implementation does not need to limit the points it provides.
+     *
+     * @param [in] shapes The added route shape coordinates
+     */
+    void routeShapesAdded(const std::vector<Coordinate>& shapes);
+
+    /**
+     * Notifies the Engine of route shape points removed from the start of the route, such as the points the
+     * vehicle has passed. To replace the route, remove all of the points and add the points of the new route.
+     *
+     * @param [in] count The number of points removed. If it is greater than the number of points of the route,
+     * all of the points are removed.
+     */
+    void routeShapesRemoved(int count);
+
     void setEngineInterface(std::shared_ptr<NavigationEngineInterface> navigationEngineInterface);
 
 private:
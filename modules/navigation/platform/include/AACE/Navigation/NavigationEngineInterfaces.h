@@ -16,6 +16,9 @@
 #ifndef AAC_NAVIGATION_NAVIGATION_ENGINE_INTERFACES_H
 #define AAC_NAVIGATION_NAVIGATION_ENGINE_INTERFACES_H
 
+#include <string>
+#include <vector>
+
 #include "Navigation.h"
 
 namespace aace {
@@ -353,9 +356,36 @@ public:
         SHORTER_DISTANCE
     };
 
+    enum class NavigationState {
+        /*
+         * Navigation is in progress
+         */
+        NAVIGATING,
+
+        /*
+         * Navigation is not in progress
+         */
+        NOT_NAVIGATING,
+
+        /*
+         * The navigation state is not known
+         */
+        UNKNOWN
+    };
+
+    /// A geographic coordinate in degrees
+    struct Coordinate {
+        double latitude;
+        double longitude;
+    };
+
     virtual void onNavigationEvent(EventName event) = 0;
     virtual void onNavigationError(ErrorType type, ErrorCode code, const std::string& description) = 0;
     virtual void onShowAlternativeRoutesSucceeded(const std::string& payload) = 0;
+    virtual void onNavigationStateChanged(NavigationState state) = 0;
+    virtual void onWaypointsChanged(const std::string& waypoints) = 0;
+    virtual void onRouteShapesAdded(const std::vector<Coordinate>& shapes) = 0;
+    virtual void onRouteShapesRemoved(int count) = 0;
 };
 
 }  // namespace navigation
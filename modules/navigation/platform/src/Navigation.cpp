@@ -38,6 +38,30 @@ void Navigation::showAlternativeRoutesSucceeded(const std::string& payload) {
     }
 }
 
+void Navigation::navigationStateChanged(NavigationState state) {
+    if (m_navigationEngineInterface != nullptr) {
+        m_navigationEngineInterface->onNavigationStateChanged(state);
+    }
+}
+
+void Navigation::waypointsChanged(const std::string& waypoints) {
+    if (m_navigationEngineInterface != nullptr) {
+        m_navigationEngineInterface->onWaypointsChanged(waypoints);
+    }
+}
+
+void Navigation::routeShapesAdded(const std::vector<Coordinate>& shapes) {
+    if (m_navigationEngineInterface != nullptr) {
+        m_navigationEngineInterface->onRouteShapesAdded(shapes);
+    }
+}
+
+void Navigation::routeShapesRemoved(int count) {
+    if (m_navigationEngineInterface != nullptr) {
+        m_navigationEngineInterface->onRouteShapesRemoved(count);
+    }
+}
+
 void Navigation::setEngineInterface(std::shared_ptr<NavigationEngineInterface> navigationEngineInterface) {
     m_navigationEngineInterface = navigationEngineInterface;
 }
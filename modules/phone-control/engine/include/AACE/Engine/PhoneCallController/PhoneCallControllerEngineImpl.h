@@ -26,6 +26,7 @@
 #include <Endpoints/EndpointBuilder.h>
 
 #include <AACE/Engine/Alexa/AlexaEndpointInterface.h>
+#include <AACE/Engine/Alexa/HttpClient.h>
 #include <AACE/PhoneCallController/PhoneCallController.h>
 #include <AACE/PhoneCallController/PhoneCallControllerEngineInterfaces.h>
 #include "PhoneCallControllerCapabilityAgent.h"
@@ -53,7 +54,8 @@ private:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> focusManager,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient);
 
 public:
     static std::shared_ptr<PhoneCallControllerEngineImpl> create(
@@ -65,7 +67,8 @@ public:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> focusManager,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::alexa::HttpClient> httpClient);
 
     // PhoneCallControllerEngineInterface
     void onConnectionStateChanged(ConnectionState state) override;
@@ -129,6 +132,9 @@ private:
     /// Used for getting the ACMS endpoint.
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> m_alexaEndpoints;
 
+    /// Used for the ACMS requests.
+    std::shared_ptr<aace::engine::alexa::HttpClient> m_httpClient;
+
     /// Thread for auto provisioning.
     std::thread m_autoProvisioningThread;
 };
@@ -85,7 +85,8 @@ bool PhoneCallControllerEngineImpl::initialize(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> focusManager,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) {
     try {
         m_phoneCallControllerCapabilityAgent = PhoneCallControllerCapabilityAgent::create(
             shared_from_this(), contextManager, exceptionSender, messageSender, focusManager);
@@ -94,6 +95,7 @@ bool PhoneCallControllerEngineImpl::initialize(
         m_authDelegate = authDelegate;
         m_deviceInfo = deviceInfo;
         m_alexaEndpoints = alexaEndpoints;
+        m_httpClient = httpClient;
 
         m_authDelegate->addAuthObserver(shared_from_this());
 
@@ -123,7 +125,8 @@ std::shared_ptr<PhoneCallControllerEngineImpl> PhoneCallControllerEngineImpl::cr
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> focusManager,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) {
     try {
         ThrowIfNull(phoneCallControllerPlatformInterface, "nullPlatformInterface");
         ThrowIfNull(defaultEndpointBuilder, "nullDefaultEndpointBuilder");
@@ -133,6 +136,7 @@ std::shared_ptr<PhoneCallControllerEngineImpl> PhoneCallControllerEngineImpl::cr
         ThrowIfNull(focusManager, "nullFocusManager");
         ThrowIfNull(authDelegate, "nullAuthDelegate");
         ThrowIfNull(deviceInfo, "nullDeviceInfo");
+        ThrowIfNull(httpClient, "nullHttpClient");
 
         auto phoneCallControllerEngineImpl = std::shared_ptr<PhoneCallControllerEngineImpl>(
             new PhoneCallControllerEngineImpl(phoneCallControllerPlatformInterface));
@@ -146,7 +150,8 @@ std::shared_ptr<PhoneCallControllerEngineImpl> PhoneCallControllerEngineImpl::cr
                 focusManager,
                 authDelegate,
                 deviceInfo,
-                alexaEndpoints),
+                alexaEndpoints,
+                httpClient),
             "initializePhoneCallControllerEngineImplFailed");
 
         // set the platform engine interface reference
@@ -314,7 +319,7 @@ void PhoneCallControllerEngineImpl::autoProvisioningThread() {
         AlexaAccountInfo alexaAccountInfo;
         int retryCounter = 0;
         while (!m_isShuttingDown && retryCounter < MAX_HTTP_RETRY_COUNT) {
-            alexaAccountInfo = getAlexaAccountInfo(m_authDelegate, m_deviceInfo, m_alexaEndpoints);
+            alexaAccountInfo = getAlexaAccountInfo(m_authDelegate, m_deviceInfo, m_alexaEndpoints, m_httpClient);
             if (AlexaAccountInfo::AccountProvisionStatus::INVALID != alexaAccountInfo.provisionStatus) {
                 break;
             }
@@ -350,7 +355,8 @@ void PhoneCallControllerEngineImpl::autoProvisioningThread() {
             bool success = false;
             int retryCounter = 0;
             while (!m_isShuttingDown && retryCounter < MAX_HTTP_RETRY_COUNT) {
-                success = doAccountAutoProvision(alexaAccountInfo, m_authDelegate, m_deviceInfo, m_alexaEndpoints);
+                success = doAccountAutoProvision(
+                    alexaAccountInfo, m_authDelegate, m_deviceInfo, m_alexaEndpoints, m_httpClient);
                 if (success) {
                     break;
                 }
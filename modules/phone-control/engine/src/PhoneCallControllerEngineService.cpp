@@ -89,6 +89,9 @@ bool PhoneCallControllerEngineService::registerPlatformInterfaceType(
             getContext()->getServiceInterface<aace::engine::alexa::AlexaEndpointInterface>("aace.alexa");
         ThrowIfNull(alexaEndpoints, "alexaEndpointsInvalid");
 
+        auto httpClient = getContext()->getServiceInterface<aace::engine::alexa::HttpClient>("aace.alexa");
+        ThrowIfNull(httpClient, "httpClientInvalid");
+
         m_phoneCallControllerEngineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
             phoneCallController,
             defaultEndpointBuilder,
@@ -98,7 +101,8 @@ bool PhoneCallControllerEngineService::registerPlatformInterfaceType(
             focusManager,
             authDelegate,
             deviceInfo,
-            alexaEndpoints);
+            alexaEndpoints,
+            httpClient);
         ThrowIfNull(m_phoneCallControllerEngineImpl, "createPhoneCallControllerEngineImplFailed");
 
         return true;
@@ -22,8 +22,6 @@
 #include "AACE/Engine/PhoneCallController/PhoneCallControllerRESTAgent.h"
 
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
 #include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
 #include <AACE/Engine/Core/EngineMacros.h>
@@ -68,6 +66,9 @@ const std::string DEFAULT_PFM = "US";
 /// Default value for User Agent HTTP header
 const std::string DEFAULT_USER_AGENT_VALUE = "AutoSDK/PhoneCallController/1.0";
 
+/// Identifies the phone call controller requests to the shared @c HttpClient
+static const std::string HTTP_CLIENT_ID = "phoneCallController";
+
 /// Default value for the HTTP request timeout.
 static const std::chrono::seconds DEFAULT_HTTP_TIMEOUT = std::chrono::seconds(60);
 
@@ -118,56 +119,6 @@ static bool parseCommonHTTPResponse(const alexaClientSDK::avsCommon::utils::libc
     return false;
 }
 
-/**
- * Helper function to do HTTP POST operation.
- *
- * @param url The endpoint url.
- * @param headerLines The HTTP header passed as part of HTTP POST.
- * @param data The HTTP body passed as part of HTTP POST.
- * @param timeout The timeout for HTTP POST operation.
- * @return On success returns @c HTTPResponse received from server, otherwise empty object of @c HTTPResponse.
- */
-static alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse doPost(
-    const std::string& url,
-    const std::vector<std::string> headerLines,
-    const std::string& data,
-    std::chrono::seconds timeout) {
-    try {
-        // Creating the HttpPost on every doPost is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpPost = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPost::create();
-        ThrowIfNull(httpPost, "nullHttpPost");
-
-        return httpPost->doPost(url, headerLines, data, timeout);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "doPost").d("reason", ex.what()));
-        return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
-    }
-}
-
-/**
- * Helper function to do HTTP GET operation.
- *
- * @param url The endpoint url.
- * @param headerLines The HTTP header passed as part of HTTP GET.
- * @return On success returns @c HTTPResponse received from server, otherwise empty object of @c HTTPResponse.
- */
-static alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse doGet(
-    const std::string& url,
-    const std::vector<std::string>& headers) {
-    try {
-        // Creating the HttpGet on every doGet is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-        ThrowIfNull(httpGet, "nullHttpGet");
-
-        return httpGet->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "doGet").d("reason", ex.what()));
-        return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
-    }
-}
-
 /**
  * Helper function to convert HTTP response error to strings used for logging.
  *
@@ -227,13 +178,18 @@ static std::string getACMSEndpoint(std::shared_ptr<aace::engine::alexa::AlexaEnd
 AlexaAccountInfo getAlexaAccountInfo(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) {
     rapidjson::Document document;
     AlexaAccountInfo alexaAccount;
 
     auto httpHeaderData = buildCommonHTTPHeader(deviceInfo->getDeviceSerialNumber(), authDelegate->getAuthToken());
     try {
-        auto httpResponse = doGet(getACMSEndpoint(alexaEndpoints) + FORWARD_SLASH + ACCOUNTS_PATH, httpHeaderData);
+        auto httpResponse = httpClient->doGet(
+            HTTP_CLIENT_ID,
+            getACMSEndpoint(alexaEndpoints) + FORWARD_SLASH + ACCOUNTS_PATH,
+            httpHeaderData,
+            DEFAULT_HTTP_TIMEOUT);
 
         ThrowIfNot(
             parseCommonHTTPResponse(httpResponse),
@@ -288,13 +244,15 @@ bool doAccountAutoProvision(
     const AlexaAccountInfo& alexaAccountInfo,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClient> httpClient) {
     auto httpHeaderData = buildCommonHTTPHeader(deviceInfo->getDeviceSerialNumber(), authDelegate->getAuthToken());
     httpHeaderData.insert(httpHeaderData.end(), CONTENT_TYPE_APPLICATION_JSON);
 
     auto autoProvisionJson = buildAutoAccountProvisionJson();
     try {
-        auto httpResponse = doPost(
+        auto httpResponse = httpClient->doPost(
+            HTTP_CLIENT_ID,
             getACMSEndpoint(alexaEndpoints) + FORWARD_SLASH + ACCOUNTS_PATH + FORWARD_SLASH +
                 alexaAccountInfo.directedId + FORWARD_SLASH + USERS_PATH,
             httpHeaderData,
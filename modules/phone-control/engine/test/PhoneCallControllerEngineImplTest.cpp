@@ -101,6 +101,7 @@ public:
         m_mockAuthDelegate = std::make_shared<testing::StrictMock<MockAuthDelegateInterface>>();
         m_deviceInfo = alexaClientSDK::avsCommon::utils::DeviceInfo::create(alexaClientSDK::avsCommon::utils::configuration::ConfigurationNode::getRoot());
         m_alexaEndpointInterface = std::make_shared<DummyAlexaEndpointInterface>();
+        m_httpClient = aace::engine::alexa::HttpClient::create();
 
         EXPECT_CALL(*m_mockAuthDelegate, addAuthObserver(testing::_)).WillOnce(testing::Return());
         EXPECT_CALL(*m_mockAuthDelegate, removeAuthObserver(testing::_)).WillOnce(testing::Return());
@@ -115,7 +116,8 @@ public:
             m_mockFocusManager,
             m_mockAuthDelegate,
             m_deviceInfo,
-            m_alexaEndpointInterface
+            m_alexaEndpointInterface,
+            m_httpClient
         );
     }
     void TearDown() override {
@@ -135,6 +137,7 @@ public:
     std::shared_ptr<testing::StrictMock<MockAuthDelegateInterface>> m_mockAuthDelegate;
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> m_deviceInfo;
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> m_alexaEndpointInterface;
+    std::shared_ptr<aace::engine::alexa::HttpClient> m_httpClient;
 };
 
 TEST_F( PhoneCallControllerEngineImplTest, create ) {
@@ -144,56 +147,63 @@ TEST_F( PhoneCallControllerEngineImplTest, create ) {
 TEST_F( PhoneCallControllerEngineImplTest, createWithNullPlatform ) {
     std::shared_ptr<aace::engine::phoneCallController::PhoneCallControllerEngineImpl> engineImpl; 
     engineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
-        nullptr, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface );
+        nullptr, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface, m_httpClient );
     EXPECT_EQ(nullptr, engineImpl);
 }
 
 TEST_F( PhoneCallControllerEngineImplTest, createWithNullCapabilitiesDelegate ) {
     std::shared_ptr<aace::engine::phoneCallController::PhoneCallControllerEngineImpl> engineImpl;
     engineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
-        m_mockPlatformInterface, nullptr, m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface );
+        m_mockPlatformInterface, nullptr, m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface, m_httpClient );
     EXPECT_EQ(nullptr, engineImpl);
 }
 
 TEST_F( PhoneCallControllerEngineImplTest, createWithNullContextManager ) {
     std::shared_ptr<aace::engine::phoneCallController::PhoneCallControllerEngineImpl> engineImpl;
     engineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
-        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), nullptr, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface );
+        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), nullptr, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface, m_httpClient );
     EXPECT_EQ(nullptr, engineImpl);
 }
 
 TEST_F( PhoneCallControllerEngineImplTest, createWithNullExceptionSender ) {
     std::shared_ptr<aace::engine::phoneCallController::PhoneCallControllerEngineImpl> engineImpl;
     engineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
-        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, nullptr, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface );
+        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, nullptr, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface, m_httpClient );
     EXPECT_EQ(nullptr, engineImpl);
 }
 
 TEST_F( PhoneCallControllerEngineImplTest, createWithNullMessageSender ) {
     std::shared_ptr<aace::engine::phoneCallController::PhoneCallControllerEngineImpl> engineImpl;
     engineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
-        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, nullptr, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface );
+        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, nullptr, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface, m_httpClient );
     EXPECT_EQ(nullptr, engineImpl);
 }
 
 TEST_F( PhoneCallControllerEngineImplTest, createWithNullFocusManager ) {
     std::shared_ptr<aace::engine::phoneCallController::PhoneCallControllerEngineImpl> engineImpl;
     engineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
-        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, nullptr, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface );
+        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, nullptr, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface, m_httpClient );
     EXPECT_EQ(nullptr, engineImpl);
 }
 
 TEST_F( PhoneCallControllerEngineImplTest, createWithNullAuthDelegate ) {
     std::shared_ptr<aace::engine::phoneCallController::PhoneCallControllerEngineImpl> engineImpl;
     engineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
-        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, nullptr, m_deviceInfo, m_alexaEndpointInterface );
+        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, nullptr, m_deviceInfo, m_alexaEndpointInterface, m_httpClient );
     EXPECT_EQ(nullptr, engineImpl);
 }
 
 TEST_F( PhoneCallControllerEngineImplTest, createWithNullDeviceInfo ) {
     std::shared_ptr<aace::engine::phoneCallController::PhoneCallControllerEngineImpl> engineImpl;
     engineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
-        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, nullptr, m_alexaEndpointInterface );
+        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, nullptr, m_alexaEndpointInterface, m_httpClient );
+    EXPECT_EQ(nullptr, engineImpl);
+}
+
+TEST_F( PhoneCallControllerEngineImplTest, createWithNullHttpClient ) {
+    std::shared_ptr<aace::engine::phoneCallController::PhoneCallControllerEngineImpl> engineImpl;
+    engineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
+        m_mockPlatformInterface, m_alexaMockFactory->getEndpointBuilderMock(), m_mockContextManager, m_mockExceptionSender, m_mockMessageSender, m_mockFocusManager, m_mockAuthDelegate, m_deviceInfo, m_alexaEndpointInterface, nullptr );
     EXPECT_EQ(nullptr, engineImpl);
 }
 
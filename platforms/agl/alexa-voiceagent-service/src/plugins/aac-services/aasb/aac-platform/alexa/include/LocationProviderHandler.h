@@ -15,7 +15,6 @@
 #ifndef AASB_LOCATION_LOCATIONPROVIDER_HANDLER_H
 #define AASB_LOCATION_LOCATIONPROVIDER_HANDLER_H
 
-#include <condition_variable>
 #include <memory>
 #include <mutex>
 
@@ -24,6 +23,7 @@
 #include <aasb/interfaces/IConfigurationProvider.h>
 #include "ResponseDispatcher.h"
 #include "LoggerHandler.h"
+#include "SyncOverAsync.h"
 
 namespace aasb {
 namespace location {
@@ -76,8 +76,8 @@ private:
     /**
      * When AASB client receives message to provide location, at some point
      * of time, it should respond with the current location. This handler
-     * is invoked by AASB Controller to notify and wake up the thread waiting
-     * on @c getLocation
+     * is invoked by AASB Controller to update the location returned by
+     * @c getLocation
      *
      * @param payload Json containing location made available by AASB client.
      */
@@ -93,11 +93,10 @@ private:
     std::weak_ptr<aasb::bridge::ResponseDispatcher> m_responseDispatcher;
 
     // Apparatus for fetching location (sync over async)
-    std::condition_variable m_cv_location;
-    std::mutex m_mutex_location;
-    bool m_location_set;
+    aasb::bridge::SyncOverAsync m_getLocationCall;
 
-    // Cached location
+    // Cached location, and its mutex
+    std::mutex m_mutex_location;
     aace::location::Location m_current_location;
 };
 
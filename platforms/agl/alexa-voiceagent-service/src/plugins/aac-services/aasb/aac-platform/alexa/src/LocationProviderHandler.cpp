@@ -52,25 +52,20 @@ LocationProviderHandler::LocationProviderHandler(
         m_logger(logger),
         m_config(config),
         m_responseDispatcher(responseDispatcher),
-        m_location_set(false),
+        m_getLocationCall(logger, responseDispatcher, TIME_OUT_IN_SECS),
         m_current_location(0, 0) {
 }
 
 aace::location::Location LocationProviderHandler::getLocation() {
     m_logger->log(Level::VERBOSE, TAG, "getLocation");
 
-    if (auto responseDispatcher = m_responseDispatcher.lock()) {
-        responseDispatcher->sendDirective(TOPIC_LOCATIONPROVIDER, ACTION_LOCATION_REQUEST_CURRENT_LOCATION, "");
-    } else {
-        m_logger->log(Level::ERROR, TAG, "LocationProviderHandler: responseDispatcher doesn't exist.");
-        return m_current_location;
-    }
-
-    std::unique_lock<std::mutex> lock(m_mutex_location);
     // Block until we receive Location
-    if (m_cv_location.wait_for(lock, TIME_OUT_IN_SECS, [this]() { return m_location_set == true; })) {
-        m_location_set = false;
-    } else {
+    std::string response;
+    bool received = m_getLocationCall.makeCallAndWaitForResponse(
+        TOPIC_LOCATIONPROVIDER, ACTION_LOCATION_REQUEST_CURRENT_LOCATION, "", response);
+
+    std::lock_guard<std::mutex> lock(m_mutex_location);
+    if (!received) {
         std::stringstream logTxt;
         logTxt << "Timeout in fetching location. Sending last location " << m_current_location.getLatitude() << ":"
                << m_current_location.getLongitude();
@@ -151,9 +146,7 @@ void LocationProviderHandler::onLocationReceived(const std::string& payload) {
         } else {
             m_current_location = aace::location::Location(latitude, longitude, altitude, accuracy);
         }
-        m_location_set = true;
     }
-    m_cv_location.notify_one();
 }
 
 std::string LocationProviderHandler::getCountry() {
@@ -167,6 +160,7 @@ void LocationProviderHandler::onReceivedEvent(const std::string& action, const s
 
     if (action == ACTION_LOCATION_RESPONSE_CURRENT_LOCATION) {
         onLocationReceived(payload);
+        m_getLocationCall.responseAvailable(payload);
     } else {
         m_logger->log(Level::WARN, TAG, "Unrecognized action: " + action);
     }
@@ -46,6 +46,7 @@
 #include "PhoneCallControllerHandler.h"
 #include "PlaybackControllerHandler.h"
 #include "NavigationHandler.h"
+#include "TopicDispatcher.h"
 
 namespace aace {
 namespace audio {
@@ -62,9 +63,10 @@ namespace bridge {
 class AASBControllerImpl : public IAASBController {
 public:
     /**
-     * Destructor for @c AASBController.
+     * Destructor for @c AASBController. Stops handling the events received from the client before the handlers
+     * are released.
      */
-    ~AASBControllerImpl() = default;
+    ~AASBControllerImpl();
     /// @name aasb::bridge::IAASBController Functions
     /// @{
     /**
@@ -230,6 +232,9 @@ private:
     // Directive Dispatcher
     std::shared_ptr<aasb::bridge::ResponseDispatcher> m_responseDispatcher;
 
+    // Dispatcher of the events received from the client, shut down first to stop handling events
+    std::shared_ptr<aasb::bridge::TopicDispatcher> m_topicDispatcher;
+
     /**
      * Configure the AACE Engine using @c m_config.
      *
@@ -266,6 +271,13 @@ private:
      */
     bool registerLocalMediaSourceCapability(
         const IConfigurationProvider::LocalMediaSourceConfiguration& localMediaSourceConfig);
+
+    /**
+     * Register the handlers of the topics of the events received from the client with @c m_topicDispatcher.
+     *
+     * @return true when succeeded, false otherwise.
+     */
+    bool registerTopicHandlers();
 };
 
 }  // namespace bridge
@@ -15,10 +15,15 @@
 #ifndef AASB_BRIDGE_SYNC_OVER_ASYNC_H
 #define AASB_BRIDGE_SYNC_OVER_ASYNC_H
 
-#include <memory>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <chrono>
+#include <unordered_map>
 
 #include "ResponseDispatcher.h"
 #include "LoggerHandler.h"
@@ -28,6 +33,15 @@ namespace bridge {
 
 /**
  * Helper class to make sync over async calls to AASB clients
+ *
+ * Each call is sent with a request ID in the @c JSON_ATTR_REQUEST_ID attribute of its payload, which the client
+ * returns in the payload of the response. Responses are routed to the pending call with their request ID, so
+ * several calls can wait for a response at the same time, and a response arriving after its call timed out is
+ * dropped.
+ *
+ * A response without a request ID is for the oldest call that was not answered, as clients that do not return the
+ * request ID answer the calls in order. It is dropped when that call timed out, rather than resolving a later call.
+ * A call that timed out is no longer expected to be answered after a second wait duration.
  */
 class SyncOverAsync {
 public:
@@ -36,22 +50,73 @@ public:
         std::weak_ptr<aasb::bridge::ResponseDispatcher> responseDispatcher,
         std::chrono::microseconds waitDuration);
 
+    /**
+     * Sends a directive to the client and waits for its response for the wait duration of this instance.
+     */
     bool makeCallAndWaitForResponse(
         const std::string& topic,
         const std::string& action,
         const std::string& payload,
         std::string& response);
-    void responseAvailable(const std::string& payload);
+
+    /**
+     * Sends a directive to the client and waits for its response for @c waitDuration.
+     */
+    bool makeCallAndWaitForResponse(
+        const std::string& topic,
+        const std::string& action,
+        const std::string& payload,
+        std::string& response,
+        std::chrono::microseconds waitDuration);
+
+    /**
+     * Resolves the pending call the response is for.
+     *
+     * @return @c false if no pending call matches the response.
+     */
+    bool responseAvailable(const std::string& payload);
 
 private:
-    // Promise which will be resolved when the response for the msg arrives
-    std::promise<const std::string> m_responsePromise;
-    // Wait duration for response
-    std::chrono::microseconds m_waitDuration;
+    /**
+     * Returns @c payload with the request ID added, or @c payload unchanged if it is not a JSON object.
+     */
+    static std::string addRequestId(const std::string& payload, const std::string& requestId);
+
+    /**
+     * Gets the request ID of a response payload.
+     *
+     * @return @c false if the payload has no request ID.
+     */
+    static bool getRequestId(const std::string& payload, std::string& requestId);
+
+    /**
+     * Forgets the calls that timed out and are no longer expected to be answered. Must be called with the lock held.
+     */
+    void removeExpiredRequests();
+
+private:
+    /// A call that was not answered, pending or timed out
+    struct UnansweredRequest {
+        std::string requestId;
+        bool timedOut;
+        // the time after which a call that timed out is no longer expected to be answered
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    // Promises which will be resolved when the responses arrive, by request ID
+    std::unordered_map<std::string, std::shared_ptr<std::promise<std::string>>> m_pendingResponses;
+    // Calls that were not answered, in the order they were made
+    std::deque<UnansweredRequest> m_unansweredRequests;
     // aasb::core::logger::LoggerHandler
     std::shared_ptr<aasb::core::logger::LoggerHandler> m_logger;
     // ResponseDispatcher to send status info
     std::weak_ptr<aasb::bridge::ResponseDispatcher> m_responseDispatcher;
+    // Wait duration for response
+    std::chrono::microseconds m_waitDuration;
+    // Serializes access to m_pendingResponses and m_unansweredRequests
+    std::mutex m_mutex;
+    // Request ID of the next call, shared by all instances so IDs are unique in the process
+    static std::atomic<uint64_t> s_nextRequestId;
 };
 
 }  // namespace bridge
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AASB_BRIDGE_TOPIC_DISPATCHER_H
+#define AASB_BRIDGE_TOPIC_DISPATCHER_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <AVSCommon/Utils/Threading/Executor.h>
+
+#include "LoggerHandler.h"
+
+namespace aasb {
+namespace bridge {
+
+/**
+ * Routes the events received from the AASB client to the handler registered for their topic.
+ *
+ * Topics are looked up in a hash table, and each topic has its own executor, so the events of a topic are handled
+ * in the order they were received while a slow handler only delays the events of its own topic. Received events
+ * are logged with their topic, action and payload size only, as payloads may hold personal data such as the phone
+ * numbers and contact names of PhoneCallController, and log messages are only formatted when their level is enabled.
+ */
+class TopicDispatcher {
+public:
+    using Level = aace::logger::LoggerEngineInterface::Level;
+
+    /// Handles an event received for a topic
+    using Handler = std::function<void(const std::string& action, const std::string& payload)>;
+
+    /**
+     * Creates a @c TopicDispatcher.
+     *
+     * @param logger The logger used to log the received events.
+     * @param logLevel The lowest level of the messages that are formatted and logged.
+     */
+    static std::shared_ptr<TopicDispatcher> create(
+        std::shared_ptr<aasb::core::logger::LoggerHandler> logger,
+        Level logLevel = Level::INFO);
+
+    ~TopicDispatcher();
+
+    /**
+     * Registers the handler of a topic.
+     *
+     * @return @c false if the handler is empty or the topic already has a handler.
+     */
+    bool registerTopic(const std::string& topic, Handler handler);
+
+    /**
+     * Queues an event on the executor of its topic.
+     *
+     * @return @c false if no handler is registered for the topic, or the dispatcher is shut down.
+     */
+    bool dispatch(const std::string& topic, const std::string& action, const std::string& payload);
+
+    /**
+     * Waits for the events dispatched so far to be handled.
+     */
+    void waitForDispatchedEvents();
+
+    /**
+     * Stops handling events. Events that are queued but not handled yet are dropped.
+     */
+    void shutdown();
+
+private:
+    /// The handler of a topic and the executor its events are handled on
+    struct Route {
+        std::string topic;
+        Handler handler;
+        alexaClientSDK::avsCommon::utils::threading::Executor executor;
+    };
+
+    TopicDispatcher(std::shared_ptr<aasb::core::logger::LoggerHandler> logger, Level logLevel);
+
+    /**
+     * Logs the message returned by @c formatter, which is only called if @c level is enabled.
+     */
+    template <typename Formatter>
+    void log(Level level, Formatter formatter) {
+        if (m_logger && level >= m_logLevel) {
+            m_logger->log(level, "aasb::bridge::TopicDispatcher", formatter());
+        }
+    }
+
+private:
+    std::shared_ptr<aasb::core::logger::LoggerHandler> m_logger;
+    Level m_logLevel;
+
+    std::unordered_map<std::string, std::unique_ptr<Route>> m_routes;
+    bool m_isShutdown;
+    std::mutex m_mutex;
+};
+
+}  // namespace bridge
+}  // namespace aasb
+
+#endif  // AASB_BRIDGE_TOPIC_DISPATCHER_H
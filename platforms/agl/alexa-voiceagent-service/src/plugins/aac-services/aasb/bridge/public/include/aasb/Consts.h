@@ -238,6 +238,9 @@ extern const std::string JSON_ATTR_PLAYER_DESCRIPTION;
 extern const std::string JSON_ATTR_PLAYER_FATAL;
 extern const std::string JSON_ATTR_PLAYER_ERROR_CODE;
 
+// Request ID of the directives of synchronous calls, returned by the AASB client in the response payload.
+extern const std::string JSON_ATTR_REQUEST_ID;
+
 // Actions for @c TOPIC_CBL topic.
 extern const std::string ACTION_CBL_CODEPAIR_RECEIVED;
 extern const std::string ACTION_CBL_CODEPAIR_EXPIRED;
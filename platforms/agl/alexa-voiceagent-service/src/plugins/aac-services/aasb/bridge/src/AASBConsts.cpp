@@ -235,6 +235,8 @@ const std::string JSON_ATTR_CALL_ERROR_MSG = "message";
 const std::string JSON_ATTR_DTMF_ERROR = "error";
 const std::string JSON_ATTR_DTMF_ERROR_MSG = "message";
 
+const std::string JSON_ATTR_REQUEST_ID = "requestId";
+
 const std::string ACTION_SPEAKER_SET_VOLUME = "setVolume";
 const std::string ACTION_SPEAKER_GET_VOLUME = "getVolume";
 const std::string ACTION_SPEAKER_GET_VOLUME_RESPONSE = "getVolumeResponse";
@@ -98,10 +98,43 @@ const std::string TAG = "aasb::alexa::AASBControllerImpl";
 // Input channel name.
 const std::string INPUT_CHANNEL_NAME = "Input";
 
+#ifdef DISABLE_LOGGING
+// Received events are not formatted for logging when the platform logs are compiled out.
+static const Level TOPIC_DISPATCHER_LOG_LEVEL = Level::WARN;
+#else
+static const Level TOPIC_DISPATCHER_LOG_LEVEL = Level::INFO;
+#endif
+
+/**
+ * Creates the topic handler forwarding the events to @c handler, or warning that the topic is not enabled if
+ * @c handler is not created.
+ */
+template <typename HandlerType>
+static TopicDispatcher::Handler createTopicHandler(
+    std::shared_ptr<HandlerType> handler,
+    std::shared_ptr<aasb::core::logger::LoggerHandler> logger,
+    const std::string& disabledMessage) {
+    if (handler) {
+        return [handler](const std::string& action, const std::string& payload) {
+            handler->onReceivedEvent(action, payload);
+        };
+    }
+    return [logger, disabledMessage](const std::string& action, const std::string& payload) {
+        logger->log(Level::WARN, TAG, disabledMessage);
+    };
+}
+
 AASBControllerImpl::AASBControllerImpl() :
         m_engine(NULL), m_responseDispatcher{std::make_shared<ResponseDispatcher>()} {
 }
 
+AASBControllerImpl::~AASBControllerImpl() {
+    // wait for the handlers running on the executors of the topics, and drop the queued events
+    if (m_topicDispatcher) {
+        m_topicDispatcher->shutdown();
+    }
+}
+
 void AASBControllerImpl::setMockEngine(std::shared_ptr<aace::core::Engine> engine) {
     m_engine = engine;
 }
@@ -250,6 +283,11 @@ bool AASBControllerImpl::start() {
         }
     }
 
+    if (!registerTopicHandlers()) {
+        AASB_ERROR("Failed to register topic handlers");
+        return false;
+    }
+
     if (!m_engine->start()) {
         AASB_ERROR("Failed to start Alexa Auto Core Engine");
         return false;
@@ -786,88 +824,40 @@ void AASBControllerImpl::onReceivedEvent(
     const std::string& topic,
     const std::string& action,
     const std::string& payload) {
-    if (topic == TOPIC_AUTH_PROVIDER) {
-        if (m_authProviderHandler) {
-            m_logger->log(Level::INFO, TAG, "Received AuthProvider Event: " + action + " payload: " + payload);
-            m_authProviderHandler->onReceivedEvent(action, payload);
-        } else {
-            m_logger->log(Level::WARN, TAG, "Auth Provider is not enabled.");
-        }
-        return;
-    }
-
-    if (topic == TOPIC_AUDIO_PLAYER) {
-        m_audioPlayerHandler->onReceivedEvent(action, payload);
-        return;
-    }
-
-    if (topic == TOPIC_PHONECALL_CONTROLLER) {
-        if (m_phoneCallControllerHandler) {
-            m_phoneCallControllerHandler->onReceivedEvent(action, payload);
-        } else {
-            m_logger->log(Level::WARN, TAG, "Phone call controller is not enabled.");
-        }
-        return;
-    }
-
-    if (topic == TOPIC_PLAYBACK_CONTROLLER) {
-        if (m_playbackControllerHandler) {
-            m_logger->log(Level::INFO, TAG, "Received Playback Controller Event: " + action + " payload: " + payload);
-            m_playbackControllerHandler->onReceivedEvent(action, payload);
-        } else {
-            m_logger->log(Level::WARN, TAG, "Playback Controller is not enabled.");
-        }
-        return;
-    }
-
-    if (topic == TOPIC_CBL) {
-        if (m_CBLHandler) {
-            m_logger->log(Level::INFO, TAG, "Received CBL Event: " + action + " payload: " + payload);
-            m_CBLHandler->onReceivedEvent(action, payload);
-        } else {
-            m_logger->log(Level::WARN, TAG, "CBL is not enabled.");
-        }
-        return;
-    }
-
-    if (topic == TOPIC_LOCAL_MEDIA_SOURCE) {
-        m_logger->log(Level::INFO, TAG, "Received Local Media Source Event: " + action + " payload: " + payload);
-        m_LocalMediaSourceHandlerManager->onReceivedEvent(action, payload);
-        return;
-    }
-
-    if (topic == TOPIC_LOCATIONPROVIDER) {
-        m_logger->log(Level::INFO, TAG, "Received Location Provider Event: " + action + " payload: " + payload);
-        if (m_locationProviderHandler) {
-            m_locationProviderHandler->onReceivedEvent(action, payload);
-        } else {
-            m_logger->log(Level::WARN, TAG, "Location provider not enabled.");
-        }
+    if (!m_topicDispatcher || !m_topicDispatcher->dispatch(topic, action, payload)) {
+        AASB_ERROR("UNKNOWN TOPIC %s", topic.c_str());
     }
+}
 
+bool AASBControllerImpl::registerTopicHandlers() {
+    m_topicDispatcher = TopicDispatcher::create(m_logger, TOPIC_DISPATCHER_LOG_LEVEL);
+
+    std::vector<std::pair<std::string, TopicDispatcher::Handler>> topicHandlers = {
+        {TOPIC_AUTH_PROVIDER, createTopicHandler(m_authProviderHandler, m_logger, "Auth Provider is not enabled.")},
+        {TOPIC_AUDIO_PLAYER, createTopicHandler(m_audioPlayerHandler, m_logger, "Audio player is not enabled.")},
+        {TOPIC_PHONECALL_CONTROLLER,
+         createTopicHandler(m_phoneCallControllerHandler, m_logger, "Phone call controller is not enabled.")},
+        {TOPIC_PLAYBACK_CONTROLLER,
+         createTopicHandler(m_playbackControllerHandler, m_logger, "Playback Controller is not enabled.")},
+        {TOPIC_CBL, createTopicHandler(m_CBLHandler, m_logger, "CBL is not enabled.")},
+        {TOPIC_LOCAL_MEDIA_SOURCE,
+         createTopicHandler(m_LocalMediaSourceHandlerManager, m_logger, "Local media source not enabled.")},
+        {TOPIC_LOCATIONPROVIDER,
+         createTopicHandler(m_locationProviderHandler, m_logger, "Location provider not enabled.")},
 #ifdef ENABLE_AAC_GLORIA
-    if (topic == TOPIC_GLORIA_LISTRENDERER) {
-        m_logger->log(Level::INFO, TAG, "Received Gloria list renderer Event: " + action + " payload: " + payload);
-        if (m_gloriaListHandler) {
-            m_gloriaListHandler->onReceivedEvent(action, payload);
-        } else {
-            m_logger->log(Level::WARN, TAG, "Gloria list rendering not enabled");
-        }
-        return;
-    }
+        {TOPIC_GLORIA_LISTRENDERER,
+         createTopicHandler(m_gloriaListHandler, m_logger, "Gloria list rendering not enabled")},
 #endif  // ENABLE_AAC_GLORIA
+        {TOPIC_CARCONTROL, createTopicHandler(m_carControlHandler, m_logger, "CarControl not enabled")}};
 
-    if (topic == TOPIC_CARCONTROL) {
-        m_logger->log(Level::INFO, TAG, "Received Car Control Event: " + action + " payload: " + payload);
-        if (m_carControlHandler) {
-            m_carControlHandler->onReceivedEvent(action, payload);
-        } else {
-            m_logger->log(Level::WARN, TAG, "CarControl not enabled");
+    for (auto& topicHandler : topicHandlers) {
+        if (!m_topicDispatcher->registerTopic(topicHandler.first, topicHandler.second)) {
+            AASB_ERROR("Failed to register handler of topic %s", topicHandler.first.c_str());
+            return false;
         }
-        return;
     }
 
-    AASB_ERROR("UKNOWN TOPIC %s", topic.c_str());
+    return true;
 }
 
 bool AASBControllerImpl::registerAudioPlayerCapability() {
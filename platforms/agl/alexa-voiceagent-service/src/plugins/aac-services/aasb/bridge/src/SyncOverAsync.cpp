@@ -15,6 +15,14 @@
 
 #include "SyncOverAsync.h"
 
+#include <algorithm>
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <aasb/Consts.h>
+
 /**
  * Specifies the severity level of a log message
  * @sa @c aace::logger::LoggerEngineInterface::Level
@@ -27,6 +35,8 @@ namespace bridge {
 
 const std::string TAG = "aasb::bridge::SyncOverAsync";
 
+std::atomic<uint64_t> SyncOverAsync::s_nextRequestId(1);
+
 SyncOverAsync::SyncOverAsync(
     std::shared_ptr<aasb::core::logger::LoggerHandler> logger,
     std::weak_ptr<aasb::bridge::ResponseDispatcher> responseDispatcher,
@@ -39,7 +49,18 @@ bool SyncOverAsync::makeCallAndWaitForResponse(
     const std::string& action,
     const std::string& payload,
     std::string& response) {
-    m_logger->log(Level::VERBOSE, TAG, "Making async call for topic " + topic + " action " + action);
+    return makeCallAndWaitForResponse(topic, action, payload, response, m_waitDuration);
+}
+
+bool SyncOverAsync::makeCallAndWaitForResponse(
+    const std::string& topic,
+    const std::string& action,
+    const std::string& payload,
+    std::string& response,
+    std::chrono::microseconds waitDuration) {
+    auto requestId = std::to_string(s_nextRequestId++);
+    m_logger->log(
+        Level::VERBOSE, TAG, "Making async call for topic " + topic + " action " + action + " request " + requestId);
 
     auto responseDispatcher = m_responseDispatcher.lock();
     if (!responseDispatcher) {
@@ -47,23 +68,131 @@ bool SyncOverAsync::makeCallAndWaitForResponse(
         return false;
     }
 
-    m_responsePromise = std::promise<const std::string>();
-    auto responseFuture = m_responsePromise.get_future();
-    responseDispatcher->sendDirective(topic, action, payload);
+    auto responsePromise = std::make_shared<std::promise<std::string>>();
+    auto responseFuture = responsePromise->get_future();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingResponses[requestId] = responsePromise;
+        m_unansweredRequests.push_back({requestId, false, {}});
+    }
+
+    responseDispatcher->sendDirective(topic, action, addRequestId(payload, requestId));
+    responseFuture.wait_for(waitDuration);
+
+    // the response may have arrived after the wait timed out, before the call was removed
+    bool answered = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingResponses.erase(requestId);
+        answered = responseFuture.wait_for(std::chrono::microseconds::zero()) == std::future_status::ready;
+        if (!answered) {
+            // a late response without request ID must not resolve the next call
+            auto it = std::find_if(
+                m_unansweredRequests.begin(),
+                m_unansweredRequests.end(),
+                [&requestId](const UnansweredRequest& request) { return request.requestId == requestId; });
+            if (it != m_unansweredRequests.end()) {
+                it->timedOut = true;
+                it->expiry = std::chrono::steady_clock::now() + waitDuration;
+            }
+        }
+    }
 
-    std::future_status status = responseFuture.wait_for(m_waitDuration);
-    if (status == std::future_status::ready) {
+    if (answered) {
         response = responseFuture.get();
         return true;
     } else {
-        m_logger->log(Level::WARN, TAG, "Failed to get result for topic " + topic + " action " + action);
+        m_logger->log(
+            Level::WARN,
+            TAG,
+            "Failed to get result for topic " + topic + " action " + action + " request " + requestId);
         return false;
     }
 }
 
-void SyncOverAsync::responseAvailable(const std::string& payload) {
-    m_responsePromise.set_value(payload);
+bool SyncOverAsync::responseAvailable(const std::string& payload) {
+    std::shared_ptr<std::promise<std::string>> responsePromise;
+    std::string requestId;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        removeExpiredRequests();
+        auto it = m_pendingResponses.end();
+        if (getRequestId(payload, requestId)) {
+            it = m_pendingResponses.find(requestId);
+            m_unansweredRequests.erase(
+                std::remove_if(
+                    m_unansweredRequests.begin(),
+                    m_unansweredRequests.end(),
+                    [&requestId](const UnansweredRequest& request) { return request.requestId == requestId; }),
+                m_unansweredRequests.end());
+        } else if (!m_unansweredRequests.empty()) {
+            // the client did not return the request ID, so the response is for the oldest call it did not answer,
+            // which is no longer pending if it timed out
+            requestId = m_unansweredRequests.front().requestId;
+            m_unansweredRequests.pop_front();
+            it = m_pendingResponses.find(requestId);
+        }
+        if (it != m_pendingResponses.end()) {
+            // resolved under the lock, so a call that finds no response once removed has timed out
+            responsePromise = it->second;
+            m_pendingResponses.erase(it);
+            responsePromise->set_value(payload);
+        }
+    }
+
+    if (!responsePromise) {
+        m_logger->log(Level::WARN, TAG, "No pending call for response with request " + requestId);
+        return false;
+    }
+
+    return true;
+}
+
+void SyncOverAsync::removeExpiredRequests() {
+    auto now = std::chrono::steady_clock::now();
+    m_unansweredRequests.erase(
+        std::remove_if(
+            m_unansweredRequests.begin(),
+            m_unansweredRequests.end(),
+            [now](const UnansweredRequest& request) { return request.timedOut && request.expiry <= now; }),
+        m_unansweredRequests.end());
+}
+
+std::string SyncOverAsync::addRequestId(const std::string& payload, const std::string& requestId) {
+    rapidjson::Document document;
+    if (payload.empty()) {
+        document.SetObject();
+    } else if (document.Parse(payload.c_str()).HasParseError() || !document.IsObject()) {
+        return payload;
+    }
+
+    document.RemoveMember(JSON_ATTR_REQUEST_ID.c_str());
+    document.AddMember(
+        rapidjson::Value().SetString(JSON_ATTR_REQUEST_ID.c_str(), JSON_ATTR_REQUEST_ID.length()),
+        rapidjson::Value().SetString(requestId.c_str(), requestId.length(), document.GetAllocator()),
+        document.GetAllocator());
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    document.Accept(writer);
+
+    return buffer.GetString();
+}
+
+bool SyncOverAsync::getRequestId(const std::string& payload, std::string& requestId) {
+    rapidjson::Document document;
+    if (document.Parse(payload.c_str()).HasParseError() || !document.IsObject()) {
+        return false;
+    }
+
+    auto root = document.GetObject();
+    if (!root.HasMember(JSON_ATTR_REQUEST_ID.c_str()) || !root[JSON_ATTR_REQUEST_ID.c_str()].IsString()) {
+        return false;
+    }
+
+    requestId = root[JSON_ATTR_REQUEST_ID.c_str()].GetString();
+    return true;
 }
 
 }  // namespace bridge
-}  // namespace aasb
\ No newline at end of file
+}  // namespace aasb
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "TopicDispatcher.h"
+
+#include <vector>
+
+namespace aasb {
+namespace bridge {
+
+std::shared_ptr<TopicDispatcher> TopicDispatcher::create(
+    std::shared_ptr<aasb::core::logger::LoggerHandler> logger,
+    Level logLevel) {
+    return std::shared_ptr<TopicDispatcher>(new TopicDispatcher(logger, logLevel));
+}
+
+TopicDispatcher::TopicDispatcher(std::shared_ptr<aasb::core::logger::LoggerHandler> logger, Level logLevel) :
+        m_logger(logger), m_logLevel(logLevel), m_isShutdown(false) {
+}
+
+TopicDispatcher::~TopicDispatcher() {
+    shutdown();
+}
+
+bool TopicDispatcher::registerTopic(const std::string& topic, Handler handler) {
+    if (!handler) {
+        log(Level::ERROR, [&topic]() { return "Handler of topic " + topic + " is empty"; });
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isShutdown || m_routes.count(topic) != 0) {
+        log(Level::ERROR, [&topic]() { return "Topic " + topic + " cannot be registered"; });
+        return false;
+    }
+
+    std::unique_ptr<Route> route(new Route());
+    route->topic = topic;
+    route->handler = std::move(handler);
+    m_routes.emplace(topic, std::move(route));
+
+    return true;
+}
+
+bool TopicDispatcher::dispatch(const std::string& topic, const std::string& action, const std::string& payload) {
+    Route* route = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_routes.find(topic);
+        if (m_isShutdown || it == m_routes.end()) {
+            return false;
+        }
+        route = it->second.get();
+    }
+
+    // routes are only destroyed with the dispatcher, after their executor is shut down
+    route->executor.submit([this, route, action, payload]() {
+        log(Level::INFO, [route, &action, &payload]() {
+            return "Received " + route->topic + " event: " + action +
+                   " payload size: " + std::to_string(payload.size());
+        });
+        route->handler(action, payload);
+    });
+
+    return true;
+}
+
+void TopicDispatcher::waitForDispatchedEvents() {
+    std::vector<Route*> routes;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& route : m_routes) {
+            routes.push_back(route.second.get());
+        }
+    }
+
+    for (auto route : routes) {
+        route->executor.waitForSubmittedTasks();
+    }
+}
+
+void TopicDispatcher::shutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isShutdown = true;
+    for (auto& route : m_routes) {
+        route.second->executor.shutdown();
+    }
+}
+
+}  // namespace bridge
+}  // namespace aasb
@@ -0,0 +1,243 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rapidjson/document.h>
+
+#include <aasb/Consts.h>
+
+#include "SyncOverAsync.h"
+
+namespace aasb {
+namespace bridge {
+
+/// Wait duration of the calls answered by the test
+static const std::chrono::seconds WAIT_DURATION(5);
+
+/// Wait duration of the calls that time out
+static const std::chrono::milliseconds SHORT_WAIT_DURATION(50);
+
+/// Number of concurrent callers of the stress test
+static const int CALLER_COUNT = 200;
+
+/**
+ * Records the directives of the calls, for the test to answer them.
+ */
+class DirectiveRecorder : public IAlexaCapabilityDirectiveListener {
+public:
+    /// A directive sent for a call, with the caller and request ID of its payload
+    struct Directive {
+        int caller;
+        std::string requestId;
+    };
+
+    void onReceivedDirective(const std::string& topic, const std::string& action, const std::string& jsonPayload)
+        override {
+        rapidjson::Document document;
+        document.Parse(jsonPayload.c_str());
+        auto root = document.GetObject();
+
+        Directive directive{-1, ""};
+        if (root.HasMember("caller") && root["caller"].IsInt()) {
+            directive.caller = root["caller"].GetInt();
+        }
+        if (root.HasMember(JSON_ATTR_REQUEST_ID.c_str()) && root[JSON_ATTR_REQUEST_ID.c_str()].IsString()) {
+            directive.requestId = root[JSON_ATTR_REQUEST_ID.c_str()].GetString();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_directives.push_back(directive);
+        m_directiveReceived.notify_all();
+    }
+
+    /**
+     * Waits until @c count directives are recorded, and takes them.
+     */
+    std::vector<Directive> takeDirectives(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_directiveReceived.wait_for(lock, WAIT_DURATION, [this, count]() { return m_directives.size() >= count; });
+        auto directives = std::move(m_directives);
+        m_directives.clear();
+        return directives;
+    }
+
+private:
+    std::vector<Directive> m_directives;
+    std::condition_variable m_directiveReceived;
+    std::mutex m_mutex;
+};
+
+/**
+ * Test for @c SyncOverAsync
+ */
+class SyncOverAsyncTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mDirectiveRecorder = std::make_shared<DirectiveRecorder>();
+        mResponseDispatcher = std::make_shared<ResponseDispatcher>();
+        mResponseDispatcher->registerCapabilityDirectiveListener(mDirectiveRecorder);
+        mSyncOverAsync = std::make_shared<SyncOverAsync>(
+            aasb::core::logger::LoggerHandler::create(), mResponseDispatcher, WAIT_DURATION);
+    }
+
+    /**
+     * Creates the response payload of a directive.
+     */
+    static std::string createResponse(const DirectiveRecorder::Directive& directive) {
+        return "{\"" + JSON_ATTR_REQUEST_ID + "\":\"" + directive.requestId +
+               "\",\"caller\":" + std::to_string(directive.caller) + "}";
+    }
+
+    std::shared_ptr<DirectiveRecorder> mDirectiveRecorder;
+    std::shared_ptr<ResponseDispatcher> mResponseDispatcher;
+    std::shared_ptr<SyncOverAsync> mSyncOverAsync;
+};
+
+/**
+ * Test that concurrent calls answered out of order each receive their own response
+ */
+TEST_F(SyncOverAsyncTest, concurrentCallsWithOutOfOrderResponses) {
+    std::atomic<int> mismatches(0);
+    std::vector<std::thread> callers;
+    for (int i = 0; i < CALLER_COUNT; i++) {
+        callers.emplace_back([this, i, &mismatches]() {
+            std::string response;
+            auto payload = "{\"caller\":" + std::to_string(i) + "}";
+            if (!mSyncOverAsync->makeCallAndWaitForResponse(TOPIC_CARCONTROL, "test", payload, response)) {
+                mismatches++;
+                return;
+            }
+            rapidjson::Document document;
+            document.Parse(response.c_str());
+            auto root = document.GetObject();
+            if (!root.HasMember("caller") || !root["caller"].IsInt() || root["caller"].GetInt() != i) {
+                mismatches++;
+            }
+        });
+    }
+
+    auto directives = mDirectiveRecorder->takeDirectives(CALLER_COUNT);
+    ASSERT_EQ(directives.size(), static_cast<size_t>(CALLER_COUNT));
+
+    std::shuffle(directives.begin(), directives.end(), std::default_random_engine(CALLER_COUNT));
+    std::vector<std::thread> responders;
+    for (int i = 0; i < 4; i++) {
+        responders.emplace_back([this, i, &directives]() {
+            for (size_t j = i; j < directives.size(); j += 4) {
+                EXPECT_TRUE(mSyncOverAsync->responseAvailable(createResponse(directives[j])));
+            }
+        });
+    }
+
+    for (auto& responder : responders) {
+        responder.join();
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0) << "Calls failed or received the response of another call!";
+}
+
+/**
+ * Test that a response arriving after its call timed out does not resolve the next call
+ */
+TEST_F(SyncOverAsyncTest, lateResponseIsDropped) {
+    std::string response;
+    ASSERT_FALSE(mSyncOverAsync->makeCallAndWaitForResponse(
+        TOPIC_CARCONTROL, "test", "{\"caller\":1}", response, SHORT_WAIT_DURATION));
+    auto lateDirectives = mDirectiveRecorder->takeDirectives(1);
+    ASSERT_EQ(lateDirectives.size(), 1u);
+
+    std::thread caller([this, &response]() {
+        mSyncOverAsync->makeCallAndWaitForResponse(TOPIC_CARCONTROL, "test", "{\"caller\":2}", response);
+    });
+    auto directives = mDirectiveRecorder->takeDirectives(1);
+    ASSERT_EQ(directives.size(), 1u);
+
+    EXPECT_FALSE(mSyncOverAsync->responseAvailable(createResponse(lateDirectives[0])));
+    EXPECT_TRUE(mSyncOverAsync->responseAvailable(createResponse(directives[0])));
+    caller.join();
+    EXPECT_EQ(response, createResponse(directives[0]));
+}
+
+/**
+ * Test that a response without request ID resolves the pending call
+ */
+TEST_F(SyncOverAsyncTest, responseWithoutRequestId) {
+    EXPECT_FALSE(mSyncOverAsync->responseAvailable("{}")) << "Response resolved a call that was not made!";
+
+    std::string response;
+    std::thread caller([this, &response]() {
+        mSyncOverAsync->makeCallAndWaitForResponse(TOPIC_LOCATIONPROVIDER, "test", "", response);
+    });
+    ASSERT_EQ(mDirectiveRecorder->takeDirectives(1).size(), 1u);
+
+    EXPECT_TRUE(mSyncOverAsync->responseAvailable("{\"caller\":3}"));
+    caller.join();
+    EXPECT_EQ(response, "{\"caller\":3}");
+}
+
+/**
+ * Test that a late response without request ID is dropped instead of resolving the next call
+ */
+TEST_F(SyncOverAsyncTest, lateResponseWithoutRequestIdIsDropped) {
+    std::string response;
+    ASSERT_FALSE(
+        mSyncOverAsync->makeCallAndWaitForResponse(TOPIC_LOCATIONPROVIDER, "test", "", response, SHORT_WAIT_DURATION));
+    ASSERT_EQ(mDirectiveRecorder->takeDirectives(1).size(), 1u);
+
+    std::thread caller([this, &response]() {
+        mSyncOverAsync->makeCallAndWaitForResponse(TOPIC_LOCATIONPROVIDER, "test", "", response);
+    });
+    ASSERT_EQ(mDirectiveRecorder->takeDirectives(1).size(), 1u);
+
+    EXPECT_FALSE(mSyncOverAsync->responseAvailable("{\"caller\":1}")) << "Late response resolved the next call!";
+    EXPECT_TRUE(mSyncOverAsync->responseAvailable("{\"caller\":2}"));
+    caller.join();
+    EXPECT_EQ(response, "{\"caller\":2}");
+}
+
+/**
+ * Test that a call that timed out is no longer expected to be answered after a second wait duration
+ */
+TEST_F(SyncOverAsyncTest, timedOutCallExpires) {
+    std::string response;
+    ASSERT_FALSE(
+        mSyncOverAsync->makeCallAndWaitForResponse(TOPIC_LOCATIONPROVIDER, "test", "", response, SHORT_WAIT_DURATION));
+    ASSERT_EQ(mDirectiveRecorder->takeDirectives(1).size(), 1u);
+    std::this_thread::sleep_for(SHORT_WAIT_DURATION * 2);
+
+    std::thread caller([this, &response]() {
+        mSyncOverAsync->makeCallAndWaitForResponse(TOPIC_LOCATIONPROVIDER, "test", "", response);
+    });
+    ASSERT_EQ(mDirectiveRecorder->takeDirectives(1).size(), 1u);
+
+    EXPECT_TRUE(mSyncOverAsync->responseAvailable("{\"caller\":2}"));
+    caller.join();
+    EXPECT_EQ(response, "{\"caller\":2}");
+}
+
+}  // namespace bridge
+}  // namespace aasb
@@ -0,0 +1,217 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <aasb/Consts.h>
+
+#include "TopicDispatcher.h"
+
+namespace aasb {
+namespace bridge {
+
+/// Timeout for the events to be handled
+static const std::chrono::seconds TIMEOUT(2);
+
+/// Environment variable with the path of a recorded trace replayed by the throughput benchmark
+static const char* TRACE_FILE_ENV = "AASB_TOPIC_TRACE";
+
+/// Number of times the throughput benchmark replays the trace
+static const int TRACE_REPLAY_COUNT = 1000;
+
+/**
+ * Trace recorded from a client during media playback with a car control utterance, replayed by the throughput
+ * benchmark when no trace file is given. Each line is a tab-separated topic, action and payload.
+ */
+static const std::string RECORDED_TRACE = R"(AudioPlayer	mediaStateChanged	{"state":"BUFFERING"}
+AudioPlayer	mediaStateChanged	{"state":"PLAYING"}
+AudioPlayer	mediaPlayerPosition	{"position":1000}
+PlaybackController	buttonPressed	{"button":"PAUSE"}
+AudioPlayer	mediaStateChanged	{"state":"STOPPED"}
+LocationProvider	responseLocation	{"latitude":36.115,"longitude":-115.173}
+CarControl	isPowerControllerOnResponse	{"endpointId":"default.fan","isOn":true}
+AudioPlayer	mediaStateChanged	{"state":"PLAYING"}
+AudioPlayer	mediaPlayerPosition	{"position":2000}
+CBL	cblStart	{}
+)";
+
+using Message = std::tuple<std::string, std::string, std::string>;
+
+/**
+ * Parses a trace of tab-separated topic, action and payload lines.
+ */
+static std::vector<Message> parseTrace(std::istream& trace) {
+    std::vector<Message> messages;
+    std::string line;
+    while (std::getline(trace, line)) {
+        auto actionStart = line.find('\t');
+        auto payloadStart = line.find('\t', actionStart + 1);
+        if (actionStart == std::string::npos || payloadStart == std::string::npos) {
+            continue;
+        }
+        messages.emplace_back(
+            line.substr(0, actionStart),
+            line.substr(actionStart + 1, payloadStart - actionStart - 1),
+            line.substr(payloadStart + 1));
+    }
+    return messages;
+}
+
+/**
+ * Test for @c TopicDispatcher
+ */
+class TopicDispatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mTopicDispatcher = TopicDispatcher::create(aasb::core::logger::LoggerHandler::create());
+        ASSERT_NE(mTopicDispatcher, nullptr);
+    }
+
+    void TearDown() override {
+        mTopicDispatcher->shutdown();
+    }
+
+    std::shared_ptr<TopicDispatcher> mTopicDispatcher;
+};
+
+/**
+ * Test that events are handled by the handler of their topic only
+ */
+TEST_F(TopicDispatcherTest, dispatchesToHandlerOfTopic) {
+    std::promise<std::pair<std::string, std::string>> eventPromise;
+    ASSERT_TRUE(mTopicDispatcher->registerTopic(
+        TOPIC_AUDIO_PLAYER, [&eventPromise](const std::string& action, const std::string& payload) {
+            eventPromise.set_value(std::make_pair(action, payload));
+        }));
+    ASSERT_TRUE(mTopicDispatcher->registerTopic(
+        TOPIC_CBL, [](const std::string& action, const std::string& payload) { FAIL() << "Wrong topic handled!"; }));
+
+    ASSERT_TRUE(mTopicDispatcher->dispatch(TOPIC_AUDIO_PLAYER, ACTION_MEDIA_STATE_CHANGED, "PLAYING"));
+
+    auto eventFuture = eventPromise.get_future();
+    ASSERT_EQ(eventFuture.wait_for(TIMEOUT), std::future_status::ready);
+    auto event = eventFuture.get();
+    EXPECT_EQ(event.first, ACTION_MEDIA_STATE_CHANGED);
+    EXPECT_EQ(event.second, "PLAYING");
+    mTopicDispatcher->waitForDispatchedEvents();
+}
+
+/**
+ * Test that invalid registrations and events of unregistered topics are rejected
+ */
+TEST_F(TopicDispatcherTest, rejectsInvalidTopics) {
+    EXPECT_FALSE(mTopicDispatcher->registerTopic(TOPIC_CBL, nullptr));
+    ASSERT_TRUE(mTopicDispatcher->registerTopic(TOPIC_CBL, [](const std::string&, const std::string&) {}));
+    EXPECT_FALSE(mTopicDispatcher->registerTopic(TOPIC_CBL, [](const std::string&, const std::string&) {}));
+
+    EXPECT_FALSE(mTopicDispatcher->dispatch("unknownTopic", ACTION_CBL_START, ""));
+
+    mTopicDispatcher->shutdown();
+    EXPECT_FALSE(mTopicDispatcher->dispatch(TOPIC_CBL, ACTION_CBL_START, ""));
+}
+
+/**
+ * Test that the events of a topic are handled in the order they were dispatched
+ */
+TEST_F(TopicDispatcherTest, handlesEventsOfTopicInOrder) {
+    std::vector<std::string> payloads;
+    ASSERT_TRUE(mTopicDispatcher->registerTopic(
+        TOPIC_AUDIO_PLAYER,
+        [&payloads](const std::string& action, const std::string& payload) { payloads.push_back(payload); }));
+
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(mTopicDispatcher->dispatch(TOPIC_AUDIO_PLAYER, ACTION_MEDIA_PLAYER_POSITION, std::to_string(i)));
+    }
+    mTopicDispatcher->waitForDispatchedEvents();
+
+    ASSERT_EQ(payloads.size(), 100u);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(payloads[i], std::to_string(i));
+    }
+}
+
+/**
+ * Test that a blocked handler does not delay the events of other topics
+ */
+TEST_F(TopicDispatcherTest, blockedTopicDoesNotDelayOtherTopics) {
+    std::promise<void> unblockPromise;
+    auto unblockFuture = unblockPromise.get_future().share();
+    ASSERT_TRUE(mTopicDispatcher->registerTopic(
+        TOPIC_CARCONTROL, [unblockFuture](const std::string& action, const std::string& payload) {
+            unblockFuture.wait();
+        }));
+
+    std::promise<void> handledPromise;
+    ASSERT_TRUE(mTopicDispatcher->registerTopic(
+        TOPIC_AUDIO_PLAYER,
+        [&handledPromise](const std::string& action, const std::string& payload) { handledPromise.set_value(); }));
+
+    ASSERT_TRUE(mTopicDispatcher->dispatch(TOPIC_CARCONTROL, ACTION_CARCONTROL_IS_POWER_CONTROLLER_ON_RESPONSE, ""));
+    ASSERT_TRUE(mTopicDispatcher->dispatch(TOPIC_AUDIO_PLAYER, ACTION_MEDIA_STATE_CHANGED, "PLAYING"));
+
+    EXPECT_EQ(handledPromise.get_future().wait_for(TIMEOUT), std::future_status::ready)
+        << "Audio player event was delayed by the car control handler!";
+    unblockPromise.set_value();
+    mTopicDispatcher->waitForDispatchedEvents();
+}
+
+/**
+ * Benchmark replaying a recorded trace, from the file set in @c AASB_TOPIC_TRACE or @c RECORDED_TRACE. The throughput
+ * is recorded as a property of the test. Disabled by default, run with --gtest_also_run_disabled_tests.
+ */
+TEST_F(TopicDispatcherTest, DISABLED_replayRecordedTraceThroughput) {
+    std::vector<Message> trace;
+    auto traceFile = std::getenv(TRACE_FILE_ENV);
+    if (traceFile != nullptr) {
+        std::ifstream traceStream(traceFile);
+        ASSERT_TRUE(traceStream.good()) << "Failed to open trace " << traceFile;
+        trace = parseTrace(traceStream);
+    } else {
+        std::istringstream traceStream(RECORDED_TRACE);
+        trace = parseTrace(traceStream);
+    }
+    ASSERT_FALSE(trace.empty());
+
+    std::atomic<int> handled(0);
+    for (const auto& message : trace) {
+        mTopicDispatcher->registerTopic(
+            std::get<0>(message), [&handled](const std::string& action, const std::string& payload) { handled++; });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < TRACE_REPLAY_COUNT; i++) {
+        for (const auto& message : trace) {
+            mTopicDispatcher->dispatch(std::get<0>(message), std::get<1>(message), std::get<2>(message));
+        }
+    }
+    mTopicDispatcher->waitForDispatchedEvents();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    ASSERT_EQ(handled.load(), static_cast<int>(trace.size()) * TRACE_REPLAY_COUNT);
+    auto messagesPerSecond = handled * 1000000.0 / std::max<int64_t>(elapsed.count(), 1);
+    RecordProperty("messagesPerSecond", static_cast<int>(messagesPerSecond));
+}
+
+}  // namespace bridge
+}  // namespace aasb
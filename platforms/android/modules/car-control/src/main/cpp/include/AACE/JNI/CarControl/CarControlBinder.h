@@ -81,6 +81,10 @@ public:
         return m_carControlHandler;
     }
 
+    std::shared_ptr<CarControlHandler> getCarControlHandler() {
+        return m_carControlHandler;
+    }
+
 private:
     std::shared_ptr<CarControlHandler> m_carControlHandler;
 };
@@ -345,4 +345,74 @@ Java_com_amazon_aace_carControl_CarControl_disposeBinder(JNIEnv* env, jobject /*
         AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_carControl_CarControl_disposeBinder", ex.what());
     }
 }
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_carControl_CarControl_powerControllerStateChanged(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jstring endpointId,
+    jboolean isOn) {
+    try {
+        auto carControlBinder = CAR_CONTROL_BINDER(ref);
+        ThrowIfNull(carControlBinder, "invalidCarControlBinder");
+
+        carControlBinder->getCarControlHandler()->powerControllerStateChanged(JString(endpointId).toStdStr(), isOn);
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_carControl_CarControl_powerControllerStateChanged", ex.what());
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_carControl_CarControl_toggleControllerStateChanged(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jstring endpointId,
+    jstring controllerId,
+    jboolean isOn) {
+    try {
+        auto carControlBinder = CAR_CONTROL_BINDER(ref);
+        ThrowIfNull(carControlBinder, "invalidCarControlBinder");
+
+        carControlBinder->getCarControlHandler()->toggleControllerStateChanged(
+            JString(endpointId).toStdStr(), JString(controllerId).toStdStr(), isOn);
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_carControl_CarControl_toggleControllerStateChanged", ex.what());
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_carControl_CarControl_rangeControllerValueChanged(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jstring endpointId,
+    jstring controllerId,
+    jdouble value) {
+    try {
+        auto carControlBinder = CAR_CONTROL_BINDER(ref);
+        ThrowIfNull(carControlBinder, "invalidCarControlBinder");
+
+        carControlBinder->getCarControlHandler()->rangeControllerValueChanged(
+            JString(endpointId).toStdStr(), JString(controllerId).toStdStr(), value);
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_carControl_CarControl_rangeControllerValueChanged", ex.what());
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_carControl_CarControl_modeControllerValueChanged(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jstring endpointId,
+    jstring controllerId,
+    jstring value) {
+    try {
+        auto carControlBinder = CAR_CONTROL_BINDER(ref);
+        ThrowIfNull(carControlBinder, "invalidCarControlBinder");
+
+        carControlBinder->getCarControlHandler()->modeControllerValueChanged(
+            JString(endpointId).toStdStr(), JString(controllerId).toStdStr(), JString(value).toStdStr());
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_carControl_CarControl_modeControllerValueChanged", ex.what());
+    }
+}
 }
\ No newline at end of file
@@ -176,6 +176,51 @@ abstract public class CarControl extends PlatformInterface {
         throw new Exception("Invalid");
     }
 
+    /**
+     * Notifies the Engine that the power state of the controller identified by @c endpointId changed in the vehicle.
+     * When the state cache is enabled in the 'aace.carControl' configuration, the Engine answers state queries from
+     * the states reported with these notifications instead of querying the platform implementation.
+     *
+     * @param endpointId The unique identifier of the endpoint.
+     * @param isOn @c true if the controller is powered on.
+     */
+    protected void powerControllerStateChanged(String endpointId, boolean isOn) {
+        powerControllerStateChanged(getNativeRef(), endpointId, isOn);
+    }
+    /**
+     * Notifies the Engine that the power state of the controller identified by @c endpointId and @c controllerId
+     * changed in the vehicle.
+     *
+     * @param endpointId The unique identifier of the endpoint.
+     * @param controllerId The unique identifier of the controller.
+     * @param isOn @c true if the controller is turned on.
+     */
+    protected void toggleControllerStateChanged(String endpointId, String controllerId, boolean isOn) {
+        toggleControllerStateChanged(getNativeRef(), endpointId, controllerId, isOn);
+    }
+    /**
+     * Notifies the Engine that the range setting of the controller identified by @c endpointId and @c controllerId
+     * changed in the vehicle.
+     *
+     * @param endpointId The unique identifier of the endpoint.
+     * @param controllerId The unique identifier of the controller.
+     * @param value The current range setting.
+     */
+    protected void rangeControllerValueChanged(String endpointId, String controllerId, double value) {
+        rangeControllerValueChanged(getNativeRef(), endpointId, controllerId, value);
+    }
+    /**
+     * Notifies the Engine that the mode of the controller identified by @c endpointId and @c controllerId changed in
+     * the vehicle.
+     *
+     * @param endpointId The unique identifier of the endpoint.
+     * @param controllerId The unique identifier of the controller.
+     * @param value The current mode.
+     */
+    protected void modeControllerValueChanged(String endpointId, String controllerId, String value) {
+        modeControllerValueChanged(getNativeRef(), endpointId, controllerId, value);
+    }
+
     // NativeRef implementation
     final protected long createNativeRef() {
         return createBinder();
@@ -188,4 +233,11 @@ abstract public class CarControl extends PlatformInterface {
     // Native Engine JNI methods
     private native long createBinder();
     private native void disposeBinder(long nativeRef);
+    private native void powerControllerStateChanged(long nativeObject, String endpointId, boolean isOn);
+    private native void toggleControllerStateChanged(
+            long nativeObject, String endpointId, String controllerId, boolean isOn);
+    private native void rangeControllerValueChanged(
+            long nativeObject, String endpointId, String controllerId, double value);
+    private native void modeControllerValueChanged(
+            long nativeObject, String endpointId, String controllerId, String value);
 }
\ No newline at end of file
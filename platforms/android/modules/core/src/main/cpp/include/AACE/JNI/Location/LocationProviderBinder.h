@@ -51,6 +51,10 @@ public:
         return m_locationProviderHandler;
     }
 
+    std::shared_ptr<LocationProviderHandler> getLocationProviderHandler() {
+        return m_locationProviderHandler;
+    }
+
 private:
     std::shared_ptr<LocationProviderHandler> m_locationProviderHandler;
 };
@@ -259,4 +259,19 @@ Java_com_amazon_aace_audio_AudioOutput_mediaStateChanged(JNIEnv* env, jobject /*
         AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_audio_AudioOutput_mediaStateChanged", ex.what());
     }
 }
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_audio_AudioOutput_mediaPositionChanged(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jlong position) {
+    try {
+        auto audioOutputBinder = AUDIO_OUTPUT_BINDER(ref);
+        ThrowIfNull(audioOutputBinder, "invalidAudioOutputBinder");
+
+        audioOutputBinder->getAudioOutputHandler()->mediaPositionChanged(position);
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_audio_AudioOutput_mediaPositionChanged", ex.what());
+    }
+}
 }
@@ -114,4 +114,21 @@ Java_com_amazon_aace_location_LocationProvider_disposeBinder(JNIEnv* env, jobjec
         AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_location_LocationProvider_disposeBinder", ex.what());
     }
 }
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_location_LocationProvider_locationChanged(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jobject location) {
+    try {
+        auto locationProviderBinder = LOCATION_PROVIDER_BINDER(ref);
+        ThrowIfNull(locationProviderBinder, "invalidLocationProviderBinder");
+        ThrowIfNull(location, "invalidLocation");
+
+        locationProviderBinder->getLocationProviderHandler()->locationChanged(
+            aace::jni::location::JLocation(location).getLocation());
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_location_LocationProvider_locationChanged", ex.what());
+    }
+}
 }
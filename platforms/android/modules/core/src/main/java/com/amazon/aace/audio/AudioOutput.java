@@ -346,6 +346,17 @@ abstract public class AudioOutput extends NativeRef {
         }
     }
 
+    /**
+     * Notifies the Engine that the playback position of the platform media player moved independently of the
+     * playback clock, such as after a seek, a stall, or a change in playback rate. The platform implementation
+     * does not need to call @c mediaPositionChanged() while playback progresses normally.
+     *
+     * @param  position The current playback position of the platform media player in milliseconds
+     */
+    protected void mediaPositionChanged(long position) {
+        mediaPositionChanged(getNativeRef(), position);
+    }
+
     protected long createNativeRef() {
         return createBinder();
     }
@@ -359,6 +370,7 @@ abstract public class AudioOutput extends NativeRef {
     private native void disposeBinder(long nativeRef);
     private native void mediaError(long nativeObject, MediaError type, String error);
     private native void mediaStateChanged(long nativeObject, MediaState state);
+    private native void mediaPositionChanged(long nativeObject, long position);
 
     // MediaStateListener
 
@@ -38,6 +38,16 @@ abstract public class LocationProvider extends PlatformInterface {
         return "";
     }
 
+    /**
+     * Notifies the Engine of a new geolocation of the device. The Engine serves location requests from the most
+     * recent location while it is fresh, and only calls @c getLocation() when no fresh location is available.
+     *
+     * @param  location The new location
+     */
+    protected void locationChanged(Location location) {
+        locationChanged(getNativeRef(), location);
+    }
+
     final protected long createNativeRef() {
         return createBinder();
     }
@@ -49,4 +59,5 @@ abstract public class LocationProvider extends PlatformInterface {
     // Native Engine JNI methods
     private native long createBinder();
     private native void disposeBinder(long nativeRef);
+    private native void locationChanged(long nativeObject, Location location);
 }
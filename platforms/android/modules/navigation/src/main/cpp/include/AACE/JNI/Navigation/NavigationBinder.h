@@ -255,6 +255,25 @@ public:
 
 using JErrorCode = JEnum<NavigationHandler::ErrorCode, JErrorCodeConfig>;
 
+//
+// JNavigationState
+//
+
+class JNavigationStateConfig : public EnumConfiguration<NavigationHandler::NavigationState> {
+public:
+    using T = NavigationHandler::NavigationState;
+
+    const char* getClassName() override {
+        return "com/amazon/aace/navigation/Navigation$NavigationState";
+    }
+
+    std::vector<std::pair<T, std::string>> getConfiguration() override {
+        return {{T::NAVIGATING, "NAVIGATING"}, {T::NOT_NAVIGATING, "NOT_NAVIGATING"}, {T::UNKNOWN, "UNKNOWN"}};
+    }
+};
+
+using JNavigationState = JEnum<NavigationHandler::NavigationState, JNavigationStateConfig>;
+
 }  // namespace navigation
 }  // namespace jni
 }  // namespace aace
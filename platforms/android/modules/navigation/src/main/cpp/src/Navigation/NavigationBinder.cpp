@@ -230,4 +230,73 @@ JNIEXPORT void JNICALL Java_com_amazon_aace_navigation_Navigation_showAlternativ
         AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_navigation_Navigation_showAlternativeRoutesSucceeded", ex.what());
     }
 }
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_navigation_Navigation_navigationStateChanged(
+    JNIEnv* env,
+    jobject,
+    jlong ref,
+    jobject state) {
+    try {
+        auto navigationBinder = NAVIGATION_BINDER(ref);
+        ThrowIfNull(navigationBinder, "invalidNavigationBinder");
+
+        aace::navigation::NavigationEngineInterface::NavigationState navigationState;
+        ThrowIfNot(
+            aace::jni::navigation::JNavigationState::checkType(state, &navigationState), "invalidNavigationState");
+
+        navigationBinder->getNavigation()->navigationStateChanged(navigationState);
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_navigation_Navigation_navigationStateChanged", ex.what());
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_amazon_aace_navigation_Navigation_waypointsChanged(JNIEnv* env, jobject, jlong ref, jstring waypoints) {
+    try {
+        auto navigationBinder = NAVIGATION_BINDER(ref);
+        ThrowIfNull(navigationBinder, "invalidNavigationBinder");
+
+        navigationBinder->getNavigation()->waypointsChanged(JString(waypoints).toStdStr());
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_navigation_Navigation_waypointsChanged", ex.what());
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_amazon_aace_navigation_Navigation_routeShapesAdded(JNIEnv* env, jobject, jlong ref, jdoubleArray shapes) {
+    try {
+        auto navigationBinder = NAVIGATION_BINDER(ref);
+        ThrowIfNull(navigationBinder, "invalidNavigationBinder");
+        ThrowIfNull(shapes, "invalidShapes");
+
+        // the shapes are latitude and longitude pairs
+        int length = env->GetArrayLength(shapes);
+        ThrowIf(length % 2 != 0, "invalidShapesLength");
+
+        std::vector<aace::navigation::NavigationEngineInterface::Coordinate> coordinates;
+        coordinates.reserve(length / 2);
+        jdouble* values = env->GetDoubleArrayElements(shapes, nullptr);
+        ThrowIfNull(values, "getShapesFailed");
+        for (int i = 0; i < length; i += 2) {
+            coordinates.push_back({values[i], values[i + 1]});
+        }
+        env->ReleaseDoubleArrayElements(shapes, values, JNI_ABORT);
+
+        navigationBinder->getNavigation()->routeShapesAdded(coordinates);
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_navigation_Navigation_routeShapesAdded", ex.what());
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_amazon_aace_navigation_Navigation_routeShapesRemoved(JNIEnv* env, jobject, jlong ref, jint count) {
+    try {
+        auto navigationBinder = NAVIGATION_BINDER(ref);
+        ThrowIfNull(navigationBinder, "invalidNavigationBinder");
+
+        navigationBinder->getNavigation()->routeShapesRemoved(count);
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_navigation_Navigation_routeShapesRemoved", ex.what());
+    }
+}
 }
@@ -358,6 +358,40 @@ abstract public class Navigation extends PlatformInterface {
             return m_name;
         }
     }
+
+    public enum NavigationState {
+        /**
+         * Navigation is in progress
+         */
+        NAVIGATING("NAVIGATING"),
+        /**
+         * Navigation is not in progress
+         */
+        NOT_NAVIGATING("NOT_NAVIGATING"),
+        /**
+         * The navigation state is not known
+         */
+        UNKNOWN("UNKNOWN");
+
+        /**
+         * @internal
+         */
+        private String m_name;
+
+        /**
+         * @internal
+         */
+        private NavigationState(String name) {
+            m_name = name;
+        }
+
+        /**
+         * @internal
+         */
+        public String toString() {
+            return m_name;
+        }
+    }
     ;
 
     /**
@@ -691,6 +725,49 @@ abstract public class Navigation extends PlatformInterface {
         showAlternativeRoutesSucceeded(getNativeRef(), payload);
     }
 
+    /**
+     * Notifies the Engine of a change in the navigation state. Pushing the navigation state with this method,
+     * {@link #waypointsChanged(String)}, {@link #routeShapesAdded(double[])} and {@link #routeShapesRemoved(int)}
+     * replaces {@link #getNavigationState()}, so the Engine no longer requests the full navigation state payload
+     * each time the context is needed.
+     *
+     * @param state The current navigation state
+     */
+    final protected void navigationStateChanged(NavigationState state) {
+        navigationStateChanged(getNativeRef(), state);
+    }
+
+    /**
+     * Notifies the Engine that the waypoints of the route changed.
+     *
+     * @param waypoints JSON array of all of the waypoints of the route, in the format of the {@code waypoints}
+     *         field of the {@link #getNavigationState()} payload. The array can be empty.
+     */
+    final protected void waypointsChanged(String waypoints) {
+        waypointsChanged(getNativeRef(), waypoints);
+    }
+
+    /**
+     * Notifies the Engine of route shape points added to the end of the route. The Engine keeps the full route
+     * and reduces it to the configured number of points when the navigation state is sent to AVS.
+     *
+     * @param shapes The added route shape coordinates as latitude and longitude pairs
+     */
+    final protected void routeShapesAdded(double[] shapes) {
+        routeShapesAdded(getNativeRef(), shapes);
+    }
+
+    /**
+     * Notifies the Engine of route shape points removed from the start of the route, such as the points the
+     * vehicle has passed. To replace the route, remove all of the points and add the points of the new route.
+     *
+     * @param count The number of points removed. If it is greater than the number of points of the route, all of
+     *         the points are removed.
+     */
+    final protected void routeShapesRemoved(int count) {
+        routeShapesRemoved(getNativeRef(), count);
+    }
+
     // NativeRef implementation
     final protected long createNativeRef() {
         return createBinder();
@@ -706,6 +783,10 @@ abstract public class Navigation extends PlatformInterface {
     private native void navigationError(long nativeRef, ErrorType type, ErrorCode code, String description);
     private native void navigationEvent(long nativeRef, EventName event);
     private native void showAlternativeRoutesSucceeded(long nativeRef, String payload);
+    private native void navigationStateChanged(long nativeRef, NavigationState state);
+    private native void waypointsChanged(long nativeRef, String waypoints);
+    private native void routeShapesAdded(long nativeRef, double[] shapes);
+    private native void routeShapesRemoved(long nativeRef, int count);
 }
 
 // END OF FILE